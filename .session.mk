@@ -0,0 +1 @@
+ARCH=arm
\ No newline at end of file
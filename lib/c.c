@@ -25,6 +25,7 @@
 #define __syscall_open 5
 #define __syscall_mmap2 192
 #define __syscall_munmap 91
+#define __syscall_clock_gettime 263
 
 #elif defined(__riscv)
 #define __SIZEOF_POINTER__ 4
@@ -36,6 +37,7 @@
 #define __syscall_openat 56
 #define __syscall_mmap2 222
 #define __syscall_munmap 215
+#define __syscall_clock_gettime64 403
 
 #else /* Only Arm32 and RV32 are supported */
 #error "Unsupported architecture"
@@ -43,7 +45,29 @@
 
 #define INT_BUF_LEN 16
 
-typedef int FILE;
+#define BUFSIZ 4096
+
+/* Streams opened by fopen() are buffered. Any other FILE pointer is taken as a
+ * plain file descriptor, e.g. (FILE *) 1 for the standard output, and accessed
+ * without buffering.
+ */
+typedef struct __file {
+    int fd;
+    int writing; /* buf holds pending output rather than input */
+    char *buf;
+    int pos; /* next byte to read, or the number of pending output bytes */
+    int len; /* number of input bytes in buf */
+    struct __file *next;
+} FILE;
+
+#define CLOCK_REALTIME 0
+#define CLOCK_MONOTONIC 1
+#define CLOCK_PROCESS_CPUTIME_ID 2
+
+typedef struct timespec {
+    int tv_sec;
+    int tv_nsec;
+} timespec_t;
 
 /* va_list support for variadic functions */
 typedef int *va_list;
@@ -502,9 +526,11 @@ int snprintf(char *buffer, int n, char *str, ...)
 }
 
 int __free_all(void);
+int fflush(FILE *stream);
 
 void exit(int exit_code)
 {
+    fflush(NULL);
     __free_all();
     __syscall(__syscall_exit, exit_code);
 }
@@ -515,41 +541,132 @@ void abort(void)
     exit(-1);
 }
 
+void *malloc(int size);
+void free(void *ptr);
+
+/* Open streams, flushed by exit() */
+FILE *__stream_list;
+
+/* Descriptors are small integers, while streams live in mapped pages */
+int __stream_is_fd(FILE *stream)
+{
+    return (int) stream >= 0 && (int) stream < BUFSIZ;
+}
+
 FILE *fopen(char *filename, char *mode)
 {
-    if (!strcmp(mode, "wb")) {
+    int fd = -1, writing = 0;
+
+    /* O_WRONLY | O_CREAT | O_TRUNC */
+    if (!strcmp(mode, "wb") || !strcmp(mode, "w")) {
+        writing = 1;
 #if defined(__arm__)
-        return __syscall(__syscall_open, filename, 65, 0x1fd);
+        fd = __syscall(__syscall_open, filename, 577, 0x1fd);
 #elif defined(__riscv)
         /* FIXME: mode not work currently in RISC-V */
-        return __syscall(__syscall_openat, -100, filename, 65, 0x1fd);
+        fd = __syscall(__syscall_openat, -100, filename, 577, 0x1fd);
 #endif
-    }
-    if (!strcmp(mode, "rb")) {
+    } else if (!strcmp(mode, "rb") || !strcmp(mode, "r")) {
 #if defined(__arm__)
-        return __syscall(__syscall_open, filename, 0, 0);
+        fd = __syscall(__syscall_open, filename, 0, 0);
 #elif defined(__riscv)
-        return __syscall(__syscall_openat, -100, filename, 0, 0);
+        fd = __syscall(__syscall_openat, -100, filename, 0, 0);
 #endif
     }
-    return NULL;
+    if (fd < 0)
+        return NULL;
+
+    /* The buffer directly follows the stream structure */
+    FILE *stream = malloc(sizeof(FILE) + BUFSIZ);
+    stream->fd = fd;
+    stream->writing = writing;
+    stream->buf = (char *) (stream + 1);
+    stream->pos = 0;
+    stream->len = 0;
+    stream->next = __stream_list;
+    __stream_list = stream;
+    return stream;
+}
+
+/* Write all of buf to a descriptor, retrying on short writes */
+int __write_all(int fd, char *buf, int len)
+{
+    int done = 0;
+    while (done < len) {
+        int r = __syscall(__syscall_write, fd, buf + done, len - done);
+        if (r <= 0)
+            return -1;
+        done += r;
+    }
+    return 0;
+}
+
+/* Write out pending output. A NULL stream flushes every open stream. */
+int fflush(FILE *stream)
+{
+    if (!stream) {
+        int result = 0;
+        for (FILE *s = __stream_list; s; s = s->next) {
+            if (fflush(s))
+                result = -1;
+        }
+        return result;
+    }
+    if (__stream_is_fd(stream) || !stream->writing || !stream->pos)
+        return 0;
+
+    int r = __write_all(stream->fd, stream->buf, stream->pos);
+    stream->pos = 0;
+    return r;
 }
 
 int fclose(FILE *stream)
 {
-    __syscall(__syscall_close, stream);
-    return 0;
+    if (__stream_is_fd(stream)) {
+        __syscall(__syscall_close, stream);
+        return 0;
+    }
+
+    int result = fflush(stream);
+    if (__stream_list == stream) {
+        __stream_list = stream->next;
+    } else {
+        FILE *prev = __stream_list;
+        while (prev->next != stream)
+            prev = prev->next;
+        prev->next = stream->next;
+    }
+    __syscall(__syscall_close, stream->fd);
+    free(stream);
+    return result;
 }
 
-/* Read a byte from file descriptor. So the return value is either in the range
- * of 0 to 127 for the character, or -1 on the end of file.
+/* Refill the input buffer. Returns the number of bytes now available. */
+int __stream_fill(FILE *stream)
+{
+    int r = __syscall(__syscall_read, stream->fd, stream->buf, BUFSIZ);
+    stream->pos = 0;
+    stream->len = r > 0 ? r : 0;
+    return stream->len;
+}
+
+/* Read a byte from the stream. So the return value is either in the range of
+ * 0 to 255 for the character, or -1 on the end of file.
  */
 int fgetc(FILE *stream)
 {
-    int buf = 0, r = __syscall(__syscall_read, stream, &buf, 1);
-    if (r < 1)
+    if (__stream_is_fd(stream)) {
+        int buf = 0, r = __syscall(__syscall_read, stream, &buf, 1);
+        if (r < 1)
+            return -1;
+        return buf;
+    }
+
+    if (stream->pos == stream->len && !__stream_fill(stream))
         return -1;
-    return buf;
+    int c = stream->buf[stream->pos] & 0xff;
+    stream->pos++;
+    return c;
 }
 
 char *fgets(char *str, int n, FILE *stream)
@@ -577,13 +694,116 @@ char *fgets(char *str, int n, FILE *stream)
     return str;
 }
 
+int fread(void *ptr, int size, int n, FILE *stream)
+{
+    char *dest = ptr;
+    int total = size * n, done = 0;
+
+    if (!total)
+        return 0;
+
+    if (__stream_is_fd(stream)) {
+        while (done < total) {
+            int r = __syscall(__syscall_read, stream, dest + done,
+                              total - done);
+            if (r <= 0)
+                break;
+            done += r;
+        }
+        return done / size;
+    }
+
+    while (done < total) {
+        int avail = stream->len - stream->pos;
+        if (!avail) {
+            /* Large reads bypass the buffer */
+            if (total - done >= BUFSIZ) {
+                int r = __syscall(__syscall_read, stream->fd, dest + done,
+                                  total - done);
+                if (r <= 0)
+                    break;
+                done += r;
+                continue;
+            }
+            avail = __stream_fill(stream);
+            if (!avail)
+                break;
+        }
+        if (avail > total - done)
+            avail = total - done;
+        memcpy(dest + done, stream->buf + stream->pos, avail);
+        stream->pos += avail;
+        done += avail;
+    }
+    return done / size;
+}
+
 int fputc(int c, FILE *stream)
 {
-    if (__syscall(__syscall_write, stream, &c, 1) < 0)
+    if (__stream_is_fd(stream)) {
+        if (__syscall(__syscall_write, stream, &c, 1) < 0)
+            return -1;
+        return c;
+    }
+
+    if (stream->pos == BUFSIZ && fflush(stream))
         return -1;
+    stream->buf[stream->pos] = c;
+    stream->pos++;
     return c;
 }
 
+int fwrite(void *ptr, int size, int n, FILE *stream)
+{
+    char *src = ptr;
+    int total = size * n;
+
+    if (!total)
+        return 0;
+
+    if (__stream_is_fd(stream)) {
+        if (__write_all(stream, src, total))
+            return 0;
+        return n;
+    }
+
+    if (stream->pos + total > BUFSIZ && fflush(stream))
+        return 0;
+    /* Large writes bypass the buffer */
+    if (total >= BUFSIZ) {
+        if (__write_all(stream->fd, src, total))
+            return 0;
+        return n;
+    }
+    memcpy(stream->buf + stream->pos, src, total);
+    stream->pos += total;
+    return n;
+}
+
+int fputs(char *str, FILE *stream)
+{
+    int len = strlen(str);
+    if (fwrite(str, 1, len, stream) != len)
+        return -1;
+    return 0;
+}
+
+int clock_gettime(int clock_id, timespec_t *tp)
+{
+#if defined(__arm__)
+    return __syscall(__syscall_clock_gettime, clock_id, tp);
+#elif defined(__riscv)
+    /* RV32 only provides the 64-bit time variant. Both fields are 64-bit and
+     * little-endian, so the low words hold the values we need.
+     */
+    int ts64[4];
+    int r = __syscall(__syscall_clock_gettime64, clock_id, ts64);
+    tp->tv_sec = ts64[0];
+    tp->tv_nsec = ts64[2];
+    return r;
+#endif
+}
+
 /* Non-portable: Assume page size is 4KiB */
 #define PAGESIZE 4096
 
@@ -661,7 +881,8 @@ void *malloc(int size)
         allocated = NULL;
     } else {
         for (chunk_t *fh = __freelist_head; fh->next; fh = fh->next) {
-            int fh_size = CHUNK_GET_SIZE(fh->size);
+            /* The chunk size includes its header */
+            int fh_size = CHUNK_GET_SIZE(fh->size) - sizeof(chunk_t);
             if (fh_size >= size && (!best_fit_chunk || fh_size < best_size)) {
                 best_fit_chunk = fh;
                 best_size = fh_size;
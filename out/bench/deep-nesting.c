@@ -0,0 +1,8124 @@
+int nest0(int n)
+{
+    int s = 0;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest1(int n)
+{
+    int s = 1;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest2(int n)
+{
+    int s = 2;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest3(int n)
+{
+    int s = 3;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest4(int n)
+{
+    int s = 4;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest5(int n)
+{
+    int s = 5;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest6(int n)
+{
+    int s = 6;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest7(int n)
+{
+    int s = 7;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest8(int n)
+{
+    int s = 8;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest9(int n)
+{
+    int s = 9;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest10(int n)
+{
+    int s = 10;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest11(int n)
+{
+    int s = 11;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest12(int n)
+{
+    int s = 12;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest13(int n)
+{
+    int s = 13;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest14(int n)
+{
+    int s = 14;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest15(int n)
+{
+    int s = 15;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest16(int n)
+{
+    int s = 16;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest17(int n)
+{
+    int s = 17;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest18(int n)
+{
+    int s = 18;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int nest19(int n)
+{
+    int s = 19;
+    for (int i0 = 0; i0 < n; i0++) {
+    if ((s + 1) & 1) {
+    for (int i2 = 0; i2 < n; i2++) {
+    if ((s + 3) & 1) {
+    for (int i4 = 0; i4 < n; i4++) {
+    if ((s + 5) & 1) {
+    for (int i6 = 0; i6 < n; i6++) {
+    if ((s + 7) & 1) {
+    for (int i8 = 0; i8 < n; i8++) {
+    if ((s + 9) & 1) {
+    for (int i10 = 0; i10 < n; i10++) {
+    if ((s + 11) & 1) {
+    for (int i12 = 0; i12 < n; i12++) {
+    if ((s + 13) & 1) {
+    for (int i14 = 0; i14 < n; i14++) {
+    if ((s + 15) & 1) {
+    for (int i16 = 0; i16 < n; i16++) {
+    if ((s + 17) & 1) {
+    for (int i18 = 0; i18 < n; i18++) {
+    if ((s + 19) & 1) {
+    for (int i20 = 0; i20 < n; i20++) {
+    if ((s + 21) & 1) {
+    for (int i22 = 0; i22 < n; i22++) {
+    if ((s + 23) & 1) {
+    for (int i24 = 0; i24 < n; i24++) {
+    if ((s + 25) & 1) {
+    for (int i26 = 0; i26 < n; i26++) {
+    if ((s + 27) & 1) {
+    for (int i28 = 0; i28 < n; i28++) {
+    if ((s + 29) & 1) {
+    for (int i30 = 0; i30 < n; i30++) {
+    if ((s + 31) & 1) {
+    for (int i32 = 0; i32 < n; i32++) {
+    if ((s + 33) & 1) {
+    for (int i34 = 0; i34 < n; i34++) {
+    if ((s + 35) & 1) {
+    for (int i36 = 0; i36 < n; i36++) {
+    if ((s + 37) & 1) {
+    for (int i38 = 0; i38 < n; i38++) {
+    if ((s + 39) & 1) {
+    for (int i40 = 0; i40 < n; i40++) {
+    if ((s + 41) & 1) {
+    for (int i42 = 0; i42 < n; i42++) {
+    if ((s + 43) & 1) {
+    for (int i44 = 0; i44 < n; i44++) {
+    if ((s + 45) & 1) {
+    for (int i46 = 0; i46 < n; i46++) {
+    if ((s + 47) & 1) {
+    for (int i48 = 0; i48 < n; i48++) {
+    if ((s + 49) & 1) {
+    for (int i50 = 0; i50 < n; i50++) {
+    if ((s + 51) & 1) {
+    for (int i52 = 0; i52 < n; i52++) {
+    if ((s + 53) & 1) {
+    for (int i54 = 0; i54 < n; i54++) {
+    if ((s + 55) & 1) {
+    for (int i56 = 0; i56 < n; i56++) {
+    if ((s + 57) & 1) {
+    for (int i58 = 0; i58 < n; i58++) {
+    if ((s + 59) & 1) {
+    for (int i60 = 0; i60 < n; i60++) {
+    if ((s + 61) & 1) {
+    for (int i62 = 0; i62 < n; i62++) {
+    if ((s + 63) & 1) {
+    for (int i64 = 0; i64 < n; i64++) {
+    if ((s + 65) & 1) {
+    for (int i66 = 0; i66 < n; i66++) {
+    if ((s + 67) & 1) {
+    for (int i68 = 0; i68 < n; i68++) {
+    if ((s + 69) & 1) {
+    for (int i70 = 0; i70 < n; i70++) {
+    if ((s + 71) & 1) {
+    for (int i72 = 0; i72 < n; i72++) {
+    if ((s + 73) & 1) {
+    for (int i74 = 0; i74 < n; i74++) {
+    if ((s + 75) & 1) {
+    for (int i76 = 0; i76 < n; i76++) {
+    if ((s + 77) & 1) {
+    for (int i78 = 0; i78 < n; i78++) {
+    if ((s + 79) & 1) {
+    for (int i80 = 0; i80 < n; i80++) {
+    if ((s + 81) & 1) {
+    for (int i82 = 0; i82 < n; i82++) {
+    if ((s + 83) & 1) {
+    for (int i84 = 0; i84 < n; i84++) {
+    if ((s + 85) & 1) {
+    for (int i86 = 0; i86 < n; i86++) {
+    if ((s + 87) & 1) {
+    for (int i88 = 0; i88 < n; i88++) {
+    if ((s + 89) & 1) {
+    for (int i90 = 0; i90 < n; i90++) {
+    if ((s + 91) & 1) {
+    for (int i92 = 0; i92 < n; i92++) {
+    if ((s + 93) & 1) {
+    for (int i94 = 0; i94 < n; i94++) {
+    if ((s + 95) & 1) {
+    for (int i96 = 0; i96 < n; i96++) {
+    if ((s + 97) & 1) {
+    for (int i98 = 0; i98 < n; i98++) {
+    if ((s + 99) & 1) {
+    for (int i100 = 0; i100 < n; i100++) {
+    if ((s + 101) & 1) {
+    for (int i102 = 0; i102 < n; i102++) {
+    if ((s + 103) & 1) {
+    for (int i104 = 0; i104 < n; i104++) {
+    if ((s + 105) & 1) {
+    for (int i106 = 0; i106 < n; i106++) {
+    if ((s + 107) & 1) {
+    for (int i108 = 0; i108 < n; i108++) {
+    if ((s + 109) & 1) {
+    for (int i110 = 0; i110 < n; i110++) {
+    if ((s + 111) & 1) {
+    for (int i112 = 0; i112 < n; i112++) {
+    if ((s + 113) & 1) {
+    for (int i114 = 0; i114 < n; i114++) {
+    if ((s + 115) & 1) {
+    for (int i116 = 0; i116 < n; i116++) {
+    if ((s + 117) & 1) {
+    for (int i118 = 0; i118 < n; i118++) {
+    if ((s + 119) & 1) {
+    for (int i120 = 0; i120 < n; i120++) {
+    if ((s + 121) & 1) {
+    for (int i122 = 0; i122 < n; i122++) {
+    if ((s + 123) & 1) {
+    for (int i124 = 0; i124 < n; i124++) {
+    if ((s + 125) & 1) {
+    for (int i126 = 0; i126 < n; i126++) {
+    if ((s + 127) & 1) {
+    for (int i128 = 0; i128 < n; i128++) {
+    if ((s + 129) & 1) {
+    for (int i130 = 0; i130 < n; i130++) {
+    if ((s + 131) & 1) {
+    for (int i132 = 0; i132 < n; i132++) {
+    if ((s + 133) & 1) {
+    for (int i134 = 0; i134 < n; i134++) {
+    if ((s + 135) & 1) {
+    for (int i136 = 0; i136 < n; i136++) {
+    if ((s + 137) & 1) {
+    for (int i138 = 0; i138 < n; i138++) {
+    if ((s + 139) & 1) {
+    for (int i140 = 0; i140 < n; i140++) {
+    if ((s + 141) & 1) {
+    for (int i142 = 0; i142 < n; i142++) {
+    if ((s + 143) & 1) {
+    for (int i144 = 0; i144 < n; i144++) {
+    if ((s + 145) & 1) {
+    for (int i146 = 0; i146 < n; i146++) {
+    if ((s + 147) & 1) {
+    for (int i148 = 0; i148 < n; i148++) {
+    if ((s + 149) & 1) {
+    for (int i150 = 0; i150 < n; i150++) {
+    if ((s + 151) & 1) {
+    for (int i152 = 0; i152 < n; i152++) {
+    if ((s + 153) & 1) {
+    for (int i154 = 0; i154 < n; i154++) {
+    if ((s + 155) & 1) {
+    for (int i156 = 0; i156 < n; i156++) {
+    if ((s + 157) & 1) {
+    for (int i158 = 0; i158 < n; i158++) {
+    if ((s + 159) & 1) {
+    for (int i160 = 0; i160 < n; i160++) {
+    if ((s + 161) & 1) {
+    for (int i162 = 0; i162 < n; i162++) {
+    if ((s + 163) & 1) {
+    for (int i164 = 0; i164 < n; i164++) {
+    if ((s + 165) & 1) {
+    for (int i166 = 0; i166 < n; i166++) {
+    if ((s + 167) & 1) {
+    for (int i168 = 0; i168 < n; i168++) {
+    if ((s + 169) & 1) {
+    for (int i170 = 0; i170 < n; i170++) {
+    if ((s + 171) & 1) {
+    for (int i172 = 0; i172 < n; i172++) {
+    if ((s + 173) & 1) {
+    for (int i174 = 0; i174 < n; i174++) {
+    if ((s + 175) & 1) {
+    for (int i176 = 0; i176 < n; i176++) {
+    if ((s + 177) & 1) {
+    for (int i178 = 0; i178 < n; i178++) {
+    if ((s + 179) & 1) {
+    for (int i180 = 0; i180 < n; i180++) {
+    if ((s + 181) & 1) {
+    for (int i182 = 0; i182 < n; i182++) {
+    if ((s + 183) & 1) {
+    for (int i184 = 0; i184 < n; i184++) {
+    if ((s + 185) & 1) {
+    for (int i186 = 0; i186 < n; i186++) {
+    if ((s + 187) & 1) {
+    for (int i188 = 0; i188 < n; i188++) {
+    if ((s + 189) & 1) {
+    for (int i190 = 0; i190 < n; i190++) {
+    if ((s + 191) & 1) {
+    for (int i192 = 0; i192 < n; i192++) {
+    if ((s + 193) & 1) {
+    for (int i194 = 0; i194 < n; i194++) {
+    if ((s + 195) & 1) {
+    for (int i196 = 0; i196 < n; i196++) {
+    if ((s + 197) & 1) {
+    for (int i198 = 0; i198 < n; i198++) {
+    if ((s + 199) & 1) {
+    s = s + n;
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    }
+    return s;
+}
+int main()
+{
+    return nest0(1) & 255;
+}
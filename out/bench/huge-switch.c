@@ -0,0 +1,30214 @@
+int dispatch0(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch1(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch2(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch3(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch4(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch5(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch6(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch7(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch8(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch9(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch10(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch11(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch12(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch13(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch14(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch15(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch16(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch17(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch18(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch19(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch20(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch21(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch22(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch23(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch24(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch25(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch26(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch27(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch28(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int dispatch29(int op, int x)
+{
+    switch (op) {
+    case 0:
+        return x * 1 + 0;
+    case 1:
+        return x * 2 + 1;
+    case 2:
+        return x * 3 + 2;
+    case 3:
+        return x * 4 + 3;
+    case 4:
+        return x * 5 + 4;
+    case 5:
+        return x * 6 + 5;
+    case 6:
+        return x * 7 + 6;
+    case 7:
+        return x * 8 + 7;
+    case 8:
+        return x * 9 + 8;
+    case 9:
+        return x * 1 + 9;
+    case 10:
+        return x * 2 + 10;
+    case 11:
+        return x * 3 + 11;
+    case 12:
+        return x * 4 + 12;
+    case 13:
+        return x * 5 + 13;
+    case 14:
+        return x * 6 + 14;
+    case 15:
+        return x * 7 + 15;
+    case 16:
+        return x * 8 + 16;
+    case 17:
+        return x * 9 + 17;
+    case 18:
+        return x * 1 + 18;
+    case 19:
+        return x * 2 + 19;
+    case 20:
+        return x * 3 + 20;
+    case 21:
+        return x * 4 + 21;
+    case 22:
+        return x * 5 + 22;
+    case 23:
+        return x * 6 + 23;
+    case 24:
+        return x * 7 + 24;
+    case 25:
+        return x * 8 + 25;
+    case 26:
+        return x * 9 + 26;
+    case 27:
+        return x * 1 + 27;
+    case 28:
+        return x * 2 + 28;
+    case 29:
+        return x * 3 + 29;
+    case 30:
+        return x * 4 + 30;
+    case 31:
+        return x * 5 + 31;
+    case 32:
+        return x * 6 + 32;
+    case 33:
+        return x * 7 + 33;
+    case 34:
+        return x * 8 + 34;
+    case 35:
+        return x * 9 + 35;
+    case 36:
+        return x * 1 + 36;
+    case 37:
+        return x * 2 + 37;
+    case 38:
+        return x * 3 + 38;
+    case 39:
+        return x * 4 + 39;
+    case 40:
+        return x * 5 + 40;
+    case 41:
+        return x * 6 + 41;
+    case 42:
+        return x * 7 + 42;
+    case 43:
+        return x * 8 + 43;
+    case 44:
+        return x * 9 + 44;
+    case 45:
+        return x * 1 + 45;
+    case 46:
+        return x * 2 + 46;
+    case 47:
+        return x * 3 + 47;
+    case 48:
+        return x * 4 + 48;
+    case 49:
+        return x * 5 + 49;
+    case 50:
+        return x * 6 + 50;
+    case 51:
+        return x * 7 + 51;
+    case 52:
+        return x * 8 + 52;
+    case 53:
+        return x * 9 + 53;
+    case 54:
+        return x * 1 + 54;
+    case 55:
+        return x * 2 + 55;
+    case 56:
+        return x * 3 + 56;
+    case 57:
+        return x * 4 + 57;
+    case 58:
+        return x * 5 + 58;
+    case 59:
+        return x * 6 + 59;
+    case 60:
+        return x * 7 + 60;
+    case 61:
+        return x * 8 + 61;
+    case 62:
+        return x * 9 + 62;
+    case 63:
+        return x * 1 + 63;
+    case 64:
+        return x * 2 + 64;
+    case 65:
+        return x * 3 + 65;
+    case 66:
+        return x * 4 + 66;
+    case 67:
+        return x * 5 + 67;
+    case 68:
+        return x * 6 + 68;
+    case 69:
+        return x * 7 + 69;
+    case 70:
+        return x * 8 + 70;
+    case 71:
+        return x * 9 + 71;
+    case 72:
+        return x * 1 + 72;
+    case 73:
+        return x * 2 + 73;
+    case 74:
+        return x * 3 + 74;
+    case 75:
+        return x * 4 + 75;
+    case 76:
+        return x * 5 + 76;
+    case 77:
+        return x * 6 + 77;
+    case 78:
+        return x * 7 + 78;
+    case 79:
+        return x * 8 + 79;
+    case 80:
+        return x * 9 + 80;
+    case 81:
+        return x * 1 + 81;
+    case 82:
+        return x * 2 + 82;
+    case 83:
+        return x * 3 + 83;
+    case 84:
+        return x * 4 + 84;
+    case 85:
+        return x * 5 + 85;
+    case 86:
+        return x * 6 + 86;
+    case 87:
+        return x * 7 + 87;
+    case 88:
+        return x * 8 + 88;
+    case 89:
+        return x * 9 + 89;
+    case 90:
+        return x * 1 + 90;
+    case 91:
+        return x * 2 + 91;
+    case 92:
+        return x * 3 + 92;
+    case 93:
+        return x * 4 + 93;
+    case 94:
+        return x * 5 + 94;
+    case 95:
+        return x * 6 + 95;
+    case 96:
+        return x * 7 + 96;
+    case 97:
+        return x * 8 + 97;
+    case 98:
+        return x * 9 + 98;
+    case 99:
+        return x * 1 + 99;
+    case 100:
+        return x * 2 + 100;
+    case 101:
+        return x * 3 + 101;
+    case 102:
+        return x * 4 + 102;
+    case 103:
+        return x * 5 + 103;
+    case 104:
+        return x * 6 + 104;
+    case 105:
+        return x * 7 + 105;
+    case 106:
+        return x * 8 + 106;
+    case 107:
+        return x * 9 + 107;
+    case 108:
+        return x * 1 + 108;
+    case 109:
+        return x * 2 + 109;
+    case 110:
+        return x * 3 + 110;
+    case 111:
+        return x * 4 + 111;
+    case 112:
+        return x * 5 + 112;
+    case 113:
+        return x * 6 + 113;
+    case 114:
+        return x * 7 + 114;
+    case 115:
+        return x * 8 + 115;
+    case 116:
+        return x * 9 + 116;
+    case 117:
+        return x * 1 + 117;
+    case 118:
+        return x * 2 + 118;
+    case 119:
+        return x * 3 + 119;
+    case 120:
+        return x * 4 + 120;
+    case 121:
+        return x * 5 + 121;
+    case 122:
+        return x * 6 + 122;
+    case 123:
+        return x * 7 + 123;
+    case 124:
+        return x * 8 + 124;
+    case 125:
+        return x * 9 + 125;
+    case 126:
+        return x * 1 + 126;
+    case 127:
+        return x * 2 + 127;
+    case 128:
+        return x * 3 + 128;
+    case 129:
+        return x * 4 + 129;
+    case 130:
+        return x * 5 + 130;
+    case 131:
+        return x * 6 + 131;
+    case 132:
+        return x * 7 + 132;
+    case 133:
+        return x * 8 + 133;
+    case 134:
+        return x * 9 + 134;
+    case 135:
+        return x * 1 + 135;
+    case 136:
+        return x * 2 + 136;
+    case 137:
+        return x * 3 + 137;
+    case 138:
+        return x * 4 + 138;
+    case 139:
+        return x * 5 + 139;
+    case 140:
+        return x * 6 + 140;
+    case 141:
+        return x * 7 + 141;
+    case 142:
+        return x * 8 + 142;
+    case 143:
+        return x * 9 + 143;
+    case 144:
+        return x * 1 + 144;
+    case 145:
+        return x * 2 + 145;
+    case 146:
+        return x * 3 + 146;
+    case 147:
+        return x * 4 + 147;
+    case 148:
+        return x * 5 + 148;
+    case 149:
+        return x * 6 + 149;
+    case 150:
+        return x * 7 + 150;
+    case 151:
+        return x * 8 + 151;
+    case 152:
+        return x * 9 + 152;
+    case 153:
+        return x * 1 + 153;
+    case 154:
+        return x * 2 + 154;
+    case 155:
+        return x * 3 + 155;
+    case 156:
+        return x * 4 + 156;
+    case 157:
+        return x * 5 + 157;
+    case 158:
+        return x * 6 + 158;
+    case 159:
+        return x * 7 + 159;
+    case 160:
+        return x * 8 + 160;
+    case 161:
+        return x * 9 + 161;
+    case 162:
+        return x * 1 + 162;
+    case 163:
+        return x * 2 + 163;
+    case 164:
+        return x * 3 + 164;
+    case 165:
+        return x * 4 + 165;
+    case 166:
+        return x * 5 + 166;
+    case 167:
+        return x * 6 + 167;
+    case 168:
+        return x * 7 + 168;
+    case 169:
+        return x * 8 + 169;
+    case 170:
+        return x * 9 + 170;
+    case 171:
+        return x * 1 + 171;
+    case 172:
+        return x * 2 + 172;
+    case 173:
+        return x * 3 + 173;
+    case 174:
+        return x * 4 + 174;
+    case 175:
+        return x * 5 + 175;
+    case 176:
+        return x * 6 + 176;
+    case 177:
+        return x * 7 + 177;
+    case 178:
+        return x * 8 + 178;
+    case 179:
+        return x * 9 + 179;
+    case 180:
+        return x * 1 + 180;
+    case 181:
+        return x * 2 + 181;
+    case 182:
+        return x * 3 + 182;
+    case 183:
+        return x * 4 + 183;
+    case 184:
+        return x * 5 + 184;
+    case 185:
+        return x * 6 + 185;
+    case 186:
+        return x * 7 + 186;
+    case 187:
+        return x * 8 + 187;
+    case 188:
+        return x * 9 + 188;
+    case 189:
+        return x * 1 + 189;
+    case 190:
+        return x * 2 + 190;
+    case 191:
+        return x * 3 + 191;
+    case 192:
+        return x * 4 + 192;
+    case 193:
+        return x * 5 + 193;
+    case 194:
+        return x * 6 + 194;
+    case 195:
+        return x * 7 + 195;
+    case 196:
+        return x * 8 + 196;
+    case 197:
+        return x * 9 + 197;
+    case 198:
+        return x * 1 + 198;
+    case 199:
+        return x * 2 + 199;
+    case 200:
+        return x * 3 + 200;
+    case 201:
+        return x * 4 + 201;
+    case 202:
+        return x * 5 + 202;
+    case 203:
+        return x * 6 + 203;
+    case 204:
+        return x * 7 + 204;
+    case 205:
+        return x * 8 + 205;
+    case 206:
+        return x * 9 + 206;
+    case 207:
+        return x * 1 + 207;
+    case 208:
+        return x * 2 + 208;
+    case 209:
+        return x * 3 + 209;
+    case 210:
+        return x * 4 + 210;
+    case 211:
+        return x * 5 + 211;
+    case 212:
+        return x * 6 + 212;
+    case 213:
+        return x * 7 + 213;
+    case 214:
+        return x * 8 + 214;
+    case 215:
+        return x * 9 + 215;
+    case 216:
+        return x * 1 + 216;
+    case 217:
+        return x * 2 + 217;
+    case 218:
+        return x * 3 + 218;
+    case 219:
+        return x * 4 + 219;
+    case 220:
+        return x * 5 + 220;
+    case 221:
+        return x * 6 + 221;
+    case 222:
+        return x * 7 + 222;
+    case 223:
+        return x * 8 + 223;
+    case 224:
+        return x * 9 + 224;
+    case 225:
+        return x * 1 + 225;
+    case 226:
+        return x * 2 + 226;
+    case 227:
+        return x * 3 + 227;
+    case 228:
+        return x * 4 + 228;
+    case 229:
+        return x * 5 + 229;
+    case 230:
+        return x * 6 + 230;
+    case 231:
+        return x * 7 + 231;
+    case 232:
+        return x * 8 + 232;
+    case 233:
+        return x * 9 + 233;
+    case 234:
+        return x * 1 + 234;
+    case 235:
+        return x * 2 + 235;
+    case 236:
+        return x * 3 + 236;
+    case 237:
+        return x * 4 + 237;
+    case 238:
+        return x * 5 + 238;
+    case 239:
+        return x * 6 + 239;
+    case 240:
+        return x * 7 + 240;
+    case 241:
+        return x * 8 + 241;
+    case 242:
+        return x * 9 + 242;
+    case 243:
+        return x * 1 + 243;
+    case 244:
+        return x * 2 + 244;
+    case 245:
+        return x * 3 + 245;
+    case 246:
+        return x * 4 + 246;
+    case 247:
+        return x * 5 + 247;
+    case 248:
+        return x * 6 + 248;
+    case 249:
+        return x * 7 + 249;
+    case 250:
+        return x * 8 + 250;
+    case 251:
+        return x * 9 + 251;
+    case 252:
+        return x * 1 + 252;
+    case 253:
+        return x * 2 + 253;
+    case 254:
+        return x * 3 + 254;
+    case 255:
+        return x * 4 + 255;
+    case 256:
+        return x * 5 + 256;
+    case 257:
+        return x * 6 + 257;
+    case 258:
+        return x * 7 + 258;
+    case 259:
+        return x * 8 + 259;
+    case 260:
+        return x * 9 + 260;
+    case 261:
+        return x * 1 + 261;
+    case 262:
+        return x * 2 + 262;
+    case 263:
+        return x * 3 + 263;
+    case 264:
+        return x * 4 + 264;
+    case 265:
+        return x * 5 + 265;
+    case 266:
+        return x * 6 + 266;
+    case 267:
+        return x * 7 + 267;
+    case 268:
+        return x * 8 + 268;
+    case 269:
+        return x * 9 + 269;
+    case 270:
+        return x * 1 + 270;
+    case 271:
+        return x * 2 + 271;
+    case 272:
+        return x * 3 + 272;
+    case 273:
+        return x * 4 + 273;
+    case 274:
+        return x * 5 + 274;
+    case 275:
+        return x * 6 + 275;
+    case 276:
+        return x * 7 + 276;
+    case 277:
+        return x * 8 + 277;
+    case 278:
+        return x * 9 + 278;
+    case 279:
+        return x * 1 + 279;
+    case 280:
+        return x * 2 + 280;
+    case 281:
+        return x * 3 + 281;
+    case 282:
+        return x * 4 + 282;
+    case 283:
+        return x * 5 + 283;
+    case 284:
+        return x * 6 + 284;
+    case 285:
+        return x * 7 + 285;
+    case 286:
+        return x * 8 + 286;
+    case 287:
+        return x * 9 + 287;
+    case 288:
+        return x * 1 + 288;
+    case 289:
+        return x * 2 + 289;
+    case 290:
+        return x * 3 + 290;
+    case 291:
+        return x * 4 + 291;
+    case 292:
+        return x * 5 + 292;
+    case 293:
+        return x * 6 + 293;
+    case 294:
+        return x * 7 + 294;
+    case 295:
+        return x * 8 + 295;
+    case 296:
+        return x * 9 + 296;
+    case 297:
+        return x * 1 + 297;
+    case 298:
+        return x * 2 + 298;
+    case 299:
+        return x * 3 + 299;
+    case 300:
+        return x * 4 + 300;
+    case 301:
+        return x * 5 + 301;
+    case 302:
+        return x * 6 + 302;
+    case 303:
+        return x * 7 + 303;
+    case 304:
+        return x * 8 + 304;
+    case 305:
+        return x * 9 + 305;
+    case 306:
+        return x * 1 + 306;
+    case 307:
+        return x * 2 + 307;
+    case 308:
+        return x * 3 + 308;
+    case 309:
+        return x * 4 + 309;
+    case 310:
+        return x * 5 + 310;
+    case 311:
+        return x * 6 + 311;
+    case 312:
+        return x * 7 + 312;
+    case 313:
+        return x * 8 + 313;
+    case 314:
+        return x * 9 + 314;
+    case 315:
+        return x * 1 + 315;
+    case 316:
+        return x * 2 + 316;
+    case 317:
+        return x * 3 + 317;
+    case 318:
+        return x * 4 + 318;
+    case 319:
+        return x * 5 + 319;
+    case 320:
+        return x * 6 + 320;
+    case 321:
+        return x * 7 + 321;
+    case 322:
+        return x * 8 + 322;
+    case 323:
+        return x * 9 + 323;
+    case 324:
+        return x * 1 + 324;
+    case 325:
+        return x * 2 + 325;
+    case 326:
+        return x * 3 + 326;
+    case 327:
+        return x * 4 + 327;
+    case 328:
+        return x * 5 + 328;
+    case 329:
+        return x * 6 + 329;
+    case 330:
+        return x * 7 + 330;
+    case 331:
+        return x * 8 + 331;
+    case 332:
+        return x * 9 + 332;
+    case 333:
+        return x * 1 + 333;
+    case 334:
+        return x * 2 + 334;
+    case 335:
+        return x * 3 + 335;
+    case 336:
+        return x * 4 + 336;
+    case 337:
+        return x * 5 + 337;
+    case 338:
+        return x * 6 + 338;
+    case 339:
+        return x * 7 + 339;
+    case 340:
+        return x * 8 + 340;
+    case 341:
+        return x * 9 + 341;
+    case 342:
+        return x * 1 + 342;
+    case 343:
+        return x * 2 + 343;
+    case 344:
+        return x * 3 + 344;
+    case 345:
+        return x * 4 + 345;
+    case 346:
+        return x * 5 + 346;
+    case 347:
+        return x * 6 + 347;
+    case 348:
+        return x * 7 + 348;
+    case 349:
+        return x * 8 + 349;
+    case 350:
+        return x * 9 + 350;
+    case 351:
+        return x * 1 + 351;
+    case 352:
+        return x * 2 + 352;
+    case 353:
+        return x * 3 + 353;
+    case 354:
+        return x * 4 + 354;
+    case 355:
+        return x * 5 + 355;
+    case 356:
+        return x * 6 + 356;
+    case 357:
+        return x * 7 + 357;
+    case 358:
+        return x * 8 + 358;
+    case 359:
+        return x * 9 + 359;
+    case 360:
+        return x * 1 + 360;
+    case 361:
+        return x * 2 + 361;
+    case 362:
+        return x * 3 + 362;
+    case 363:
+        return x * 4 + 363;
+    case 364:
+        return x * 5 + 364;
+    case 365:
+        return x * 6 + 365;
+    case 366:
+        return x * 7 + 366;
+    case 367:
+        return x * 8 + 367;
+    case 368:
+        return x * 9 + 368;
+    case 369:
+        return x * 1 + 369;
+    case 370:
+        return x * 2 + 370;
+    case 371:
+        return x * 3 + 371;
+    case 372:
+        return x * 4 + 372;
+    case 373:
+        return x * 5 + 373;
+    case 374:
+        return x * 6 + 374;
+    case 375:
+        return x * 7 + 375;
+    case 376:
+        return x * 8 + 376;
+    case 377:
+        return x * 9 + 377;
+    case 378:
+        return x * 1 + 378;
+    case 379:
+        return x * 2 + 379;
+    case 380:
+        return x * 3 + 380;
+    case 381:
+        return x * 4 + 381;
+    case 382:
+        return x * 5 + 382;
+    case 383:
+        return x * 6 + 383;
+    case 384:
+        return x * 7 + 384;
+    case 385:
+        return x * 8 + 385;
+    case 386:
+        return x * 9 + 386;
+    case 387:
+        return x * 1 + 387;
+    case 388:
+        return x * 2 + 388;
+    case 389:
+        return x * 3 + 389;
+    case 390:
+        return x * 4 + 390;
+    case 391:
+        return x * 5 + 391;
+    case 392:
+        return x * 6 + 392;
+    case 393:
+        return x * 7 + 393;
+    case 394:
+        return x * 8 + 394;
+    case 395:
+        return x * 9 + 395;
+    case 396:
+        return x * 1 + 396;
+    case 397:
+        return x * 2 + 397;
+    case 398:
+        return x * 3 + 398;
+    case 399:
+        return x * 4 + 399;
+    case 400:
+        return x * 5 + 400;
+    case 401:
+        return x * 6 + 401;
+    case 402:
+        return x * 7 + 402;
+    case 403:
+        return x * 8 + 403;
+    case 404:
+        return x * 9 + 404;
+    case 405:
+        return x * 1 + 405;
+    case 406:
+        return x * 2 + 406;
+    case 407:
+        return x * 3 + 407;
+    case 408:
+        return x * 4 + 408;
+    case 409:
+        return x * 5 + 409;
+    case 410:
+        return x * 6 + 410;
+    case 411:
+        return x * 7 + 411;
+    case 412:
+        return x * 8 + 412;
+    case 413:
+        return x * 9 + 413;
+    case 414:
+        return x * 1 + 414;
+    case 415:
+        return x * 2 + 415;
+    case 416:
+        return x * 3 + 416;
+    case 417:
+        return x * 4 + 417;
+    case 418:
+        return x * 5 + 418;
+    case 419:
+        return x * 6 + 419;
+    case 420:
+        return x * 7 + 420;
+    case 421:
+        return x * 8 + 421;
+    case 422:
+        return x * 9 + 422;
+    case 423:
+        return x * 1 + 423;
+    case 424:
+        return x * 2 + 424;
+    case 425:
+        return x * 3 + 425;
+    case 426:
+        return x * 4 + 426;
+    case 427:
+        return x * 5 + 427;
+    case 428:
+        return x * 6 + 428;
+    case 429:
+        return x * 7 + 429;
+    case 430:
+        return x * 8 + 430;
+    case 431:
+        return x * 9 + 431;
+    case 432:
+        return x * 1 + 432;
+    case 433:
+        return x * 2 + 433;
+    case 434:
+        return x * 3 + 434;
+    case 435:
+        return x * 4 + 435;
+    case 436:
+        return x * 5 + 436;
+    case 437:
+        return x * 6 + 437;
+    case 438:
+        return x * 7 + 438;
+    case 439:
+        return x * 8 + 439;
+    case 440:
+        return x * 9 + 440;
+    case 441:
+        return x * 1 + 441;
+    case 442:
+        return x * 2 + 442;
+    case 443:
+        return x * 3 + 443;
+    case 444:
+        return x * 4 + 444;
+    case 445:
+        return x * 5 + 445;
+    case 446:
+        return x * 6 + 446;
+    case 447:
+        return x * 7 + 447;
+    case 448:
+        return x * 8 + 448;
+    case 449:
+        return x * 9 + 449;
+    case 450:
+        return x * 1 + 450;
+    case 451:
+        return x * 2 + 451;
+    case 452:
+        return x * 3 + 452;
+    case 453:
+        return x * 4 + 453;
+    case 454:
+        return x * 5 + 454;
+    case 455:
+        return x * 6 + 455;
+    case 456:
+        return x * 7 + 456;
+    case 457:
+        return x * 8 + 457;
+    case 458:
+        return x * 9 + 458;
+    case 459:
+        return x * 1 + 459;
+    case 460:
+        return x * 2 + 460;
+    case 461:
+        return x * 3 + 461;
+    case 462:
+        return x * 4 + 462;
+    case 463:
+        return x * 5 + 463;
+    case 464:
+        return x * 6 + 464;
+    case 465:
+        return x * 7 + 465;
+    case 466:
+        return x * 8 + 466;
+    case 467:
+        return x * 9 + 467;
+    case 468:
+        return x * 1 + 468;
+    case 469:
+        return x * 2 + 469;
+    case 470:
+        return x * 3 + 470;
+    case 471:
+        return x * 4 + 471;
+    case 472:
+        return x * 5 + 472;
+    case 473:
+        return x * 6 + 473;
+    case 474:
+        return x * 7 + 474;
+    case 475:
+        return x * 8 + 475;
+    case 476:
+        return x * 9 + 476;
+    case 477:
+        return x * 1 + 477;
+    case 478:
+        return x * 2 + 478;
+    case 479:
+        return x * 3 + 479;
+    case 480:
+        return x * 4 + 480;
+    case 481:
+        return x * 5 + 481;
+    case 482:
+        return x * 6 + 482;
+    case 483:
+        return x * 7 + 483;
+    case 484:
+        return x * 8 + 484;
+    case 485:
+        return x * 9 + 485;
+    case 486:
+        return x * 1 + 486;
+    case 487:
+        return x * 2 + 487;
+    case 488:
+        return x * 3 + 488;
+    case 489:
+        return x * 4 + 489;
+    case 490:
+        return x * 5 + 490;
+    case 491:
+        return x * 6 + 491;
+    case 492:
+        return x * 7 + 492;
+    case 493:
+        return x * 8 + 493;
+    case 494:
+        return x * 9 + 494;
+    case 495:
+        return x * 1 + 495;
+    case 496:
+        return x * 2 + 496;
+    case 497:
+        return x * 3 + 497;
+    case 498:
+        return x * 4 + 498;
+    case 499:
+        return x * 5 + 499;
+    default:
+        return -1;
+    }
+}
+int main()
+{
+    return dispatch0(3, 4) & 255;
+}
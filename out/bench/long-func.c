@@ -0,0 +1,12024 @@
+int work(int x, int y)
+{
+    int v0 = x + 0 * y;
+    int v1 = x + 1 * y;
+    int v2 = x + 2 * y;
+    int v3 = x + 3 * y;
+    int v4 = x + 4 * y;
+    int v5 = x + 5 * y;
+    int v6 = x + 6 * y;
+    int v7 = x + 7 * y;
+    int v8 = x + 8 * y;
+    int v9 = x + 9 * y;
+    int v10 = x + 10 * y;
+    int v11 = x + 11 * y;
+    int v12 = x + 12 * y;
+    int v13 = x + 13 * y;
+    int v14 = x + 14 * y;
+    int v15 = x + 15 * y;
+    v0 = v3 * 1 + (v7 ^ 0);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 2 + (v8 ^ 1);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 3 + (v9 ^ 2);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 4 + (v10 ^ 3);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 5 + (v11 ^ 4);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 6 + (v12 ^ 5);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 7 + (v13 ^ 6);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 8 + (v14 ^ 7);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 9 + (v15 ^ 8);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 10 + (v0 ^ 9);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 11 + (v1 ^ 10);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 12 + (v2 ^ 11);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 13 + (v3 ^ 12);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 1 + (v4 ^ 13);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 2 + (v5 ^ 14);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 3 + (v6 ^ 15);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 4 + (v7 ^ 16);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 5 + (v8 ^ 17);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 6 + (v9 ^ 18);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 7 + (v10 ^ 19);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 8 + (v11 ^ 20);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 9 + (v12 ^ 21);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 10 + (v13 ^ 22);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 11 + (v14 ^ 23);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 12 + (v15 ^ 24);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 13 + (v0 ^ 25);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 1 + (v1 ^ 26);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 2 + (v2 ^ 27);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 3 + (v3 ^ 28);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 4 + (v4 ^ 29);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 5 + (v5 ^ 30);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 6 + (v6 ^ 31);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 7 + (v7 ^ 32);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 8 + (v8 ^ 33);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 9 + (v9 ^ 34);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 10 + (v10 ^ 35);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 11 + (v11 ^ 36);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 12 + (v12 ^ 37);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 13 + (v13 ^ 38);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 1 + (v14 ^ 39);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 2 + (v15 ^ 40);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 3 + (v0 ^ 41);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 4 + (v1 ^ 42);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 5 + (v2 ^ 43);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 6 + (v3 ^ 44);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 7 + (v4 ^ 45);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 8 + (v5 ^ 46);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 9 + (v6 ^ 47);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 10 + (v7 ^ 48);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 11 + (v8 ^ 49);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 12 + (v9 ^ 50);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 13 + (v10 ^ 51);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 1 + (v11 ^ 52);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 2 + (v12 ^ 53);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 3 + (v13 ^ 54);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 4 + (v14 ^ 55);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 5 + (v15 ^ 56);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 6 + (v0 ^ 57);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 7 + (v1 ^ 58);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 8 + (v2 ^ 59);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 9 + (v3 ^ 60);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 10 + (v4 ^ 61);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 11 + (v5 ^ 62);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 12 + (v6 ^ 63);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 13 + (v7 ^ 64);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 1 + (v8 ^ 65);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 2 + (v9 ^ 66);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 3 + (v10 ^ 67);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 4 + (v11 ^ 68);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 5 + (v12 ^ 69);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 6 + (v13 ^ 70);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 7 + (v14 ^ 71);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 8 + (v15 ^ 72);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 9 + (v0 ^ 73);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 10 + (v1 ^ 74);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 11 + (v2 ^ 75);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 12 + (v3 ^ 76);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 13 + (v4 ^ 77);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 1 + (v5 ^ 78);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 2 + (v6 ^ 79);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 3 + (v7 ^ 80);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 4 + (v8 ^ 81);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 5 + (v9 ^ 82);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 6 + (v10 ^ 83);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 7 + (v11 ^ 84);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 8 + (v12 ^ 85);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 9 + (v13 ^ 86);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 10 + (v14 ^ 87);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 11 + (v15 ^ 88);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 12 + (v0 ^ 89);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 13 + (v1 ^ 90);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 1 + (v2 ^ 91);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 2 + (v3 ^ 92);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 3 + (v4 ^ 93);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 4 + (v5 ^ 94);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 5 + (v6 ^ 95);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 6 + (v7 ^ 96);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 7 + (v8 ^ 97);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 8 + (v9 ^ 98);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 9 + (v10 ^ 99);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 10 + (v11 ^ 100);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 11 + (v12 ^ 101);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 12 + (v13 ^ 102);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 13 + (v14 ^ 103);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 1 + (v15 ^ 104);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 2 + (v0 ^ 105);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 3 + (v1 ^ 106);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 4 + (v2 ^ 107);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 5 + (v3 ^ 108);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 6 + (v4 ^ 109);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 7 + (v5 ^ 110);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 8 + (v6 ^ 111);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 9 + (v7 ^ 112);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 10 + (v8 ^ 113);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 11 + (v9 ^ 114);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 12 + (v10 ^ 115);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 13 + (v11 ^ 116);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 1 + (v12 ^ 117);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 2 + (v13 ^ 118);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 3 + (v14 ^ 119);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 4 + (v15 ^ 120);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 5 + (v0 ^ 121);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 6 + (v1 ^ 122);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 7 + (v2 ^ 123);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 8 + (v3 ^ 124);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 9 + (v4 ^ 125);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 10 + (v5 ^ 126);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 11 + (v6 ^ 127);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 12 + (v7 ^ 128);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 13 + (v8 ^ 129);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 1 + (v9 ^ 130);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 2 + (v10 ^ 131);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 3 + (v11 ^ 132);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 4 + (v12 ^ 133);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 5 + (v13 ^ 134);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 6 + (v14 ^ 135);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 7 + (v15 ^ 136);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 8 + (v0 ^ 137);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 9 + (v1 ^ 138);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 10 + (v2 ^ 139);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 11 + (v3 ^ 140);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 12 + (v4 ^ 141);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 13 + (v5 ^ 142);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 1 + (v6 ^ 143);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 2 + (v7 ^ 144);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 3 + (v8 ^ 145);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 4 + (v9 ^ 146);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 5 + (v10 ^ 147);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 6 + (v11 ^ 148);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 7 + (v12 ^ 149);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 8 + (v13 ^ 150);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 9 + (v14 ^ 151);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 10 + (v15 ^ 152);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 11 + (v0 ^ 153);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 12 + (v1 ^ 154);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 13 + (v2 ^ 155);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 1 + (v3 ^ 156);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 2 + (v4 ^ 157);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 3 + (v5 ^ 158);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 4 + (v6 ^ 159);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 5 + (v7 ^ 160);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 6 + (v8 ^ 161);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 7 + (v9 ^ 162);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 8 + (v10 ^ 163);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 9 + (v11 ^ 164);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 10 + (v12 ^ 165);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 11 + (v13 ^ 166);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 12 + (v14 ^ 167);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 13 + (v15 ^ 168);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 1 + (v0 ^ 169);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 2 + (v1 ^ 170);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 3 + (v2 ^ 171);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 4 + (v3 ^ 172);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 5 + (v4 ^ 173);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 6 + (v5 ^ 174);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 7 + (v6 ^ 175);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 8 + (v7 ^ 176);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 9 + (v8 ^ 177);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 10 + (v9 ^ 178);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 11 + (v10 ^ 179);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 12 + (v11 ^ 180);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 13 + (v12 ^ 181);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 1 + (v13 ^ 182);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 2 + (v14 ^ 183);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 3 + (v15 ^ 184);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 4 + (v0 ^ 185);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 5 + (v1 ^ 186);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 6 + (v2 ^ 187);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 7 + (v3 ^ 188);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 8 + (v4 ^ 189);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 9 + (v5 ^ 190);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 10 + (v6 ^ 191);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 11 + (v7 ^ 192);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 12 + (v8 ^ 193);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 13 + (v9 ^ 194);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 1 + (v10 ^ 195);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 2 + (v11 ^ 196);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 3 + (v12 ^ 197);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 4 + (v13 ^ 198);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 5 + (v14 ^ 199);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 6 + (v15 ^ 200);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 7 + (v0 ^ 201);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 8 + (v1 ^ 202);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 9 + (v2 ^ 203);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 10 + (v3 ^ 204);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 11 + (v4 ^ 205);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 12 + (v5 ^ 206);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 13 + (v6 ^ 207);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 1 + (v7 ^ 208);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 2 + (v8 ^ 209);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 3 + (v9 ^ 210);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 4 + (v10 ^ 211);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 5 + (v11 ^ 212);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 6 + (v12 ^ 213);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 7 + (v13 ^ 214);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 8 + (v14 ^ 215);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 9 + (v15 ^ 216);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 10 + (v0 ^ 217);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 11 + (v1 ^ 218);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 12 + (v2 ^ 219);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 13 + (v3 ^ 220);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 1 + (v4 ^ 221);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 2 + (v5 ^ 222);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 3 + (v6 ^ 223);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 4 + (v7 ^ 224);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 5 + (v8 ^ 225);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 6 + (v9 ^ 226);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 7 + (v10 ^ 227);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 8 + (v11 ^ 228);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 9 + (v12 ^ 229);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 10 + (v13 ^ 230);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 11 + (v14 ^ 231);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 12 + (v15 ^ 232);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 13 + (v0 ^ 233);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 1 + (v1 ^ 234);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 2 + (v2 ^ 235);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 3 + (v3 ^ 236);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 4 + (v4 ^ 237);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 5 + (v5 ^ 238);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 6 + (v6 ^ 239);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 7 + (v7 ^ 240);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 8 + (v8 ^ 241);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 9 + (v9 ^ 242);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 10 + (v10 ^ 243);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 11 + (v11 ^ 244);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 12 + (v12 ^ 245);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 13 + (v13 ^ 246);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 1 + (v14 ^ 247);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 2 + (v15 ^ 248);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 3 + (v0 ^ 249);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 4 + (v1 ^ 250);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 5 + (v2 ^ 251);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 6 + (v3 ^ 252);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 7 + (v4 ^ 253);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 8 + (v5 ^ 254);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 9 + (v6 ^ 255);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 10 + (v7 ^ 256);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 11 + (v8 ^ 257);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 12 + (v9 ^ 258);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 13 + (v10 ^ 259);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 1 + (v11 ^ 260);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 2 + (v12 ^ 261);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 3 + (v13 ^ 262);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 4 + (v14 ^ 263);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 5 + (v15 ^ 264);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 6 + (v0 ^ 265);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 7 + (v1 ^ 266);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 8 + (v2 ^ 267);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 9 + (v3 ^ 268);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 10 + (v4 ^ 269);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 11 + (v5 ^ 270);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 12 + (v6 ^ 271);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 13 + (v7 ^ 272);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 1 + (v8 ^ 273);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 2 + (v9 ^ 274);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 3 + (v10 ^ 275);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 4 + (v11 ^ 276);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 5 + (v12 ^ 277);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 6 + (v13 ^ 278);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 7 + (v14 ^ 279);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 8 + (v15 ^ 280);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 9 + (v0 ^ 281);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 10 + (v1 ^ 282);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 11 + (v2 ^ 283);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 12 + (v3 ^ 284);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 13 + (v4 ^ 285);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 1 + (v5 ^ 286);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 2 + (v6 ^ 287);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 3 + (v7 ^ 288);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 4 + (v8 ^ 289);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 5 + (v9 ^ 290);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 6 + (v10 ^ 291);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 7 + (v11 ^ 292);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 8 + (v12 ^ 293);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 9 + (v13 ^ 294);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 10 + (v14 ^ 295);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 11 + (v15 ^ 296);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 12 + (v0 ^ 297);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 13 + (v1 ^ 298);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 1 + (v2 ^ 299);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 2 + (v3 ^ 300);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 3 + (v4 ^ 301);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 4 + (v5 ^ 302);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 5 + (v6 ^ 303);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 6 + (v7 ^ 304);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 7 + (v8 ^ 305);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 8 + (v9 ^ 306);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 9 + (v10 ^ 307);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 10 + (v11 ^ 308);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 11 + (v12 ^ 309);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 12 + (v13 ^ 310);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 13 + (v14 ^ 311);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 1 + (v15 ^ 312);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 2 + (v0 ^ 313);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 3 + (v1 ^ 314);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 4 + (v2 ^ 315);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 5 + (v3 ^ 316);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 6 + (v4 ^ 317);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 7 + (v5 ^ 318);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 8 + (v6 ^ 319);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 9 + (v7 ^ 320);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 10 + (v8 ^ 321);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 11 + (v9 ^ 322);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 12 + (v10 ^ 323);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 13 + (v11 ^ 324);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 1 + (v12 ^ 325);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 2 + (v13 ^ 326);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 3 + (v14 ^ 327);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 4 + (v15 ^ 328);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 5 + (v0 ^ 329);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 6 + (v1 ^ 330);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 7 + (v2 ^ 331);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 8 + (v3 ^ 332);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 9 + (v4 ^ 333);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 10 + (v5 ^ 334);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 11 + (v6 ^ 335);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 12 + (v7 ^ 336);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 13 + (v8 ^ 337);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 1 + (v9 ^ 338);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 2 + (v10 ^ 339);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 3 + (v11 ^ 340);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 4 + (v12 ^ 341);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 5 + (v13 ^ 342);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 6 + (v14 ^ 343);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 7 + (v15 ^ 344);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 8 + (v0 ^ 345);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 9 + (v1 ^ 346);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 10 + (v2 ^ 347);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 11 + (v3 ^ 348);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 12 + (v4 ^ 349);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 13 + (v5 ^ 350);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 1 + (v6 ^ 351);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 2 + (v7 ^ 352);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 3 + (v8 ^ 353);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 4 + (v9 ^ 354);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 5 + (v10 ^ 355);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 6 + (v11 ^ 356);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 7 + (v12 ^ 357);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 8 + (v13 ^ 358);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 9 + (v14 ^ 359);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 10 + (v15 ^ 360);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 11 + (v0 ^ 361);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 12 + (v1 ^ 362);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 13 + (v2 ^ 363);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 1 + (v3 ^ 364);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 2 + (v4 ^ 365);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 3 + (v5 ^ 366);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 4 + (v6 ^ 367);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 5 + (v7 ^ 368);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 6 + (v8 ^ 369);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 7 + (v9 ^ 370);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 8 + (v10 ^ 371);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 9 + (v11 ^ 372);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 10 + (v12 ^ 373);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 11 + (v13 ^ 374);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 12 + (v14 ^ 375);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 13 + (v15 ^ 376);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 1 + (v0 ^ 377);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 2 + (v1 ^ 378);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 3 + (v2 ^ 379);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 4 + (v3 ^ 380);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 5 + (v4 ^ 381);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 6 + (v5 ^ 382);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 7 + (v6 ^ 383);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 8 + (v7 ^ 384);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 9 + (v8 ^ 385);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 10 + (v9 ^ 386);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 11 + (v10 ^ 387);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 12 + (v11 ^ 388);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 13 + (v12 ^ 389);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 1 + (v13 ^ 390);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 2 + (v14 ^ 391);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 3 + (v15 ^ 392);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 4 + (v0 ^ 393);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 5 + (v1 ^ 394);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 6 + (v2 ^ 395);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 7 + (v3 ^ 396);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 8 + (v4 ^ 397);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 9 + (v5 ^ 398);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 10 + (v6 ^ 399);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 11 + (v7 ^ 400);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 12 + (v8 ^ 401);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 13 + (v9 ^ 402);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 1 + (v10 ^ 403);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 2 + (v11 ^ 404);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 3 + (v12 ^ 405);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 4 + (v13 ^ 406);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 5 + (v14 ^ 407);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 6 + (v15 ^ 408);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 7 + (v0 ^ 409);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 8 + (v1 ^ 410);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 9 + (v2 ^ 411);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 10 + (v3 ^ 412);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 11 + (v4 ^ 413);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 12 + (v5 ^ 414);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 13 + (v6 ^ 415);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 1 + (v7 ^ 416);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 2 + (v8 ^ 417);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 3 + (v9 ^ 418);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 4 + (v10 ^ 419);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 5 + (v11 ^ 420);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 6 + (v12 ^ 421);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 7 + (v13 ^ 422);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 8 + (v14 ^ 423);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 9 + (v15 ^ 424);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 10 + (v0 ^ 425);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 11 + (v1 ^ 426);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 12 + (v2 ^ 427);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 13 + (v3 ^ 428);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 1 + (v4 ^ 429);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 2 + (v5 ^ 430);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 3 + (v6 ^ 431);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 4 + (v7 ^ 432);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 5 + (v8 ^ 433);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 6 + (v9 ^ 434);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 7 + (v10 ^ 435);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 8 + (v11 ^ 436);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 9 + (v12 ^ 437);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 10 + (v13 ^ 438);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 11 + (v14 ^ 439);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 12 + (v15 ^ 440);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 13 + (v0 ^ 441);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 1 + (v1 ^ 442);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 2 + (v2 ^ 443);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 3 + (v3 ^ 444);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 4 + (v4 ^ 445);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 5 + (v5 ^ 446);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 6 + (v6 ^ 447);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 7 + (v7 ^ 448);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 8 + (v8 ^ 449);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 9 + (v9 ^ 450);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 10 + (v10 ^ 451);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 11 + (v11 ^ 452);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 12 + (v12 ^ 453);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 13 + (v13 ^ 454);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 1 + (v14 ^ 455);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 2 + (v15 ^ 456);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 3 + (v0 ^ 457);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 4 + (v1 ^ 458);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 5 + (v2 ^ 459);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 6 + (v3 ^ 460);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 7 + (v4 ^ 461);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 8 + (v5 ^ 462);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 9 + (v6 ^ 463);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 10 + (v7 ^ 464);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 11 + (v8 ^ 465);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 12 + (v9 ^ 466);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 13 + (v10 ^ 467);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 1 + (v11 ^ 468);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 2 + (v12 ^ 469);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 3 + (v13 ^ 470);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 4 + (v14 ^ 471);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 5 + (v15 ^ 472);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 6 + (v0 ^ 473);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 7 + (v1 ^ 474);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 8 + (v2 ^ 475);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 9 + (v3 ^ 476);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 10 + (v4 ^ 477);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 11 + (v5 ^ 478);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 12 + (v6 ^ 479);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 13 + (v7 ^ 480);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 1 + (v8 ^ 481);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 2 + (v9 ^ 482);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 3 + (v10 ^ 483);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 4 + (v11 ^ 484);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 5 + (v12 ^ 485);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 6 + (v13 ^ 486);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 7 + (v14 ^ 487);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 8 + (v15 ^ 488);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 9 + (v0 ^ 489);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 10 + (v1 ^ 490);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 11 + (v2 ^ 491);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 12 + (v3 ^ 492);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 13 + (v4 ^ 493);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 1 + (v5 ^ 494);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 2 + (v6 ^ 495);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 3 + (v7 ^ 496);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 4 + (v8 ^ 497);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 5 + (v9 ^ 498);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 6 + (v10 ^ 499);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 7 + (v11 ^ 500);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 8 + (v12 ^ 501);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 9 + (v13 ^ 502);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 10 + (v14 ^ 503);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 11 + (v15 ^ 504);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 12 + (v0 ^ 505);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 13 + (v1 ^ 506);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 1 + (v2 ^ 507);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 2 + (v3 ^ 508);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 3 + (v4 ^ 509);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 4 + (v5 ^ 510);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 5 + (v6 ^ 511);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 6 + (v7 ^ 512);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 7 + (v8 ^ 513);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 8 + (v9 ^ 514);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 9 + (v10 ^ 515);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 10 + (v11 ^ 516);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 11 + (v12 ^ 517);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 12 + (v13 ^ 518);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 13 + (v14 ^ 519);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 1 + (v15 ^ 520);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 2 + (v0 ^ 521);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 3 + (v1 ^ 522);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 4 + (v2 ^ 523);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 5 + (v3 ^ 524);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 6 + (v4 ^ 525);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 7 + (v5 ^ 526);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 8 + (v6 ^ 527);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 9 + (v7 ^ 528);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 10 + (v8 ^ 529);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 11 + (v9 ^ 530);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 12 + (v10 ^ 531);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 13 + (v11 ^ 532);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 1 + (v12 ^ 533);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 2 + (v13 ^ 534);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 3 + (v14 ^ 535);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 4 + (v15 ^ 536);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 5 + (v0 ^ 537);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 6 + (v1 ^ 538);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 7 + (v2 ^ 539);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 8 + (v3 ^ 540);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 9 + (v4 ^ 541);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 10 + (v5 ^ 542);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 11 + (v6 ^ 543);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 12 + (v7 ^ 544);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 13 + (v8 ^ 545);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 1 + (v9 ^ 546);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 2 + (v10 ^ 547);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 3 + (v11 ^ 548);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 4 + (v12 ^ 549);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 5 + (v13 ^ 550);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 6 + (v14 ^ 551);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 7 + (v15 ^ 552);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 8 + (v0 ^ 553);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 9 + (v1 ^ 554);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 10 + (v2 ^ 555);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 11 + (v3 ^ 556);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 12 + (v4 ^ 557);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 13 + (v5 ^ 558);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 1 + (v6 ^ 559);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 2 + (v7 ^ 560);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 3 + (v8 ^ 561);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 4 + (v9 ^ 562);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 5 + (v10 ^ 563);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 6 + (v11 ^ 564);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 7 + (v12 ^ 565);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 8 + (v13 ^ 566);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 9 + (v14 ^ 567);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 10 + (v15 ^ 568);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 11 + (v0 ^ 569);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 12 + (v1 ^ 570);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 13 + (v2 ^ 571);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 1 + (v3 ^ 572);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 2 + (v4 ^ 573);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 3 + (v5 ^ 574);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 4 + (v6 ^ 575);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 5 + (v7 ^ 576);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 6 + (v8 ^ 577);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 7 + (v9 ^ 578);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 8 + (v10 ^ 579);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 9 + (v11 ^ 580);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 10 + (v12 ^ 581);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 11 + (v13 ^ 582);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 12 + (v14 ^ 583);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 13 + (v15 ^ 584);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 1 + (v0 ^ 585);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 2 + (v1 ^ 586);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 3 + (v2 ^ 587);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 4 + (v3 ^ 588);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 5 + (v4 ^ 589);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 6 + (v5 ^ 590);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 7 + (v6 ^ 591);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 8 + (v7 ^ 592);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 9 + (v8 ^ 593);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 10 + (v9 ^ 594);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 11 + (v10 ^ 595);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 12 + (v11 ^ 596);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 13 + (v12 ^ 597);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 1 + (v13 ^ 598);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 2 + (v14 ^ 599);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 3 + (v15 ^ 600);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 4 + (v0 ^ 601);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 5 + (v1 ^ 602);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 6 + (v2 ^ 603);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 7 + (v3 ^ 604);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 8 + (v4 ^ 605);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 9 + (v5 ^ 606);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 10 + (v6 ^ 607);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 11 + (v7 ^ 608);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 12 + (v8 ^ 609);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 13 + (v9 ^ 610);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 1 + (v10 ^ 611);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 2 + (v11 ^ 612);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 3 + (v12 ^ 613);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 4 + (v13 ^ 614);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 5 + (v14 ^ 615);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 6 + (v15 ^ 616);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 7 + (v0 ^ 617);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 8 + (v1 ^ 618);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 9 + (v2 ^ 619);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 10 + (v3 ^ 620);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 11 + (v4 ^ 621);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 12 + (v5 ^ 622);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 13 + (v6 ^ 623);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 1 + (v7 ^ 624);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 2 + (v8 ^ 625);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 3 + (v9 ^ 626);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 4 + (v10 ^ 627);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 5 + (v11 ^ 628);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 6 + (v12 ^ 629);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 7 + (v13 ^ 630);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 8 + (v14 ^ 631);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 9 + (v15 ^ 632);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 10 + (v0 ^ 633);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 11 + (v1 ^ 634);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 12 + (v2 ^ 635);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 13 + (v3 ^ 636);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 1 + (v4 ^ 637);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 2 + (v5 ^ 638);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 3 + (v6 ^ 639);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 4 + (v7 ^ 640);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 5 + (v8 ^ 641);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 6 + (v9 ^ 642);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 7 + (v10 ^ 643);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 8 + (v11 ^ 644);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 9 + (v12 ^ 645);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 10 + (v13 ^ 646);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 11 + (v14 ^ 647);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 12 + (v15 ^ 648);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 13 + (v0 ^ 649);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 1 + (v1 ^ 650);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 2 + (v2 ^ 651);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 3 + (v3 ^ 652);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 4 + (v4 ^ 653);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 5 + (v5 ^ 654);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 6 + (v6 ^ 655);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 7 + (v7 ^ 656);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 8 + (v8 ^ 657);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 9 + (v9 ^ 658);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 10 + (v10 ^ 659);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 11 + (v11 ^ 660);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 12 + (v12 ^ 661);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 13 + (v13 ^ 662);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 1 + (v14 ^ 663);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 2 + (v15 ^ 664);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 3 + (v0 ^ 665);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 4 + (v1 ^ 666);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 5 + (v2 ^ 667);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 6 + (v3 ^ 668);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 7 + (v4 ^ 669);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 8 + (v5 ^ 670);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 9 + (v6 ^ 671);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 10 + (v7 ^ 672);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 11 + (v8 ^ 673);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 12 + (v9 ^ 674);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 13 + (v10 ^ 675);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 1 + (v11 ^ 676);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 2 + (v12 ^ 677);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 3 + (v13 ^ 678);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 4 + (v14 ^ 679);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 5 + (v15 ^ 680);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 6 + (v0 ^ 681);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 7 + (v1 ^ 682);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 8 + (v2 ^ 683);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 9 + (v3 ^ 684);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 10 + (v4 ^ 685);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 11 + (v5 ^ 686);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 12 + (v6 ^ 687);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 13 + (v7 ^ 688);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 1 + (v8 ^ 689);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 2 + (v9 ^ 690);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 3 + (v10 ^ 691);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 4 + (v11 ^ 692);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 5 + (v12 ^ 693);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 6 + (v13 ^ 694);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 7 + (v14 ^ 695);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 8 + (v15 ^ 696);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 9 + (v0 ^ 697);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 10 + (v1 ^ 698);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 11 + (v2 ^ 699);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 12 + (v3 ^ 700);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 13 + (v4 ^ 701);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 1 + (v5 ^ 702);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 2 + (v6 ^ 703);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 3 + (v7 ^ 704);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 4 + (v8 ^ 705);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 5 + (v9 ^ 706);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 6 + (v10 ^ 707);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 7 + (v11 ^ 708);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 8 + (v12 ^ 709);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 9 + (v13 ^ 710);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 10 + (v14 ^ 711);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 11 + (v15 ^ 712);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 12 + (v0 ^ 713);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 13 + (v1 ^ 714);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 1 + (v2 ^ 715);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 2 + (v3 ^ 716);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 3 + (v4 ^ 717);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 4 + (v5 ^ 718);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 5 + (v6 ^ 719);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 6 + (v7 ^ 720);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 7 + (v8 ^ 721);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 8 + (v9 ^ 722);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 9 + (v10 ^ 723);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 10 + (v11 ^ 724);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 11 + (v12 ^ 725);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 12 + (v13 ^ 726);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 13 + (v14 ^ 727);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 1 + (v15 ^ 728);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 2 + (v0 ^ 729);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 3 + (v1 ^ 730);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 4 + (v2 ^ 731);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 5 + (v3 ^ 732);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 6 + (v4 ^ 733);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 7 + (v5 ^ 734);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 8 + (v6 ^ 735);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 9 + (v7 ^ 736);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 10 + (v8 ^ 737);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 11 + (v9 ^ 738);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 12 + (v10 ^ 739);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 13 + (v11 ^ 740);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 1 + (v12 ^ 741);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 2 + (v13 ^ 742);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 3 + (v14 ^ 743);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 4 + (v15 ^ 744);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 5 + (v0 ^ 745);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 6 + (v1 ^ 746);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 7 + (v2 ^ 747);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 8 + (v3 ^ 748);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 9 + (v4 ^ 749);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 10 + (v5 ^ 750);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 11 + (v6 ^ 751);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 12 + (v7 ^ 752);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 13 + (v8 ^ 753);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 1 + (v9 ^ 754);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 2 + (v10 ^ 755);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 3 + (v11 ^ 756);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 4 + (v12 ^ 757);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 5 + (v13 ^ 758);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 6 + (v14 ^ 759);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 7 + (v15 ^ 760);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 8 + (v0 ^ 761);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 9 + (v1 ^ 762);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 10 + (v2 ^ 763);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 11 + (v3 ^ 764);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 12 + (v4 ^ 765);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 13 + (v5 ^ 766);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 1 + (v6 ^ 767);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 2 + (v7 ^ 768);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 3 + (v8 ^ 769);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 4 + (v9 ^ 770);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 5 + (v10 ^ 771);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 6 + (v11 ^ 772);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 7 + (v12 ^ 773);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 8 + (v13 ^ 774);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 9 + (v14 ^ 775);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 10 + (v15 ^ 776);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 11 + (v0 ^ 777);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 12 + (v1 ^ 778);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 13 + (v2 ^ 779);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 1 + (v3 ^ 780);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 2 + (v4 ^ 781);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 3 + (v5 ^ 782);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 4 + (v6 ^ 783);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 5 + (v7 ^ 784);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 6 + (v8 ^ 785);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 7 + (v9 ^ 786);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 8 + (v10 ^ 787);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 9 + (v11 ^ 788);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 10 + (v12 ^ 789);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 11 + (v13 ^ 790);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 12 + (v14 ^ 791);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 13 + (v15 ^ 792);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 1 + (v0 ^ 793);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 2 + (v1 ^ 794);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 3 + (v2 ^ 795);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 4 + (v3 ^ 796);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 5 + (v4 ^ 797);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 6 + (v5 ^ 798);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 7 + (v6 ^ 799);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 8 + (v7 ^ 800);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 9 + (v8 ^ 801);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 10 + (v9 ^ 802);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 11 + (v10 ^ 803);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 12 + (v11 ^ 804);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 13 + (v12 ^ 805);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 1 + (v13 ^ 806);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 2 + (v14 ^ 807);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 3 + (v15 ^ 808);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 4 + (v0 ^ 809);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 5 + (v1 ^ 810);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 6 + (v2 ^ 811);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 7 + (v3 ^ 812);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 8 + (v4 ^ 813);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 9 + (v5 ^ 814);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 10 + (v6 ^ 815);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 11 + (v7 ^ 816);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 12 + (v8 ^ 817);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 13 + (v9 ^ 818);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 1 + (v10 ^ 819);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 2 + (v11 ^ 820);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 3 + (v12 ^ 821);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 4 + (v13 ^ 822);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 5 + (v14 ^ 823);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 6 + (v15 ^ 824);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 7 + (v0 ^ 825);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 8 + (v1 ^ 826);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 9 + (v2 ^ 827);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 10 + (v3 ^ 828);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 11 + (v4 ^ 829);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 12 + (v5 ^ 830);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 13 + (v6 ^ 831);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 1 + (v7 ^ 832);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 2 + (v8 ^ 833);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 3 + (v9 ^ 834);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 4 + (v10 ^ 835);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 5 + (v11 ^ 836);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 6 + (v12 ^ 837);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 7 + (v13 ^ 838);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 8 + (v14 ^ 839);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 9 + (v15 ^ 840);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 10 + (v0 ^ 841);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 11 + (v1 ^ 842);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 12 + (v2 ^ 843);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 13 + (v3 ^ 844);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 1 + (v4 ^ 845);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 2 + (v5 ^ 846);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 3 + (v6 ^ 847);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 4 + (v7 ^ 848);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 5 + (v8 ^ 849);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 6 + (v9 ^ 850);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 7 + (v10 ^ 851);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 8 + (v11 ^ 852);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 9 + (v12 ^ 853);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 10 + (v13 ^ 854);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 11 + (v14 ^ 855);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 12 + (v15 ^ 856);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 13 + (v0 ^ 857);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 1 + (v1 ^ 858);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 2 + (v2 ^ 859);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 3 + (v3 ^ 860);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 4 + (v4 ^ 861);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 5 + (v5 ^ 862);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 6 + (v6 ^ 863);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 7 + (v7 ^ 864);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 8 + (v8 ^ 865);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 9 + (v9 ^ 866);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 10 + (v10 ^ 867);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 11 + (v11 ^ 868);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 12 + (v12 ^ 869);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 13 + (v13 ^ 870);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 1 + (v14 ^ 871);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 2 + (v15 ^ 872);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 3 + (v0 ^ 873);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 4 + (v1 ^ 874);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 5 + (v2 ^ 875);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 6 + (v3 ^ 876);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 7 + (v4 ^ 877);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 8 + (v5 ^ 878);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 9 + (v6 ^ 879);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 10 + (v7 ^ 880);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 11 + (v8 ^ 881);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 12 + (v9 ^ 882);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 13 + (v10 ^ 883);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 1 + (v11 ^ 884);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 2 + (v12 ^ 885);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 3 + (v13 ^ 886);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 4 + (v14 ^ 887);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 5 + (v15 ^ 888);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 6 + (v0 ^ 889);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 7 + (v1 ^ 890);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 8 + (v2 ^ 891);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 9 + (v3 ^ 892);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 10 + (v4 ^ 893);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 11 + (v5 ^ 894);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 12 + (v6 ^ 895);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 13 + (v7 ^ 896);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 1 + (v8 ^ 897);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 2 + (v9 ^ 898);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 3 + (v10 ^ 899);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 4 + (v11 ^ 900);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 5 + (v12 ^ 901);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 6 + (v13 ^ 902);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 7 + (v14 ^ 903);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 8 + (v15 ^ 904);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 9 + (v0 ^ 905);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 10 + (v1 ^ 906);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 11 + (v2 ^ 907);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 12 + (v3 ^ 908);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 13 + (v4 ^ 909);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 1 + (v5 ^ 910);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 2 + (v6 ^ 911);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 3 + (v7 ^ 912);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 4 + (v8 ^ 913);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 5 + (v9 ^ 914);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 6 + (v10 ^ 915);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 7 + (v11 ^ 916);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 8 + (v12 ^ 917);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 9 + (v13 ^ 918);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 10 + (v14 ^ 919);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 11 + (v15 ^ 920);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 12 + (v0 ^ 921);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 13 + (v1 ^ 922);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 1 + (v2 ^ 923);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 2 + (v3 ^ 924);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 3 + (v4 ^ 925);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 4 + (v5 ^ 926);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 5 + (v6 ^ 927);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 6 + (v7 ^ 928);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 7 + (v8 ^ 929);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 8 + (v9 ^ 930);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 9 + (v10 ^ 931);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 10 + (v11 ^ 932);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 11 + (v12 ^ 933);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 12 + (v13 ^ 934);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 13 + (v14 ^ 935);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 1 + (v15 ^ 936);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 2 + (v0 ^ 937);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 3 + (v1 ^ 938);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 4 + (v2 ^ 939);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 5 + (v3 ^ 940);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 6 + (v4 ^ 941);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 7 + (v5 ^ 942);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 8 + (v6 ^ 943);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 9 + (v7 ^ 944);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 10 + (v8 ^ 945);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 11 + (v9 ^ 946);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 12 + (v10 ^ 947);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 13 + (v11 ^ 948);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 1 + (v12 ^ 949);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 2 + (v13 ^ 950);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 3 + (v14 ^ 951);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 4 + (v15 ^ 952);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 5 + (v0 ^ 953);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 6 + (v1 ^ 954);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 7 + (v2 ^ 955);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 8 + (v3 ^ 956);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 9 + (v4 ^ 957);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 10 + (v5 ^ 958);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 11 + (v6 ^ 959);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 12 + (v7 ^ 960);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 13 + (v8 ^ 961);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 1 + (v9 ^ 962);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 2 + (v10 ^ 963);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 3 + (v11 ^ 964);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 4 + (v12 ^ 965);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 5 + (v13 ^ 966);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 6 + (v14 ^ 967);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 7 + (v15 ^ 968);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 8 + (v0 ^ 969);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 9 + (v1 ^ 970);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 10 + (v2 ^ 971);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 11 + (v3 ^ 972);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 12 + (v4 ^ 973);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 13 + (v5 ^ 974);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 1 + (v6 ^ 975);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 2 + (v7 ^ 976);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 3 + (v8 ^ 977);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 4 + (v9 ^ 978);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 5 + (v10 ^ 979);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 6 + (v11 ^ 980);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 7 + (v12 ^ 981);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 8 + (v13 ^ 982);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 9 + (v14 ^ 983);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 10 + (v15 ^ 984);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 11 + (v0 ^ 985);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 12 + (v1 ^ 986);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 13 + (v2 ^ 987);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 1 + (v3 ^ 988);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 2 + (v4 ^ 989);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 3 + (v5 ^ 990);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 4 + (v6 ^ 991);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 5 + (v7 ^ 992);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 6 + (v8 ^ 993);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 7 + (v9 ^ 994);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 8 + (v10 ^ 995);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 9 + (v11 ^ 996);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 10 + (v12 ^ 997);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 11 + (v13 ^ 998);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 12 + (v14 ^ 999);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 13 + (v15 ^ 1000);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 1 + (v0 ^ 1001);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 2 + (v1 ^ 1002);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 3 + (v2 ^ 1003);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 4 + (v3 ^ 1004);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 5 + (v4 ^ 1005);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 6 + (v5 ^ 1006);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 7 + (v6 ^ 1007);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 8 + (v7 ^ 1008);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 9 + (v8 ^ 1009);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 10 + (v9 ^ 1010);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 11 + (v10 ^ 1011);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 12 + (v11 ^ 1012);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 13 + (v12 ^ 1013);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 1 + (v13 ^ 1014);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 2 + (v14 ^ 1015);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 3 + (v15 ^ 1016);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 4 + (v0 ^ 1017);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 5 + (v1 ^ 1018);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 6 + (v2 ^ 1019);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 7 + (v3 ^ 1020);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 8 + (v4 ^ 1021);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 9 + (v5 ^ 1022);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 10 + (v6 ^ 1023);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 11 + (v7 ^ 1024);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 12 + (v8 ^ 1025);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 13 + (v9 ^ 1026);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 1 + (v10 ^ 1027);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 2 + (v11 ^ 1028);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 3 + (v12 ^ 1029);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 4 + (v13 ^ 1030);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 5 + (v14 ^ 1031);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 6 + (v15 ^ 1032);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 7 + (v0 ^ 1033);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 8 + (v1 ^ 1034);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 9 + (v2 ^ 1035);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 10 + (v3 ^ 1036);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 11 + (v4 ^ 1037);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 12 + (v5 ^ 1038);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 13 + (v6 ^ 1039);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 1 + (v7 ^ 1040);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 2 + (v8 ^ 1041);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 3 + (v9 ^ 1042);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 4 + (v10 ^ 1043);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 5 + (v11 ^ 1044);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 6 + (v12 ^ 1045);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 7 + (v13 ^ 1046);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 8 + (v14 ^ 1047);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 9 + (v15 ^ 1048);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 10 + (v0 ^ 1049);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 11 + (v1 ^ 1050);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 12 + (v2 ^ 1051);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 13 + (v3 ^ 1052);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 1 + (v4 ^ 1053);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 2 + (v5 ^ 1054);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 3 + (v6 ^ 1055);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 4 + (v7 ^ 1056);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 5 + (v8 ^ 1057);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 6 + (v9 ^ 1058);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 7 + (v10 ^ 1059);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 8 + (v11 ^ 1060);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 9 + (v12 ^ 1061);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 10 + (v13 ^ 1062);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 11 + (v14 ^ 1063);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 12 + (v15 ^ 1064);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 13 + (v0 ^ 1065);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 1 + (v1 ^ 1066);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 2 + (v2 ^ 1067);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 3 + (v3 ^ 1068);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 4 + (v4 ^ 1069);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 5 + (v5 ^ 1070);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 6 + (v6 ^ 1071);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 7 + (v7 ^ 1072);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 8 + (v8 ^ 1073);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 9 + (v9 ^ 1074);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 10 + (v10 ^ 1075);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 11 + (v11 ^ 1076);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 12 + (v12 ^ 1077);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 13 + (v13 ^ 1078);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 1 + (v14 ^ 1079);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 2 + (v15 ^ 1080);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 3 + (v0 ^ 1081);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 4 + (v1 ^ 1082);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 5 + (v2 ^ 1083);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 6 + (v3 ^ 1084);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 7 + (v4 ^ 1085);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 8 + (v5 ^ 1086);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 9 + (v6 ^ 1087);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 10 + (v7 ^ 1088);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 11 + (v8 ^ 1089);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 12 + (v9 ^ 1090);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 13 + (v10 ^ 1091);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 1 + (v11 ^ 1092);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 2 + (v12 ^ 1093);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 3 + (v13 ^ 1094);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 4 + (v14 ^ 1095);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 5 + (v15 ^ 1096);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 6 + (v0 ^ 1097);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 7 + (v1 ^ 1098);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 8 + (v2 ^ 1099);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 9 + (v3 ^ 1100);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 10 + (v4 ^ 1101);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 11 + (v5 ^ 1102);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 12 + (v6 ^ 1103);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 13 + (v7 ^ 1104);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 1 + (v8 ^ 1105);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 2 + (v9 ^ 1106);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 3 + (v10 ^ 1107);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 4 + (v11 ^ 1108);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 5 + (v12 ^ 1109);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 6 + (v13 ^ 1110);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 7 + (v14 ^ 1111);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 8 + (v15 ^ 1112);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 9 + (v0 ^ 1113);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 10 + (v1 ^ 1114);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 11 + (v2 ^ 1115);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 12 + (v3 ^ 1116);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 13 + (v4 ^ 1117);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 1 + (v5 ^ 1118);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 2 + (v6 ^ 1119);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 3 + (v7 ^ 1120);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 4 + (v8 ^ 1121);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 5 + (v9 ^ 1122);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 6 + (v10 ^ 1123);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 7 + (v11 ^ 1124);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 8 + (v12 ^ 1125);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 9 + (v13 ^ 1126);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 10 + (v14 ^ 1127);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 11 + (v15 ^ 1128);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 12 + (v0 ^ 1129);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 13 + (v1 ^ 1130);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 1 + (v2 ^ 1131);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 2 + (v3 ^ 1132);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 3 + (v4 ^ 1133);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 4 + (v5 ^ 1134);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 5 + (v6 ^ 1135);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 6 + (v7 ^ 1136);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 7 + (v8 ^ 1137);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 8 + (v9 ^ 1138);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 9 + (v10 ^ 1139);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 10 + (v11 ^ 1140);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 11 + (v12 ^ 1141);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 12 + (v13 ^ 1142);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 13 + (v14 ^ 1143);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 1 + (v15 ^ 1144);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 2 + (v0 ^ 1145);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 3 + (v1 ^ 1146);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 4 + (v2 ^ 1147);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 5 + (v3 ^ 1148);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 6 + (v4 ^ 1149);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 7 + (v5 ^ 1150);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 8 + (v6 ^ 1151);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 9 + (v7 ^ 1152);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 10 + (v8 ^ 1153);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 11 + (v9 ^ 1154);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 12 + (v10 ^ 1155);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 13 + (v11 ^ 1156);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 1 + (v12 ^ 1157);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 2 + (v13 ^ 1158);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 3 + (v14 ^ 1159);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 4 + (v15 ^ 1160);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 5 + (v0 ^ 1161);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 6 + (v1 ^ 1162);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 7 + (v2 ^ 1163);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 8 + (v3 ^ 1164);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 9 + (v4 ^ 1165);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 10 + (v5 ^ 1166);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 11 + (v6 ^ 1167);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 12 + (v7 ^ 1168);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 13 + (v8 ^ 1169);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 1 + (v9 ^ 1170);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 2 + (v10 ^ 1171);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 3 + (v11 ^ 1172);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 4 + (v12 ^ 1173);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 5 + (v13 ^ 1174);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 6 + (v14 ^ 1175);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 7 + (v15 ^ 1176);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 8 + (v0 ^ 1177);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 9 + (v1 ^ 1178);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 10 + (v2 ^ 1179);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 11 + (v3 ^ 1180);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 12 + (v4 ^ 1181);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 13 + (v5 ^ 1182);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 1 + (v6 ^ 1183);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 2 + (v7 ^ 1184);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 3 + (v8 ^ 1185);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 4 + (v9 ^ 1186);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 5 + (v10 ^ 1187);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 6 + (v11 ^ 1188);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 7 + (v12 ^ 1189);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 8 + (v13 ^ 1190);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 9 + (v14 ^ 1191);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 10 + (v15 ^ 1192);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 11 + (v0 ^ 1193);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 12 + (v1 ^ 1194);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 13 + (v2 ^ 1195);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 1 + (v3 ^ 1196);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 2 + (v4 ^ 1197);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 3 + (v5 ^ 1198);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 4 + (v6 ^ 1199);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 5 + (v7 ^ 1200);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 6 + (v8 ^ 1201);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 7 + (v9 ^ 1202);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 8 + (v10 ^ 1203);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 9 + (v11 ^ 1204);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 10 + (v12 ^ 1205);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 11 + (v13 ^ 1206);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 12 + (v14 ^ 1207);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 13 + (v15 ^ 1208);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 1 + (v0 ^ 1209);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 2 + (v1 ^ 1210);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 3 + (v2 ^ 1211);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 4 + (v3 ^ 1212);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 5 + (v4 ^ 1213);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 6 + (v5 ^ 1214);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 7 + (v6 ^ 1215);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 8 + (v7 ^ 1216);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 9 + (v8 ^ 1217);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 10 + (v9 ^ 1218);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 11 + (v10 ^ 1219);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 12 + (v11 ^ 1220);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 13 + (v12 ^ 1221);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 1 + (v13 ^ 1222);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 2 + (v14 ^ 1223);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 3 + (v15 ^ 1224);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 4 + (v0 ^ 1225);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 5 + (v1 ^ 1226);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 6 + (v2 ^ 1227);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 7 + (v3 ^ 1228);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 8 + (v4 ^ 1229);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 9 + (v5 ^ 1230);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 10 + (v6 ^ 1231);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 11 + (v7 ^ 1232);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 12 + (v8 ^ 1233);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 13 + (v9 ^ 1234);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 1 + (v10 ^ 1235);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 2 + (v11 ^ 1236);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 3 + (v12 ^ 1237);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 4 + (v13 ^ 1238);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 5 + (v14 ^ 1239);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 6 + (v15 ^ 1240);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 7 + (v0 ^ 1241);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 8 + (v1 ^ 1242);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 9 + (v2 ^ 1243);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 10 + (v3 ^ 1244);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 11 + (v4 ^ 1245);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 12 + (v5 ^ 1246);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 13 + (v6 ^ 1247);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 1 + (v7 ^ 1248);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 2 + (v8 ^ 1249);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 3 + (v9 ^ 1250);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 4 + (v10 ^ 1251);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 5 + (v11 ^ 1252);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 6 + (v12 ^ 1253);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 7 + (v13 ^ 1254);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 8 + (v14 ^ 1255);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 9 + (v15 ^ 1256);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 10 + (v0 ^ 1257);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 11 + (v1 ^ 1258);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 12 + (v2 ^ 1259);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 13 + (v3 ^ 1260);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 1 + (v4 ^ 1261);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 2 + (v5 ^ 1262);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 3 + (v6 ^ 1263);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 4 + (v7 ^ 1264);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 5 + (v8 ^ 1265);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 6 + (v9 ^ 1266);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 7 + (v10 ^ 1267);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 8 + (v11 ^ 1268);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 9 + (v12 ^ 1269);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 10 + (v13 ^ 1270);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 11 + (v14 ^ 1271);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 12 + (v15 ^ 1272);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 13 + (v0 ^ 1273);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 1 + (v1 ^ 1274);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 2 + (v2 ^ 1275);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 3 + (v3 ^ 1276);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 4 + (v4 ^ 1277);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 5 + (v5 ^ 1278);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 6 + (v6 ^ 1279);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 7 + (v7 ^ 1280);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 8 + (v8 ^ 1281);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 9 + (v9 ^ 1282);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 10 + (v10 ^ 1283);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 11 + (v11 ^ 1284);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 12 + (v12 ^ 1285);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 13 + (v13 ^ 1286);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 1 + (v14 ^ 1287);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 2 + (v15 ^ 1288);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 3 + (v0 ^ 1289);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 4 + (v1 ^ 1290);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 5 + (v2 ^ 1291);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 6 + (v3 ^ 1292);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 7 + (v4 ^ 1293);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 8 + (v5 ^ 1294);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 9 + (v6 ^ 1295);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 10 + (v7 ^ 1296);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 11 + (v8 ^ 1297);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 12 + (v9 ^ 1298);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 13 + (v10 ^ 1299);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 1 + (v11 ^ 1300);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 2 + (v12 ^ 1301);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 3 + (v13 ^ 1302);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 4 + (v14 ^ 1303);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 5 + (v15 ^ 1304);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 6 + (v0 ^ 1305);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 7 + (v1 ^ 1306);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 8 + (v2 ^ 1307);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 9 + (v3 ^ 1308);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 10 + (v4 ^ 1309);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 11 + (v5 ^ 1310);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 12 + (v6 ^ 1311);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 13 + (v7 ^ 1312);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 1 + (v8 ^ 1313);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 2 + (v9 ^ 1314);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 3 + (v10 ^ 1315);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 4 + (v11 ^ 1316);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 5 + (v12 ^ 1317);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 6 + (v13 ^ 1318);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 7 + (v14 ^ 1319);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 8 + (v15 ^ 1320);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 9 + (v0 ^ 1321);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 10 + (v1 ^ 1322);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 11 + (v2 ^ 1323);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 12 + (v3 ^ 1324);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 13 + (v4 ^ 1325);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 1 + (v5 ^ 1326);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 2 + (v6 ^ 1327);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 3 + (v7 ^ 1328);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 4 + (v8 ^ 1329);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 5 + (v9 ^ 1330);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 6 + (v10 ^ 1331);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 7 + (v11 ^ 1332);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 8 + (v12 ^ 1333);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 9 + (v13 ^ 1334);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 10 + (v14 ^ 1335);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 11 + (v15 ^ 1336);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 12 + (v0 ^ 1337);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 13 + (v1 ^ 1338);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 1 + (v2 ^ 1339);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 2 + (v3 ^ 1340);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 3 + (v4 ^ 1341);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 4 + (v5 ^ 1342);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 5 + (v6 ^ 1343);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 6 + (v7 ^ 1344);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 7 + (v8 ^ 1345);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 8 + (v9 ^ 1346);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 9 + (v10 ^ 1347);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 10 + (v11 ^ 1348);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 11 + (v12 ^ 1349);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 12 + (v13 ^ 1350);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 13 + (v14 ^ 1351);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 1 + (v15 ^ 1352);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 2 + (v0 ^ 1353);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 3 + (v1 ^ 1354);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 4 + (v2 ^ 1355);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 5 + (v3 ^ 1356);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 6 + (v4 ^ 1357);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 7 + (v5 ^ 1358);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 8 + (v6 ^ 1359);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 9 + (v7 ^ 1360);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 10 + (v8 ^ 1361);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 11 + (v9 ^ 1362);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 12 + (v10 ^ 1363);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 13 + (v11 ^ 1364);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 1 + (v12 ^ 1365);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 2 + (v13 ^ 1366);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 3 + (v14 ^ 1367);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 4 + (v15 ^ 1368);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 5 + (v0 ^ 1369);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 6 + (v1 ^ 1370);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 7 + (v2 ^ 1371);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 8 + (v3 ^ 1372);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 9 + (v4 ^ 1373);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 10 + (v5 ^ 1374);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 11 + (v6 ^ 1375);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 12 + (v7 ^ 1376);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 13 + (v8 ^ 1377);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 1 + (v9 ^ 1378);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 2 + (v10 ^ 1379);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 3 + (v11 ^ 1380);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 4 + (v12 ^ 1381);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 5 + (v13 ^ 1382);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 6 + (v14 ^ 1383);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 7 + (v15 ^ 1384);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 8 + (v0 ^ 1385);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 9 + (v1 ^ 1386);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 10 + (v2 ^ 1387);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 11 + (v3 ^ 1388);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 12 + (v4 ^ 1389);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 13 + (v5 ^ 1390);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 1 + (v6 ^ 1391);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 2 + (v7 ^ 1392);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 3 + (v8 ^ 1393);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 4 + (v9 ^ 1394);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 5 + (v10 ^ 1395);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 6 + (v11 ^ 1396);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 7 + (v12 ^ 1397);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 8 + (v13 ^ 1398);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 9 + (v14 ^ 1399);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 10 + (v15 ^ 1400);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 11 + (v0 ^ 1401);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 12 + (v1 ^ 1402);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 13 + (v2 ^ 1403);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 1 + (v3 ^ 1404);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 2 + (v4 ^ 1405);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 3 + (v5 ^ 1406);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 4 + (v6 ^ 1407);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 5 + (v7 ^ 1408);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 6 + (v8 ^ 1409);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 7 + (v9 ^ 1410);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 8 + (v10 ^ 1411);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 9 + (v11 ^ 1412);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 10 + (v12 ^ 1413);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 11 + (v13 ^ 1414);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 12 + (v14 ^ 1415);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 13 + (v15 ^ 1416);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 1 + (v0 ^ 1417);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 2 + (v1 ^ 1418);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 3 + (v2 ^ 1419);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 4 + (v3 ^ 1420);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 5 + (v4 ^ 1421);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 6 + (v5 ^ 1422);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 7 + (v6 ^ 1423);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 8 + (v7 ^ 1424);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 9 + (v8 ^ 1425);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 10 + (v9 ^ 1426);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 11 + (v10 ^ 1427);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 12 + (v11 ^ 1428);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 13 + (v12 ^ 1429);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 1 + (v13 ^ 1430);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 2 + (v14 ^ 1431);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 3 + (v15 ^ 1432);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 4 + (v0 ^ 1433);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 5 + (v1 ^ 1434);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 6 + (v2 ^ 1435);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 7 + (v3 ^ 1436);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 8 + (v4 ^ 1437);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 9 + (v5 ^ 1438);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 10 + (v6 ^ 1439);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 11 + (v7 ^ 1440);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 12 + (v8 ^ 1441);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 13 + (v9 ^ 1442);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 1 + (v10 ^ 1443);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 2 + (v11 ^ 1444);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 3 + (v12 ^ 1445);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 4 + (v13 ^ 1446);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 5 + (v14 ^ 1447);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 6 + (v15 ^ 1448);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 7 + (v0 ^ 1449);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 8 + (v1 ^ 1450);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 9 + (v2 ^ 1451);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 10 + (v3 ^ 1452);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 11 + (v4 ^ 1453);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 12 + (v5 ^ 1454);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 13 + (v6 ^ 1455);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 1 + (v7 ^ 1456);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 2 + (v8 ^ 1457);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 3 + (v9 ^ 1458);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 4 + (v10 ^ 1459);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 5 + (v11 ^ 1460);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 6 + (v12 ^ 1461);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 7 + (v13 ^ 1462);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 8 + (v14 ^ 1463);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 9 + (v15 ^ 1464);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 10 + (v0 ^ 1465);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 11 + (v1 ^ 1466);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 12 + (v2 ^ 1467);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 13 + (v3 ^ 1468);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 1 + (v4 ^ 1469);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 2 + (v5 ^ 1470);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 3 + (v6 ^ 1471);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 4 + (v7 ^ 1472);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 5 + (v8 ^ 1473);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 6 + (v9 ^ 1474);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 7 + (v10 ^ 1475);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 8 + (v11 ^ 1476);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 9 + (v12 ^ 1477);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 10 + (v13 ^ 1478);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 11 + (v14 ^ 1479);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 12 + (v15 ^ 1480);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 13 + (v0 ^ 1481);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 1 + (v1 ^ 1482);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 2 + (v2 ^ 1483);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 3 + (v3 ^ 1484);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 4 + (v4 ^ 1485);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 5 + (v5 ^ 1486);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 6 + (v6 ^ 1487);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 7 + (v7 ^ 1488);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 8 + (v8 ^ 1489);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 9 + (v9 ^ 1490);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 10 + (v10 ^ 1491);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 11 + (v11 ^ 1492);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 12 + (v12 ^ 1493);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 13 + (v13 ^ 1494);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 1 + (v14 ^ 1495);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 2 + (v15 ^ 1496);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 3 + (v0 ^ 1497);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 4 + (v1 ^ 1498);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 5 + (v2 ^ 1499);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 6 + (v3 ^ 1500);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 7 + (v4 ^ 1501);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 8 + (v5 ^ 1502);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 9 + (v6 ^ 1503);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 10 + (v7 ^ 1504);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 11 + (v8 ^ 1505);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 12 + (v9 ^ 1506);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 13 + (v10 ^ 1507);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 1 + (v11 ^ 1508);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 2 + (v12 ^ 1509);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 3 + (v13 ^ 1510);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 4 + (v14 ^ 1511);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 5 + (v15 ^ 1512);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 6 + (v0 ^ 1513);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 7 + (v1 ^ 1514);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 8 + (v2 ^ 1515);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 9 + (v3 ^ 1516);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 10 + (v4 ^ 1517);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 11 + (v5 ^ 1518);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 12 + (v6 ^ 1519);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 13 + (v7 ^ 1520);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 1 + (v8 ^ 1521);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 2 + (v9 ^ 1522);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 3 + (v10 ^ 1523);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 4 + (v11 ^ 1524);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 5 + (v12 ^ 1525);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 6 + (v13 ^ 1526);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 7 + (v14 ^ 1527);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 8 + (v15 ^ 1528);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 9 + (v0 ^ 1529);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 10 + (v1 ^ 1530);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 11 + (v2 ^ 1531);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 12 + (v3 ^ 1532);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 13 + (v4 ^ 1533);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 1 + (v5 ^ 1534);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 2 + (v6 ^ 1535);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 3 + (v7 ^ 1536);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 4 + (v8 ^ 1537);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 5 + (v9 ^ 1538);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 6 + (v10 ^ 1539);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 7 + (v11 ^ 1540);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 8 + (v12 ^ 1541);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 9 + (v13 ^ 1542);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 10 + (v14 ^ 1543);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 11 + (v15 ^ 1544);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 12 + (v0 ^ 1545);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 13 + (v1 ^ 1546);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 1 + (v2 ^ 1547);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 2 + (v3 ^ 1548);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 3 + (v4 ^ 1549);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 4 + (v5 ^ 1550);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 5 + (v6 ^ 1551);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 6 + (v7 ^ 1552);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 7 + (v8 ^ 1553);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 8 + (v9 ^ 1554);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 9 + (v10 ^ 1555);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 10 + (v11 ^ 1556);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 11 + (v12 ^ 1557);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 12 + (v13 ^ 1558);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 13 + (v14 ^ 1559);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 1 + (v15 ^ 1560);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 2 + (v0 ^ 1561);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 3 + (v1 ^ 1562);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 4 + (v2 ^ 1563);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 5 + (v3 ^ 1564);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 6 + (v4 ^ 1565);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 7 + (v5 ^ 1566);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 8 + (v6 ^ 1567);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 9 + (v7 ^ 1568);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 10 + (v8 ^ 1569);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 11 + (v9 ^ 1570);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 12 + (v10 ^ 1571);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 13 + (v11 ^ 1572);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 1 + (v12 ^ 1573);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 2 + (v13 ^ 1574);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 3 + (v14 ^ 1575);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 4 + (v15 ^ 1576);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 5 + (v0 ^ 1577);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 6 + (v1 ^ 1578);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 7 + (v2 ^ 1579);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 8 + (v3 ^ 1580);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 9 + (v4 ^ 1581);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 10 + (v5 ^ 1582);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 11 + (v6 ^ 1583);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 12 + (v7 ^ 1584);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 13 + (v8 ^ 1585);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 1 + (v9 ^ 1586);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 2 + (v10 ^ 1587);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 3 + (v11 ^ 1588);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 4 + (v12 ^ 1589);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 5 + (v13 ^ 1590);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 6 + (v14 ^ 1591);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 7 + (v15 ^ 1592);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 8 + (v0 ^ 1593);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 9 + (v1 ^ 1594);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 10 + (v2 ^ 1595);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 11 + (v3 ^ 1596);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 12 + (v4 ^ 1597);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 13 + (v5 ^ 1598);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 1 + (v6 ^ 1599);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 2 + (v7 ^ 1600);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 3 + (v8 ^ 1601);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 4 + (v9 ^ 1602);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 5 + (v10 ^ 1603);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 6 + (v11 ^ 1604);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 7 + (v12 ^ 1605);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 8 + (v13 ^ 1606);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 9 + (v14 ^ 1607);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 10 + (v15 ^ 1608);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 11 + (v0 ^ 1609);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 12 + (v1 ^ 1610);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 13 + (v2 ^ 1611);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 1 + (v3 ^ 1612);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 2 + (v4 ^ 1613);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 3 + (v5 ^ 1614);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 4 + (v6 ^ 1615);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 5 + (v7 ^ 1616);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 6 + (v8 ^ 1617);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 7 + (v9 ^ 1618);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 8 + (v10 ^ 1619);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 9 + (v11 ^ 1620);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 10 + (v12 ^ 1621);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 11 + (v13 ^ 1622);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 12 + (v14 ^ 1623);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 13 + (v15 ^ 1624);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 1 + (v0 ^ 1625);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 2 + (v1 ^ 1626);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 3 + (v2 ^ 1627);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 4 + (v3 ^ 1628);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 5 + (v4 ^ 1629);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 6 + (v5 ^ 1630);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 7 + (v6 ^ 1631);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 8 + (v7 ^ 1632);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 9 + (v8 ^ 1633);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 10 + (v9 ^ 1634);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 11 + (v10 ^ 1635);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 12 + (v11 ^ 1636);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 13 + (v12 ^ 1637);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 1 + (v13 ^ 1638);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 2 + (v14 ^ 1639);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 3 + (v15 ^ 1640);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 4 + (v0 ^ 1641);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 5 + (v1 ^ 1642);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 6 + (v2 ^ 1643);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 7 + (v3 ^ 1644);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 8 + (v4 ^ 1645);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 9 + (v5 ^ 1646);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 10 + (v6 ^ 1647);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 11 + (v7 ^ 1648);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 12 + (v8 ^ 1649);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 13 + (v9 ^ 1650);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 1 + (v10 ^ 1651);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 2 + (v11 ^ 1652);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 3 + (v12 ^ 1653);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 4 + (v13 ^ 1654);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 5 + (v14 ^ 1655);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 6 + (v15 ^ 1656);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 7 + (v0 ^ 1657);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 8 + (v1 ^ 1658);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 9 + (v2 ^ 1659);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 10 + (v3 ^ 1660);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 11 + (v4 ^ 1661);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 12 + (v5 ^ 1662);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 13 + (v6 ^ 1663);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 1 + (v7 ^ 1664);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 2 + (v8 ^ 1665);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 3 + (v9 ^ 1666);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 4 + (v10 ^ 1667);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 5 + (v11 ^ 1668);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 6 + (v12 ^ 1669);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 7 + (v13 ^ 1670);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 8 + (v14 ^ 1671);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 9 + (v15 ^ 1672);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 10 + (v0 ^ 1673);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 11 + (v1 ^ 1674);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 12 + (v2 ^ 1675);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 13 + (v3 ^ 1676);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 1 + (v4 ^ 1677);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 2 + (v5 ^ 1678);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 3 + (v6 ^ 1679);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 4 + (v7 ^ 1680);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 5 + (v8 ^ 1681);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 6 + (v9 ^ 1682);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 7 + (v10 ^ 1683);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 8 + (v11 ^ 1684);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 9 + (v12 ^ 1685);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 10 + (v13 ^ 1686);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 11 + (v14 ^ 1687);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 12 + (v15 ^ 1688);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 13 + (v0 ^ 1689);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 1 + (v1 ^ 1690);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 2 + (v2 ^ 1691);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 3 + (v3 ^ 1692);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 4 + (v4 ^ 1693);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 5 + (v5 ^ 1694);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 6 + (v6 ^ 1695);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 7 + (v7 ^ 1696);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 8 + (v8 ^ 1697);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 9 + (v9 ^ 1698);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 10 + (v10 ^ 1699);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 11 + (v11 ^ 1700);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 12 + (v12 ^ 1701);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 13 + (v13 ^ 1702);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 1 + (v14 ^ 1703);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 2 + (v15 ^ 1704);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 3 + (v0 ^ 1705);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 4 + (v1 ^ 1706);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 5 + (v2 ^ 1707);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 6 + (v3 ^ 1708);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 7 + (v4 ^ 1709);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 8 + (v5 ^ 1710);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 9 + (v6 ^ 1711);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 10 + (v7 ^ 1712);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 11 + (v8 ^ 1713);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 12 + (v9 ^ 1714);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 13 + (v10 ^ 1715);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 1 + (v11 ^ 1716);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 2 + (v12 ^ 1717);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 3 + (v13 ^ 1718);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 4 + (v14 ^ 1719);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 5 + (v15 ^ 1720);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 6 + (v0 ^ 1721);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 7 + (v1 ^ 1722);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 8 + (v2 ^ 1723);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 9 + (v3 ^ 1724);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 10 + (v4 ^ 1725);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 11 + (v5 ^ 1726);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 12 + (v6 ^ 1727);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 13 + (v7 ^ 1728);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 1 + (v8 ^ 1729);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 2 + (v9 ^ 1730);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 3 + (v10 ^ 1731);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 4 + (v11 ^ 1732);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 5 + (v12 ^ 1733);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 6 + (v13 ^ 1734);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 7 + (v14 ^ 1735);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 8 + (v15 ^ 1736);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 9 + (v0 ^ 1737);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 10 + (v1 ^ 1738);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 11 + (v2 ^ 1739);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 12 + (v3 ^ 1740);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 13 + (v4 ^ 1741);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 1 + (v5 ^ 1742);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 2 + (v6 ^ 1743);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 3 + (v7 ^ 1744);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 4 + (v8 ^ 1745);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 5 + (v9 ^ 1746);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 6 + (v10 ^ 1747);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 7 + (v11 ^ 1748);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 8 + (v12 ^ 1749);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 9 + (v13 ^ 1750);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 10 + (v14 ^ 1751);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 11 + (v15 ^ 1752);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 12 + (v0 ^ 1753);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 13 + (v1 ^ 1754);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 1 + (v2 ^ 1755);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 2 + (v3 ^ 1756);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 3 + (v4 ^ 1757);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 4 + (v5 ^ 1758);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 5 + (v6 ^ 1759);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 6 + (v7 ^ 1760);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 7 + (v8 ^ 1761);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 8 + (v9 ^ 1762);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 9 + (v10 ^ 1763);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 10 + (v11 ^ 1764);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 11 + (v12 ^ 1765);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 12 + (v13 ^ 1766);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 13 + (v14 ^ 1767);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 1 + (v15 ^ 1768);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 2 + (v0 ^ 1769);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 3 + (v1 ^ 1770);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 4 + (v2 ^ 1771);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 5 + (v3 ^ 1772);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 6 + (v4 ^ 1773);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 7 + (v5 ^ 1774);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 8 + (v6 ^ 1775);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 9 + (v7 ^ 1776);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 10 + (v8 ^ 1777);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 11 + (v9 ^ 1778);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 12 + (v10 ^ 1779);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 13 + (v11 ^ 1780);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 1 + (v12 ^ 1781);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 2 + (v13 ^ 1782);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 3 + (v14 ^ 1783);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 4 + (v15 ^ 1784);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 5 + (v0 ^ 1785);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 6 + (v1 ^ 1786);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 7 + (v2 ^ 1787);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 8 + (v3 ^ 1788);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 9 + (v4 ^ 1789);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 10 + (v5 ^ 1790);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 11 + (v6 ^ 1791);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 12 + (v7 ^ 1792);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 13 + (v8 ^ 1793);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 1 + (v9 ^ 1794);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 2 + (v10 ^ 1795);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 3 + (v11 ^ 1796);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 4 + (v12 ^ 1797);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 5 + (v13 ^ 1798);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 6 + (v14 ^ 1799);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 7 + (v15 ^ 1800);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 8 + (v0 ^ 1801);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 9 + (v1 ^ 1802);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 10 + (v2 ^ 1803);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 11 + (v3 ^ 1804);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 12 + (v4 ^ 1805);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 13 + (v5 ^ 1806);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 1 + (v6 ^ 1807);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 2 + (v7 ^ 1808);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 3 + (v8 ^ 1809);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 4 + (v9 ^ 1810);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 5 + (v10 ^ 1811);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 6 + (v11 ^ 1812);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 7 + (v12 ^ 1813);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 8 + (v13 ^ 1814);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 9 + (v14 ^ 1815);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 10 + (v15 ^ 1816);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 11 + (v0 ^ 1817);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 12 + (v1 ^ 1818);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 13 + (v2 ^ 1819);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 1 + (v3 ^ 1820);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 2 + (v4 ^ 1821);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 3 + (v5 ^ 1822);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 4 + (v6 ^ 1823);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 5 + (v7 ^ 1824);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 6 + (v8 ^ 1825);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 7 + (v9 ^ 1826);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 8 + (v10 ^ 1827);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 9 + (v11 ^ 1828);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 10 + (v12 ^ 1829);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 11 + (v13 ^ 1830);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 12 + (v14 ^ 1831);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 13 + (v15 ^ 1832);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 1 + (v0 ^ 1833);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 2 + (v1 ^ 1834);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 3 + (v2 ^ 1835);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 4 + (v3 ^ 1836);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 5 + (v4 ^ 1837);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 6 + (v5 ^ 1838);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 7 + (v6 ^ 1839);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 8 + (v7 ^ 1840);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 9 + (v8 ^ 1841);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 10 + (v9 ^ 1842);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 11 + (v10 ^ 1843);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 12 + (v11 ^ 1844);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 13 + (v12 ^ 1845);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 1 + (v13 ^ 1846);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 2 + (v14 ^ 1847);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 3 + (v15 ^ 1848);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 4 + (v0 ^ 1849);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 5 + (v1 ^ 1850);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 6 + (v2 ^ 1851);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 7 + (v3 ^ 1852);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 8 + (v4 ^ 1853);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 9 + (v5 ^ 1854);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 10 + (v6 ^ 1855);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 11 + (v7 ^ 1856);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 12 + (v8 ^ 1857);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 13 + (v9 ^ 1858);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 1 + (v10 ^ 1859);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 2 + (v11 ^ 1860);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 3 + (v12 ^ 1861);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 4 + (v13 ^ 1862);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 5 + (v14 ^ 1863);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 6 + (v15 ^ 1864);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 7 + (v0 ^ 1865);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 8 + (v1 ^ 1866);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 9 + (v2 ^ 1867);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 10 + (v3 ^ 1868);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 11 + (v4 ^ 1869);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 12 + (v5 ^ 1870);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 13 + (v6 ^ 1871);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 1 + (v7 ^ 1872);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 2 + (v8 ^ 1873);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 3 + (v9 ^ 1874);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 4 + (v10 ^ 1875);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 5 + (v11 ^ 1876);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 6 + (v12 ^ 1877);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 7 + (v13 ^ 1878);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 8 + (v14 ^ 1879);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 9 + (v15 ^ 1880);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 10 + (v0 ^ 1881);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 11 + (v1 ^ 1882);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 12 + (v2 ^ 1883);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 13 + (v3 ^ 1884);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 1 + (v4 ^ 1885);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 2 + (v5 ^ 1886);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 3 + (v6 ^ 1887);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 4 + (v7 ^ 1888);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 5 + (v8 ^ 1889);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 6 + (v9 ^ 1890);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 7 + (v10 ^ 1891);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 8 + (v11 ^ 1892);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 9 + (v12 ^ 1893);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 10 + (v13 ^ 1894);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 11 + (v14 ^ 1895);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 12 + (v15 ^ 1896);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 13 + (v0 ^ 1897);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 1 + (v1 ^ 1898);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 2 + (v2 ^ 1899);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 3 + (v3 ^ 1900);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 4 + (v4 ^ 1901);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 5 + (v5 ^ 1902);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 6 + (v6 ^ 1903);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 7 + (v7 ^ 1904);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 8 + (v8 ^ 1905);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 9 + (v9 ^ 1906);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 10 + (v10 ^ 1907);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 11 + (v11 ^ 1908);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 12 + (v12 ^ 1909);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 13 + (v13 ^ 1910);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 1 + (v14 ^ 1911);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 2 + (v15 ^ 1912);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 3 + (v0 ^ 1913);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 4 + (v1 ^ 1914);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 5 + (v2 ^ 1915);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 6 + (v3 ^ 1916);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 7 + (v4 ^ 1917);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 8 + (v5 ^ 1918);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 9 + (v6 ^ 1919);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 10 + (v7 ^ 1920);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 11 + (v8 ^ 1921);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 12 + (v9 ^ 1922);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 13 + (v10 ^ 1923);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 1 + (v11 ^ 1924);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 2 + (v12 ^ 1925);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 3 + (v13 ^ 1926);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 4 + (v14 ^ 1927);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 5 + (v15 ^ 1928);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 6 + (v0 ^ 1929);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 7 + (v1 ^ 1930);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 8 + (v2 ^ 1931);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 9 + (v3 ^ 1932);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 10 + (v4 ^ 1933);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 11 + (v5 ^ 1934);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 12 + (v6 ^ 1935);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 13 + (v7 ^ 1936);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 1 + (v8 ^ 1937);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 2 + (v9 ^ 1938);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 3 + (v10 ^ 1939);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 4 + (v11 ^ 1940);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 5 + (v12 ^ 1941);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 6 + (v13 ^ 1942);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 7 + (v14 ^ 1943);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 8 + (v15 ^ 1944);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 9 + (v0 ^ 1945);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 10 + (v1 ^ 1946);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 11 + (v2 ^ 1947);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 12 + (v3 ^ 1948);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 13 + (v4 ^ 1949);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 1 + (v5 ^ 1950);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 2 + (v6 ^ 1951);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 3 + (v7 ^ 1952);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 4 + (v8 ^ 1953);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 5 + (v9 ^ 1954);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 6 + (v10 ^ 1955);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 7 + (v11 ^ 1956);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 8 + (v12 ^ 1957);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 9 + (v13 ^ 1958);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 10 + (v14 ^ 1959);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 11 + (v15 ^ 1960);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 12 + (v0 ^ 1961);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 13 + (v1 ^ 1962);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 1 + (v2 ^ 1963);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 2 + (v3 ^ 1964);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 3 + (v4 ^ 1965);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 4 + (v5 ^ 1966);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 5 + (v6 ^ 1967);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 6 + (v7 ^ 1968);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 7 + (v8 ^ 1969);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 8 + (v9 ^ 1970);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 9 + (v10 ^ 1971);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 10 + (v11 ^ 1972);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 11 + (v12 ^ 1973);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 12 + (v13 ^ 1974);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 13 + (v14 ^ 1975);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 1 + (v15 ^ 1976);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 2 + (v0 ^ 1977);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 3 + (v1 ^ 1978);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 4 + (v2 ^ 1979);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 5 + (v3 ^ 1980);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 6 + (v4 ^ 1981);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 7 + (v5 ^ 1982);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 8 + (v6 ^ 1983);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 9 + (v7 ^ 1984);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 10 + (v8 ^ 1985);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 11 + (v9 ^ 1986);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 12 + (v10 ^ 1987);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 13 + (v11 ^ 1988);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 1 + (v12 ^ 1989);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 2 + (v13 ^ 1990);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 3 + (v14 ^ 1991);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 4 + (v15 ^ 1992);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 5 + (v0 ^ 1993);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 6 + (v1 ^ 1994);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 7 + (v2 ^ 1995);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 8 + (v3 ^ 1996);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 9 + (v4 ^ 1997);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 10 + (v5 ^ 1998);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 11 + (v6 ^ 1999);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 12 + (v7 ^ 2000);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 13 + (v8 ^ 2001);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 1 + (v9 ^ 2002);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 2 + (v10 ^ 2003);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 3 + (v11 ^ 2004);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 4 + (v12 ^ 2005);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 5 + (v13 ^ 2006);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 6 + (v14 ^ 2007);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 7 + (v15 ^ 2008);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 8 + (v0 ^ 2009);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 9 + (v1 ^ 2010);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 10 + (v2 ^ 2011);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 11 + (v3 ^ 2012);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 12 + (v4 ^ 2013);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 13 + (v5 ^ 2014);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 1 + (v6 ^ 2015);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 2 + (v7 ^ 2016);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 3 + (v8 ^ 2017);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 4 + (v9 ^ 2018);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 5 + (v10 ^ 2019);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 6 + (v11 ^ 2020);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 7 + (v12 ^ 2021);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 8 + (v13 ^ 2022);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 9 + (v14 ^ 2023);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 10 + (v15 ^ 2024);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 11 + (v0 ^ 2025);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 12 + (v1 ^ 2026);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 13 + (v2 ^ 2027);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 1 + (v3 ^ 2028);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 2 + (v4 ^ 2029);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 3 + (v5 ^ 2030);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 4 + (v6 ^ 2031);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 5 + (v7 ^ 2032);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 6 + (v8 ^ 2033);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 7 + (v9 ^ 2034);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 8 + (v10 ^ 2035);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 9 + (v11 ^ 2036);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 10 + (v12 ^ 2037);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 11 + (v13 ^ 2038);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 12 + (v14 ^ 2039);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 13 + (v15 ^ 2040);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 1 + (v0 ^ 2041);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 2 + (v1 ^ 2042);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 3 + (v2 ^ 2043);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 4 + (v3 ^ 2044);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 5 + (v4 ^ 2045);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 6 + (v5 ^ 2046);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 7 + (v6 ^ 2047);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 8 + (v7 ^ 2048);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 9 + (v8 ^ 2049);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 10 + (v9 ^ 2050);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 11 + (v10 ^ 2051);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 12 + (v11 ^ 2052);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 13 + (v12 ^ 2053);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 1 + (v13 ^ 2054);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 2 + (v14 ^ 2055);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 3 + (v15 ^ 2056);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 4 + (v0 ^ 2057);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 5 + (v1 ^ 2058);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 6 + (v2 ^ 2059);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 7 + (v3 ^ 2060);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 8 + (v4 ^ 2061);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 9 + (v5 ^ 2062);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 10 + (v6 ^ 2063);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 11 + (v7 ^ 2064);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 12 + (v8 ^ 2065);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 13 + (v9 ^ 2066);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 1 + (v10 ^ 2067);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 2 + (v11 ^ 2068);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 3 + (v12 ^ 2069);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 4 + (v13 ^ 2070);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 5 + (v14 ^ 2071);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 6 + (v15 ^ 2072);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 7 + (v0 ^ 2073);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 8 + (v1 ^ 2074);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 9 + (v2 ^ 2075);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 10 + (v3 ^ 2076);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 11 + (v4 ^ 2077);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 12 + (v5 ^ 2078);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 13 + (v6 ^ 2079);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 1 + (v7 ^ 2080);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 2 + (v8 ^ 2081);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 3 + (v9 ^ 2082);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 4 + (v10 ^ 2083);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 5 + (v11 ^ 2084);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 6 + (v12 ^ 2085);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 7 + (v13 ^ 2086);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 8 + (v14 ^ 2087);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 9 + (v15 ^ 2088);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 10 + (v0 ^ 2089);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 11 + (v1 ^ 2090);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 12 + (v2 ^ 2091);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 13 + (v3 ^ 2092);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 1 + (v4 ^ 2093);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 2 + (v5 ^ 2094);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 3 + (v6 ^ 2095);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 4 + (v7 ^ 2096);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 5 + (v8 ^ 2097);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 6 + (v9 ^ 2098);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 7 + (v10 ^ 2099);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 8 + (v11 ^ 2100);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 9 + (v12 ^ 2101);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 10 + (v13 ^ 2102);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 11 + (v14 ^ 2103);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 12 + (v15 ^ 2104);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 13 + (v0 ^ 2105);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 1 + (v1 ^ 2106);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 2 + (v2 ^ 2107);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 3 + (v3 ^ 2108);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 4 + (v4 ^ 2109);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 5 + (v5 ^ 2110);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 6 + (v6 ^ 2111);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 7 + (v7 ^ 2112);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 8 + (v8 ^ 2113);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 9 + (v9 ^ 2114);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 10 + (v10 ^ 2115);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 11 + (v11 ^ 2116);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 12 + (v12 ^ 2117);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 13 + (v13 ^ 2118);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 1 + (v14 ^ 2119);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 2 + (v15 ^ 2120);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 3 + (v0 ^ 2121);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 4 + (v1 ^ 2122);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 5 + (v2 ^ 2123);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 6 + (v3 ^ 2124);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 7 + (v4 ^ 2125);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 8 + (v5 ^ 2126);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 9 + (v6 ^ 2127);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 10 + (v7 ^ 2128);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 11 + (v8 ^ 2129);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 12 + (v9 ^ 2130);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 13 + (v10 ^ 2131);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 1 + (v11 ^ 2132);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 2 + (v12 ^ 2133);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 3 + (v13 ^ 2134);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 4 + (v14 ^ 2135);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 5 + (v15 ^ 2136);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 6 + (v0 ^ 2137);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 7 + (v1 ^ 2138);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 8 + (v2 ^ 2139);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 9 + (v3 ^ 2140);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 10 + (v4 ^ 2141);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 11 + (v5 ^ 2142);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 12 + (v6 ^ 2143);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 13 + (v7 ^ 2144);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 1 + (v8 ^ 2145);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 2 + (v9 ^ 2146);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 3 + (v10 ^ 2147);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 4 + (v11 ^ 2148);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 5 + (v12 ^ 2149);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 6 + (v13 ^ 2150);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 7 + (v14 ^ 2151);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 8 + (v15 ^ 2152);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 9 + (v0 ^ 2153);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 10 + (v1 ^ 2154);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 11 + (v2 ^ 2155);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 12 + (v3 ^ 2156);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 13 + (v4 ^ 2157);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 1 + (v5 ^ 2158);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 2 + (v6 ^ 2159);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 3 + (v7 ^ 2160);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 4 + (v8 ^ 2161);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 5 + (v9 ^ 2162);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 6 + (v10 ^ 2163);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 7 + (v11 ^ 2164);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 8 + (v12 ^ 2165);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 9 + (v13 ^ 2166);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 10 + (v14 ^ 2167);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 11 + (v15 ^ 2168);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 12 + (v0 ^ 2169);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 13 + (v1 ^ 2170);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 1 + (v2 ^ 2171);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 2 + (v3 ^ 2172);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 3 + (v4 ^ 2173);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 4 + (v5 ^ 2174);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 5 + (v6 ^ 2175);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 6 + (v7 ^ 2176);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 7 + (v8 ^ 2177);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 8 + (v9 ^ 2178);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 9 + (v10 ^ 2179);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 10 + (v11 ^ 2180);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 11 + (v12 ^ 2181);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 12 + (v13 ^ 2182);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 13 + (v14 ^ 2183);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 1 + (v15 ^ 2184);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 2 + (v0 ^ 2185);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 3 + (v1 ^ 2186);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 4 + (v2 ^ 2187);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 5 + (v3 ^ 2188);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 6 + (v4 ^ 2189);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 7 + (v5 ^ 2190);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 8 + (v6 ^ 2191);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 9 + (v7 ^ 2192);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 10 + (v8 ^ 2193);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 11 + (v9 ^ 2194);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 12 + (v10 ^ 2195);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 13 + (v11 ^ 2196);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 1 + (v12 ^ 2197);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 2 + (v13 ^ 2198);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 3 + (v14 ^ 2199);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 4 + (v15 ^ 2200);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 5 + (v0 ^ 2201);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 6 + (v1 ^ 2202);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 7 + (v2 ^ 2203);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 8 + (v3 ^ 2204);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 9 + (v4 ^ 2205);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 10 + (v5 ^ 2206);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 11 + (v6 ^ 2207);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 12 + (v7 ^ 2208);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 13 + (v8 ^ 2209);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 1 + (v9 ^ 2210);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 2 + (v10 ^ 2211);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 3 + (v11 ^ 2212);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 4 + (v12 ^ 2213);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 5 + (v13 ^ 2214);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 6 + (v14 ^ 2215);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 7 + (v15 ^ 2216);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 8 + (v0 ^ 2217);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 9 + (v1 ^ 2218);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 10 + (v2 ^ 2219);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 11 + (v3 ^ 2220);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 12 + (v4 ^ 2221);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 13 + (v5 ^ 2222);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 1 + (v6 ^ 2223);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 2 + (v7 ^ 2224);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 3 + (v8 ^ 2225);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 4 + (v9 ^ 2226);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 5 + (v10 ^ 2227);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 6 + (v11 ^ 2228);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 7 + (v12 ^ 2229);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 8 + (v13 ^ 2230);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 9 + (v14 ^ 2231);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 10 + (v15 ^ 2232);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 11 + (v0 ^ 2233);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 12 + (v1 ^ 2234);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 13 + (v2 ^ 2235);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 1 + (v3 ^ 2236);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 2 + (v4 ^ 2237);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 3 + (v5 ^ 2238);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 4 + (v6 ^ 2239);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 5 + (v7 ^ 2240);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 6 + (v8 ^ 2241);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 7 + (v9 ^ 2242);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 8 + (v10 ^ 2243);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 9 + (v11 ^ 2244);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 10 + (v12 ^ 2245);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 11 + (v13 ^ 2246);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 12 + (v14 ^ 2247);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 13 + (v15 ^ 2248);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 1 + (v0 ^ 2249);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 2 + (v1 ^ 2250);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 3 + (v2 ^ 2251);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 4 + (v3 ^ 2252);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 5 + (v4 ^ 2253);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 6 + (v5 ^ 2254);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 7 + (v6 ^ 2255);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 8 + (v7 ^ 2256);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 9 + (v8 ^ 2257);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 10 + (v9 ^ 2258);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 11 + (v10 ^ 2259);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 12 + (v11 ^ 2260);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 13 + (v12 ^ 2261);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 1 + (v13 ^ 2262);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 2 + (v14 ^ 2263);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 3 + (v15 ^ 2264);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 4 + (v0 ^ 2265);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 5 + (v1 ^ 2266);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 6 + (v2 ^ 2267);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 7 + (v3 ^ 2268);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 8 + (v4 ^ 2269);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 9 + (v5 ^ 2270);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 10 + (v6 ^ 2271);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 11 + (v7 ^ 2272);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 12 + (v8 ^ 2273);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 13 + (v9 ^ 2274);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 1 + (v10 ^ 2275);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 2 + (v11 ^ 2276);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 3 + (v12 ^ 2277);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 4 + (v13 ^ 2278);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 5 + (v14 ^ 2279);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 6 + (v15 ^ 2280);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 7 + (v0 ^ 2281);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 8 + (v1 ^ 2282);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 9 + (v2 ^ 2283);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 10 + (v3 ^ 2284);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 11 + (v4 ^ 2285);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 12 + (v5 ^ 2286);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 13 + (v6 ^ 2287);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 1 + (v7 ^ 2288);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 2 + (v8 ^ 2289);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 3 + (v9 ^ 2290);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 4 + (v10 ^ 2291);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 5 + (v11 ^ 2292);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 6 + (v12 ^ 2293);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 7 + (v13 ^ 2294);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 8 + (v14 ^ 2295);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 9 + (v15 ^ 2296);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 10 + (v0 ^ 2297);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 11 + (v1 ^ 2298);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 12 + (v2 ^ 2299);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 13 + (v3 ^ 2300);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 1 + (v4 ^ 2301);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 2 + (v5 ^ 2302);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 3 + (v6 ^ 2303);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 4 + (v7 ^ 2304);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 5 + (v8 ^ 2305);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 6 + (v9 ^ 2306);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 7 + (v10 ^ 2307);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 8 + (v11 ^ 2308);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 9 + (v12 ^ 2309);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 10 + (v13 ^ 2310);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 11 + (v14 ^ 2311);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 12 + (v15 ^ 2312);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 13 + (v0 ^ 2313);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 1 + (v1 ^ 2314);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 2 + (v2 ^ 2315);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 3 + (v3 ^ 2316);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 4 + (v4 ^ 2317);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 5 + (v5 ^ 2318);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 6 + (v6 ^ 2319);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 7 + (v7 ^ 2320);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 8 + (v8 ^ 2321);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 9 + (v9 ^ 2322);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 10 + (v10 ^ 2323);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 11 + (v11 ^ 2324);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 12 + (v12 ^ 2325);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 13 + (v13 ^ 2326);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 1 + (v14 ^ 2327);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 2 + (v15 ^ 2328);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 3 + (v0 ^ 2329);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 4 + (v1 ^ 2330);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 5 + (v2 ^ 2331);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 6 + (v3 ^ 2332);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 7 + (v4 ^ 2333);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 8 + (v5 ^ 2334);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 9 + (v6 ^ 2335);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 10 + (v7 ^ 2336);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 11 + (v8 ^ 2337);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 12 + (v9 ^ 2338);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 13 + (v10 ^ 2339);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 1 + (v11 ^ 2340);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 2 + (v12 ^ 2341);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 3 + (v13 ^ 2342);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 4 + (v14 ^ 2343);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 5 + (v15 ^ 2344);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 6 + (v0 ^ 2345);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 7 + (v1 ^ 2346);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 8 + (v2 ^ 2347);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 9 + (v3 ^ 2348);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 10 + (v4 ^ 2349);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 11 + (v5 ^ 2350);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 12 + (v6 ^ 2351);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 13 + (v7 ^ 2352);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 1 + (v8 ^ 2353);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 2 + (v9 ^ 2354);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 3 + (v10 ^ 2355);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 4 + (v11 ^ 2356);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 5 + (v12 ^ 2357);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 6 + (v13 ^ 2358);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 7 + (v14 ^ 2359);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 8 + (v15 ^ 2360);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 9 + (v0 ^ 2361);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 10 + (v1 ^ 2362);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 11 + (v2 ^ 2363);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 12 + (v3 ^ 2364);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 13 + (v4 ^ 2365);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 1 + (v5 ^ 2366);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 2 + (v6 ^ 2367);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 3 + (v7 ^ 2368);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 4 + (v8 ^ 2369);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 5 + (v9 ^ 2370);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 6 + (v10 ^ 2371);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 7 + (v11 ^ 2372);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 8 + (v12 ^ 2373);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 9 + (v13 ^ 2374);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 10 + (v14 ^ 2375);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 11 + (v15 ^ 2376);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 12 + (v0 ^ 2377);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 13 + (v1 ^ 2378);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 1 + (v2 ^ 2379);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 2 + (v3 ^ 2380);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 3 + (v4 ^ 2381);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 4 + (v5 ^ 2382);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 5 + (v6 ^ 2383);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 6 + (v7 ^ 2384);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 7 + (v8 ^ 2385);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 8 + (v9 ^ 2386);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 9 + (v10 ^ 2387);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 10 + (v11 ^ 2388);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 11 + (v12 ^ 2389);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 12 + (v13 ^ 2390);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 13 + (v14 ^ 2391);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 1 + (v15 ^ 2392);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 2 + (v0 ^ 2393);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 3 + (v1 ^ 2394);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 4 + (v2 ^ 2395);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 5 + (v3 ^ 2396);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 6 + (v4 ^ 2397);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 7 + (v5 ^ 2398);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 8 + (v6 ^ 2399);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 9 + (v7 ^ 2400);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 10 + (v8 ^ 2401);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 11 + (v9 ^ 2402);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 12 + (v10 ^ 2403);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 13 + (v11 ^ 2404);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 1 + (v12 ^ 2405);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 2 + (v13 ^ 2406);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 3 + (v14 ^ 2407);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 4 + (v15 ^ 2408);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 5 + (v0 ^ 2409);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 6 + (v1 ^ 2410);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 7 + (v2 ^ 2411);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 8 + (v3 ^ 2412);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 9 + (v4 ^ 2413);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 10 + (v5 ^ 2414);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 11 + (v6 ^ 2415);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 12 + (v7 ^ 2416);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 13 + (v8 ^ 2417);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 1 + (v9 ^ 2418);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 2 + (v10 ^ 2419);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 3 + (v11 ^ 2420);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 4 + (v12 ^ 2421);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 5 + (v13 ^ 2422);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 6 + (v14 ^ 2423);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 7 + (v15 ^ 2424);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 8 + (v0 ^ 2425);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 9 + (v1 ^ 2426);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 10 + (v2 ^ 2427);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 11 + (v3 ^ 2428);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 12 + (v4 ^ 2429);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 13 + (v5 ^ 2430);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 1 + (v6 ^ 2431);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 2 + (v7 ^ 2432);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 3 + (v8 ^ 2433);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 4 + (v9 ^ 2434);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 5 + (v10 ^ 2435);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 6 + (v11 ^ 2436);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 7 + (v12 ^ 2437);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 8 + (v13 ^ 2438);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 9 + (v14 ^ 2439);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 10 + (v15 ^ 2440);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 11 + (v0 ^ 2441);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 12 + (v1 ^ 2442);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 13 + (v2 ^ 2443);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 1 + (v3 ^ 2444);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 2 + (v4 ^ 2445);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 3 + (v5 ^ 2446);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 4 + (v6 ^ 2447);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 5 + (v7 ^ 2448);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 6 + (v8 ^ 2449);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 7 + (v9 ^ 2450);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 8 + (v10 ^ 2451);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 9 + (v11 ^ 2452);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 10 + (v12 ^ 2453);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 11 + (v13 ^ 2454);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 12 + (v14 ^ 2455);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 13 + (v15 ^ 2456);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 1 + (v0 ^ 2457);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 2 + (v1 ^ 2458);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 3 + (v2 ^ 2459);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 4 + (v3 ^ 2460);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 5 + (v4 ^ 2461);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 6 + (v5 ^ 2462);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 7 + (v6 ^ 2463);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 8 + (v7 ^ 2464);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 9 + (v8 ^ 2465);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 10 + (v9 ^ 2466);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 11 + (v10 ^ 2467);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 12 + (v11 ^ 2468);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 13 + (v12 ^ 2469);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 1 + (v13 ^ 2470);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 2 + (v14 ^ 2471);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 3 + (v15 ^ 2472);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 4 + (v0 ^ 2473);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 5 + (v1 ^ 2474);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 6 + (v2 ^ 2475);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 7 + (v3 ^ 2476);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 8 + (v4 ^ 2477);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 9 + (v5 ^ 2478);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 10 + (v6 ^ 2479);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 11 + (v7 ^ 2480);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 12 + (v8 ^ 2481);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 13 + (v9 ^ 2482);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 1 + (v10 ^ 2483);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 2 + (v11 ^ 2484);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 3 + (v12 ^ 2485);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 4 + (v13 ^ 2486);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 5 + (v14 ^ 2487);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 6 + (v15 ^ 2488);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 7 + (v0 ^ 2489);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 8 + (v1 ^ 2490);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 9 + (v2 ^ 2491);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 10 + (v3 ^ 2492);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 11 + (v4 ^ 2493);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 12 + (v5 ^ 2494);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 13 + (v6 ^ 2495);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 1 + (v7 ^ 2496);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 2 + (v8 ^ 2497);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 3 + (v9 ^ 2498);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 4 + (v10 ^ 2499);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 5 + (v11 ^ 2500);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 6 + (v12 ^ 2501);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 7 + (v13 ^ 2502);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 8 + (v14 ^ 2503);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 9 + (v15 ^ 2504);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 10 + (v0 ^ 2505);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 11 + (v1 ^ 2506);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 12 + (v2 ^ 2507);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 13 + (v3 ^ 2508);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 1 + (v4 ^ 2509);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 2 + (v5 ^ 2510);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 3 + (v6 ^ 2511);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 4 + (v7 ^ 2512);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 5 + (v8 ^ 2513);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 6 + (v9 ^ 2514);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 7 + (v10 ^ 2515);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 8 + (v11 ^ 2516);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 9 + (v12 ^ 2517);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 10 + (v13 ^ 2518);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 11 + (v14 ^ 2519);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 12 + (v15 ^ 2520);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 13 + (v0 ^ 2521);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 1 + (v1 ^ 2522);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 2 + (v2 ^ 2523);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 3 + (v3 ^ 2524);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 4 + (v4 ^ 2525);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 5 + (v5 ^ 2526);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 6 + (v6 ^ 2527);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 7 + (v7 ^ 2528);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 8 + (v8 ^ 2529);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 9 + (v9 ^ 2530);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 10 + (v10 ^ 2531);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 11 + (v11 ^ 2532);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 12 + (v12 ^ 2533);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 13 + (v13 ^ 2534);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 1 + (v14 ^ 2535);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 2 + (v15 ^ 2536);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 3 + (v0 ^ 2537);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 4 + (v1 ^ 2538);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 5 + (v2 ^ 2539);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 6 + (v3 ^ 2540);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 7 + (v4 ^ 2541);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 8 + (v5 ^ 2542);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 9 + (v6 ^ 2543);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 10 + (v7 ^ 2544);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 11 + (v8 ^ 2545);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 12 + (v9 ^ 2546);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 13 + (v10 ^ 2547);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 1 + (v11 ^ 2548);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 2 + (v12 ^ 2549);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 3 + (v13 ^ 2550);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 4 + (v14 ^ 2551);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 5 + (v15 ^ 2552);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 6 + (v0 ^ 2553);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 7 + (v1 ^ 2554);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 8 + (v2 ^ 2555);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 9 + (v3 ^ 2556);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 10 + (v4 ^ 2557);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 11 + (v5 ^ 2558);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 12 + (v6 ^ 2559);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 13 + (v7 ^ 2560);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 1 + (v8 ^ 2561);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 2 + (v9 ^ 2562);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 3 + (v10 ^ 2563);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 4 + (v11 ^ 2564);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 5 + (v12 ^ 2565);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 6 + (v13 ^ 2566);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 7 + (v14 ^ 2567);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 8 + (v15 ^ 2568);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 9 + (v0 ^ 2569);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 10 + (v1 ^ 2570);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 11 + (v2 ^ 2571);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 12 + (v3 ^ 2572);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 13 + (v4 ^ 2573);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 1 + (v5 ^ 2574);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 2 + (v6 ^ 2575);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 3 + (v7 ^ 2576);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 4 + (v8 ^ 2577);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 5 + (v9 ^ 2578);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 6 + (v10 ^ 2579);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 7 + (v11 ^ 2580);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 8 + (v12 ^ 2581);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 9 + (v13 ^ 2582);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 10 + (v14 ^ 2583);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 11 + (v15 ^ 2584);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 12 + (v0 ^ 2585);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 13 + (v1 ^ 2586);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 1 + (v2 ^ 2587);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 2 + (v3 ^ 2588);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 3 + (v4 ^ 2589);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 4 + (v5 ^ 2590);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 5 + (v6 ^ 2591);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 6 + (v7 ^ 2592);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 7 + (v8 ^ 2593);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 8 + (v9 ^ 2594);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 9 + (v10 ^ 2595);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 10 + (v11 ^ 2596);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 11 + (v12 ^ 2597);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 12 + (v13 ^ 2598);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 13 + (v14 ^ 2599);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 1 + (v15 ^ 2600);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 2 + (v0 ^ 2601);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 3 + (v1 ^ 2602);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 4 + (v2 ^ 2603);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 5 + (v3 ^ 2604);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 6 + (v4 ^ 2605);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 7 + (v5 ^ 2606);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 8 + (v6 ^ 2607);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 9 + (v7 ^ 2608);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 10 + (v8 ^ 2609);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 11 + (v9 ^ 2610);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 12 + (v10 ^ 2611);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 13 + (v11 ^ 2612);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 1 + (v12 ^ 2613);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 2 + (v13 ^ 2614);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 3 + (v14 ^ 2615);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 4 + (v15 ^ 2616);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 5 + (v0 ^ 2617);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 6 + (v1 ^ 2618);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 7 + (v2 ^ 2619);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 8 + (v3 ^ 2620);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 9 + (v4 ^ 2621);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 10 + (v5 ^ 2622);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 11 + (v6 ^ 2623);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 12 + (v7 ^ 2624);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 13 + (v8 ^ 2625);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 1 + (v9 ^ 2626);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 2 + (v10 ^ 2627);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 3 + (v11 ^ 2628);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 4 + (v12 ^ 2629);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 5 + (v13 ^ 2630);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 6 + (v14 ^ 2631);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 7 + (v15 ^ 2632);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 8 + (v0 ^ 2633);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 9 + (v1 ^ 2634);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 10 + (v2 ^ 2635);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 11 + (v3 ^ 2636);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 12 + (v4 ^ 2637);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 13 + (v5 ^ 2638);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 1 + (v6 ^ 2639);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 2 + (v7 ^ 2640);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 3 + (v8 ^ 2641);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 4 + (v9 ^ 2642);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 5 + (v10 ^ 2643);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 6 + (v11 ^ 2644);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 7 + (v12 ^ 2645);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 8 + (v13 ^ 2646);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 9 + (v14 ^ 2647);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 10 + (v15 ^ 2648);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 11 + (v0 ^ 2649);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 12 + (v1 ^ 2650);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 13 + (v2 ^ 2651);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 1 + (v3 ^ 2652);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 2 + (v4 ^ 2653);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 3 + (v5 ^ 2654);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 4 + (v6 ^ 2655);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 5 + (v7 ^ 2656);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 6 + (v8 ^ 2657);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 7 + (v9 ^ 2658);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 8 + (v10 ^ 2659);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 9 + (v11 ^ 2660);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 10 + (v12 ^ 2661);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 11 + (v13 ^ 2662);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 12 + (v14 ^ 2663);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 13 + (v15 ^ 2664);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 1 + (v0 ^ 2665);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 2 + (v1 ^ 2666);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 3 + (v2 ^ 2667);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 4 + (v3 ^ 2668);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 5 + (v4 ^ 2669);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 6 + (v5 ^ 2670);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 7 + (v6 ^ 2671);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 8 + (v7 ^ 2672);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 9 + (v8 ^ 2673);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 10 + (v9 ^ 2674);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 11 + (v10 ^ 2675);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 12 + (v11 ^ 2676);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 13 + (v12 ^ 2677);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 1 + (v13 ^ 2678);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 2 + (v14 ^ 2679);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 3 + (v15 ^ 2680);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 4 + (v0 ^ 2681);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 5 + (v1 ^ 2682);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 6 + (v2 ^ 2683);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 7 + (v3 ^ 2684);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 8 + (v4 ^ 2685);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 9 + (v5 ^ 2686);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 10 + (v6 ^ 2687);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 11 + (v7 ^ 2688);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 12 + (v8 ^ 2689);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 13 + (v9 ^ 2690);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 1 + (v10 ^ 2691);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 2 + (v11 ^ 2692);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 3 + (v12 ^ 2693);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 4 + (v13 ^ 2694);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 5 + (v14 ^ 2695);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 6 + (v15 ^ 2696);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 7 + (v0 ^ 2697);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 8 + (v1 ^ 2698);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 9 + (v2 ^ 2699);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 10 + (v3 ^ 2700);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 11 + (v4 ^ 2701);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 12 + (v5 ^ 2702);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 13 + (v6 ^ 2703);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 1 + (v7 ^ 2704);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 2 + (v8 ^ 2705);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 3 + (v9 ^ 2706);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 4 + (v10 ^ 2707);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 5 + (v11 ^ 2708);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 6 + (v12 ^ 2709);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 7 + (v13 ^ 2710);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 8 + (v14 ^ 2711);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 9 + (v15 ^ 2712);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 10 + (v0 ^ 2713);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 11 + (v1 ^ 2714);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 12 + (v2 ^ 2715);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 13 + (v3 ^ 2716);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 1 + (v4 ^ 2717);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 2 + (v5 ^ 2718);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 3 + (v6 ^ 2719);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 4 + (v7 ^ 2720);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 5 + (v8 ^ 2721);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 6 + (v9 ^ 2722);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 7 + (v10 ^ 2723);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 8 + (v11 ^ 2724);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 9 + (v12 ^ 2725);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 10 + (v13 ^ 2726);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 11 + (v14 ^ 2727);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 12 + (v15 ^ 2728);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 13 + (v0 ^ 2729);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 1 + (v1 ^ 2730);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 2 + (v2 ^ 2731);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 3 + (v3 ^ 2732);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 4 + (v4 ^ 2733);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 5 + (v5 ^ 2734);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 6 + (v6 ^ 2735);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 7 + (v7 ^ 2736);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 8 + (v8 ^ 2737);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 9 + (v9 ^ 2738);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 10 + (v10 ^ 2739);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 11 + (v11 ^ 2740);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 12 + (v12 ^ 2741);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 13 + (v13 ^ 2742);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 1 + (v14 ^ 2743);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 2 + (v15 ^ 2744);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 3 + (v0 ^ 2745);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 4 + (v1 ^ 2746);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 5 + (v2 ^ 2747);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 6 + (v3 ^ 2748);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 7 + (v4 ^ 2749);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 8 + (v5 ^ 2750);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 9 + (v6 ^ 2751);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 10 + (v7 ^ 2752);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 11 + (v8 ^ 2753);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 12 + (v9 ^ 2754);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 13 + (v10 ^ 2755);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 1 + (v11 ^ 2756);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 2 + (v12 ^ 2757);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 3 + (v13 ^ 2758);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 4 + (v14 ^ 2759);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 5 + (v15 ^ 2760);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 6 + (v0 ^ 2761);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 7 + (v1 ^ 2762);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 8 + (v2 ^ 2763);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 9 + (v3 ^ 2764);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 10 + (v4 ^ 2765);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 11 + (v5 ^ 2766);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 12 + (v6 ^ 2767);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 13 + (v7 ^ 2768);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 1 + (v8 ^ 2769);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 2 + (v9 ^ 2770);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 3 + (v10 ^ 2771);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 4 + (v11 ^ 2772);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 5 + (v12 ^ 2773);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 6 + (v13 ^ 2774);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 7 + (v14 ^ 2775);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 8 + (v15 ^ 2776);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 9 + (v0 ^ 2777);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 10 + (v1 ^ 2778);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 11 + (v2 ^ 2779);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 12 + (v3 ^ 2780);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 13 + (v4 ^ 2781);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 1 + (v5 ^ 2782);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 2 + (v6 ^ 2783);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 3 + (v7 ^ 2784);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 4 + (v8 ^ 2785);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 5 + (v9 ^ 2786);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 6 + (v10 ^ 2787);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 7 + (v11 ^ 2788);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 8 + (v12 ^ 2789);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 9 + (v13 ^ 2790);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 10 + (v14 ^ 2791);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 11 + (v15 ^ 2792);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 12 + (v0 ^ 2793);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 13 + (v1 ^ 2794);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 1 + (v2 ^ 2795);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 2 + (v3 ^ 2796);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 3 + (v4 ^ 2797);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 4 + (v5 ^ 2798);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 5 + (v6 ^ 2799);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 6 + (v7 ^ 2800);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 7 + (v8 ^ 2801);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 8 + (v9 ^ 2802);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 9 + (v10 ^ 2803);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 10 + (v11 ^ 2804);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 11 + (v12 ^ 2805);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 12 + (v13 ^ 2806);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 13 + (v14 ^ 2807);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 1 + (v15 ^ 2808);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 2 + (v0 ^ 2809);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 3 + (v1 ^ 2810);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 4 + (v2 ^ 2811);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 5 + (v3 ^ 2812);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 6 + (v4 ^ 2813);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 7 + (v5 ^ 2814);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 8 + (v6 ^ 2815);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 9 + (v7 ^ 2816);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 10 + (v8 ^ 2817);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 11 + (v9 ^ 2818);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 12 + (v10 ^ 2819);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 13 + (v11 ^ 2820);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 1 + (v12 ^ 2821);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 2 + (v13 ^ 2822);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 3 + (v14 ^ 2823);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 4 + (v15 ^ 2824);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 5 + (v0 ^ 2825);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 6 + (v1 ^ 2826);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 7 + (v2 ^ 2827);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 8 + (v3 ^ 2828);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 9 + (v4 ^ 2829);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 10 + (v5 ^ 2830);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 11 + (v6 ^ 2831);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 12 + (v7 ^ 2832);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 13 + (v8 ^ 2833);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 1 + (v9 ^ 2834);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 2 + (v10 ^ 2835);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 3 + (v11 ^ 2836);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 4 + (v12 ^ 2837);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 5 + (v13 ^ 2838);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 6 + (v14 ^ 2839);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 7 + (v15 ^ 2840);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 8 + (v0 ^ 2841);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 9 + (v1 ^ 2842);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 10 + (v2 ^ 2843);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 11 + (v3 ^ 2844);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 12 + (v4 ^ 2845);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 13 + (v5 ^ 2846);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 1 + (v6 ^ 2847);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 2 + (v7 ^ 2848);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 3 + (v8 ^ 2849);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 4 + (v9 ^ 2850);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 5 + (v10 ^ 2851);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 6 + (v11 ^ 2852);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 7 + (v12 ^ 2853);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 8 + (v13 ^ 2854);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 9 + (v14 ^ 2855);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 10 + (v15 ^ 2856);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 11 + (v0 ^ 2857);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 12 + (v1 ^ 2858);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 13 + (v2 ^ 2859);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 1 + (v3 ^ 2860);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 2 + (v4 ^ 2861);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 3 + (v5 ^ 2862);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 4 + (v6 ^ 2863);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 5 + (v7 ^ 2864);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 6 + (v8 ^ 2865);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 7 + (v9 ^ 2866);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 8 + (v10 ^ 2867);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 9 + (v11 ^ 2868);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 10 + (v12 ^ 2869);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 11 + (v13 ^ 2870);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 12 + (v14 ^ 2871);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 13 + (v15 ^ 2872);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 1 + (v0 ^ 2873);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 2 + (v1 ^ 2874);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 3 + (v2 ^ 2875);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 4 + (v3 ^ 2876);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 5 + (v4 ^ 2877);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 6 + (v5 ^ 2878);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 7 + (v6 ^ 2879);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 8 + (v7 ^ 2880);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 9 + (v8 ^ 2881);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 10 + (v9 ^ 2882);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 11 + (v10 ^ 2883);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 12 + (v11 ^ 2884);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 13 + (v12 ^ 2885);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 1 + (v13 ^ 2886);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 2 + (v14 ^ 2887);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 3 + (v15 ^ 2888);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 4 + (v0 ^ 2889);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 5 + (v1 ^ 2890);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 6 + (v2 ^ 2891);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 7 + (v3 ^ 2892);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 8 + (v4 ^ 2893);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 9 + (v5 ^ 2894);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 10 + (v6 ^ 2895);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 11 + (v7 ^ 2896);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 12 + (v8 ^ 2897);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 13 + (v9 ^ 2898);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 1 + (v10 ^ 2899);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 2 + (v11 ^ 2900);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 3 + (v12 ^ 2901);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 4 + (v13 ^ 2902);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 5 + (v14 ^ 2903);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 6 + (v15 ^ 2904);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 7 + (v0 ^ 2905);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 8 + (v1 ^ 2906);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 9 + (v2 ^ 2907);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 10 + (v3 ^ 2908);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 11 + (v4 ^ 2909);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 12 + (v5 ^ 2910);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 13 + (v6 ^ 2911);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 1 + (v7 ^ 2912);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 2 + (v8 ^ 2913);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 3 + (v9 ^ 2914);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 4 + (v10 ^ 2915);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 5 + (v11 ^ 2916);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 6 + (v12 ^ 2917);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 7 + (v13 ^ 2918);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 8 + (v14 ^ 2919);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 9 + (v15 ^ 2920);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 10 + (v0 ^ 2921);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 11 + (v1 ^ 2922);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 12 + (v2 ^ 2923);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 13 + (v3 ^ 2924);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 1 + (v4 ^ 2925);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 2 + (v5 ^ 2926);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 3 + (v6 ^ 2927);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 4 + (v7 ^ 2928);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 5 + (v8 ^ 2929);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 6 + (v9 ^ 2930);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 7 + (v10 ^ 2931);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 8 + (v11 ^ 2932);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 9 + (v12 ^ 2933);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 10 + (v13 ^ 2934);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 11 + (v14 ^ 2935);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 12 + (v15 ^ 2936);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 13 + (v0 ^ 2937);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 1 + (v1 ^ 2938);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 2 + (v2 ^ 2939);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 3 + (v3 ^ 2940);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 4 + (v4 ^ 2941);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 5 + (v5 ^ 2942);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 6 + (v6 ^ 2943);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 7 + (v7 ^ 2944);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 8 + (v8 ^ 2945);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 9 + (v9 ^ 2946);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 10 + (v10 ^ 2947);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 11 + (v11 ^ 2948);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 12 + (v12 ^ 2949);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 13 + (v13 ^ 2950);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 1 + (v14 ^ 2951);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 2 + (v15 ^ 2952);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 3 + (v0 ^ 2953);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 4 + (v1 ^ 2954);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 5 + (v2 ^ 2955);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 6 + (v3 ^ 2956);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 7 + (v4 ^ 2957);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 8 + (v5 ^ 2958);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 9 + (v6 ^ 2959);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 10 + (v7 ^ 2960);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 11 + (v8 ^ 2961);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 12 + (v9 ^ 2962);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 13 + (v10 ^ 2963);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 1 + (v11 ^ 2964);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 2 + (v12 ^ 2965);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 3 + (v13 ^ 2966);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 4 + (v14 ^ 2967);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 5 + (v15 ^ 2968);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 6 + (v0 ^ 2969);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 7 + (v1 ^ 2970);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 8 + (v2 ^ 2971);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 9 + (v3 ^ 2972);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 10 + (v4 ^ 2973);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 11 + (v5 ^ 2974);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 12 + (v6 ^ 2975);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 13 + (v7 ^ 2976);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 1 + (v8 ^ 2977);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 2 + (v9 ^ 2978);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 3 + (v10 ^ 2979);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 4 + (v11 ^ 2980);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 5 + (v12 ^ 2981);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 6 + (v13 ^ 2982);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 7 + (v14 ^ 2983);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 8 + (v15 ^ 2984);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 9 + (v0 ^ 2985);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 10 + (v1 ^ 2986);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 11 + (v2 ^ 2987);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 12 + (v3 ^ 2988);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 13 + (v4 ^ 2989);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 1 + (v5 ^ 2990);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 2 + (v6 ^ 2991);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 3 + (v7 ^ 2992);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 4 + (v8 ^ 2993);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 5 + (v9 ^ 2994);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 6 + (v10 ^ 2995);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 7 + (v11 ^ 2996);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 8 + (v12 ^ 2997);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 9 + (v13 ^ 2998);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 10 + (v14 ^ 2999);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 11 + (v15 ^ 3000);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 12 + (v0 ^ 3001);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 13 + (v1 ^ 3002);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 1 + (v2 ^ 3003);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 2 + (v3 ^ 3004);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 3 + (v4 ^ 3005);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 4 + (v5 ^ 3006);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 5 + (v6 ^ 3007);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 6 + (v7 ^ 3008);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 7 + (v8 ^ 3009);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 8 + (v9 ^ 3010);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 9 + (v10 ^ 3011);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 10 + (v11 ^ 3012);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 11 + (v12 ^ 3013);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 12 + (v13 ^ 3014);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 13 + (v14 ^ 3015);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 1 + (v15 ^ 3016);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 2 + (v0 ^ 3017);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 3 + (v1 ^ 3018);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 4 + (v2 ^ 3019);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 5 + (v3 ^ 3020);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 6 + (v4 ^ 3021);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 7 + (v5 ^ 3022);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 8 + (v6 ^ 3023);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 9 + (v7 ^ 3024);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 10 + (v8 ^ 3025);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 11 + (v9 ^ 3026);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 12 + (v10 ^ 3027);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 13 + (v11 ^ 3028);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 1 + (v12 ^ 3029);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 2 + (v13 ^ 3030);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 3 + (v14 ^ 3031);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 4 + (v15 ^ 3032);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 5 + (v0 ^ 3033);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 6 + (v1 ^ 3034);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 7 + (v2 ^ 3035);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 8 + (v3 ^ 3036);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 9 + (v4 ^ 3037);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 10 + (v5 ^ 3038);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 11 + (v6 ^ 3039);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 12 + (v7 ^ 3040);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 13 + (v8 ^ 3041);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 1 + (v9 ^ 3042);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 2 + (v10 ^ 3043);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 3 + (v11 ^ 3044);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 4 + (v12 ^ 3045);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 5 + (v13 ^ 3046);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 6 + (v14 ^ 3047);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 7 + (v15 ^ 3048);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 8 + (v0 ^ 3049);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 9 + (v1 ^ 3050);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 10 + (v2 ^ 3051);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 11 + (v3 ^ 3052);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 12 + (v4 ^ 3053);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 13 + (v5 ^ 3054);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 1 + (v6 ^ 3055);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 2 + (v7 ^ 3056);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 3 + (v8 ^ 3057);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 4 + (v9 ^ 3058);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 5 + (v10 ^ 3059);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 6 + (v11 ^ 3060);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 7 + (v12 ^ 3061);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 8 + (v13 ^ 3062);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 9 + (v14 ^ 3063);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 10 + (v15 ^ 3064);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 11 + (v0 ^ 3065);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 12 + (v1 ^ 3066);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 13 + (v2 ^ 3067);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 1 + (v3 ^ 3068);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 2 + (v4 ^ 3069);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 3 + (v5 ^ 3070);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 4 + (v6 ^ 3071);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 5 + (v7 ^ 3072);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 6 + (v8 ^ 3073);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 7 + (v9 ^ 3074);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 8 + (v10 ^ 3075);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 9 + (v11 ^ 3076);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 10 + (v12 ^ 3077);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 11 + (v13 ^ 3078);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 12 + (v14 ^ 3079);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 13 + (v15 ^ 3080);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 1 + (v0 ^ 3081);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 2 + (v1 ^ 3082);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 3 + (v2 ^ 3083);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 4 + (v3 ^ 3084);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 5 + (v4 ^ 3085);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 6 + (v5 ^ 3086);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 7 + (v6 ^ 3087);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 8 + (v7 ^ 3088);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 9 + (v8 ^ 3089);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 10 + (v9 ^ 3090);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 11 + (v10 ^ 3091);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 12 + (v11 ^ 3092);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 13 + (v12 ^ 3093);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 1 + (v13 ^ 3094);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 2 + (v14 ^ 3095);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 3 + (v15 ^ 3096);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 4 + (v0 ^ 3097);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 5 + (v1 ^ 3098);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 6 + (v2 ^ 3099);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 7 + (v3 ^ 3100);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 8 + (v4 ^ 3101);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 9 + (v5 ^ 3102);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 10 + (v6 ^ 3103);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 11 + (v7 ^ 3104);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 12 + (v8 ^ 3105);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 13 + (v9 ^ 3106);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 1 + (v10 ^ 3107);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 2 + (v11 ^ 3108);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 3 + (v12 ^ 3109);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 4 + (v13 ^ 3110);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 5 + (v14 ^ 3111);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 6 + (v15 ^ 3112);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 7 + (v0 ^ 3113);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 8 + (v1 ^ 3114);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 9 + (v2 ^ 3115);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 10 + (v3 ^ 3116);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 11 + (v4 ^ 3117);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 12 + (v5 ^ 3118);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 13 + (v6 ^ 3119);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 1 + (v7 ^ 3120);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 2 + (v8 ^ 3121);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 3 + (v9 ^ 3122);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 4 + (v10 ^ 3123);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 5 + (v11 ^ 3124);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 6 + (v12 ^ 3125);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 7 + (v13 ^ 3126);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 8 + (v14 ^ 3127);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 9 + (v15 ^ 3128);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 10 + (v0 ^ 3129);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 11 + (v1 ^ 3130);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 12 + (v2 ^ 3131);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 13 + (v3 ^ 3132);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 1 + (v4 ^ 3133);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 2 + (v5 ^ 3134);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 3 + (v6 ^ 3135);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 4 + (v7 ^ 3136);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 5 + (v8 ^ 3137);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 6 + (v9 ^ 3138);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 7 + (v10 ^ 3139);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 8 + (v11 ^ 3140);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 9 + (v12 ^ 3141);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 10 + (v13 ^ 3142);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 11 + (v14 ^ 3143);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 12 + (v15 ^ 3144);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 13 + (v0 ^ 3145);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 1 + (v1 ^ 3146);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 2 + (v2 ^ 3147);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 3 + (v3 ^ 3148);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 4 + (v4 ^ 3149);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 5 + (v5 ^ 3150);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 6 + (v6 ^ 3151);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 7 + (v7 ^ 3152);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 8 + (v8 ^ 3153);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 9 + (v9 ^ 3154);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 10 + (v10 ^ 3155);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 11 + (v11 ^ 3156);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 12 + (v12 ^ 3157);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 13 + (v13 ^ 3158);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 1 + (v14 ^ 3159);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 2 + (v15 ^ 3160);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 3 + (v0 ^ 3161);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 4 + (v1 ^ 3162);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 5 + (v2 ^ 3163);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 6 + (v3 ^ 3164);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 7 + (v4 ^ 3165);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 8 + (v5 ^ 3166);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 9 + (v6 ^ 3167);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 10 + (v7 ^ 3168);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 11 + (v8 ^ 3169);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 12 + (v9 ^ 3170);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 13 + (v10 ^ 3171);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 1 + (v11 ^ 3172);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 2 + (v12 ^ 3173);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 3 + (v13 ^ 3174);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 4 + (v14 ^ 3175);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 5 + (v15 ^ 3176);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 6 + (v0 ^ 3177);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 7 + (v1 ^ 3178);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 8 + (v2 ^ 3179);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 9 + (v3 ^ 3180);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 10 + (v4 ^ 3181);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 11 + (v5 ^ 3182);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 12 + (v6 ^ 3183);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 13 + (v7 ^ 3184);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 1 + (v8 ^ 3185);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 2 + (v9 ^ 3186);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 3 + (v10 ^ 3187);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 4 + (v11 ^ 3188);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 5 + (v12 ^ 3189);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 6 + (v13 ^ 3190);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 7 + (v14 ^ 3191);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 8 + (v15 ^ 3192);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 9 + (v0 ^ 3193);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 10 + (v1 ^ 3194);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 11 + (v2 ^ 3195);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 12 + (v3 ^ 3196);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 13 + (v4 ^ 3197);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 1 + (v5 ^ 3198);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 2 + (v6 ^ 3199);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 3 + (v7 ^ 3200);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 4 + (v8 ^ 3201);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 5 + (v9 ^ 3202);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 6 + (v10 ^ 3203);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 7 + (v11 ^ 3204);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 8 + (v12 ^ 3205);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 9 + (v13 ^ 3206);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 10 + (v14 ^ 3207);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 11 + (v15 ^ 3208);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 12 + (v0 ^ 3209);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 13 + (v1 ^ 3210);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 1 + (v2 ^ 3211);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 2 + (v3 ^ 3212);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 3 + (v4 ^ 3213);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 4 + (v5 ^ 3214);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 5 + (v6 ^ 3215);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 6 + (v7 ^ 3216);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 7 + (v8 ^ 3217);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 8 + (v9 ^ 3218);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 9 + (v10 ^ 3219);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 10 + (v11 ^ 3220);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 11 + (v12 ^ 3221);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 12 + (v13 ^ 3222);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 13 + (v14 ^ 3223);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 1 + (v15 ^ 3224);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 2 + (v0 ^ 3225);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 3 + (v1 ^ 3226);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 4 + (v2 ^ 3227);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 5 + (v3 ^ 3228);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 6 + (v4 ^ 3229);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 7 + (v5 ^ 3230);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 8 + (v6 ^ 3231);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 9 + (v7 ^ 3232);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 10 + (v8 ^ 3233);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 11 + (v9 ^ 3234);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 12 + (v10 ^ 3235);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 13 + (v11 ^ 3236);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 1 + (v12 ^ 3237);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 2 + (v13 ^ 3238);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 3 + (v14 ^ 3239);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 4 + (v15 ^ 3240);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 5 + (v0 ^ 3241);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 6 + (v1 ^ 3242);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 7 + (v2 ^ 3243);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 8 + (v3 ^ 3244);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 9 + (v4 ^ 3245);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 10 + (v5 ^ 3246);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 11 + (v6 ^ 3247);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 12 + (v7 ^ 3248);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 13 + (v8 ^ 3249);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 1 + (v9 ^ 3250);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 2 + (v10 ^ 3251);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 3 + (v11 ^ 3252);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 4 + (v12 ^ 3253);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 5 + (v13 ^ 3254);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 6 + (v14 ^ 3255);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 7 + (v15 ^ 3256);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 8 + (v0 ^ 3257);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 9 + (v1 ^ 3258);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 10 + (v2 ^ 3259);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 11 + (v3 ^ 3260);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 12 + (v4 ^ 3261);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 13 + (v5 ^ 3262);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 1 + (v6 ^ 3263);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 2 + (v7 ^ 3264);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 3 + (v8 ^ 3265);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 4 + (v9 ^ 3266);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 5 + (v10 ^ 3267);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 6 + (v11 ^ 3268);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 7 + (v12 ^ 3269);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 8 + (v13 ^ 3270);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 9 + (v14 ^ 3271);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 10 + (v15 ^ 3272);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 11 + (v0 ^ 3273);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 12 + (v1 ^ 3274);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 13 + (v2 ^ 3275);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 1 + (v3 ^ 3276);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 2 + (v4 ^ 3277);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 3 + (v5 ^ 3278);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 4 + (v6 ^ 3279);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 5 + (v7 ^ 3280);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 6 + (v8 ^ 3281);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 7 + (v9 ^ 3282);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 8 + (v10 ^ 3283);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 9 + (v11 ^ 3284);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 10 + (v12 ^ 3285);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 11 + (v13 ^ 3286);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 12 + (v14 ^ 3287);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 13 + (v15 ^ 3288);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 1 + (v0 ^ 3289);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 2 + (v1 ^ 3290);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 3 + (v2 ^ 3291);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 4 + (v3 ^ 3292);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 5 + (v4 ^ 3293);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 6 + (v5 ^ 3294);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 7 + (v6 ^ 3295);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 8 + (v7 ^ 3296);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 9 + (v8 ^ 3297);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 10 + (v9 ^ 3298);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 11 + (v10 ^ 3299);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 12 + (v11 ^ 3300);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 13 + (v12 ^ 3301);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 1 + (v13 ^ 3302);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 2 + (v14 ^ 3303);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 3 + (v15 ^ 3304);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 4 + (v0 ^ 3305);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 5 + (v1 ^ 3306);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 6 + (v2 ^ 3307);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 7 + (v3 ^ 3308);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 8 + (v4 ^ 3309);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 9 + (v5 ^ 3310);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 10 + (v6 ^ 3311);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 11 + (v7 ^ 3312);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 12 + (v8 ^ 3313);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 13 + (v9 ^ 3314);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 1 + (v10 ^ 3315);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 2 + (v11 ^ 3316);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 3 + (v12 ^ 3317);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 4 + (v13 ^ 3318);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 5 + (v14 ^ 3319);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 6 + (v15 ^ 3320);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 7 + (v0 ^ 3321);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 8 + (v1 ^ 3322);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 9 + (v2 ^ 3323);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 10 + (v3 ^ 3324);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 11 + (v4 ^ 3325);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 12 + (v5 ^ 3326);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 13 + (v6 ^ 3327);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 1 + (v7 ^ 3328);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 2 + (v8 ^ 3329);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 3 + (v9 ^ 3330);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 4 + (v10 ^ 3331);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 5 + (v11 ^ 3332);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 6 + (v12 ^ 3333);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 7 + (v13 ^ 3334);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 8 + (v14 ^ 3335);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 9 + (v15 ^ 3336);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 10 + (v0 ^ 3337);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 11 + (v1 ^ 3338);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 12 + (v2 ^ 3339);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 13 + (v3 ^ 3340);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 1 + (v4 ^ 3341);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 2 + (v5 ^ 3342);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 3 + (v6 ^ 3343);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 4 + (v7 ^ 3344);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 5 + (v8 ^ 3345);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 6 + (v9 ^ 3346);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 7 + (v10 ^ 3347);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 8 + (v11 ^ 3348);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 9 + (v12 ^ 3349);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 10 + (v13 ^ 3350);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 11 + (v14 ^ 3351);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 12 + (v15 ^ 3352);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 13 + (v0 ^ 3353);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 1 + (v1 ^ 3354);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 2 + (v2 ^ 3355);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 3 + (v3 ^ 3356);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 4 + (v4 ^ 3357);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 5 + (v5 ^ 3358);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 6 + (v6 ^ 3359);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 7 + (v7 ^ 3360);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 8 + (v8 ^ 3361);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 9 + (v9 ^ 3362);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 10 + (v10 ^ 3363);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 11 + (v11 ^ 3364);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 12 + (v12 ^ 3365);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 13 + (v13 ^ 3366);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 1 + (v14 ^ 3367);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 2 + (v15 ^ 3368);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 3 + (v0 ^ 3369);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 4 + (v1 ^ 3370);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 5 + (v2 ^ 3371);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 6 + (v3 ^ 3372);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 7 + (v4 ^ 3373);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 8 + (v5 ^ 3374);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 9 + (v6 ^ 3375);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 10 + (v7 ^ 3376);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 11 + (v8 ^ 3377);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 12 + (v9 ^ 3378);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 13 + (v10 ^ 3379);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 1 + (v11 ^ 3380);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 2 + (v12 ^ 3381);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 3 + (v13 ^ 3382);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 4 + (v14 ^ 3383);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 5 + (v15 ^ 3384);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 6 + (v0 ^ 3385);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 7 + (v1 ^ 3386);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 8 + (v2 ^ 3387);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 9 + (v3 ^ 3388);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 10 + (v4 ^ 3389);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 11 + (v5 ^ 3390);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 12 + (v6 ^ 3391);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 13 + (v7 ^ 3392);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 1 + (v8 ^ 3393);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 2 + (v9 ^ 3394);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 3 + (v10 ^ 3395);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 4 + (v11 ^ 3396);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 5 + (v12 ^ 3397);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 6 + (v13 ^ 3398);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 7 + (v14 ^ 3399);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 8 + (v15 ^ 3400);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 9 + (v0 ^ 3401);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 10 + (v1 ^ 3402);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 11 + (v2 ^ 3403);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 12 + (v3 ^ 3404);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 13 + (v4 ^ 3405);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 1 + (v5 ^ 3406);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 2 + (v6 ^ 3407);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 3 + (v7 ^ 3408);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 4 + (v8 ^ 3409);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 5 + (v9 ^ 3410);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 6 + (v10 ^ 3411);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 7 + (v11 ^ 3412);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 8 + (v12 ^ 3413);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 9 + (v13 ^ 3414);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 10 + (v14 ^ 3415);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 11 + (v15 ^ 3416);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 12 + (v0 ^ 3417);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 13 + (v1 ^ 3418);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 1 + (v2 ^ 3419);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 2 + (v3 ^ 3420);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 3 + (v4 ^ 3421);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 4 + (v5 ^ 3422);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 5 + (v6 ^ 3423);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 6 + (v7 ^ 3424);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 7 + (v8 ^ 3425);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 8 + (v9 ^ 3426);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 9 + (v10 ^ 3427);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 10 + (v11 ^ 3428);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 11 + (v12 ^ 3429);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 12 + (v13 ^ 3430);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 13 + (v14 ^ 3431);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 1 + (v15 ^ 3432);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 2 + (v0 ^ 3433);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 3 + (v1 ^ 3434);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 4 + (v2 ^ 3435);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 5 + (v3 ^ 3436);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 6 + (v4 ^ 3437);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 7 + (v5 ^ 3438);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 8 + (v6 ^ 3439);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 9 + (v7 ^ 3440);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 10 + (v8 ^ 3441);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 11 + (v9 ^ 3442);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 12 + (v10 ^ 3443);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 13 + (v11 ^ 3444);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 1 + (v12 ^ 3445);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 2 + (v13 ^ 3446);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 3 + (v14 ^ 3447);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 4 + (v15 ^ 3448);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 5 + (v0 ^ 3449);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 6 + (v1 ^ 3450);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 7 + (v2 ^ 3451);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 8 + (v3 ^ 3452);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 9 + (v4 ^ 3453);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 10 + (v5 ^ 3454);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 11 + (v6 ^ 3455);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 12 + (v7 ^ 3456);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 13 + (v8 ^ 3457);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 1 + (v9 ^ 3458);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 2 + (v10 ^ 3459);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 3 + (v11 ^ 3460);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 4 + (v12 ^ 3461);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 5 + (v13 ^ 3462);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 6 + (v14 ^ 3463);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 7 + (v15 ^ 3464);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 8 + (v0 ^ 3465);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 9 + (v1 ^ 3466);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 10 + (v2 ^ 3467);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 11 + (v3 ^ 3468);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 12 + (v4 ^ 3469);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 13 + (v5 ^ 3470);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 1 + (v6 ^ 3471);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 2 + (v7 ^ 3472);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 3 + (v8 ^ 3473);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 4 + (v9 ^ 3474);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 5 + (v10 ^ 3475);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 6 + (v11 ^ 3476);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 7 + (v12 ^ 3477);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 8 + (v13 ^ 3478);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 9 + (v14 ^ 3479);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 10 + (v15 ^ 3480);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 11 + (v0 ^ 3481);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 12 + (v1 ^ 3482);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 13 + (v2 ^ 3483);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 1 + (v3 ^ 3484);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 2 + (v4 ^ 3485);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 3 + (v5 ^ 3486);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 4 + (v6 ^ 3487);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 5 + (v7 ^ 3488);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 6 + (v8 ^ 3489);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 7 + (v9 ^ 3490);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 8 + (v10 ^ 3491);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 9 + (v11 ^ 3492);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 10 + (v12 ^ 3493);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 11 + (v13 ^ 3494);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 12 + (v14 ^ 3495);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 13 + (v15 ^ 3496);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 1 + (v0 ^ 3497);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 2 + (v1 ^ 3498);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 3 + (v2 ^ 3499);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 4 + (v3 ^ 3500);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 5 + (v4 ^ 3501);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 6 + (v5 ^ 3502);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 7 + (v6 ^ 3503);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 8 + (v7 ^ 3504);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 9 + (v8 ^ 3505);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 10 + (v9 ^ 3506);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 11 + (v10 ^ 3507);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 12 + (v11 ^ 3508);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 13 + (v12 ^ 3509);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 1 + (v13 ^ 3510);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 2 + (v14 ^ 3511);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 3 + (v15 ^ 3512);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 4 + (v0 ^ 3513);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 5 + (v1 ^ 3514);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 6 + (v2 ^ 3515);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 7 + (v3 ^ 3516);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 8 + (v4 ^ 3517);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 9 + (v5 ^ 3518);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 10 + (v6 ^ 3519);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 11 + (v7 ^ 3520);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 12 + (v8 ^ 3521);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 13 + (v9 ^ 3522);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 1 + (v10 ^ 3523);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 2 + (v11 ^ 3524);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 3 + (v12 ^ 3525);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 4 + (v13 ^ 3526);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 5 + (v14 ^ 3527);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 6 + (v15 ^ 3528);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 7 + (v0 ^ 3529);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 8 + (v1 ^ 3530);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 9 + (v2 ^ 3531);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 10 + (v3 ^ 3532);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 11 + (v4 ^ 3533);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 12 + (v5 ^ 3534);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 13 + (v6 ^ 3535);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 1 + (v7 ^ 3536);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 2 + (v8 ^ 3537);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 3 + (v9 ^ 3538);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 4 + (v10 ^ 3539);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 5 + (v11 ^ 3540);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 6 + (v12 ^ 3541);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 7 + (v13 ^ 3542);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 8 + (v14 ^ 3543);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 9 + (v15 ^ 3544);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 10 + (v0 ^ 3545);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 11 + (v1 ^ 3546);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 12 + (v2 ^ 3547);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 13 + (v3 ^ 3548);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 1 + (v4 ^ 3549);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 2 + (v5 ^ 3550);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 3 + (v6 ^ 3551);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 4 + (v7 ^ 3552);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 5 + (v8 ^ 3553);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 6 + (v9 ^ 3554);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 7 + (v10 ^ 3555);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 8 + (v11 ^ 3556);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 9 + (v12 ^ 3557);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 10 + (v13 ^ 3558);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 11 + (v14 ^ 3559);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 12 + (v15 ^ 3560);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 13 + (v0 ^ 3561);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 1 + (v1 ^ 3562);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 2 + (v2 ^ 3563);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 3 + (v3 ^ 3564);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 4 + (v4 ^ 3565);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 5 + (v5 ^ 3566);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 6 + (v6 ^ 3567);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 7 + (v7 ^ 3568);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 8 + (v8 ^ 3569);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 9 + (v9 ^ 3570);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 10 + (v10 ^ 3571);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 11 + (v11 ^ 3572);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 12 + (v12 ^ 3573);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 13 + (v13 ^ 3574);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 1 + (v14 ^ 3575);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 2 + (v15 ^ 3576);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 3 + (v0 ^ 3577);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 4 + (v1 ^ 3578);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 5 + (v2 ^ 3579);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 6 + (v3 ^ 3580);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 7 + (v4 ^ 3581);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 8 + (v5 ^ 3582);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 9 + (v6 ^ 3583);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 10 + (v7 ^ 3584);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 11 + (v8 ^ 3585);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 12 + (v9 ^ 3586);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 13 + (v10 ^ 3587);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 1 + (v11 ^ 3588);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 2 + (v12 ^ 3589);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 3 + (v13 ^ 3590);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 4 + (v14 ^ 3591);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 5 + (v15 ^ 3592);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 6 + (v0 ^ 3593);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 7 + (v1 ^ 3594);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 8 + (v2 ^ 3595);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 9 + (v3 ^ 3596);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 10 + (v4 ^ 3597);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 11 + (v5 ^ 3598);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 12 + (v6 ^ 3599);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 13 + (v7 ^ 3600);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 1 + (v8 ^ 3601);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 2 + (v9 ^ 3602);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 3 + (v10 ^ 3603);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 4 + (v11 ^ 3604);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 5 + (v12 ^ 3605);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 6 + (v13 ^ 3606);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 7 + (v14 ^ 3607);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 8 + (v15 ^ 3608);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 9 + (v0 ^ 3609);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 10 + (v1 ^ 3610);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 11 + (v2 ^ 3611);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 12 + (v3 ^ 3612);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 13 + (v4 ^ 3613);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 1 + (v5 ^ 3614);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 2 + (v6 ^ 3615);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 3 + (v7 ^ 3616);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 4 + (v8 ^ 3617);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 5 + (v9 ^ 3618);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 6 + (v10 ^ 3619);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 7 + (v11 ^ 3620);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 8 + (v12 ^ 3621);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 9 + (v13 ^ 3622);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 10 + (v14 ^ 3623);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 11 + (v15 ^ 3624);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 12 + (v0 ^ 3625);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 13 + (v1 ^ 3626);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 1 + (v2 ^ 3627);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 2 + (v3 ^ 3628);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 3 + (v4 ^ 3629);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 4 + (v5 ^ 3630);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 5 + (v6 ^ 3631);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 6 + (v7 ^ 3632);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 7 + (v8 ^ 3633);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 8 + (v9 ^ 3634);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 9 + (v10 ^ 3635);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 10 + (v11 ^ 3636);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 11 + (v12 ^ 3637);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 12 + (v13 ^ 3638);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 13 + (v14 ^ 3639);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 1 + (v15 ^ 3640);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 2 + (v0 ^ 3641);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 3 + (v1 ^ 3642);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 4 + (v2 ^ 3643);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 5 + (v3 ^ 3644);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 6 + (v4 ^ 3645);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 7 + (v5 ^ 3646);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 8 + (v6 ^ 3647);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 9 + (v7 ^ 3648);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 10 + (v8 ^ 3649);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 11 + (v9 ^ 3650);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 12 + (v10 ^ 3651);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 13 + (v11 ^ 3652);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 1 + (v12 ^ 3653);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 2 + (v13 ^ 3654);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 3 + (v14 ^ 3655);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 4 + (v15 ^ 3656);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 5 + (v0 ^ 3657);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 6 + (v1 ^ 3658);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 7 + (v2 ^ 3659);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 8 + (v3 ^ 3660);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 9 + (v4 ^ 3661);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 10 + (v5 ^ 3662);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 11 + (v6 ^ 3663);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 12 + (v7 ^ 3664);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 13 + (v8 ^ 3665);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 1 + (v9 ^ 3666);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 2 + (v10 ^ 3667);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 3 + (v11 ^ 3668);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 4 + (v12 ^ 3669);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 5 + (v13 ^ 3670);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 6 + (v14 ^ 3671);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 7 + (v15 ^ 3672);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 8 + (v0 ^ 3673);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 9 + (v1 ^ 3674);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 10 + (v2 ^ 3675);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 11 + (v3 ^ 3676);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 12 + (v4 ^ 3677);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 13 + (v5 ^ 3678);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 1 + (v6 ^ 3679);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 2 + (v7 ^ 3680);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 3 + (v8 ^ 3681);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 4 + (v9 ^ 3682);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 5 + (v10 ^ 3683);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 6 + (v11 ^ 3684);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 7 + (v12 ^ 3685);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 8 + (v13 ^ 3686);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 9 + (v14 ^ 3687);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 10 + (v15 ^ 3688);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 11 + (v0 ^ 3689);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 12 + (v1 ^ 3690);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 13 + (v2 ^ 3691);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 1 + (v3 ^ 3692);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 2 + (v4 ^ 3693);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 3 + (v5 ^ 3694);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 4 + (v6 ^ 3695);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 5 + (v7 ^ 3696);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 6 + (v8 ^ 3697);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 7 + (v9 ^ 3698);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 8 + (v10 ^ 3699);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 9 + (v11 ^ 3700);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 10 + (v12 ^ 3701);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 11 + (v13 ^ 3702);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 12 + (v14 ^ 3703);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 13 + (v15 ^ 3704);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 1 + (v0 ^ 3705);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 2 + (v1 ^ 3706);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 3 + (v2 ^ 3707);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 4 + (v3 ^ 3708);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 5 + (v4 ^ 3709);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 6 + (v5 ^ 3710);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 7 + (v6 ^ 3711);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 8 + (v7 ^ 3712);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 9 + (v8 ^ 3713);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 10 + (v9 ^ 3714);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 11 + (v10 ^ 3715);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 12 + (v11 ^ 3716);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 13 + (v12 ^ 3717);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 1 + (v13 ^ 3718);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 2 + (v14 ^ 3719);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 3 + (v15 ^ 3720);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 4 + (v0 ^ 3721);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 5 + (v1 ^ 3722);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 6 + (v2 ^ 3723);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 7 + (v3 ^ 3724);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 8 + (v4 ^ 3725);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 9 + (v5 ^ 3726);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 10 + (v6 ^ 3727);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 11 + (v7 ^ 3728);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 12 + (v8 ^ 3729);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 13 + (v9 ^ 3730);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 1 + (v10 ^ 3731);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 2 + (v11 ^ 3732);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 3 + (v12 ^ 3733);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 4 + (v13 ^ 3734);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 5 + (v14 ^ 3735);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 6 + (v15 ^ 3736);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 7 + (v0 ^ 3737);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 8 + (v1 ^ 3738);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 9 + (v2 ^ 3739);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 10 + (v3 ^ 3740);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 11 + (v4 ^ 3741);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 12 + (v5 ^ 3742);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 13 + (v6 ^ 3743);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 1 + (v7 ^ 3744);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 2 + (v8 ^ 3745);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 3 + (v9 ^ 3746);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 4 + (v10 ^ 3747);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 5 + (v11 ^ 3748);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 6 + (v12 ^ 3749);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 7 + (v13 ^ 3750);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 8 + (v14 ^ 3751);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 9 + (v15 ^ 3752);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 10 + (v0 ^ 3753);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 11 + (v1 ^ 3754);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 12 + (v2 ^ 3755);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 13 + (v3 ^ 3756);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 1 + (v4 ^ 3757);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 2 + (v5 ^ 3758);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 3 + (v6 ^ 3759);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 4 + (v7 ^ 3760);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 5 + (v8 ^ 3761);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 6 + (v9 ^ 3762);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 7 + (v10 ^ 3763);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 8 + (v11 ^ 3764);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 9 + (v12 ^ 3765);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 10 + (v13 ^ 3766);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 11 + (v14 ^ 3767);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 12 + (v15 ^ 3768);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 13 + (v0 ^ 3769);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 1 + (v1 ^ 3770);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 2 + (v2 ^ 3771);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 3 + (v3 ^ 3772);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 4 + (v4 ^ 3773);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 5 + (v5 ^ 3774);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 6 + (v6 ^ 3775);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 7 + (v7 ^ 3776);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 8 + (v8 ^ 3777);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 9 + (v9 ^ 3778);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 10 + (v10 ^ 3779);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 11 + (v11 ^ 3780);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 12 + (v12 ^ 3781);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 13 + (v13 ^ 3782);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 1 + (v14 ^ 3783);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 2 + (v15 ^ 3784);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 3 + (v0 ^ 3785);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 4 + (v1 ^ 3786);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 5 + (v2 ^ 3787);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 6 + (v3 ^ 3788);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 7 + (v4 ^ 3789);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 8 + (v5 ^ 3790);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 9 + (v6 ^ 3791);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 10 + (v7 ^ 3792);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 11 + (v8 ^ 3793);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 12 + (v9 ^ 3794);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 13 + (v10 ^ 3795);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 1 + (v11 ^ 3796);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 2 + (v12 ^ 3797);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 3 + (v13 ^ 3798);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 4 + (v14 ^ 3799);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 5 + (v15 ^ 3800);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 6 + (v0 ^ 3801);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 7 + (v1 ^ 3802);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 8 + (v2 ^ 3803);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 9 + (v3 ^ 3804);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 10 + (v4 ^ 3805);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 11 + (v5 ^ 3806);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 12 + (v6 ^ 3807);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 13 + (v7 ^ 3808);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 1 + (v8 ^ 3809);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 2 + (v9 ^ 3810);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 3 + (v10 ^ 3811);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 4 + (v11 ^ 3812);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 5 + (v12 ^ 3813);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 6 + (v13 ^ 3814);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 7 + (v14 ^ 3815);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 8 + (v15 ^ 3816);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 9 + (v0 ^ 3817);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 10 + (v1 ^ 3818);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 11 + (v2 ^ 3819);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 12 + (v3 ^ 3820);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 13 + (v4 ^ 3821);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 1 + (v5 ^ 3822);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 2 + (v6 ^ 3823);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    v0 = v3 * 3 + (v7 ^ 3824);
+    if (v0 > 100000)
+        v0 = v0 % 9;
+    v1 = v4 * 4 + (v8 ^ 3825);
+    if (v1 > 100000)
+        v1 = v1 % 10;
+    v2 = v5 * 5 + (v9 ^ 3826);
+    if (v2 > 100000)
+        v2 = v2 % 11;
+    v3 = v6 * 6 + (v10 ^ 3827);
+    if (v3 > 100000)
+        v3 = v3 % 12;
+    v4 = v7 * 7 + (v11 ^ 3828);
+    if (v4 > 100000)
+        v4 = v4 % 2;
+    v5 = v8 * 8 + (v12 ^ 3829);
+    if (v5 > 100000)
+        v5 = v5 % 3;
+    v6 = v9 * 9 + (v13 ^ 3830);
+    if (v6 > 100000)
+        v6 = v6 % 4;
+    v7 = v10 * 10 + (v14 ^ 3831);
+    if (v7 > 100000)
+        v7 = v7 % 5;
+    v8 = v11 * 11 + (v15 ^ 3832);
+    if (v8 > 100000)
+        v8 = v8 % 6;
+    v9 = v12 * 12 + (v0 ^ 3833);
+    if (v9 > 100000)
+        v9 = v9 % 7;
+    v10 = v13 * 13 + (v1 ^ 3834);
+    if (v10 > 100000)
+        v10 = v10 % 8;
+    v11 = v14 * 1 + (v2 ^ 3835);
+    if (v11 > 100000)
+        v11 = v11 % 9;
+    v12 = v15 * 2 + (v3 ^ 3836);
+    if (v12 > 100000)
+        v12 = v12 % 10;
+    v13 = v0 * 3 + (v4 ^ 3837);
+    if (v13 > 100000)
+        v13 = v13 % 11;
+    v14 = v1 * 4 + (v5 ^ 3838);
+    if (v14 > 100000)
+        v14 = v14 % 12;
+    v15 = v2 * 5 + (v6 ^ 3839);
+    if (v15 > 100000)
+        v15 = v15 % 2;
+    v0 = v3 * 6 + (v7 ^ 3840);
+    if (v0 > 100000)
+        v0 = v0 % 3;
+    v1 = v4 * 7 + (v8 ^ 3841);
+    if (v1 > 100000)
+        v1 = v1 % 4;
+    v2 = v5 * 8 + (v9 ^ 3842);
+    if (v2 > 100000)
+        v2 = v2 % 5;
+    v3 = v6 * 9 + (v10 ^ 3843);
+    if (v3 > 100000)
+        v3 = v3 % 6;
+    v4 = v7 * 10 + (v11 ^ 3844);
+    if (v4 > 100000)
+        v4 = v4 % 7;
+    v5 = v8 * 11 + (v12 ^ 3845);
+    if (v5 > 100000)
+        v5 = v5 % 8;
+    v6 = v9 * 12 + (v13 ^ 3846);
+    if (v6 > 100000)
+        v6 = v6 % 9;
+    v7 = v10 * 13 + (v14 ^ 3847);
+    if (v7 > 100000)
+        v7 = v7 % 10;
+    v8 = v11 * 1 + (v15 ^ 3848);
+    if (v8 > 100000)
+        v8 = v8 % 11;
+    v9 = v12 * 2 + (v0 ^ 3849);
+    if (v9 > 100000)
+        v9 = v9 % 12;
+    v10 = v13 * 3 + (v1 ^ 3850);
+    if (v10 > 100000)
+        v10 = v10 % 2;
+    v11 = v14 * 4 + (v2 ^ 3851);
+    if (v11 > 100000)
+        v11 = v11 % 3;
+    v12 = v15 * 5 + (v3 ^ 3852);
+    if (v12 > 100000)
+        v12 = v12 % 4;
+    v13 = v0 * 6 + (v4 ^ 3853);
+    if (v13 > 100000)
+        v13 = v13 % 5;
+    v14 = v1 * 7 + (v5 ^ 3854);
+    if (v14 > 100000)
+        v14 = v14 % 6;
+    v15 = v2 * 8 + (v6 ^ 3855);
+    if (v15 > 100000)
+        v15 = v15 % 7;
+    v0 = v3 * 9 + (v7 ^ 3856);
+    if (v0 > 100000)
+        v0 = v0 % 8;
+    v1 = v4 * 10 + (v8 ^ 3857);
+    if (v1 > 100000)
+        v1 = v1 % 9;
+    v2 = v5 * 11 + (v9 ^ 3858);
+    if (v2 > 100000)
+        v2 = v2 % 10;
+    v3 = v6 * 12 + (v10 ^ 3859);
+    if (v3 > 100000)
+        v3 = v3 % 11;
+    v4 = v7 * 13 + (v11 ^ 3860);
+    if (v4 > 100000)
+        v4 = v4 % 12;
+    v5 = v8 * 1 + (v12 ^ 3861);
+    if (v5 > 100000)
+        v5 = v5 % 2;
+    v6 = v9 * 2 + (v13 ^ 3862);
+    if (v6 > 100000)
+        v6 = v6 % 3;
+    v7 = v10 * 3 + (v14 ^ 3863);
+    if (v7 > 100000)
+        v7 = v7 % 4;
+    v8 = v11 * 4 + (v15 ^ 3864);
+    if (v8 > 100000)
+        v8 = v8 % 5;
+    v9 = v12 * 5 + (v0 ^ 3865);
+    if (v9 > 100000)
+        v9 = v9 % 6;
+    v10 = v13 * 6 + (v1 ^ 3866);
+    if (v10 > 100000)
+        v10 = v10 % 7;
+    v11 = v14 * 7 + (v2 ^ 3867);
+    if (v11 > 100000)
+        v11 = v11 % 8;
+    v12 = v15 * 8 + (v3 ^ 3868);
+    if (v12 > 100000)
+        v12 = v12 % 9;
+    v13 = v0 * 9 + (v4 ^ 3869);
+    if (v13 > 100000)
+        v13 = v13 % 10;
+    v14 = v1 * 10 + (v5 ^ 3870);
+    if (v14 > 100000)
+        v14 = v14 % 11;
+    v15 = v2 * 11 + (v6 ^ 3871);
+    if (v15 > 100000)
+        v15 = v15 % 12;
+    v0 = v3 * 12 + (v7 ^ 3872);
+    if (v0 > 100000)
+        v0 = v0 % 2;
+    v1 = v4 * 13 + (v8 ^ 3873);
+    if (v1 > 100000)
+        v1 = v1 % 3;
+    v2 = v5 * 1 + (v9 ^ 3874);
+    if (v2 > 100000)
+        v2 = v2 % 4;
+    v3 = v6 * 2 + (v10 ^ 3875);
+    if (v3 > 100000)
+        v3 = v3 % 5;
+    v4 = v7 * 3 + (v11 ^ 3876);
+    if (v4 > 100000)
+        v4 = v4 % 6;
+    v5 = v8 * 4 + (v12 ^ 3877);
+    if (v5 > 100000)
+        v5 = v5 % 7;
+    v6 = v9 * 5 + (v13 ^ 3878);
+    if (v6 > 100000)
+        v6 = v6 % 8;
+    v7 = v10 * 6 + (v14 ^ 3879);
+    if (v7 > 100000)
+        v7 = v7 % 9;
+    v8 = v11 * 7 + (v15 ^ 3880);
+    if (v8 > 100000)
+        v8 = v8 % 10;
+    v9 = v12 * 8 + (v0 ^ 3881);
+    if (v9 > 100000)
+        v9 = v9 % 11;
+    v10 = v13 * 9 + (v1 ^ 3882);
+    if (v10 > 100000)
+        v10 = v10 % 12;
+    v11 = v14 * 10 + (v2 ^ 3883);
+    if (v11 > 100000)
+        v11 = v11 % 2;
+    v12 = v15 * 11 + (v3 ^ 3884);
+    if (v12 > 100000)
+        v12 = v12 % 3;
+    v13 = v0 * 12 + (v4 ^ 3885);
+    if (v13 > 100000)
+        v13 = v13 % 4;
+    v14 = v1 * 13 + (v5 ^ 3886);
+    if (v14 > 100000)
+        v14 = v14 % 5;
+    v15 = v2 * 1 + (v6 ^ 3887);
+    if (v15 > 100000)
+        v15 = v15 % 6;
+    v0 = v3 * 2 + (v7 ^ 3888);
+    if (v0 > 100000)
+        v0 = v0 % 7;
+    v1 = v4 * 3 + (v8 ^ 3889);
+    if (v1 > 100000)
+        v1 = v1 % 8;
+    v2 = v5 * 4 + (v9 ^ 3890);
+    if (v2 > 100000)
+        v2 = v2 % 9;
+    v3 = v6 * 5 + (v10 ^ 3891);
+    if (v3 > 100000)
+        v3 = v3 % 10;
+    v4 = v7 * 6 + (v11 ^ 3892);
+    if (v4 > 100000)
+        v4 = v4 % 11;
+    v5 = v8 * 7 + (v12 ^ 3893);
+    if (v5 > 100000)
+        v5 = v5 % 12;
+    v6 = v9 * 8 + (v13 ^ 3894);
+    if (v6 > 100000)
+        v6 = v6 % 2;
+    v7 = v10 * 9 + (v14 ^ 3895);
+    if (v7 > 100000)
+        v7 = v7 % 3;
+    v8 = v11 * 10 + (v15 ^ 3896);
+    if (v8 > 100000)
+        v8 = v8 % 4;
+    v9 = v12 * 11 + (v0 ^ 3897);
+    if (v9 > 100000)
+        v9 = v9 % 5;
+    v10 = v13 * 12 + (v1 ^ 3898);
+    if (v10 > 100000)
+        v10 = v10 % 6;
+    v11 = v14 * 13 + (v2 ^ 3899);
+    if (v11 > 100000)
+        v11 = v11 % 7;
+    v12 = v15 * 1 + (v3 ^ 3900);
+    if (v12 > 100000)
+        v12 = v12 % 8;
+    v13 = v0 * 2 + (v4 ^ 3901);
+    if (v13 > 100000)
+        v13 = v13 % 9;
+    v14 = v1 * 3 + (v5 ^ 3902);
+    if (v14 > 100000)
+        v14 = v14 % 10;
+    v15 = v2 * 4 + (v6 ^ 3903);
+    if (v15 > 100000)
+        v15 = v15 % 11;
+    v0 = v3 * 5 + (v7 ^ 3904);
+    if (v0 > 100000)
+        v0 = v0 % 12;
+    v1 = v4 * 6 + (v8 ^ 3905);
+    if (v1 > 100000)
+        v1 = v1 % 2;
+    v2 = v5 * 7 + (v9 ^ 3906);
+    if (v2 > 100000)
+        v2 = v2 % 3;
+    v3 = v6 * 8 + (v10 ^ 3907);
+    if (v3 > 100000)
+        v3 = v3 % 4;
+    v4 = v7 * 9 + (v11 ^ 3908);
+    if (v4 > 100000)
+        v4 = v4 % 5;
+    v5 = v8 * 10 + (v12 ^ 3909);
+    if (v5 > 100000)
+        v5 = v5 % 6;
+    v6 = v9 * 11 + (v13 ^ 3910);
+    if (v6 > 100000)
+        v6 = v6 % 7;
+    v7 = v10 * 12 + (v14 ^ 3911);
+    if (v7 > 100000)
+        v7 = v7 % 8;
+    v8 = v11 * 13 + (v15 ^ 3912);
+    if (v8 > 100000)
+        v8 = v8 % 9;
+    v9 = v12 * 1 + (v0 ^ 3913);
+    if (v9 > 100000)
+        v9 = v9 % 10;
+    v10 = v13 * 2 + (v1 ^ 3914);
+    if (v10 > 100000)
+        v10 = v10 % 11;
+    v11 = v14 * 3 + (v2 ^ 3915);
+    if (v11 > 100000)
+        v11 = v11 % 12;
+    v12 = v15 * 4 + (v3 ^ 3916);
+    if (v12 > 100000)
+        v12 = v12 % 2;
+    v13 = v0 * 5 + (v4 ^ 3917);
+    if (v13 > 100000)
+        v13 = v13 % 3;
+    v14 = v1 * 6 + (v5 ^ 3918);
+    if (v14 > 100000)
+        v14 = v14 % 4;
+    v15 = v2 * 7 + (v6 ^ 3919);
+    if (v15 > 100000)
+        v15 = v15 % 5;
+    v0 = v3 * 8 + (v7 ^ 3920);
+    if (v0 > 100000)
+        v0 = v0 % 6;
+    v1 = v4 * 9 + (v8 ^ 3921);
+    if (v1 > 100000)
+        v1 = v1 % 7;
+    v2 = v5 * 10 + (v9 ^ 3922);
+    if (v2 > 100000)
+        v2 = v2 % 8;
+    v3 = v6 * 11 + (v10 ^ 3923);
+    if (v3 > 100000)
+        v3 = v3 % 9;
+    v4 = v7 * 12 + (v11 ^ 3924);
+    if (v4 > 100000)
+        v4 = v4 % 10;
+    v5 = v8 * 13 + (v12 ^ 3925);
+    if (v5 > 100000)
+        v5 = v5 % 11;
+    v6 = v9 * 1 + (v13 ^ 3926);
+    if (v6 > 100000)
+        v6 = v6 % 12;
+    v7 = v10 * 2 + (v14 ^ 3927);
+    if (v7 > 100000)
+        v7 = v7 % 2;
+    v8 = v11 * 3 + (v15 ^ 3928);
+    if (v8 > 100000)
+        v8 = v8 % 3;
+    v9 = v12 * 4 + (v0 ^ 3929);
+    if (v9 > 100000)
+        v9 = v9 % 4;
+    v10 = v13 * 5 + (v1 ^ 3930);
+    if (v10 > 100000)
+        v10 = v10 % 5;
+    v11 = v14 * 6 + (v2 ^ 3931);
+    if (v11 > 100000)
+        v11 = v11 % 6;
+    v12 = v15 * 7 + (v3 ^ 3932);
+    if (v12 > 100000)
+        v12 = v12 % 7;
+    v13 = v0 * 8 + (v4 ^ 3933);
+    if (v13 > 100000)
+        v13 = v13 % 8;
+    v14 = v1 * 9 + (v5 ^ 3934);
+    if (v14 > 100000)
+        v14 = v14 % 9;
+    v15 = v2 * 10 + (v6 ^ 3935);
+    if (v15 > 100000)
+        v15 = v15 % 10;
+    v0 = v3 * 11 + (v7 ^ 3936);
+    if (v0 > 100000)
+        v0 = v0 % 11;
+    v1 = v4 * 12 + (v8 ^ 3937);
+    if (v1 > 100000)
+        v1 = v1 % 12;
+    v2 = v5 * 13 + (v9 ^ 3938);
+    if (v2 > 100000)
+        v2 = v2 % 2;
+    v3 = v6 * 1 + (v10 ^ 3939);
+    if (v3 > 100000)
+        v3 = v3 % 3;
+    v4 = v7 * 2 + (v11 ^ 3940);
+    if (v4 > 100000)
+        v4 = v4 % 4;
+    v5 = v8 * 3 + (v12 ^ 3941);
+    if (v5 > 100000)
+        v5 = v5 % 5;
+    v6 = v9 * 4 + (v13 ^ 3942);
+    if (v6 > 100000)
+        v6 = v6 % 6;
+    v7 = v10 * 5 + (v14 ^ 3943);
+    if (v7 > 100000)
+        v7 = v7 % 7;
+    v8 = v11 * 6 + (v15 ^ 3944);
+    if (v8 > 100000)
+        v8 = v8 % 8;
+    v9 = v12 * 7 + (v0 ^ 3945);
+    if (v9 > 100000)
+        v9 = v9 % 9;
+    v10 = v13 * 8 + (v1 ^ 3946);
+    if (v10 > 100000)
+        v10 = v10 % 10;
+    v11 = v14 * 9 + (v2 ^ 3947);
+    if (v11 > 100000)
+        v11 = v11 % 11;
+    v12 = v15 * 10 + (v3 ^ 3948);
+    if (v12 > 100000)
+        v12 = v12 % 12;
+    v13 = v0 * 11 + (v4 ^ 3949);
+    if (v13 > 100000)
+        v13 = v13 % 2;
+    v14 = v1 * 12 + (v5 ^ 3950);
+    if (v14 > 100000)
+        v14 = v14 % 3;
+    v15 = v2 * 13 + (v6 ^ 3951);
+    if (v15 > 100000)
+        v15 = v15 % 4;
+    v0 = v3 * 1 + (v7 ^ 3952);
+    if (v0 > 100000)
+        v0 = v0 % 5;
+    v1 = v4 * 2 + (v8 ^ 3953);
+    if (v1 > 100000)
+        v1 = v1 % 6;
+    v2 = v5 * 3 + (v9 ^ 3954);
+    if (v2 > 100000)
+        v2 = v2 % 7;
+    v3 = v6 * 4 + (v10 ^ 3955);
+    if (v3 > 100000)
+        v3 = v3 % 8;
+    v4 = v7 * 5 + (v11 ^ 3956);
+    if (v4 > 100000)
+        v4 = v4 % 9;
+    v5 = v8 * 6 + (v12 ^ 3957);
+    if (v5 > 100000)
+        v5 = v5 % 10;
+    v6 = v9 * 7 + (v13 ^ 3958);
+    if (v6 > 100000)
+        v6 = v6 % 11;
+    v7 = v10 * 8 + (v14 ^ 3959);
+    if (v7 > 100000)
+        v7 = v7 % 12;
+    v8 = v11 * 9 + (v15 ^ 3960);
+    if (v8 > 100000)
+        v8 = v8 % 2;
+    v9 = v12 * 10 + (v0 ^ 3961);
+    if (v9 > 100000)
+        v9 = v9 % 3;
+    v10 = v13 * 11 + (v1 ^ 3962);
+    if (v10 > 100000)
+        v10 = v10 % 4;
+    v11 = v14 * 12 + (v2 ^ 3963);
+    if (v11 > 100000)
+        v11 = v11 % 5;
+    v12 = v15 * 13 + (v3 ^ 3964);
+    if (v12 > 100000)
+        v12 = v12 % 6;
+    v13 = v0 * 1 + (v4 ^ 3965);
+    if (v13 > 100000)
+        v13 = v13 % 7;
+    v14 = v1 * 2 + (v5 ^ 3966);
+    if (v14 > 100000)
+        v14 = v14 % 8;
+    v15 = v2 * 3 + (v6 ^ 3967);
+    if (v15 > 100000)
+        v15 = v15 % 9;
+    v0 = v3 * 4 + (v7 ^ 3968);
+    if (v0 > 100000)
+        v0 = v0 % 10;
+    v1 = v4 * 5 + (v8 ^ 3969);
+    if (v1 > 100000)
+        v1 = v1 % 11;
+    v2 = v5 * 6 + (v9 ^ 3970);
+    if (v2 > 100000)
+        v2 = v2 % 12;
+    v3 = v6 * 7 + (v10 ^ 3971);
+    if (v3 > 100000)
+        v3 = v3 % 2;
+    v4 = v7 * 8 + (v11 ^ 3972);
+    if (v4 > 100000)
+        v4 = v4 % 3;
+    v5 = v8 * 9 + (v12 ^ 3973);
+    if (v5 > 100000)
+        v5 = v5 % 4;
+    v6 = v9 * 10 + (v13 ^ 3974);
+    if (v6 > 100000)
+        v6 = v6 % 5;
+    v7 = v10 * 11 + (v14 ^ 3975);
+    if (v7 > 100000)
+        v7 = v7 % 6;
+    v8 = v11 * 12 + (v15 ^ 3976);
+    if (v8 > 100000)
+        v8 = v8 % 7;
+    v9 = v12 * 13 + (v0 ^ 3977);
+    if (v9 > 100000)
+        v9 = v9 % 8;
+    v10 = v13 * 1 + (v1 ^ 3978);
+    if (v10 > 100000)
+        v10 = v10 % 9;
+    v11 = v14 * 2 + (v2 ^ 3979);
+    if (v11 > 100000)
+        v11 = v11 % 10;
+    v12 = v15 * 3 + (v3 ^ 3980);
+    if (v12 > 100000)
+        v12 = v12 % 11;
+    v13 = v0 * 4 + (v4 ^ 3981);
+    if (v13 > 100000)
+        v13 = v13 % 12;
+    v14 = v1 * 5 + (v5 ^ 3982);
+    if (v14 > 100000)
+        v14 = v14 % 2;
+    v15 = v2 * 6 + (v6 ^ 3983);
+    if (v15 > 100000)
+        v15 = v15 % 3;
+    v0 = v3 * 7 + (v7 ^ 3984);
+    if (v0 > 100000)
+        v0 = v0 % 4;
+    v1 = v4 * 8 + (v8 ^ 3985);
+    if (v1 > 100000)
+        v1 = v1 % 5;
+    v2 = v5 * 9 + (v9 ^ 3986);
+    if (v2 > 100000)
+        v2 = v2 % 6;
+    v3 = v6 * 10 + (v10 ^ 3987);
+    if (v3 > 100000)
+        v3 = v3 % 7;
+    v4 = v7 * 11 + (v11 ^ 3988);
+    if (v4 > 100000)
+        v4 = v4 % 8;
+    v5 = v8 * 12 + (v12 ^ 3989);
+    if (v5 > 100000)
+        v5 = v5 % 9;
+    v6 = v9 * 13 + (v13 ^ 3990);
+    if (v6 > 100000)
+        v6 = v6 % 10;
+    v7 = v10 * 1 + (v14 ^ 3991);
+    if (v7 > 100000)
+        v7 = v7 % 11;
+    v8 = v11 * 2 + (v15 ^ 3992);
+    if (v8 > 100000)
+        v8 = v8 % 12;
+    v9 = v12 * 3 + (v0 ^ 3993);
+    if (v9 > 100000)
+        v9 = v9 % 2;
+    v10 = v13 * 4 + (v1 ^ 3994);
+    if (v10 > 100000)
+        v10 = v10 % 3;
+    v11 = v14 * 5 + (v2 ^ 3995);
+    if (v11 > 100000)
+        v11 = v11 % 4;
+    v12 = v15 * 6 + (v3 ^ 3996);
+    if (v12 > 100000)
+        v12 = v12 % 5;
+    v13 = v0 * 7 + (v4 ^ 3997);
+    if (v13 > 100000)
+        v13 = v13 % 6;
+    v14 = v1 * 8 + (v5 ^ 3998);
+    if (v14 > 100000)
+        v14 = v14 % 7;
+    v15 = v2 * 9 + (v6 ^ 3999);
+    if (v15 > 100000)
+        v15 = v15 % 8;
+    return v0 + v15;
+}
+int main()
+{
+    return work(1, 2) & 255;
+}
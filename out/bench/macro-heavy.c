@@ -0,0 +1,9208 @@
+#include "macro-heavy.h"
+int use0(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_0);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_0);
+    s = ADD(s, K_1);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_1);
+    s = ADD(s, K_2);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_2);
+    s = ADD(s, K_3);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_3);
+    s = ADD(s, K_4);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_4);
+    s = ADD(s, K_5);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_5);
+    s = ADD(s, K_6);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_6);
+    s = ADD(s, K_7);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_7);
+    s = ADD(s, K_8);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_8);
+    s = ADD(s, K_9);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_9);
+    return s;
+}
+int use1(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_10);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_7);
+    s = ADD(s, K_11);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_8);
+    s = ADD(s, K_12);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_9);
+    s = ADD(s, K_13);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_10);
+    s = ADD(s, K_14);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_11);
+    s = ADD(s, K_15);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_12);
+    s = ADD(s, K_16);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_13);
+    s = ADD(s, K_17);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_14);
+    s = ADD(s, K_18);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_15);
+    s = ADD(s, K_19);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_16);
+    return s;
+}
+int use2(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_20);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_14);
+    s = ADD(s, K_21);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_15);
+    s = ADD(s, K_22);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_16);
+    s = ADD(s, K_23);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_17);
+    s = ADD(s, K_24);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_18);
+    s = ADD(s, K_25);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_19);
+    s = ADD(s, K_26);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_20);
+    s = ADD(s, K_27);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_21);
+    s = ADD(s, K_28);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_22);
+    s = ADD(s, K_29);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_23);
+    return s;
+}
+int use3(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_30);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_21);
+    s = ADD(s, K_31);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_22);
+    s = ADD(s, K_32);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_23);
+    s = ADD(s, K_33);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_24);
+    s = ADD(s, K_34);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_25);
+    s = ADD(s, K_35);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_26);
+    s = ADD(s, K_36);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_27);
+    s = ADD(s, K_37);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_28);
+    s = ADD(s, K_38);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_29);
+    s = ADD(s, K_39);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_30);
+    return s;
+}
+int use4(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_40);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_28);
+    s = ADD(s, K_41);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_29);
+    s = ADD(s, K_42);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_30);
+    s = ADD(s, K_43);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_31);
+    s = ADD(s, K_44);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_32);
+    s = ADD(s, K_45);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_33);
+    s = ADD(s, K_46);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_34);
+    s = ADD(s, K_47);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_35);
+    s = ADD(s, K_48);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_36);
+    s = ADD(s, K_49);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_37);
+    return s;
+}
+int use5(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_50);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_35);
+    s = ADD(s, K_51);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_36);
+    s = ADD(s, K_52);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_37);
+    s = ADD(s, K_53);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_38);
+    s = ADD(s, K_54);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_39);
+    s = ADD(s, K_55);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_40);
+    s = ADD(s, K_56);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_41);
+    s = ADD(s, K_57);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_42);
+    s = ADD(s, K_58);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_43);
+    s = ADD(s, K_59);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_44);
+    return s;
+}
+int use6(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_60);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_42);
+    s = ADD(s, K_61);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_43);
+    s = ADD(s, K_62);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_44);
+    s = ADD(s, K_63);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_45);
+    s = ADD(s, K_64);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_46);
+    s = ADD(s, K_65);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_47);
+    s = ADD(s, K_66);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_48);
+    s = ADD(s, K_67);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_49);
+    s = ADD(s, K_68);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_50);
+    s = ADD(s, K_69);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_51);
+    return s;
+}
+int use7(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_70);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_49);
+    s = ADD(s, K_71);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_50);
+    s = ADD(s, K_72);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_51);
+    s = ADD(s, K_73);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_52);
+    s = ADD(s, K_74);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_53);
+    s = ADD(s, K_75);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_54);
+    s = ADD(s, K_76);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_55);
+    s = ADD(s, K_77);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_56);
+    s = ADD(s, K_78);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_57);
+    s = ADD(s, K_79);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_58);
+    return s;
+}
+int use8(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_80);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_56);
+    s = ADD(s, K_81);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_57);
+    s = ADD(s, K_82);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_58);
+    s = ADD(s, K_83);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_59);
+    s = ADD(s, K_84);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_60);
+    s = ADD(s, K_85);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_61);
+    s = ADD(s, K_86);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_62);
+    s = ADD(s, K_87);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_63);
+    s = ADD(s, K_88);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_64);
+    s = ADD(s, K_89);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_65);
+    return s;
+}
+int use9(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_90);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_63);
+    s = ADD(s, K_91);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_64);
+    s = ADD(s, K_92);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_65);
+    s = ADD(s, K_93);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_66);
+    s = ADD(s, K_94);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_67);
+    s = ADD(s, K_95);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_68);
+    s = ADD(s, K_96);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_69);
+    s = ADD(s, K_97);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_70);
+    s = ADD(s, K_98);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_71);
+    s = ADD(s, K_99);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_72);
+    return s;
+}
+int use10(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_100);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_70);
+    s = ADD(s, K_101);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_71);
+    s = ADD(s, K_102);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_72);
+    s = ADD(s, K_103);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_73);
+    s = ADD(s, K_104);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_74);
+    s = ADD(s, K_105);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_75);
+    s = ADD(s, K_106);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_76);
+    s = ADD(s, K_107);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_77);
+    s = ADD(s, K_108);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_78);
+    s = ADD(s, K_109);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_79);
+    return s;
+}
+int use11(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_110);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_77);
+    s = ADD(s, K_111);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_78);
+    s = ADD(s, K_112);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_79);
+    s = ADD(s, K_113);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_80);
+    s = ADD(s, K_114);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_81);
+    s = ADD(s, K_115);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_82);
+    s = ADD(s, K_116);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_83);
+    s = ADD(s, K_117);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_84);
+    s = ADD(s, K_118);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_85);
+    s = ADD(s, K_119);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_86);
+    return s;
+}
+int use12(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_120);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_84);
+    s = ADD(s, K_121);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_85);
+    s = ADD(s, K_122);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_86);
+    s = ADD(s, K_123);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_87);
+    s = ADD(s, K_124);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_88);
+    s = ADD(s, K_125);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_89);
+    s = ADD(s, K_126);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_90);
+    s = ADD(s, K_127);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_91);
+    s = ADD(s, K_128);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_92);
+    s = ADD(s, K_129);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_93);
+    return s;
+}
+int use13(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_130);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_91);
+    s = ADD(s, K_131);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_92);
+    s = ADD(s, K_132);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_93);
+    s = ADD(s, K_133);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_94);
+    s = ADD(s, K_134);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_95);
+    s = ADD(s, K_135);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_96);
+    s = ADD(s, K_136);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_97);
+    s = ADD(s, K_137);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_98);
+    s = ADD(s, K_138);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_99);
+    s = ADD(s, K_139);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_100);
+    return s;
+}
+int use14(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_140);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_98);
+    s = ADD(s, K_141);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_99);
+    s = ADD(s, K_142);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_100);
+    s = ADD(s, K_143);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_101);
+    s = ADD(s, K_144);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_102);
+    s = ADD(s, K_145);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_103);
+    s = ADD(s, K_146);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_104);
+    s = ADD(s, K_147);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_105);
+    s = ADD(s, K_148);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_106);
+    s = ADD(s, K_149);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_107);
+    return s;
+}
+int use15(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_150);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_105);
+    s = ADD(s, K_151);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_106);
+    s = ADD(s, K_152);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_107);
+    s = ADD(s, K_153);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_108);
+    s = ADD(s, K_154);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_109);
+    s = ADD(s, K_155);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_110);
+    s = ADD(s, K_156);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_111);
+    s = ADD(s, K_157);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_112);
+    s = ADD(s, K_158);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_113);
+    s = ADD(s, K_159);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_114);
+    return s;
+}
+int use16(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_160);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_112);
+    s = ADD(s, K_161);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_113);
+    s = ADD(s, K_162);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_114);
+    s = ADD(s, K_163);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_115);
+    s = ADD(s, K_164);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_116);
+    s = ADD(s, K_165);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_117);
+    s = ADD(s, K_166);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_118);
+    s = ADD(s, K_167);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_119);
+    s = ADD(s, K_168);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_120);
+    s = ADD(s, K_169);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_121);
+    return s;
+}
+int use17(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_170);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_119);
+    s = ADD(s, K_171);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_120);
+    s = ADD(s, K_172);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_121);
+    s = ADD(s, K_173);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_122);
+    s = ADD(s, K_174);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_123);
+    s = ADD(s, K_175);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_124);
+    s = ADD(s, K_176);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_125);
+    s = ADD(s, K_177);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_126);
+    s = ADD(s, K_178);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_127);
+    s = ADD(s, K_179);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_128);
+    return s;
+}
+int use18(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_180);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_126);
+    s = ADD(s, K_181);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_127);
+    s = ADD(s, K_182);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_128);
+    s = ADD(s, K_183);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_129);
+    s = ADD(s, K_184);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_130);
+    s = ADD(s, K_185);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_131);
+    s = ADD(s, K_186);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_132);
+    s = ADD(s, K_187);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_133);
+    s = ADD(s, K_188);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_134);
+    s = ADD(s, K_189);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_135);
+    return s;
+}
+int use19(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_190);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_133);
+    s = ADD(s, K_191);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_134);
+    s = ADD(s, K_192);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_135);
+    s = ADD(s, K_193);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_136);
+    s = ADD(s, K_194);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_137);
+    s = ADD(s, K_195);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_138);
+    s = ADD(s, K_196);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_139);
+    s = ADD(s, K_197);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_140);
+    s = ADD(s, K_198);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_141);
+    s = ADD(s, K_199);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_142);
+    return s;
+}
+int use20(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_200);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_140);
+    s = ADD(s, K_201);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_141);
+    s = ADD(s, K_202);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_142);
+    s = ADD(s, K_203);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_143);
+    s = ADD(s, K_204);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_144);
+    s = ADD(s, K_205);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_145);
+    s = ADD(s, K_206);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_146);
+    s = ADD(s, K_207);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_147);
+    s = ADD(s, K_208);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_148);
+    s = ADD(s, K_209);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_149);
+    return s;
+}
+int use21(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_210);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_147);
+    s = ADD(s, K_211);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_148);
+    s = ADD(s, K_212);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_149);
+    s = ADD(s, K_213);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_150);
+    s = ADD(s, K_214);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_151);
+    s = ADD(s, K_215);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_152);
+    s = ADD(s, K_216);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_153);
+    s = ADD(s, K_217);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_154);
+    s = ADD(s, K_218);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_155);
+    s = ADD(s, K_219);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_156);
+    return s;
+}
+int use22(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_220);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_154);
+    s = ADD(s, K_221);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_155);
+    s = ADD(s, K_222);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_156);
+    s = ADD(s, K_223);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_157);
+    s = ADD(s, K_224);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_158);
+    s = ADD(s, K_225);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_159);
+    s = ADD(s, K_226);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_160);
+    s = ADD(s, K_227);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_161);
+    s = ADD(s, K_228);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_162);
+    s = ADD(s, K_229);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_163);
+    return s;
+}
+int use23(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_230);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_161);
+    s = ADD(s, K_231);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_162);
+    s = ADD(s, K_232);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_163);
+    s = ADD(s, K_233);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_164);
+    s = ADD(s, K_234);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_165);
+    s = ADD(s, K_235);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_166);
+    s = ADD(s, K_236);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_167);
+    s = ADD(s, K_237);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_168);
+    s = ADD(s, K_238);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_169);
+    s = ADD(s, K_239);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_170);
+    return s;
+}
+int use24(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_240);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_168);
+    s = ADD(s, K_241);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_169);
+    s = ADD(s, K_242);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_170);
+    s = ADD(s, K_243);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_171);
+    s = ADD(s, K_244);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_172);
+    s = ADD(s, K_245);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_173);
+    s = ADD(s, K_246);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_174);
+    s = ADD(s, K_247);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_175);
+    s = ADD(s, K_248);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_176);
+    s = ADD(s, K_249);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_177);
+    return s;
+}
+int use25(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_250);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_175);
+    s = ADD(s, K_251);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_176);
+    s = ADD(s, K_252);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_177);
+    s = ADD(s, K_253);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_178);
+    s = ADD(s, K_254);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_179);
+    s = ADD(s, K_255);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_180);
+    s = ADD(s, K_256);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_181);
+    s = ADD(s, K_257);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_182);
+    s = ADD(s, K_258);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_183);
+    s = ADD(s, K_259);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_184);
+    return s;
+}
+int use26(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_260);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_182);
+    s = ADD(s, K_261);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_183);
+    s = ADD(s, K_262);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_184);
+    s = ADD(s, K_263);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_185);
+    s = ADD(s, K_264);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_186);
+    s = ADD(s, K_265);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_187);
+    s = ADD(s, K_266);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_188);
+    s = ADD(s, K_267);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_189);
+    s = ADD(s, K_268);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_190);
+    s = ADD(s, K_269);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_191);
+    return s;
+}
+int use27(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_270);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_189);
+    s = ADD(s, K_271);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_190);
+    s = ADD(s, K_272);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_191);
+    s = ADD(s, K_273);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_192);
+    s = ADD(s, K_274);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_193);
+    s = ADD(s, K_275);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_194);
+    s = ADD(s, K_276);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_195);
+    s = ADD(s, K_277);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_196);
+    s = ADD(s, K_278);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_197);
+    s = ADD(s, K_279);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_198);
+    return s;
+}
+int use28(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_280);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_196);
+    s = ADD(s, K_281);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_197);
+    s = ADD(s, K_282);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_198);
+    s = ADD(s, K_283);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_199);
+    s = ADD(s, K_284);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_200);
+    s = ADD(s, K_285);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_201);
+    s = ADD(s, K_286);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_202);
+    s = ADD(s, K_287);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_203);
+    s = ADD(s, K_288);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_204);
+    s = ADD(s, K_289);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_205);
+    return s;
+}
+int use29(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_290);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_203);
+    s = ADD(s, K_291);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_204);
+    s = ADD(s, K_292);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_205);
+    s = ADD(s, K_293);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_206);
+    s = ADD(s, K_294);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_207);
+    s = ADD(s, K_295);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_208);
+    s = ADD(s, K_296);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_209);
+    s = ADD(s, K_297);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_210);
+    s = ADD(s, K_298);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_211);
+    s = ADD(s, K_299);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_212);
+    return s;
+}
+int use30(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_300);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_210);
+    s = ADD(s, K_301);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_211);
+    s = ADD(s, K_302);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_212);
+    s = ADD(s, K_303);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_213);
+    s = ADD(s, K_304);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_214);
+    s = ADD(s, K_305);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_215);
+    s = ADD(s, K_306);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_216);
+    s = ADD(s, K_307);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_217);
+    s = ADD(s, K_308);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_218);
+    s = ADD(s, K_309);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_219);
+    return s;
+}
+int use31(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_310);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_217);
+    s = ADD(s, K_311);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_218);
+    s = ADD(s, K_312);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_219);
+    s = ADD(s, K_313);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_220);
+    s = ADD(s, K_314);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_221);
+    s = ADD(s, K_315);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_222);
+    s = ADD(s, K_316);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_223);
+    s = ADD(s, K_317);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_224);
+    s = ADD(s, K_318);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_225);
+    s = ADD(s, K_319);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_226);
+    return s;
+}
+int use32(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_320);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_224);
+    s = ADD(s, K_321);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_225);
+    s = ADD(s, K_322);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_226);
+    s = ADD(s, K_323);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_227);
+    s = ADD(s, K_324);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_228);
+    s = ADD(s, K_325);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_229);
+    s = ADD(s, K_326);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_230);
+    s = ADD(s, K_327);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_231);
+    s = ADD(s, K_328);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_232);
+    s = ADD(s, K_329);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_233);
+    return s;
+}
+int use33(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_330);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_231);
+    s = ADD(s, K_331);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_232);
+    s = ADD(s, K_332);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_233);
+    s = ADD(s, K_333);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_234);
+    s = ADD(s, K_334);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_235);
+    s = ADD(s, K_335);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_236);
+    s = ADD(s, K_336);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_237);
+    s = ADD(s, K_337);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_238);
+    s = ADD(s, K_338);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_239);
+    s = ADD(s, K_339);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_240);
+    return s;
+}
+int use34(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_340);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_238);
+    s = ADD(s, K_341);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_239);
+    s = ADD(s, K_342);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_240);
+    s = ADD(s, K_343);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_241);
+    s = ADD(s, K_344);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_242);
+    s = ADD(s, K_345);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_243);
+    s = ADD(s, K_346);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_244);
+    s = ADD(s, K_347);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_245);
+    s = ADD(s, K_348);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_246);
+    s = ADD(s, K_349);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_247);
+    return s;
+}
+int use35(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_350);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_245);
+    s = ADD(s, K_351);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_246);
+    s = ADD(s, K_352);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_247);
+    s = ADD(s, K_353);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_248);
+    s = ADD(s, K_354);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_249);
+    s = ADD(s, K_355);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_250);
+    s = ADD(s, K_356);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_251);
+    s = ADD(s, K_357);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_252);
+    s = ADD(s, K_358);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_253);
+    s = ADD(s, K_359);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_254);
+    return s;
+}
+int use36(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_360);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_252);
+    s = ADD(s, K_361);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_253);
+    s = ADD(s, K_362);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_254);
+    s = ADD(s, K_363);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_255);
+    s = ADD(s, K_364);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_256);
+    s = ADD(s, K_365);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_257);
+    s = ADD(s, K_366);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_258);
+    s = ADD(s, K_367);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_259);
+    s = ADD(s, K_368);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_260);
+    s = ADD(s, K_369);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_261);
+    return s;
+}
+int use37(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_370);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_259);
+    s = ADD(s, K_371);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_260);
+    s = ADD(s, K_372);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_261);
+    s = ADD(s, K_373);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_262);
+    s = ADD(s, K_374);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_263);
+    s = ADD(s, K_375);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_264);
+    s = ADD(s, K_376);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_265);
+    s = ADD(s, K_377);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_266);
+    s = ADD(s, K_378);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_267);
+    s = ADD(s, K_379);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_268);
+    return s;
+}
+int use38(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_380);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_266);
+    s = ADD(s, K_381);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_267);
+    s = ADD(s, K_382);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_268);
+    s = ADD(s, K_383);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_269);
+    s = ADD(s, K_384);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_270);
+    s = ADD(s, K_385);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_271);
+    s = ADD(s, K_386);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_272);
+    s = ADD(s, K_387);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_273);
+    s = ADD(s, K_388);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_274);
+    s = ADD(s, K_389);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_275);
+    return s;
+}
+int use39(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_390);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_273);
+    s = ADD(s, K_391);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_274);
+    s = ADD(s, K_392);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_275);
+    s = ADD(s, K_393);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_276);
+    s = ADD(s, K_394);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_277);
+    s = ADD(s, K_395);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_278);
+    s = ADD(s, K_396);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_279);
+    s = ADD(s, K_397);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_280);
+    s = ADD(s, K_398);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_281);
+    s = ADD(s, K_399);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_282);
+    return s;
+}
+int use40(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_400);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_280);
+    s = ADD(s, K_401);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_281);
+    s = ADD(s, K_402);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_282);
+    s = ADD(s, K_403);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_283);
+    s = ADD(s, K_404);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_284);
+    s = ADD(s, K_405);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_285);
+    s = ADD(s, K_406);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_286);
+    s = ADD(s, K_407);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_287);
+    s = ADD(s, K_408);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_288);
+    s = ADD(s, K_409);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_289);
+    return s;
+}
+int use41(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_410);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_287);
+    s = ADD(s, K_411);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_288);
+    s = ADD(s, K_412);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_289);
+    s = ADD(s, K_413);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_290);
+    s = ADD(s, K_414);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_291);
+    s = ADD(s, K_415);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_292);
+    s = ADD(s, K_416);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_293);
+    s = ADD(s, K_417);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_294);
+    s = ADD(s, K_418);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_295);
+    s = ADD(s, K_419);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_296);
+    return s;
+}
+int use42(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_420);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_294);
+    s = ADD(s, K_421);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_295);
+    s = ADD(s, K_422);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_296);
+    s = ADD(s, K_423);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_297);
+    s = ADD(s, K_424);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_298);
+    s = ADD(s, K_425);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_299);
+    s = ADD(s, K_426);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_300);
+    s = ADD(s, K_427);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_301);
+    s = ADD(s, K_428);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_302);
+    s = ADD(s, K_429);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_303);
+    return s;
+}
+int use43(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_430);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_301);
+    s = ADD(s, K_431);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_302);
+    s = ADD(s, K_432);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_303);
+    s = ADD(s, K_433);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_304);
+    s = ADD(s, K_434);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_305);
+    s = ADD(s, K_435);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_306);
+    s = ADD(s, K_436);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_307);
+    s = ADD(s, K_437);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_308);
+    s = ADD(s, K_438);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_309);
+    s = ADD(s, K_439);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_310);
+    return s;
+}
+int use44(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_440);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_308);
+    s = ADD(s, K_441);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_309);
+    s = ADD(s, K_442);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_310);
+    s = ADD(s, K_443);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_311);
+    s = ADD(s, K_444);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_312);
+    s = ADD(s, K_445);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_313);
+    s = ADD(s, K_446);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_314);
+    s = ADD(s, K_447);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_315);
+    s = ADD(s, K_448);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_316);
+    s = ADD(s, K_449);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_317);
+    return s;
+}
+int use45(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_450);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_315);
+    s = ADD(s, K_451);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_316);
+    s = ADD(s, K_452);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_317);
+    s = ADD(s, K_453);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_318);
+    s = ADD(s, K_454);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_319);
+    s = ADD(s, K_455);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_320);
+    s = ADD(s, K_456);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_321);
+    s = ADD(s, K_457);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_322);
+    s = ADD(s, K_458);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_323);
+    s = ADD(s, K_459);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_324);
+    return s;
+}
+int use46(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_460);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_322);
+    s = ADD(s, K_461);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_323);
+    s = ADD(s, K_462);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_324);
+    s = ADD(s, K_463);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_325);
+    s = ADD(s, K_464);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_326);
+    s = ADD(s, K_465);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_327);
+    s = ADD(s, K_466);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_328);
+    s = ADD(s, K_467);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_329);
+    s = ADD(s, K_468);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_330);
+    s = ADD(s, K_469);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_331);
+    return s;
+}
+int use47(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_470);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_329);
+    s = ADD(s, K_471);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_330);
+    s = ADD(s, K_472);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_331);
+    s = ADD(s, K_473);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_332);
+    s = ADD(s, K_474);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_333);
+    s = ADD(s, K_475);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_334);
+    s = ADD(s, K_476);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_335);
+    s = ADD(s, K_477);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_336);
+    s = ADD(s, K_478);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_337);
+    s = ADD(s, K_479);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_338);
+    return s;
+}
+int use48(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_480);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_336);
+    s = ADD(s, K_481);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_337);
+    s = ADD(s, K_482);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_338);
+    s = ADD(s, K_483);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_339);
+    s = ADD(s, K_484);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_340);
+    s = ADD(s, K_485);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_341);
+    s = ADD(s, K_486);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_342);
+    s = ADD(s, K_487);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_343);
+    s = ADD(s, K_488);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_344);
+    s = ADD(s, K_489);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_345);
+    return s;
+}
+int use49(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_490);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_343);
+    s = ADD(s, K_491);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_344);
+    s = ADD(s, K_492);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_345);
+    s = ADD(s, K_493);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_346);
+    s = ADD(s, K_494);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_347);
+    s = ADD(s, K_495);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_348);
+    s = ADD(s, K_496);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_349);
+    s = ADD(s, K_497);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_350);
+    s = ADD(s, K_498);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_351);
+    s = ADD(s, K_499);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_352);
+    return s;
+}
+int use50(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_500);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_350);
+    s = ADD(s, K_501);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_351);
+    s = ADD(s, K_502);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_352);
+    s = ADD(s, K_503);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_353);
+    s = ADD(s, K_504);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_354);
+    s = ADD(s, K_505);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_355);
+    s = ADD(s, K_506);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_356);
+    s = ADD(s, K_507);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_357);
+    s = ADD(s, K_508);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_358);
+    s = ADD(s, K_509);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_359);
+    return s;
+}
+int use51(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_510);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_357);
+    s = ADD(s, K_511);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_358);
+    s = ADD(s, K_512);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_359);
+    s = ADD(s, K_513);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_360);
+    s = ADD(s, K_514);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_361);
+    s = ADD(s, K_515);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_362);
+    s = ADD(s, K_516);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_363);
+    s = ADD(s, K_517);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_364);
+    s = ADD(s, K_518);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_365);
+    s = ADD(s, K_519);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_366);
+    return s;
+}
+int use52(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_520);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_364);
+    s = ADD(s, K_521);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_365);
+    s = ADD(s, K_522);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_366);
+    s = ADD(s, K_523);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_367);
+    s = ADD(s, K_524);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_368);
+    s = ADD(s, K_525);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_369);
+    s = ADD(s, K_526);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_370);
+    s = ADD(s, K_527);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_371);
+    s = ADD(s, K_528);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_372);
+    s = ADD(s, K_529);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_373);
+    return s;
+}
+int use53(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_530);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_371);
+    s = ADD(s, K_531);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_372);
+    s = ADD(s, K_532);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_373);
+    s = ADD(s, K_533);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_374);
+    s = ADD(s, K_534);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_375);
+    s = ADD(s, K_535);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_376);
+    s = ADD(s, K_536);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_377);
+    s = ADD(s, K_537);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_378);
+    s = ADD(s, K_538);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_379);
+    s = ADD(s, K_539);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_380);
+    return s;
+}
+int use54(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_540);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_378);
+    s = ADD(s, K_541);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_379);
+    s = ADD(s, K_542);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_380);
+    s = ADD(s, K_543);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_381);
+    s = ADD(s, K_544);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_382);
+    s = ADD(s, K_545);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_383);
+    s = ADD(s, K_546);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_384);
+    s = ADD(s, K_547);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_385);
+    s = ADD(s, K_548);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_386);
+    s = ADD(s, K_549);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_387);
+    return s;
+}
+int use55(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_550);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_385);
+    s = ADD(s, K_551);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_386);
+    s = ADD(s, K_552);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_387);
+    s = ADD(s, K_553);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_388);
+    s = ADD(s, K_554);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_389);
+    s = ADD(s, K_555);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_390);
+    s = ADD(s, K_556);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_391);
+    s = ADD(s, K_557);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_392);
+    s = ADD(s, K_558);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_393);
+    s = ADD(s, K_559);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_394);
+    return s;
+}
+int use56(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_560);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_392);
+    s = ADD(s, K_561);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_393);
+    s = ADD(s, K_562);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_394);
+    s = ADD(s, K_563);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_395);
+    s = ADD(s, K_564);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_396);
+    s = ADD(s, K_565);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_397);
+    s = ADD(s, K_566);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_398);
+    s = ADD(s, K_567);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_399);
+    s = ADD(s, K_568);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_400);
+    s = ADD(s, K_569);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_401);
+    return s;
+}
+int use57(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_570);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_399);
+    s = ADD(s, K_571);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_400);
+    s = ADD(s, K_572);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_401);
+    s = ADD(s, K_573);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_402);
+    s = ADD(s, K_574);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_403);
+    s = ADD(s, K_575);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_404);
+    s = ADD(s, K_576);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_405);
+    s = ADD(s, K_577);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_406);
+    s = ADD(s, K_578);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_407);
+    s = ADD(s, K_579);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_408);
+    return s;
+}
+int use58(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_580);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_406);
+    s = ADD(s, K_581);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_407);
+    s = ADD(s, K_582);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_408);
+    s = ADD(s, K_583);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_409);
+    s = ADD(s, K_584);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_410);
+    s = ADD(s, K_585);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_411);
+    s = ADD(s, K_586);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_412);
+    s = ADD(s, K_587);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_413);
+    s = ADD(s, K_588);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_414);
+    s = ADD(s, K_589);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_415);
+    return s;
+}
+int use59(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_590);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_413);
+    s = ADD(s, K_591);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_414);
+    s = ADD(s, K_592);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_415);
+    s = ADD(s, K_593);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_416);
+    s = ADD(s, K_594);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_417);
+    s = ADD(s, K_595);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_418);
+    s = ADD(s, K_596);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_419);
+    s = ADD(s, K_597);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_420);
+    s = ADD(s, K_598);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_421);
+    s = ADD(s, K_599);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_422);
+    return s;
+}
+int use60(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_600);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_420);
+    s = ADD(s, K_601);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_421);
+    s = ADD(s, K_602);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_422);
+    s = ADD(s, K_603);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_423);
+    s = ADD(s, K_604);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_424);
+    s = ADD(s, K_605);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_425);
+    s = ADD(s, K_606);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_426);
+    s = ADD(s, K_607);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_427);
+    s = ADD(s, K_608);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_428);
+    s = ADD(s, K_609);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_429);
+    return s;
+}
+int use61(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_610);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_427);
+    s = ADD(s, K_611);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_428);
+    s = ADD(s, K_612);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_429);
+    s = ADD(s, K_613);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_430);
+    s = ADD(s, K_614);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_431);
+    s = ADD(s, K_615);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_432);
+    s = ADD(s, K_616);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_433);
+    s = ADD(s, K_617);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_434);
+    s = ADD(s, K_618);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_435);
+    s = ADD(s, K_619);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_436);
+    return s;
+}
+int use62(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_620);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_434);
+    s = ADD(s, K_621);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_435);
+    s = ADD(s, K_622);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_436);
+    s = ADD(s, K_623);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_437);
+    s = ADD(s, K_624);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_438);
+    s = ADD(s, K_625);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_439);
+    s = ADD(s, K_626);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_440);
+    s = ADD(s, K_627);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_441);
+    s = ADD(s, K_628);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_442);
+    s = ADD(s, K_629);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_443);
+    return s;
+}
+int use63(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_630);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_441);
+    s = ADD(s, K_631);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_442);
+    s = ADD(s, K_632);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_443);
+    s = ADD(s, K_633);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_444);
+    s = ADD(s, K_634);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_445);
+    s = ADD(s, K_635);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_446);
+    s = ADD(s, K_636);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_447);
+    s = ADD(s, K_637);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_448);
+    s = ADD(s, K_638);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_449);
+    s = ADD(s, K_639);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_450);
+    return s;
+}
+int use64(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_640);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_448);
+    s = ADD(s, K_641);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_449);
+    s = ADD(s, K_642);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_450);
+    s = ADD(s, K_643);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_451);
+    s = ADD(s, K_644);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_452);
+    s = ADD(s, K_645);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_453);
+    s = ADD(s, K_646);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_454);
+    s = ADD(s, K_647);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_455);
+    s = ADD(s, K_648);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_456);
+    s = ADD(s, K_649);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_457);
+    return s;
+}
+int use65(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_650);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_455);
+    s = ADD(s, K_651);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_456);
+    s = ADD(s, K_652);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_457);
+    s = ADD(s, K_653);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_458);
+    s = ADD(s, K_654);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_459);
+    s = ADD(s, K_655);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_460);
+    s = ADD(s, K_656);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_461);
+    s = ADD(s, K_657);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_462);
+    s = ADD(s, K_658);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_463);
+    s = ADD(s, K_659);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_464);
+    return s;
+}
+int use66(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_660);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_462);
+    s = ADD(s, K_661);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_463);
+    s = ADD(s, K_662);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_464);
+    s = ADD(s, K_663);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_465);
+    s = ADD(s, K_664);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_466);
+    s = ADD(s, K_665);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_467);
+    s = ADD(s, K_666);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_468);
+    s = ADD(s, K_667);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_469);
+    s = ADD(s, K_668);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_470);
+    s = ADD(s, K_669);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_471);
+    return s;
+}
+int use67(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_670);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_469);
+    s = ADD(s, K_671);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_470);
+    s = ADD(s, K_672);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_471);
+    s = ADD(s, K_673);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_472);
+    s = ADD(s, K_674);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_473);
+    s = ADD(s, K_675);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_474);
+    s = ADD(s, K_676);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_475);
+    s = ADD(s, K_677);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_476);
+    s = ADD(s, K_678);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_477);
+    s = ADD(s, K_679);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_478);
+    return s;
+}
+int use68(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_680);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_476);
+    s = ADD(s, K_681);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_477);
+    s = ADD(s, K_682);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_478);
+    s = ADD(s, K_683);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_479);
+    s = ADD(s, K_684);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_480);
+    s = ADD(s, K_685);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_481);
+    s = ADD(s, K_686);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_482);
+    s = ADD(s, K_687);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_483);
+    s = ADD(s, K_688);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_484);
+    s = ADD(s, K_689);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_485);
+    return s;
+}
+int use69(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_690);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_483);
+    s = ADD(s, K_691);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_484);
+    s = ADD(s, K_692);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_485);
+    s = ADD(s, K_693);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_486);
+    s = ADD(s, K_694);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_487);
+    s = ADD(s, K_695);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_488);
+    s = ADD(s, K_696);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_489);
+    s = ADD(s, K_697);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_490);
+    s = ADD(s, K_698);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_491);
+    s = ADD(s, K_699);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_492);
+    return s;
+}
+int use70(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_700);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_490);
+    s = ADD(s, K_701);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_491);
+    s = ADD(s, K_702);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_492);
+    s = ADD(s, K_703);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_493);
+    s = ADD(s, K_704);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_494);
+    s = ADD(s, K_705);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_495);
+    s = ADD(s, K_706);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_496);
+    s = ADD(s, K_707);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_497);
+    s = ADD(s, K_708);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_498);
+    s = ADD(s, K_709);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_499);
+    return s;
+}
+int use71(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_710);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_497);
+    s = ADD(s, K_711);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_498);
+    s = ADD(s, K_712);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_499);
+    s = ADD(s, K_713);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_500);
+    s = ADD(s, K_714);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_501);
+    s = ADD(s, K_715);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_502);
+    s = ADD(s, K_716);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_503);
+    s = ADD(s, K_717);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_504);
+    s = ADD(s, K_718);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_505);
+    s = ADD(s, K_719);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_506);
+    return s;
+}
+int use72(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_720);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_504);
+    s = ADD(s, K_721);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_505);
+    s = ADD(s, K_722);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_506);
+    s = ADD(s, K_723);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_507);
+    s = ADD(s, K_724);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_508);
+    s = ADD(s, K_725);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_509);
+    s = ADD(s, K_726);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_510);
+    s = ADD(s, K_727);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_511);
+    s = ADD(s, K_728);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_512);
+    s = ADD(s, K_729);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_513);
+    return s;
+}
+int use73(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_730);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_511);
+    s = ADD(s, K_731);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_512);
+    s = ADD(s, K_732);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_513);
+    s = ADD(s, K_733);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_514);
+    s = ADD(s, K_734);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_515);
+    s = ADD(s, K_735);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_516);
+    s = ADD(s, K_736);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_517);
+    s = ADD(s, K_737);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_518);
+    s = ADD(s, K_738);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_519);
+    s = ADD(s, K_739);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_520);
+    return s;
+}
+int use74(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_740);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_518);
+    s = ADD(s, K_741);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_519);
+    s = ADD(s, K_742);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_520);
+    s = ADD(s, K_743);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_521);
+    s = ADD(s, K_744);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_522);
+    s = ADD(s, K_745);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_523);
+    s = ADD(s, K_746);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_524);
+    s = ADD(s, K_747);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_525);
+    s = ADD(s, K_748);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_526);
+    s = ADD(s, K_749);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_527);
+    return s;
+}
+int use75(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_750);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_525);
+    s = ADD(s, K_751);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_526);
+    s = ADD(s, K_752);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_527);
+    s = ADD(s, K_753);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_528);
+    s = ADD(s, K_754);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_529);
+    s = ADD(s, K_755);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_530);
+    s = ADD(s, K_756);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_531);
+    s = ADD(s, K_757);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_532);
+    s = ADD(s, K_758);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_533);
+    s = ADD(s, K_759);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_534);
+    return s;
+}
+int use76(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_760);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_532);
+    s = ADD(s, K_761);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_533);
+    s = ADD(s, K_762);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_534);
+    s = ADD(s, K_763);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_535);
+    s = ADD(s, K_764);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_536);
+    s = ADD(s, K_765);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_537);
+    s = ADD(s, K_766);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_538);
+    s = ADD(s, K_767);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_539);
+    s = ADD(s, K_768);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_540);
+    s = ADD(s, K_769);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_541);
+    return s;
+}
+int use77(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_770);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_539);
+    s = ADD(s, K_771);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_540);
+    s = ADD(s, K_772);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_541);
+    s = ADD(s, K_773);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_542);
+    s = ADD(s, K_774);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_543);
+    s = ADD(s, K_775);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_544);
+    s = ADD(s, K_776);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_545);
+    s = ADD(s, K_777);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_546);
+    s = ADD(s, K_778);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_547);
+    s = ADD(s, K_779);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_548);
+    return s;
+}
+int use78(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_780);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_546);
+    s = ADD(s, K_781);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_547);
+    s = ADD(s, K_782);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_548);
+    s = ADD(s, K_783);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_549);
+    s = ADD(s, K_784);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_550);
+    s = ADD(s, K_785);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_551);
+    s = ADD(s, K_786);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_552);
+    s = ADD(s, K_787);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_553);
+    s = ADD(s, K_788);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_554);
+    s = ADD(s, K_789);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_555);
+    return s;
+}
+int use79(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_790);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_553);
+    s = ADD(s, K_791);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_554);
+    s = ADD(s, K_792);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_555);
+    s = ADD(s, K_793);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_556);
+    s = ADD(s, K_794);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_557);
+    s = ADD(s, K_795);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_558);
+    s = ADD(s, K_796);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_559);
+    s = ADD(s, K_797);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_560);
+    s = ADD(s, K_798);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_561);
+    s = ADD(s, K_799);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_562);
+    return s;
+}
+int use80(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_800);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_560);
+    s = ADD(s, K_801);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_561);
+    s = ADD(s, K_802);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_562);
+    s = ADD(s, K_803);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_563);
+    s = ADD(s, K_804);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_564);
+    s = ADD(s, K_805);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_565);
+    s = ADD(s, K_806);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_566);
+    s = ADD(s, K_807);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_567);
+    s = ADD(s, K_808);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_568);
+    s = ADD(s, K_809);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_569);
+    return s;
+}
+int use81(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_810);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_567);
+    s = ADD(s, K_811);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_568);
+    s = ADD(s, K_812);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_569);
+    s = ADD(s, K_813);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_570);
+    s = ADD(s, K_814);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_571);
+    s = ADD(s, K_815);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_572);
+    s = ADD(s, K_816);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_573);
+    s = ADD(s, K_817);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_574);
+    s = ADD(s, K_818);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_575);
+    s = ADD(s, K_819);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_576);
+    return s;
+}
+int use82(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_820);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_574);
+    s = ADD(s, K_821);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_575);
+    s = ADD(s, K_822);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_576);
+    s = ADD(s, K_823);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_577);
+    s = ADD(s, K_824);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_578);
+    s = ADD(s, K_825);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_579);
+    s = ADD(s, K_826);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_580);
+    s = ADD(s, K_827);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_581);
+    s = ADD(s, K_828);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_582);
+    s = ADD(s, K_829);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_583);
+    return s;
+}
+int use83(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_830);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_581);
+    s = ADD(s, K_831);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_582);
+    s = ADD(s, K_832);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_583);
+    s = ADD(s, K_833);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_584);
+    s = ADD(s, K_834);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_585);
+    s = ADD(s, K_835);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_586);
+    s = ADD(s, K_836);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_587);
+    s = ADD(s, K_837);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_588);
+    s = ADD(s, K_838);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_589);
+    s = ADD(s, K_839);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_590);
+    return s;
+}
+int use84(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_840);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_588);
+    s = ADD(s, K_841);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_589);
+    s = ADD(s, K_842);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_590);
+    s = ADD(s, K_843);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_591);
+    s = ADD(s, K_844);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_592);
+    s = ADD(s, K_845);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_593);
+    s = ADD(s, K_846);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_594);
+    s = ADD(s, K_847);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_595);
+    s = ADD(s, K_848);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_596);
+    s = ADD(s, K_849);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_597);
+    return s;
+}
+int use85(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_850);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_595);
+    s = ADD(s, K_851);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_596);
+    s = ADD(s, K_852);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_597);
+    s = ADD(s, K_853);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_598);
+    s = ADD(s, K_854);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_599);
+    s = ADD(s, K_855);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_600);
+    s = ADD(s, K_856);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_601);
+    s = ADD(s, K_857);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_602);
+    s = ADD(s, K_858);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_603);
+    s = ADD(s, K_859);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_604);
+    return s;
+}
+int use86(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_860);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_602);
+    s = ADD(s, K_861);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_603);
+    s = ADD(s, K_862);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_604);
+    s = ADD(s, K_863);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_605);
+    s = ADD(s, K_864);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_606);
+    s = ADD(s, K_865);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_607);
+    s = ADD(s, K_866);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_608);
+    s = ADD(s, K_867);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_609);
+    s = ADD(s, K_868);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_610);
+    s = ADD(s, K_869);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_611);
+    return s;
+}
+int use87(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_870);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_609);
+    s = ADD(s, K_871);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_610);
+    s = ADD(s, K_872);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_611);
+    s = ADD(s, K_873);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_612);
+    s = ADD(s, K_874);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_613);
+    s = ADD(s, K_875);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_614);
+    s = ADD(s, K_876);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_615);
+    s = ADD(s, K_877);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_616);
+    s = ADD(s, K_878);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_617);
+    s = ADD(s, K_879);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_618);
+    return s;
+}
+int use88(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_880);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_616);
+    s = ADD(s, K_881);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_617);
+    s = ADD(s, K_882);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_618);
+    s = ADD(s, K_883);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_619);
+    s = ADD(s, K_884);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_620);
+    s = ADD(s, K_885);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_621);
+    s = ADD(s, K_886);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_622);
+    s = ADD(s, K_887);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_623);
+    s = ADD(s, K_888);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_624);
+    s = ADD(s, K_889);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_625);
+    return s;
+}
+int use89(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_890);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_623);
+    s = ADD(s, K_891);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_624);
+    s = ADD(s, K_892);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_625);
+    s = ADD(s, K_893);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_626);
+    s = ADD(s, K_894);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_627);
+    s = ADD(s, K_895);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_628);
+    s = ADD(s, K_896);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_629);
+    s = ADD(s, K_897);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_630);
+    s = ADD(s, K_898);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_631);
+    s = ADD(s, K_899);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_632);
+    return s;
+}
+int use90(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_900);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_630);
+    s = ADD(s, K_901);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_631);
+    s = ADD(s, K_902);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_632);
+    s = ADD(s, K_903);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_633);
+    s = ADD(s, K_904);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_634);
+    s = ADD(s, K_905);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_635);
+    s = ADD(s, K_906);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_636);
+    s = ADD(s, K_907);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_637);
+    s = ADD(s, K_908);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_638);
+    s = ADD(s, K_909);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_639);
+    return s;
+}
+int use91(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_910);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_637);
+    s = ADD(s, K_911);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_638);
+    s = ADD(s, K_912);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_639);
+    s = ADD(s, K_913);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_640);
+    s = ADD(s, K_914);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_641);
+    s = ADD(s, K_915);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_642);
+    s = ADD(s, K_916);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_643);
+    s = ADD(s, K_917);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_644);
+    s = ADD(s, K_918);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_645);
+    s = ADD(s, K_919);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_646);
+    return s;
+}
+int use92(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_920);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_644);
+    s = ADD(s, K_921);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_645);
+    s = ADD(s, K_922);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_646);
+    s = ADD(s, K_923);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_647);
+    s = ADD(s, K_924);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_648);
+    s = ADD(s, K_925);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_649);
+    s = ADD(s, K_926);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_650);
+    s = ADD(s, K_927);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_651);
+    s = ADD(s, K_928);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_652);
+    s = ADD(s, K_929);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_653);
+    return s;
+}
+int use93(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_930);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_651);
+    s = ADD(s, K_931);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_652);
+    s = ADD(s, K_932);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_653);
+    s = ADD(s, K_933);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_654);
+    s = ADD(s, K_934);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_655);
+    s = ADD(s, K_935);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_656);
+    s = ADD(s, K_936);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_657);
+    s = ADD(s, K_937);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_658);
+    s = ADD(s, K_938);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_659);
+    s = ADD(s, K_939);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_660);
+    return s;
+}
+int use94(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_940);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_658);
+    s = ADD(s, K_941);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_659);
+    s = ADD(s, K_942);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_660);
+    s = ADD(s, K_943);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_661);
+    s = ADD(s, K_944);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_662);
+    s = ADD(s, K_945);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_663);
+    s = ADD(s, K_946);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_664);
+    s = ADD(s, K_947);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_665);
+    s = ADD(s, K_948);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_666);
+    s = ADD(s, K_949);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_667);
+    return s;
+}
+int use95(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_950);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_665);
+    s = ADD(s, K_951);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_666);
+    s = ADD(s, K_952);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_667);
+    s = ADD(s, K_953);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_668);
+    s = ADD(s, K_954);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_669);
+    s = ADD(s, K_955);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_670);
+    s = ADD(s, K_956);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_671);
+    s = ADD(s, K_957);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_672);
+    s = ADD(s, K_958);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_673);
+    s = ADD(s, K_959);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_674);
+    return s;
+}
+int use96(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_960);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_672);
+    s = ADD(s, K_961);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_673);
+    s = ADD(s, K_962);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_674);
+    s = ADD(s, K_963);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_675);
+    s = ADD(s, K_964);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_676);
+    s = ADD(s, K_965);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_677);
+    s = ADD(s, K_966);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_678);
+    s = ADD(s, K_967);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_679);
+    s = ADD(s, K_968);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_680);
+    s = ADD(s, K_969);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_681);
+    return s;
+}
+int use97(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_970);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_679);
+    s = ADD(s, K_971);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_680);
+    s = ADD(s, K_972);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_681);
+    s = ADD(s, K_973);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_682);
+    s = ADD(s, K_974);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_683);
+    s = ADD(s, K_975);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_684);
+    s = ADD(s, K_976);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_685);
+    s = ADD(s, K_977);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_686);
+    s = ADD(s, K_978);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_687);
+    s = ADD(s, K_979);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_688);
+    return s;
+}
+int use98(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_980);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_686);
+    s = ADD(s, K_981);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_687);
+    s = ADD(s, K_982);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_688);
+    s = ADD(s, K_983);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_689);
+    s = ADD(s, K_984);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_690);
+    s = ADD(s, K_985);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_691);
+    s = ADD(s, K_986);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_692);
+    s = ADD(s, K_987);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_693);
+    s = ADD(s, K_988);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_694);
+    s = ADD(s, K_989);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_695);
+    return s;
+}
+int use99(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_990);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_693);
+    s = ADD(s, K_991);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_694);
+    s = ADD(s, K_992);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_695);
+    s = ADD(s, K_993);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_696);
+    s = ADD(s, K_994);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_697);
+    s = ADD(s, K_995);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_698);
+    s = ADD(s, K_996);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_699);
+    s = ADD(s, K_997);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_700);
+    s = ADD(s, K_998);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_701);
+    s = ADD(s, K_999);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_702);
+    return s;
+}
+int use100(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_0);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_700);
+    s = ADD(s, K_1);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_701);
+    s = ADD(s, K_2);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_702);
+    s = ADD(s, K_3);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_703);
+    s = ADD(s, K_4);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_704);
+    s = ADD(s, K_5);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_705);
+    s = ADD(s, K_6);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_706);
+    s = ADD(s, K_7);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_707);
+    s = ADD(s, K_8);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_708);
+    s = ADD(s, K_9);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_709);
+    return s;
+}
+int use101(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_10);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_707);
+    s = ADD(s, K_11);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_708);
+    s = ADD(s, K_12);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_709);
+    s = ADD(s, K_13);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_710);
+    s = ADD(s, K_14);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_711);
+    s = ADD(s, K_15);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_712);
+    s = ADD(s, K_16);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_713);
+    s = ADD(s, K_17);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_714);
+    s = ADD(s, K_18);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_715);
+    s = ADD(s, K_19);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_716);
+    return s;
+}
+int use102(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_20);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_714);
+    s = ADD(s, K_21);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_715);
+    s = ADD(s, K_22);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_716);
+    s = ADD(s, K_23);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_717);
+    s = ADD(s, K_24);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_718);
+    s = ADD(s, K_25);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_719);
+    s = ADD(s, K_26);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_720);
+    s = ADD(s, K_27);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_721);
+    s = ADD(s, K_28);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_722);
+    s = ADD(s, K_29);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_723);
+    return s;
+}
+int use103(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_30);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_721);
+    s = ADD(s, K_31);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_722);
+    s = ADD(s, K_32);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_723);
+    s = ADD(s, K_33);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_724);
+    s = ADD(s, K_34);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_725);
+    s = ADD(s, K_35);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_726);
+    s = ADD(s, K_36);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_727);
+    s = ADD(s, K_37);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_728);
+    s = ADD(s, K_38);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_729);
+    s = ADD(s, K_39);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_730);
+    return s;
+}
+int use104(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_40);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_728);
+    s = ADD(s, K_41);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_729);
+    s = ADD(s, K_42);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_730);
+    s = ADD(s, K_43);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_731);
+    s = ADD(s, K_44);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_732);
+    s = ADD(s, K_45);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_733);
+    s = ADD(s, K_46);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_734);
+    s = ADD(s, K_47);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_735);
+    s = ADD(s, K_48);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_736);
+    s = ADD(s, K_49);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_737);
+    return s;
+}
+int use105(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_50);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_735);
+    s = ADD(s, K_51);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_736);
+    s = ADD(s, K_52);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_737);
+    s = ADD(s, K_53);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_738);
+    s = ADD(s, K_54);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_739);
+    s = ADD(s, K_55);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_740);
+    s = ADD(s, K_56);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_741);
+    s = ADD(s, K_57);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_742);
+    s = ADD(s, K_58);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_743);
+    s = ADD(s, K_59);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_744);
+    return s;
+}
+int use106(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_60);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_742);
+    s = ADD(s, K_61);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_743);
+    s = ADD(s, K_62);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_744);
+    s = ADD(s, K_63);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_745);
+    s = ADD(s, K_64);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_746);
+    s = ADD(s, K_65);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_747);
+    s = ADD(s, K_66);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_748);
+    s = ADD(s, K_67);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_749);
+    s = ADD(s, K_68);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_750);
+    s = ADD(s, K_69);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_751);
+    return s;
+}
+int use107(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_70);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_749);
+    s = ADD(s, K_71);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_750);
+    s = ADD(s, K_72);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_751);
+    s = ADD(s, K_73);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_752);
+    s = ADD(s, K_74);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_753);
+    s = ADD(s, K_75);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_754);
+    s = ADD(s, K_76);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_755);
+    s = ADD(s, K_77);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_756);
+    s = ADD(s, K_78);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_757);
+    s = ADD(s, K_79);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_758);
+    return s;
+}
+int use108(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_80);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_756);
+    s = ADD(s, K_81);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_757);
+    s = ADD(s, K_82);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_758);
+    s = ADD(s, K_83);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_759);
+    s = ADD(s, K_84);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_760);
+    s = ADD(s, K_85);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_761);
+    s = ADD(s, K_86);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_762);
+    s = ADD(s, K_87);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_763);
+    s = ADD(s, K_88);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_764);
+    s = ADD(s, K_89);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_765);
+    return s;
+}
+int use109(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_90);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_763);
+    s = ADD(s, K_91);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_764);
+    s = ADD(s, K_92);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_765);
+    s = ADD(s, K_93);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_766);
+    s = ADD(s, K_94);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_767);
+    s = ADD(s, K_95);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_768);
+    s = ADD(s, K_96);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_769);
+    s = ADD(s, K_97);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_770);
+    s = ADD(s, K_98);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_771);
+    s = ADD(s, K_99);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_772);
+    return s;
+}
+int use110(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_100);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_770);
+    s = ADD(s, K_101);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_771);
+    s = ADD(s, K_102);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_772);
+    s = ADD(s, K_103);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_773);
+    s = ADD(s, K_104);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_774);
+    s = ADD(s, K_105);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_775);
+    s = ADD(s, K_106);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_776);
+    s = ADD(s, K_107);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_777);
+    s = ADD(s, K_108);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_778);
+    s = ADD(s, K_109);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_779);
+    return s;
+}
+int use111(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_110);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_777);
+    s = ADD(s, K_111);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_778);
+    s = ADD(s, K_112);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_779);
+    s = ADD(s, K_113);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_780);
+    s = ADD(s, K_114);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_781);
+    s = ADD(s, K_115);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_782);
+    s = ADD(s, K_116);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_783);
+    s = ADD(s, K_117);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_784);
+    s = ADD(s, K_118);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_785);
+    s = ADD(s, K_119);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_786);
+    return s;
+}
+int use112(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_120);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_784);
+    s = ADD(s, K_121);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_785);
+    s = ADD(s, K_122);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_786);
+    s = ADD(s, K_123);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_787);
+    s = ADD(s, K_124);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_788);
+    s = ADD(s, K_125);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_789);
+    s = ADD(s, K_126);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_790);
+    s = ADD(s, K_127);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_791);
+    s = ADD(s, K_128);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_792);
+    s = ADD(s, K_129);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_793);
+    return s;
+}
+int use113(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_130);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_791);
+    s = ADD(s, K_131);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_792);
+    s = ADD(s, K_132);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_793);
+    s = ADD(s, K_133);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_794);
+    s = ADD(s, K_134);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_795);
+    s = ADD(s, K_135);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_796);
+    s = ADD(s, K_136);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_797);
+    s = ADD(s, K_137);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_798);
+    s = ADD(s, K_138);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_799);
+    s = ADD(s, K_139);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_800);
+    return s;
+}
+int use114(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_140);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_798);
+    s = ADD(s, K_141);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_799);
+    s = ADD(s, K_142);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_800);
+    s = ADD(s, K_143);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_801);
+    s = ADD(s, K_144);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_802);
+    s = ADD(s, K_145);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_803);
+    s = ADD(s, K_146);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_804);
+    s = ADD(s, K_147);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_805);
+    s = ADD(s, K_148);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_806);
+    s = ADD(s, K_149);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_807);
+    return s;
+}
+int use115(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_150);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_805);
+    s = ADD(s, K_151);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_806);
+    s = ADD(s, K_152);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_807);
+    s = ADD(s, K_153);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_808);
+    s = ADD(s, K_154);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_809);
+    s = ADD(s, K_155);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_810);
+    s = ADD(s, K_156);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_811);
+    s = ADD(s, K_157);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_812);
+    s = ADD(s, K_158);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_813);
+    s = ADD(s, K_159);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_814);
+    return s;
+}
+int use116(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_160);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_812);
+    s = ADD(s, K_161);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_813);
+    s = ADD(s, K_162);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_814);
+    s = ADD(s, K_163);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_815);
+    s = ADD(s, K_164);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_816);
+    s = ADD(s, K_165);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_817);
+    s = ADD(s, K_166);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_818);
+    s = ADD(s, K_167);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_819);
+    s = ADD(s, K_168);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_820);
+    s = ADD(s, K_169);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_821);
+    return s;
+}
+int use117(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_170);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_819);
+    s = ADD(s, K_171);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_820);
+    s = ADD(s, K_172);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_821);
+    s = ADD(s, K_173);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_822);
+    s = ADD(s, K_174);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_823);
+    s = ADD(s, K_175);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_824);
+    s = ADD(s, K_176);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_825);
+    s = ADD(s, K_177);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_826);
+    s = ADD(s, K_178);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_827);
+    s = ADD(s, K_179);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_828);
+    return s;
+}
+int use118(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_180);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_826);
+    s = ADD(s, K_181);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_827);
+    s = ADD(s, K_182);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_828);
+    s = ADD(s, K_183);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_829);
+    s = ADD(s, K_184);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_830);
+    s = ADD(s, K_185);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_831);
+    s = ADD(s, K_186);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_832);
+    s = ADD(s, K_187);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_833);
+    s = ADD(s, K_188);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_834);
+    s = ADD(s, K_189);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_835);
+    return s;
+}
+int use119(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_190);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_833);
+    s = ADD(s, K_191);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_834);
+    s = ADD(s, K_192);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_835);
+    s = ADD(s, K_193);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_836);
+    s = ADD(s, K_194);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_837);
+    s = ADD(s, K_195);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_838);
+    s = ADD(s, K_196);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_839);
+    s = ADD(s, K_197);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_840);
+    s = ADD(s, K_198);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_841);
+    s = ADD(s, K_199);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_842);
+    return s;
+}
+int use120(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_200);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_840);
+    s = ADD(s, K_201);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_841);
+    s = ADD(s, K_202);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_842);
+    s = ADD(s, K_203);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_843);
+    s = ADD(s, K_204);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_844);
+    s = ADD(s, K_205);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_845);
+    s = ADD(s, K_206);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_846);
+    s = ADD(s, K_207);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_847);
+    s = ADD(s, K_208);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_848);
+    s = ADD(s, K_209);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_849);
+    return s;
+}
+int use121(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_210);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_847);
+    s = ADD(s, K_211);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_848);
+    s = ADD(s, K_212);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_849);
+    s = ADD(s, K_213);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_850);
+    s = ADD(s, K_214);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_851);
+    s = ADD(s, K_215);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_852);
+    s = ADD(s, K_216);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_853);
+    s = ADD(s, K_217);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_854);
+    s = ADD(s, K_218);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_855);
+    s = ADD(s, K_219);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_856);
+    return s;
+}
+int use122(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_220);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_854);
+    s = ADD(s, K_221);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_855);
+    s = ADD(s, K_222);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_856);
+    s = ADD(s, K_223);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_857);
+    s = ADD(s, K_224);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_858);
+    s = ADD(s, K_225);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_859);
+    s = ADD(s, K_226);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_860);
+    s = ADD(s, K_227);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_861);
+    s = ADD(s, K_228);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_862);
+    s = ADD(s, K_229);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_863);
+    return s;
+}
+int use123(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_230);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_861);
+    s = ADD(s, K_231);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_862);
+    s = ADD(s, K_232);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_863);
+    s = ADD(s, K_233);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_864);
+    s = ADD(s, K_234);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_865);
+    s = ADD(s, K_235);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_866);
+    s = ADD(s, K_236);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_867);
+    s = ADD(s, K_237);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_868);
+    s = ADD(s, K_238);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_869);
+    s = ADD(s, K_239);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_870);
+    return s;
+}
+int use124(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_240);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_868);
+    s = ADD(s, K_241);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_869);
+    s = ADD(s, K_242);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_870);
+    s = ADD(s, K_243);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_871);
+    s = ADD(s, K_244);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_872);
+    s = ADD(s, K_245);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_873);
+    s = ADD(s, K_246);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_874);
+    s = ADD(s, K_247);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_875);
+    s = ADD(s, K_248);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_876);
+    s = ADD(s, K_249);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_877);
+    return s;
+}
+int use125(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_250);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_875);
+    s = ADD(s, K_251);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_876);
+    s = ADD(s, K_252);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_877);
+    s = ADD(s, K_253);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_878);
+    s = ADD(s, K_254);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_879);
+    s = ADD(s, K_255);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_880);
+    s = ADD(s, K_256);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_881);
+    s = ADD(s, K_257);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_882);
+    s = ADD(s, K_258);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_883);
+    s = ADD(s, K_259);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_884);
+    return s;
+}
+int use126(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_260);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_882);
+    s = ADD(s, K_261);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_883);
+    s = ADD(s, K_262);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_884);
+    s = ADD(s, K_263);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_885);
+    s = ADD(s, K_264);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_886);
+    s = ADD(s, K_265);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_887);
+    s = ADD(s, K_266);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_888);
+    s = ADD(s, K_267);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_889);
+    s = ADD(s, K_268);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_890);
+    s = ADD(s, K_269);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_891);
+    return s;
+}
+int use127(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_270);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_889);
+    s = ADD(s, K_271);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_890);
+    s = ADD(s, K_272);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_891);
+    s = ADD(s, K_273);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_892);
+    s = ADD(s, K_274);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_893);
+    s = ADD(s, K_275);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_894);
+    s = ADD(s, K_276);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_895);
+    s = ADD(s, K_277);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_896);
+    s = ADD(s, K_278);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_897);
+    s = ADD(s, K_279);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_898);
+    return s;
+}
+int use128(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_280);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_896);
+    s = ADD(s, K_281);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_897);
+    s = ADD(s, K_282);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_898);
+    s = ADD(s, K_283);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_899);
+    s = ADD(s, K_284);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_900);
+    s = ADD(s, K_285);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_901);
+    s = ADD(s, K_286);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_902);
+    s = ADD(s, K_287);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_903);
+    s = ADD(s, K_288);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_904);
+    s = ADD(s, K_289);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_905);
+    return s;
+}
+int use129(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_290);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_903);
+    s = ADD(s, K_291);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_904);
+    s = ADD(s, K_292);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_905);
+    s = ADD(s, K_293);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_906);
+    s = ADD(s, K_294);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_907);
+    s = ADD(s, K_295);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_908);
+    s = ADD(s, K_296);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_909);
+    s = ADD(s, K_297);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_910);
+    s = ADD(s, K_298);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_911);
+    s = ADD(s, K_299);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_912);
+    return s;
+}
+int use130(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_300);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_910);
+    s = ADD(s, K_301);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_911);
+    s = ADD(s, K_302);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_912);
+    s = ADD(s, K_303);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_913);
+    s = ADD(s, K_304);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_914);
+    s = ADD(s, K_305);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_915);
+    s = ADD(s, K_306);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_916);
+    s = ADD(s, K_307);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_917);
+    s = ADD(s, K_308);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_918);
+    s = ADD(s, K_309);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_919);
+    return s;
+}
+int use131(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_310);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_917);
+    s = ADD(s, K_311);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_918);
+    s = ADD(s, K_312);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_919);
+    s = ADD(s, K_313);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_920);
+    s = ADD(s, K_314);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_921);
+    s = ADD(s, K_315);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_922);
+    s = ADD(s, K_316);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_923);
+    s = ADD(s, K_317);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_924);
+    s = ADD(s, K_318);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_925);
+    s = ADD(s, K_319);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_926);
+    return s;
+}
+int use132(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_320);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_924);
+    s = ADD(s, K_321);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_925);
+    s = ADD(s, K_322);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_926);
+    s = ADD(s, K_323);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_927);
+    s = ADD(s, K_324);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_928);
+    s = ADD(s, K_325);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_929);
+    s = ADD(s, K_326);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_930);
+    s = ADD(s, K_327);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_931);
+    s = ADD(s, K_328);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_932);
+    s = ADD(s, K_329);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_933);
+    return s;
+}
+int use133(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_330);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_931);
+    s = ADD(s, K_331);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_932);
+    s = ADD(s, K_332);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_933);
+    s = ADD(s, K_333);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_934);
+    s = ADD(s, K_334);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_935);
+    s = ADD(s, K_335);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_936);
+    s = ADD(s, K_336);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_937);
+    s = ADD(s, K_337);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_938);
+    s = ADD(s, K_338);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_939);
+    s = ADD(s, K_339);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_940);
+    return s;
+}
+int use134(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_340);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_938);
+    s = ADD(s, K_341);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_939);
+    s = ADD(s, K_342);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_940);
+    s = ADD(s, K_343);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_941);
+    s = ADD(s, K_344);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_942);
+    s = ADD(s, K_345);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_943);
+    s = ADD(s, K_346);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_944);
+    s = ADD(s, K_347);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_945);
+    s = ADD(s, K_348);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_946);
+    s = ADD(s, K_349);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_947);
+    return s;
+}
+int use135(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_350);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_945);
+    s = ADD(s, K_351);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_946);
+    s = ADD(s, K_352);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_947);
+    s = ADD(s, K_353);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_948);
+    s = ADD(s, K_354);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_949);
+    s = ADD(s, K_355);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_950);
+    s = ADD(s, K_356);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_951);
+    s = ADD(s, K_357);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_952);
+    s = ADD(s, K_358);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_953);
+    s = ADD(s, K_359);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_954);
+    return s;
+}
+int use136(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_360);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_952);
+    s = ADD(s, K_361);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_953);
+    s = ADD(s, K_362);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_954);
+    s = ADD(s, K_363);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_955);
+    s = ADD(s, K_364);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_956);
+    s = ADD(s, K_365);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_957);
+    s = ADD(s, K_366);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_958);
+    s = ADD(s, K_367);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_959);
+    s = ADD(s, K_368);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_960);
+    s = ADD(s, K_369);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_961);
+    return s;
+}
+int use137(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_370);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_959);
+    s = ADD(s, K_371);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_960);
+    s = ADD(s, K_372);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_961);
+    s = ADD(s, K_373);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_962);
+    s = ADD(s, K_374);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_963);
+    s = ADD(s, K_375);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_964);
+    s = ADD(s, K_376);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_965);
+    s = ADD(s, K_377);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_966);
+    s = ADD(s, K_378);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_967);
+    s = ADD(s, K_379);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_968);
+    return s;
+}
+int use138(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_380);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_966);
+    s = ADD(s, K_381);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_967);
+    s = ADD(s, K_382);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_968);
+    s = ADD(s, K_383);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_969);
+    s = ADD(s, K_384);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_970);
+    s = ADD(s, K_385);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_971);
+    s = ADD(s, K_386);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_972);
+    s = ADD(s, K_387);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_973);
+    s = ADD(s, K_388);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_974);
+    s = ADD(s, K_389);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_975);
+    return s;
+}
+int use139(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_390);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_973);
+    s = ADD(s, K_391);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_974);
+    s = ADD(s, K_392);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_975);
+    s = ADD(s, K_393);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_976);
+    s = ADD(s, K_394);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_977);
+    s = ADD(s, K_395);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_978);
+    s = ADD(s, K_396);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_979);
+    s = ADD(s, K_397);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_980);
+    s = ADD(s, K_398);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_981);
+    s = ADD(s, K_399);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_982);
+    return s;
+}
+int use140(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_400);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_980);
+    s = ADD(s, K_401);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_981);
+    s = ADD(s, K_402);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_982);
+    s = ADD(s, K_403);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_983);
+    s = ADD(s, K_404);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_984);
+    s = ADD(s, K_405);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_985);
+    s = ADD(s, K_406);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_986);
+    s = ADD(s, K_407);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_987);
+    s = ADD(s, K_408);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_988);
+    s = ADD(s, K_409);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_989);
+    return s;
+}
+int use141(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_410);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_987);
+    s = ADD(s, K_411);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_988);
+    s = ADD(s, K_412);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_989);
+    s = ADD(s, K_413);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_990);
+    s = ADD(s, K_414);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_991);
+    s = ADD(s, K_415);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_992);
+    s = ADD(s, K_416);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_993);
+    s = ADD(s, K_417);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_994);
+    s = ADD(s, K_418);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_995);
+    s = ADD(s, K_419);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_996);
+    return s;
+}
+int use142(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_420);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_994);
+    s = ADD(s, K_421);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_995);
+    s = ADD(s, K_422);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_996);
+    s = ADD(s, K_423);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_997);
+    s = ADD(s, K_424);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_998);
+    s = ADD(s, K_425);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_999);
+    s = ADD(s, K_426);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_0);
+    s = ADD(s, K_427);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_1);
+    s = ADD(s, K_428);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_2);
+    s = ADD(s, K_429);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_3);
+    return s;
+}
+int use143(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_430);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_1);
+    s = ADD(s, K_431);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_2);
+    s = ADD(s, K_432);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_3);
+    s = ADD(s, K_433);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_4);
+    s = ADD(s, K_434);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_5);
+    s = ADD(s, K_435);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_6);
+    s = ADD(s, K_436);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_7);
+    s = ADD(s, K_437);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_8);
+    s = ADD(s, K_438);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_9);
+    s = ADD(s, K_439);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_10);
+    return s;
+}
+int use144(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_440);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_8);
+    s = ADD(s, K_441);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_9);
+    s = ADD(s, K_442);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_10);
+    s = ADD(s, K_443);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_11);
+    s = ADD(s, K_444);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_12);
+    s = ADD(s, K_445);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_13);
+    s = ADD(s, K_446);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_14);
+    s = ADD(s, K_447);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_15);
+    s = ADD(s, K_448);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_16);
+    s = ADD(s, K_449);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_17);
+    return s;
+}
+int use145(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_450);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_15);
+    s = ADD(s, K_451);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_16);
+    s = ADD(s, K_452);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_17);
+    s = ADD(s, K_453);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_18);
+    s = ADD(s, K_454);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_19);
+    s = ADD(s, K_455);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_20);
+    s = ADD(s, K_456);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_21);
+    s = ADD(s, K_457);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_22);
+    s = ADD(s, K_458);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_23);
+    s = ADD(s, K_459);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_24);
+    return s;
+}
+int use146(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_460);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_22);
+    s = ADD(s, K_461);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_23);
+    s = ADD(s, K_462);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_24);
+    s = ADD(s, K_463);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_25);
+    s = ADD(s, K_464);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_26);
+    s = ADD(s, K_465);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_27);
+    s = ADD(s, K_466);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_28);
+    s = ADD(s, K_467);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_29);
+    s = ADD(s, K_468);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_30);
+    s = ADD(s, K_469);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_31);
+    return s;
+}
+int use147(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_470);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_29);
+    s = ADD(s, K_471);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_30);
+    s = ADD(s, K_472);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_31);
+    s = ADD(s, K_473);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_32);
+    s = ADD(s, K_474);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_33);
+    s = ADD(s, K_475);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_34);
+    s = ADD(s, K_476);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_35);
+    s = ADD(s, K_477);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_36);
+    s = ADD(s, K_478);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_37);
+    s = ADD(s, K_479);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_38);
+    return s;
+}
+int use148(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_480);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_36);
+    s = ADD(s, K_481);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_37);
+    s = ADD(s, K_482);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_38);
+    s = ADD(s, K_483);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_39);
+    s = ADD(s, K_484);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_40);
+    s = ADD(s, K_485);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_41);
+    s = ADD(s, K_486);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_42);
+    s = ADD(s, K_487);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_43);
+    s = ADD(s, K_488);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_44);
+    s = ADD(s, K_489);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_45);
+    return s;
+}
+int use149(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_490);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_43);
+    s = ADD(s, K_491);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_44);
+    s = ADD(s, K_492);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_45);
+    s = ADD(s, K_493);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_46);
+    s = ADD(s, K_494);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_47);
+    s = ADD(s, K_495);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_48);
+    s = ADD(s, K_496);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_49);
+    s = ADD(s, K_497);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_50);
+    s = ADD(s, K_498);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_51);
+    s = ADD(s, K_499);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_52);
+    return s;
+}
+int use150(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_500);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_50);
+    s = ADD(s, K_501);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_51);
+    s = ADD(s, K_502);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_52);
+    s = ADD(s, K_503);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_53);
+    s = ADD(s, K_504);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_54);
+    s = ADD(s, K_505);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_55);
+    s = ADD(s, K_506);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_56);
+    s = ADD(s, K_507);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_57);
+    s = ADD(s, K_508);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_58);
+    s = ADD(s, K_509);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_59);
+    return s;
+}
+int use151(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_510);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_57);
+    s = ADD(s, K_511);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_58);
+    s = ADD(s, K_512);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_59);
+    s = ADD(s, K_513);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_60);
+    s = ADD(s, K_514);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_61);
+    s = ADD(s, K_515);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_62);
+    s = ADD(s, K_516);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_63);
+    s = ADD(s, K_517);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_64);
+    s = ADD(s, K_518);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_65);
+    s = ADD(s, K_519);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_66);
+    return s;
+}
+int use152(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_520);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_64);
+    s = ADD(s, K_521);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_65);
+    s = ADD(s, K_522);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_66);
+    s = ADD(s, K_523);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_67);
+    s = ADD(s, K_524);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_68);
+    s = ADD(s, K_525);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_69);
+    s = ADD(s, K_526);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_70);
+    s = ADD(s, K_527);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_71);
+    s = ADD(s, K_528);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_72);
+    s = ADD(s, K_529);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_73);
+    return s;
+}
+int use153(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_530);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_71);
+    s = ADD(s, K_531);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_72);
+    s = ADD(s, K_532);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_73);
+    s = ADD(s, K_533);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_74);
+    s = ADD(s, K_534);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_75);
+    s = ADD(s, K_535);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_76);
+    s = ADD(s, K_536);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_77);
+    s = ADD(s, K_537);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_78);
+    s = ADD(s, K_538);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_79);
+    s = ADD(s, K_539);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_80);
+    return s;
+}
+int use154(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_540);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_78);
+    s = ADD(s, K_541);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_79);
+    s = ADD(s, K_542);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_80);
+    s = ADD(s, K_543);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_81);
+    s = ADD(s, K_544);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_82);
+    s = ADD(s, K_545);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_83);
+    s = ADD(s, K_546);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_84);
+    s = ADD(s, K_547);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_85);
+    s = ADD(s, K_548);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_86);
+    s = ADD(s, K_549);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_87);
+    return s;
+}
+int use155(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_550);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_85);
+    s = ADD(s, K_551);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_86);
+    s = ADD(s, K_552);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_87);
+    s = ADD(s, K_553);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_88);
+    s = ADD(s, K_554);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_89);
+    s = ADD(s, K_555);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_90);
+    s = ADD(s, K_556);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_91);
+    s = ADD(s, K_557);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_92);
+    s = ADD(s, K_558);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_93);
+    s = ADD(s, K_559);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_94);
+    return s;
+}
+int use156(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_560);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_92);
+    s = ADD(s, K_561);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_93);
+    s = ADD(s, K_562);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_94);
+    s = ADD(s, K_563);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_95);
+    s = ADD(s, K_564);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_96);
+    s = ADD(s, K_565);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_97);
+    s = ADD(s, K_566);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_98);
+    s = ADD(s, K_567);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_99);
+    s = ADD(s, K_568);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_100);
+    s = ADD(s, K_569);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_101);
+    return s;
+}
+int use157(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_570);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_99);
+    s = ADD(s, K_571);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_100);
+    s = ADD(s, K_572);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_101);
+    s = ADD(s, K_573);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_102);
+    s = ADD(s, K_574);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_103);
+    s = ADD(s, K_575);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_104);
+    s = ADD(s, K_576);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_105);
+    s = ADD(s, K_577);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_106);
+    s = ADD(s, K_578);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_107);
+    s = ADD(s, K_579);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_108);
+    return s;
+}
+int use158(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_580);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_106);
+    s = ADD(s, K_581);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_107);
+    s = ADD(s, K_582);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_108);
+    s = ADD(s, K_583);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_109);
+    s = ADD(s, K_584);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_110);
+    s = ADD(s, K_585);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_111);
+    s = ADD(s, K_586);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_112);
+    s = ADD(s, K_587);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_113);
+    s = ADD(s, K_588);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_114);
+    s = ADD(s, K_589);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_115);
+    return s;
+}
+int use159(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_590);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_113);
+    s = ADD(s, K_591);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_114);
+    s = ADD(s, K_592);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_115);
+    s = ADD(s, K_593);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_116);
+    s = ADD(s, K_594);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_117);
+    s = ADD(s, K_595);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_118);
+    s = ADD(s, K_596);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_119);
+    s = ADD(s, K_597);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_120);
+    s = ADD(s, K_598);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_121);
+    s = ADD(s, K_599);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_122);
+    return s;
+}
+int use160(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_600);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_120);
+    s = ADD(s, K_601);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_121);
+    s = ADD(s, K_602);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_122);
+    s = ADD(s, K_603);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_123);
+    s = ADD(s, K_604);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_124);
+    s = ADD(s, K_605);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_125);
+    s = ADD(s, K_606);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_126);
+    s = ADD(s, K_607);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_127);
+    s = ADD(s, K_608);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_128);
+    s = ADD(s, K_609);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_129);
+    return s;
+}
+int use161(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_610);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_127);
+    s = ADD(s, K_611);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_128);
+    s = ADD(s, K_612);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_129);
+    s = ADD(s, K_613);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_130);
+    s = ADD(s, K_614);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_131);
+    s = ADD(s, K_615);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_132);
+    s = ADD(s, K_616);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_133);
+    s = ADD(s, K_617);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_134);
+    s = ADD(s, K_618);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_135);
+    s = ADD(s, K_619);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_136);
+    return s;
+}
+int use162(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_620);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_134);
+    s = ADD(s, K_621);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_135);
+    s = ADD(s, K_622);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_136);
+    s = ADD(s, K_623);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_137);
+    s = ADD(s, K_624);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_138);
+    s = ADD(s, K_625);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_139);
+    s = ADD(s, K_626);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_140);
+    s = ADD(s, K_627);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_141);
+    s = ADD(s, K_628);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_142);
+    s = ADD(s, K_629);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_143);
+    return s;
+}
+int use163(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_630);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_141);
+    s = ADD(s, K_631);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_142);
+    s = ADD(s, K_632);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_143);
+    s = ADD(s, K_633);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_144);
+    s = ADD(s, K_634);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_145);
+    s = ADD(s, K_635);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_146);
+    s = ADD(s, K_636);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_147);
+    s = ADD(s, K_637);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_148);
+    s = ADD(s, K_638);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_149);
+    s = ADD(s, K_639);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_150);
+    return s;
+}
+int use164(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_640);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_148);
+    s = ADD(s, K_641);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_149);
+    s = ADD(s, K_642);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_150);
+    s = ADD(s, K_643);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_151);
+    s = ADD(s, K_644);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_152);
+    s = ADD(s, K_645);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_153);
+    s = ADD(s, K_646);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_154);
+    s = ADD(s, K_647);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_155);
+    s = ADD(s, K_648);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_156);
+    s = ADD(s, K_649);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_157);
+    return s;
+}
+int use165(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_650);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_155);
+    s = ADD(s, K_651);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_156);
+    s = ADD(s, K_652);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_157);
+    s = ADD(s, K_653);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_158);
+    s = ADD(s, K_654);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_159);
+    s = ADD(s, K_655);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_160);
+    s = ADD(s, K_656);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_161);
+    s = ADD(s, K_657);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_162);
+    s = ADD(s, K_658);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_163);
+    s = ADD(s, K_659);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_164);
+    return s;
+}
+int use166(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_660);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_162);
+    s = ADD(s, K_661);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_163);
+    s = ADD(s, K_662);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_164);
+    s = ADD(s, K_663);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_165);
+    s = ADD(s, K_664);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_166);
+    s = ADD(s, K_665);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_167);
+    s = ADD(s, K_666);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_168);
+    s = ADD(s, K_667);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_169);
+    s = ADD(s, K_668);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_170);
+    s = ADD(s, K_669);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_171);
+    return s;
+}
+int use167(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_670);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_169);
+    s = ADD(s, K_671);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_170);
+    s = ADD(s, K_672);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_171);
+    s = ADD(s, K_673);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_172);
+    s = ADD(s, K_674);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_173);
+    s = ADD(s, K_675);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_174);
+    s = ADD(s, K_676);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_175);
+    s = ADD(s, K_677);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_176);
+    s = ADD(s, K_678);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_177);
+    s = ADD(s, K_679);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_178);
+    return s;
+}
+int use168(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_680);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_176);
+    s = ADD(s, K_681);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_177);
+    s = ADD(s, K_682);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_178);
+    s = ADD(s, K_683);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_179);
+    s = ADD(s, K_684);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_180);
+    s = ADD(s, K_685);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_181);
+    s = ADD(s, K_686);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_182);
+    s = ADD(s, K_687);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_183);
+    s = ADD(s, K_688);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_184);
+    s = ADD(s, K_689);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_185);
+    return s;
+}
+int use169(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_690);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_183);
+    s = ADD(s, K_691);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_184);
+    s = ADD(s, K_692);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_185);
+    s = ADD(s, K_693);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_186);
+    s = ADD(s, K_694);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_187);
+    s = ADD(s, K_695);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_188);
+    s = ADD(s, K_696);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_189);
+    s = ADD(s, K_697);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_190);
+    s = ADD(s, K_698);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_191);
+    s = ADD(s, K_699);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_192);
+    return s;
+}
+int use170(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_700);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_190);
+    s = ADD(s, K_701);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_191);
+    s = ADD(s, K_702);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_192);
+    s = ADD(s, K_703);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_193);
+    s = ADD(s, K_704);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_194);
+    s = ADD(s, K_705);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_195);
+    s = ADD(s, K_706);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_196);
+    s = ADD(s, K_707);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_197);
+    s = ADD(s, K_708);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_198);
+    s = ADD(s, K_709);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_199);
+    return s;
+}
+int use171(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_710);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_197);
+    s = ADD(s, K_711);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_198);
+    s = ADD(s, K_712);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_199);
+    s = ADD(s, K_713);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_200);
+    s = ADD(s, K_714);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_201);
+    s = ADD(s, K_715);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_202);
+    s = ADD(s, K_716);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_203);
+    s = ADD(s, K_717);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_204);
+    s = ADD(s, K_718);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_205);
+    s = ADD(s, K_719);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_206);
+    return s;
+}
+int use172(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_720);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_204);
+    s = ADD(s, K_721);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_205);
+    s = ADD(s, K_722);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_206);
+    s = ADD(s, K_723);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_207);
+    s = ADD(s, K_724);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_208);
+    s = ADD(s, K_725);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_209);
+    s = ADD(s, K_726);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_210);
+    s = ADD(s, K_727);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_211);
+    s = ADD(s, K_728);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_212);
+    s = ADD(s, K_729);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_213);
+    return s;
+}
+int use173(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_730);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_211);
+    s = ADD(s, K_731);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_212);
+    s = ADD(s, K_732);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_213);
+    s = ADD(s, K_733);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_214);
+    s = ADD(s, K_734);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_215);
+    s = ADD(s, K_735);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_216);
+    s = ADD(s, K_736);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_217);
+    s = ADD(s, K_737);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_218);
+    s = ADD(s, K_738);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_219);
+    s = ADD(s, K_739);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_220);
+    return s;
+}
+int use174(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_740);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_218);
+    s = ADD(s, K_741);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_219);
+    s = ADD(s, K_742);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_220);
+    s = ADD(s, K_743);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_221);
+    s = ADD(s, K_744);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_222);
+    s = ADD(s, K_745);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_223);
+    s = ADD(s, K_746);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_224);
+    s = ADD(s, K_747);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_225);
+    s = ADD(s, K_748);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_226);
+    s = ADD(s, K_749);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_227);
+    return s;
+}
+int use175(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_750);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_225);
+    s = ADD(s, K_751);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_226);
+    s = ADD(s, K_752);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_227);
+    s = ADD(s, K_753);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_228);
+    s = ADD(s, K_754);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_229);
+    s = ADD(s, K_755);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_230);
+    s = ADD(s, K_756);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_231);
+    s = ADD(s, K_757);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_232);
+    s = ADD(s, K_758);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_233);
+    s = ADD(s, K_759);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_234);
+    return s;
+}
+int use176(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_760);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_232);
+    s = ADD(s, K_761);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_233);
+    s = ADD(s, K_762);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_234);
+    s = ADD(s, K_763);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_235);
+    s = ADD(s, K_764);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_236);
+    s = ADD(s, K_765);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_237);
+    s = ADD(s, K_766);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_238);
+    s = ADD(s, K_767);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_239);
+    s = ADD(s, K_768);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_240);
+    s = ADD(s, K_769);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_241);
+    return s;
+}
+int use177(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_770);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_239);
+    s = ADD(s, K_771);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_240);
+    s = ADD(s, K_772);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_241);
+    s = ADD(s, K_773);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_242);
+    s = ADD(s, K_774);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_243);
+    s = ADD(s, K_775);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_244);
+    s = ADD(s, K_776);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_245);
+    s = ADD(s, K_777);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_246);
+    s = ADD(s, K_778);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_247);
+    s = ADD(s, K_779);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_248);
+    return s;
+}
+int use178(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_780);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_246);
+    s = ADD(s, K_781);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_247);
+    s = ADD(s, K_782);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_248);
+    s = ADD(s, K_783);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_249);
+    s = ADD(s, K_784);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_250);
+    s = ADD(s, K_785);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_251);
+    s = ADD(s, K_786);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_252);
+    s = ADD(s, K_787);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_253);
+    s = ADD(s, K_788);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_254);
+    s = ADD(s, K_789);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_255);
+    return s;
+}
+int use179(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_790);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_253);
+    s = ADD(s, K_791);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_254);
+    s = ADD(s, K_792);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_255);
+    s = ADD(s, K_793);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_256);
+    s = ADD(s, K_794);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_257);
+    s = ADD(s, K_795);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_258);
+    s = ADD(s, K_796);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_259);
+    s = ADD(s, K_797);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_260);
+    s = ADD(s, K_798);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_261);
+    s = ADD(s, K_799);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_262);
+    return s;
+}
+int use180(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_800);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_260);
+    s = ADD(s, K_801);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_261);
+    s = ADD(s, K_802);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_262);
+    s = ADD(s, K_803);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_263);
+    s = ADD(s, K_804);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_264);
+    s = ADD(s, K_805);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_265);
+    s = ADD(s, K_806);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_266);
+    s = ADD(s, K_807);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_267);
+    s = ADD(s, K_808);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_268);
+    s = ADD(s, K_809);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_269);
+    return s;
+}
+int use181(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_810);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_267);
+    s = ADD(s, K_811);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_268);
+    s = ADD(s, K_812);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_269);
+    s = ADD(s, K_813);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_270);
+    s = ADD(s, K_814);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_271);
+    s = ADD(s, K_815);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_272);
+    s = ADD(s, K_816);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_273);
+    s = ADD(s, K_817);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_274);
+    s = ADD(s, K_818);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_275);
+    s = ADD(s, K_819);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_276);
+    return s;
+}
+int use182(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_820);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_274);
+    s = ADD(s, K_821);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_275);
+    s = ADD(s, K_822);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_276);
+    s = ADD(s, K_823);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_277);
+    s = ADD(s, K_824);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_278);
+    s = ADD(s, K_825);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_279);
+    s = ADD(s, K_826);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_280);
+    s = ADD(s, K_827);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_281);
+    s = ADD(s, K_828);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_282);
+    s = ADD(s, K_829);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_283);
+    return s;
+}
+int use183(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_830);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_281);
+    s = ADD(s, K_831);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_282);
+    s = ADD(s, K_832);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_283);
+    s = ADD(s, K_833);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_284);
+    s = ADD(s, K_834);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_285);
+    s = ADD(s, K_835);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_286);
+    s = ADD(s, K_836);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_287);
+    s = ADD(s, K_837);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_288);
+    s = ADD(s, K_838);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_289);
+    s = ADD(s, K_839);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_290);
+    return s;
+}
+int use184(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_840);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_288);
+    s = ADD(s, K_841);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_289);
+    s = ADD(s, K_842);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_290);
+    s = ADD(s, K_843);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_291);
+    s = ADD(s, K_844);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_292);
+    s = ADD(s, K_845);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_293);
+    s = ADD(s, K_846);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_294);
+    s = ADD(s, K_847);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_295);
+    s = ADD(s, K_848);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_296);
+    s = ADD(s, K_849);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_297);
+    return s;
+}
+int use185(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_850);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_295);
+    s = ADD(s, K_851);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_296);
+    s = ADD(s, K_852);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_297);
+    s = ADD(s, K_853);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_298);
+    s = ADD(s, K_854);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_299);
+    s = ADD(s, K_855);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_300);
+    s = ADD(s, K_856);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_301);
+    s = ADD(s, K_857);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_302);
+    s = ADD(s, K_858);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_303);
+    s = ADD(s, K_859);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_304);
+    return s;
+}
+int use186(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_860);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_302);
+    s = ADD(s, K_861);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_303);
+    s = ADD(s, K_862);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_304);
+    s = ADD(s, K_863);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_305);
+    s = ADD(s, K_864);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_306);
+    s = ADD(s, K_865);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_307);
+    s = ADD(s, K_866);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_308);
+    s = ADD(s, K_867);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_309);
+    s = ADD(s, K_868);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_310);
+    s = ADD(s, K_869);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_311);
+    return s;
+}
+int use187(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_870);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_309);
+    s = ADD(s, K_871);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_310);
+    s = ADD(s, K_872);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_311);
+    s = ADD(s, K_873);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_312);
+    s = ADD(s, K_874);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_313);
+    s = ADD(s, K_875);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_314);
+    s = ADD(s, K_876);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_315);
+    s = ADD(s, K_877);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_316);
+    s = ADD(s, K_878);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_317);
+    s = ADD(s, K_879);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_318);
+    return s;
+}
+int use188(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_880);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_316);
+    s = ADD(s, K_881);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_317);
+    s = ADD(s, K_882);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_318);
+    s = ADD(s, K_883);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_319);
+    s = ADD(s, K_884);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_320);
+    s = ADD(s, K_885);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_321);
+    s = ADD(s, K_886);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_322);
+    s = ADD(s, K_887);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_323);
+    s = ADD(s, K_888);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_324);
+    s = ADD(s, K_889);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_325);
+    return s;
+}
+int use189(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_890);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_323);
+    s = ADD(s, K_891);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_324);
+    s = ADD(s, K_892);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_325);
+    s = ADD(s, K_893);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_326);
+    s = ADD(s, K_894);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_327);
+    s = ADD(s, K_895);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_328);
+    s = ADD(s, K_896);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_329);
+    s = ADD(s, K_897);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_330);
+    s = ADD(s, K_898);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_331);
+    s = ADD(s, K_899);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_332);
+    return s;
+}
+int use190(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_900);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_330);
+    s = ADD(s, K_901);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_331);
+    s = ADD(s, K_902);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_332);
+    s = ADD(s, K_903);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_333);
+    s = ADD(s, K_904);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_334);
+    s = ADD(s, K_905);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_335);
+    s = ADD(s, K_906);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_336);
+    s = ADD(s, K_907);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_337);
+    s = ADD(s, K_908);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_338);
+    s = ADD(s, K_909);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_339);
+    return s;
+}
+int use191(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_910);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_337);
+    s = ADD(s, K_911);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_338);
+    s = ADD(s, K_912);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_339);
+    s = ADD(s, K_913);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_340);
+    s = ADD(s, K_914);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_341);
+    s = ADD(s, K_915);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_342);
+    s = ADD(s, K_916);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_343);
+    s = ADD(s, K_917);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_344);
+    s = ADD(s, K_918);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_345);
+    s = ADD(s, K_919);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_346);
+    return s;
+}
+int use192(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_920);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_344);
+    s = ADD(s, K_921);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_345);
+    s = ADD(s, K_922);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_346);
+    s = ADD(s, K_923);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_347);
+    s = ADD(s, K_924);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_348);
+    s = ADD(s, K_925);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_349);
+    s = ADD(s, K_926);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_350);
+    s = ADD(s, K_927);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_351);
+    s = ADD(s, K_928);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_352);
+    s = ADD(s, K_929);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_353);
+    return s;
+}
+int use193(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_930);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_351);
+    s = ADD(s, K_931);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_352);
+    s = ADD(s, K_932);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_353);
+    s = ADD(s, K_933);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_354);
+    s = ADD(s, K_934);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_355);
+    s = ADD(s, K_935);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_356);
+    s = ADD(s, K_936);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_357);
+    s = ADD(s, K_937);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_358);
+    s = ADD(s, K_938);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_359);
+    s = ADD(s, K_939);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_360);
+    return s;
+}
+int use194(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_940);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_358);
+    s = ADD(s, K_941);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_359);
+    s = ADD(s, K_942);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_360);
+    s = ADD(s, K_943);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_361);
+    s = ADD(s, K_944);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_362);
+    s = ADD(s, K_945);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_363);
+    s = ADD(s, K_946);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_364);
+    s = ADD(s, K_947);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_365);
+    s = ADD(s, K_948);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_366);
+    s = ADD(s, K_949);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_367);
+    return s;
+}
+int use195(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_950);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_365);
+    s = ADD(s, K_951);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_366);
+    s = ADD(s, K_952);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_367);
+    s = ADD(s, K_953);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_368);
+    s = ADD(s, K_954);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_369);
+    s = ADD(s, K_955);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_370);
+    s = ADD(s, K_956);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_371);
+    s = ADD(s, K_957);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_372);
+    s = ADD(s, K_958);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_373);
+    s = ADD(s, K_959);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_374);
+    return s;
+}
+int use196(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_960);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_372);
+    s = ADD(s, K_961);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_373);
+    s = ADD(s, K_962);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_374);
+    s = ADD(s, K_963);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_375);
+    s = ADD(s, K_964);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_376);
+    s = ADD(s, K_965);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_377);
+    s = ADD(s, K_966);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_378);
+    s = ADD(s, K_967);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_379);
+    s = ADD(s, K_968);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_380);
+    s = ADD(s, K_969);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_381);
+    return s;
+}
+int use197(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_970);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_379);
+    s = ADD(s, K_971);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_380);
+    s = ADD(s, K_972);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_381);
+    s = ADD(s, K_973);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_382);
+    s = ADD(s, K_974);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_383);
+    s = ADD(s, K_975);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_384);
+    s = ADD(s, K_976);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_385);
+    s = ADD(s, K_977);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_386);
+    s = ADD(s, K_978);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_387);
+    s = ADD(s, K_979);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_388);
+    return s;
+}
+int use198(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_980);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_386);
+    s = ADD(s, K_981);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_387);
+    s = ADD(s, K_982);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_388);
+    s = ADD(s, K_983);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_389);
+    s = ADD(s, K_984);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_390);
+    s = ADD(s, K_985);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_391);
+    s = ADD(s, K_986);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_392);
+    s = ADD(s, K_987);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_393);
+    s = ADD(s, K_988);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_394);
+    s = ADD(s, K_989);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_395);
+    return s;
+}
+int use199(pair_t *p)
+{
+    int m = p->m;
+    int s = p->n;
+    s = ADD(s, K_990);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_393);
+    s = ADD(s, K_991);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_394);
+    s = ADD(s, K_992);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_395);
+    s = ADD(s, K_993);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_396);
+    s = ADD(s, K_994);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_397);
+    s = ADD(s, K_995);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_398);
+    s = ADD(s, K_996);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_399);
+    s = ADD(s, K_997);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_400);
+    s = ADD(s, K_998);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_401);
+    s = ADD(s, K_999);
+    s = SCALE3(s);
+    s = MIX(s, m);
+    s = MIN(s, K_402);
+    return s;
+}
+int main()
+{
+    pair_t p;
+    p.n = 1;
+    p.m = 2;
+    return use0(&p);
+}
@@ -0,0 +1,1008 @@
+typedef struct {
+    int n;
+    int m;
+} pair_t;
+#define K_0 0
+#define K_1 1
+#define K_2 2
+#define K_3 3
+#define K_4 4
+#define K_5 5
+#define K_6 6
+#define K_7 7
+#define K_8 8
+#define K_9 9
+#define K_10 10
+#define K_11 11
+#define K_12 12
+#define K_13 13
+#define K_14 14
+#define K_15 15
+#define K_16 16
+#define K_17 17
+#define K_18 18
+#define K_19 19
+#define K_20 20
+#define K_21 21
+#define K_22 22
+#define K_23 23
+#define K_24 24
+#define K_25 25
+#define K_26 26
+#define K_27 27
+#define K_28 28
+#define K_29 29
+#define K_30 30
+#define K_31 31
+#define K_32 32
+#define K_33 33
+#define K_34 34
+#define K_35 35
+#define K_36 36
+#define K_37 37
+#define K_38 38
+#define K_39 39
+#define K_40 40
+#define K_41 41
+#define K_42 42
+#define K_43 43
+#define K_44 44
+#define K_45 45
+#define K_46 46
+#define K_47 47
+#define K_48 48
+#define K_49 49
+#define K_50 50
+#define K_51 51
+#define K_52 52
+#define K_53 53
+#define K_54 54
+#define K_55 55
+#define K_56 56
+#define K_57 57
+#define K_58 58
+#define K_59 59
+#define K_60 60
+#define K_61 61
+#define K_62 62
+#define K_63 63
+#define K_64 64
+#define K_65 65
+#define K_66 66
+#define K_67 67
+#define K_68 68
+#define K_69 69
+#define K_70 70
+#define K_71 71
+#define K_72 72
+#define K_73 73
+#define K_74 74
+#define K_75 75
+#define K_76 76
+#define K_77 77
+#define K_78 78
+#define K_79 79
+#define K_80 80
+#define K_81 81
+#define K_82 82
+#define K_83 83
+#define K_84 84
+#define K_85 85
+#define K_86 86
+#define K_87 87
+#define K_88 88
+#define K_89 89
+#define K_90 90
+#define K_91 91
+#define K_92 92
+#define K_93 93
+#define K_94 94
+#define K_95 95
+#define K_96 96
+#define K_97 97
+#define K_98 98
+#define K_99 99
+#define K_100 100
+#define K_101 101
+#define K_102 102
+#define K_103 103
+#define K_104 104
+#define K_105 105
+#define K_106 106
+#define K_107 107
+#define K_108 108
+#define K_109 109
+#define K_110 110
+#define K_111 111
+#define K_112 112
+#define K_113 113
+#define K_114 114
+#define K_115 115
+#define K_116 116
+#define K_117 117
+#define K_118 118
+#define K_119 119
+#define K_120 120
+#define K_121 121
+#define K_122 122
+#define K_123 123
+#define K_124 124
+#define K_125 125
+#define K_126 126
+#define K_127 127
+#define K_128 128
+#define K_129 129
+#define K_130 130
+#define K_131 131
+#define K_132 132
+#define K_133 133
+#define K_134 134
+#define K_135 135
+#define K_136 136
+#define K_137 137
+#define K_138 138
+#define K_139 139
+#define K_140 140
+#define K_141 141
+#define K_142 142
+#define K_143 143
+#define K_144 144
+#define K_145 145
+#define K_146 146
+#define K_147 147
+#define K_148 148
+#define K_149 149
+#define K_150 150
+#define K_151 151
+#define K_152 152
+#define K_153 153
+#define K_154 154
+#define K_155 155
+#define K_156 156
+#define K_157 157
+#define K_158 158
+#define K_159 159
+#define K_160 160
+#define K_161 161
+#define K_162 162
+#define K_163 163
+#define K_164 164
+#define K_165 165
+#define K_166 166
+#define K_167 167
+#define K_168 168
+#define K_169 169
+#define K_170 170
+#define K_171 171
+#define K_172 172
+#define K_173 173
+#define K_174 174
+#define K_175 175
+#define K_176 176
+#define K_177 177
+#define K_178 178
+#define K_179 179
+#define K_180 180
+#define K_181 181
+#define K_182 182
+#define K_183 183
+#define K_184 184
+#define K_185 185
+#define K_186 186
+#define K_187 187
+#define K_188 188
+#define K_189 189
+#define K_190 190
+#define K_191 191
+#define K_192 192
+#define K_193 193
+#define K_194 194
+#define K_195 195
+#define K_196 196
+#define K_197 197
+#define K_198 198
+#define K_199 199
+#define K_200 200
+#define K_201 201
+#define K_202 202
+#define K_203 203
+#define K_204 204
+#define K_205 205
+#define K_206 206
+#define K_207 207
+#define K_208 208
+#define K_209 209
+#define K_210 210
+#define K_211 211
+#define K_212 212
+#define K_213 213
+#define K_214 214
+#define K_215 215
+#define K_216 216
+#define K_217 217
+#define K_218 218
+#define K_219 219
+#define K_220 220
+#define K_221 221
+#define K_222 222
+#define K_223 223
+#define K_224 224
+#define K_225 225
+#define K_226 226
+#define K_227 227
+#define K_228 228
+#define K_229 229
+#define K_230 230
+#define K_231 231
+#define K_232 232
+#define K_233 233
+#define K_234 234
+#define K_235 235
+#define K_236 236
+#define K_237 237
+#define K_238 238
+#define K_239 239
+#define K_240 240
+#define K_241 241
+#define K_242 242
+#define K_243 243
+#define K_244 244
+#define K_245 245
+#define K_246 246
+#define K_247 247
+#define K_248 248
+#define K_249 249
+#define K_250 250
+#define K_251 251
+#define K_252 252
+#define K_253 253
+#define K_254 254
+#define K_255 255
+#define K_256 256
+#define K_257 257
+#define K_258 258
+#define K_259 259
+#define K_260 260
+#define K_261 261
+#define K_262 262
+#define K_263 263
+#define K_264 264
+#define K_265 265
+#define K_266 266
+#define K_267 267
+#define K_268 268
+#define K_269 269
+#define K_270 270
+#define K_271 271
+#define K_272 272
+#define K_273 273
+#define K_274 274
+#define K_275 275
+#define K_276 276
+#define K_277 277
+#define K_278 278
+#define K_279 279
+#define K_280 280
+#define K_281 281
+#define K_282 282
+#define K_283 283
+#define K_284 284
+#define K_285 285
+#define K_286 286
+#define K_287 287
+#define K_288 288
+#define K_289 289
+#define K_290 290
+#define K_291 291
+#define K_292 292
+#define K_293 293
+#define K_294 294
+#define K_295 295
+#define K_296 296
+#define K_297 297
+#define K_298 298
+#define K_299 299
+#define K_300 300
+#define K_301 301
+#define K_302 302
+#define K_303 303
+#define K_304 304
+#define K_305 305
+#define K_306 306
+#define K_307 307
+#define K_308 308
+#define K_309 309
+#define K_310 310
+#define K_311 311
+#define K_312 312
+#define K_313 313
+#define K_314 314
+#define K_315 315
+#define K_316 316
+#define K_317 317
+#define K_318 318
+#define K_319 319
+#define K_320 320
+#define K_321 321
+#define K_322 322
+#define K_323 323
+#define K_324 324
+#define K_325 325
+#define K_326 326
+#define K_327 327
+#define K_328 328
+#define K_329 329
+#define K_330 330
+#define K_331 331
+#define K_332 332
+#define K_333 333
+#define K_334 334
+#define K_335 335
+#define K_336 336
+#define K_337 337
+#define K_338 338
+#define K_339 339
+#define K_340 340
+#define K_341 341
+#define K_342 342
+#define K_343 343
+#define K_344 344
+#define K_345 345
+#define K_346 346
+#define K_347 347
+#define K_348 348
+#define K_349 349
+#define K_350 350
+#define K_351 351
+#define K_352 352
+#define K_353 353
+#define K_354 354
+#define K_355 355
+#define K_356 356
+#define K_357 357
+#define K_358 358
+#define K_359 359
+#define K_360 360
+#define K_361 361
+#define K_362 362
+#define K_363 363
+#define K_364 364
+#define K_365 365
+#define K_366 366
+#define K_367 367
+#define K_368 368
+#define K_369 369
+#define K_370 370
+#define K_371 371
+#define K_372 372
+#define K_373 373
+#define K_374 374
+#define K_375 375
+#define K_376 376
+#define K_377 377
+#define K_378 378
+#define K_379 379
+#define K_380 380
+#define K_381 381
+#define K_382 382
+#define K_383 383
+#define K_384 384
+#define K_385 385
+#define K_386 386
+#define K_387 387
+#define K_388 388
+#define K_389 389
+#define K_390 390
+#define K_391 391
+#define K_392 392
+#define K_393 393
+#define K_394 394
+#define K_395 395
+#define K_396 396
+#define K_397 397
+#define K_398 398
+#define K_399 399
+#define K_400 400
+#define K_401 401
+#define K_402 402
+#define K_403 403
+#define K_404 404
+#define K_405 405
+#define K_406 406
+#define K_407 407
+#define K_408 408
+#define K_409 409
+#define K_410 410
+#define K_411 411
+#define K_412 412
+#define K_413 413
+#define K_414 414
+#define K_415 415
+#define K_416 416
+#define K_417 417
+#define K_418 418
+#define K_419 419
+#define K_420 420
+#define K_421 421
+#define K_422 422
+#define K_423 423
+#define K_424 424
+#define K_425 425
+#define K_426 426
+#define K_427 427
+#define K_428 428
+#define K_429 429
+#define K_430 430
+#define K_431 431
+#define K_432 432
+#define K_433 433
+#define K_434 434
+#define K_435 435
+#define K_436 436
+#define K_437 437
+#define K_438 438
+#define K_439 439
+#define K_440 440
+#define K_441 441
+#define K_442 442
+#define K_443 443
+#define K_444 444
+#define K_445 445
+#define K_446 446
+#define K_447 447
+#define K_448 448
+#define K_449 449
+#define K_450 450
+#define K_451 451
+#define K_452 452
+#define K_453 453
+#define K_454 454
+#define K_455 455
+#define K_456 456
+#define K_457 457
+#define K_458 458
+#define K_459 459
+#define K_460 460
+#define K_461 461
+#define K_462 462
+#define K_463 463
+#define K_464 464
+#define K_465 465
+#define K_466 466
+#define K_467 467
+#define K_468 468
+#define K_469 469
+#define K_470 470
+#define K_471 471
+#define K_472 472
+#define K_473 473
+#define K_474 474
+#define K_475 475
+#define K_476 476
+#define K_477 477
+#define K_478 478
+#define K_479 479
+#define K_480 480
+#define K_481 481
+#define K_482 482
+#define K_483 483
+#define K_484 484
+#define K_485 485
+#define K_486 486
+#define K_487 487
+#define K_488 488
+#define K_489 489
+#define K_490 490
+#define K_491 491
+#define K_492 492
+#define K_493 493
+#define K_494 494
+#define K_495 495
+#define K_496 496
+#define K_497 497
+#define K_498 498
+#define K_499 499
+#define K_500 500
+#define K_501 501
+#define K_502 502
+#define K_503 503
+#define K_504 504
+#define K_505 505
+#define K_506 506
+#define K_507 507
+#define K_508 508
+#define K_509 509
+#define K_510 510
+#define K_511 511
+#define K_512 512
+#define K_513 513
+#define K_514 514
+#define K_515 515
+#define K_516 516
+#define K_517 517
+#define K_518 518
+#define K_519 519
+#define K_520 520
+#define K_521 521
+#define K_522 522
+#define K_523 523
+#define K_524 524
+#define K_525 525
+#define K_526 526
+#define K_527 527
+#define K_528 528
+#define K_529 529
+#define K_530 530
+#define K_531 531
+#define K_532 532
+#define K_533 533
+#define K_534 534
+#define K_535 535
+#define K_536 536
+#define K_537 537
+#define K_538 538
+#define K_539 539
+#define K_540 540
+#define K_541 541
+#define K_542 542
+#define K_543 543
+#define K_544 544
+#define K_545 545
+#define K_546 546
+#define K_547 547
+#define K_548 548
+#define K_549 549
+#define K_550 550
+#define K_551 551
+#define K_552 552
+#define K_553 553
+#define K_554 554
+#define K_555 555
+#define K_556 556
+#define K_557 557
+#define K_558 558
+#define K_559 559
+#define K_560 560
+#define K_561 561
+#define K_562 562
+#define K_563 563
+#define K_564 564
+#define K_565 565
+#define K_566 566
+#define K_567 567
+#define K_568 568
+#define K_569 569
+#define K_570 570
+#define K_571 571
+#define K_572 572
+#define K_573 573
+#define K_574 574
+#define K_575 575
+#define K_576 576
+#define K_577 577
+#define K_578 578
+#define K_579 579
+#define K_580 580
+#define K_581 581
+#define K_582 582
+#define K_583 583
+#define K_584 584
+#define K_585 585
+#define K_586 586
+#define K_587 587
+#define K_588 588
+#define K_589 589
+#define K_590 590
+#define K_591 591
+#define K_592 592
+#define K_593 593
+#define K_594 594
+#define K_595 595
+#define K_596 596
+#define K_597 597
+#define K_598 598
+#define K_599 599
+#define K_600 600
+#define K_601 601
+#define K_602 602
+#define K_603 603
+#define K_604 604
+#define K_605 605
+#define K_606 606
+#define K_607 607
+#define K_608 608
+#define K_609 609
+#define K_610 610
+#define K_611 611
+#define K_612 612
+#define K_613 613
+#define K_614 614
+#define K_615 615
+#define K_616 616
+#define K_617 617
+#define K_618 618
+#define K_619 619
+#define K_620 620
+#define K_621 621
+#define K_622 622
+#define K_623 623
+#define K_624 624
+#define K_625 625
+#define K_626 626
+#define K_627 627
+#define K_628 628
+#define K_629 629
+#define K_630 630
+#define K_631 631
+#define K_632 632
+#define K_633 633
+#define K_634 634
+#define K_635 635
+#define K_636 636
+#define K_637 637
+#define K_638 638
+#define K_639 639
+#define K_640 640
+#define K_641 641
+#define K_642 642
+#define K_643 643
+#define K_644 644
+#define K_645 645
+#define K_646 646
+#define K_647 647
+#define K_648 648
+#define K_649 649
+#define K_650 650
+#define K_651 651
+#define K_652 652
+#define K_653 653
+#define K_654 654
+#define K_655 655
+#define K_656 656
+#define K_657 657
+#define K_658 658
+#define K_659 659
+#define K_660 660
+#define K_661 661
+#define K_662 662
+#define K_663 663
+#define K_664 664
+#define K_665 665
+#define K_666 666
+#define K_667 667
+#define K_668 668
+#define K_669 669
+#define K_670 670
+#define K_671 671
+#define K_672 672
+#define K_673 673
+#define K_674 674
+#define K_675 675
+#define K_676 676
+#define K_677 677
+#define K_678 678
+#define K_679 679
+#define K_680 680
+#define K_681 681
+#define K_682 682
+#define K_683 683
+#define K_684 684
+#define K_685 685
+#define K_686 686
+#define K_687 687
+#define K_688 688
+#define K_689 689
+#define K_690 690
+#define K_691 691
+#define K_692 692
+#define K_693 693
+#define K_694 694
+#define K_695 695
+#define K_696 696
+#define K_697 697
+#define K_698 698
+#define K_699 699
+#define K_700 700
+#define K_701 701
+#define K_702 702
+#define K_703 703
+#define K_704 704
+#define K_705 705
+#define K_706 706
+#define K_707 707
+#define K_708 708
+#define K_709 709
+#define K_710 710
+#define K_711 711
+#define K_712 712
+#define K_713 713
+#define K_714 714
+#define K_715 715
+#define K_716 716
+#define K_717 717
+#define K_718 718
+#define K_719 719
+#define K_720 720
+#define K_721 721
+#define K_722 722
+#define K_723 723
+#define K_724 724
+#define K_725 725
+#define K_726 726
+#define K_727 727
+#define K_728 728
+#define K_729 729
+#define K_730 730
+#define K_731 731
+#define K_732 732
+#define K_733 733
+#define K_734 734
+#define K_735 735
+#define K_736 736
+#define K_737 737
+#define K_738 738
+#define K_739 739
+#define K_740 740
+#define K_741 741
+#define K_742 742
+#define K_743 743
+#define K_744 744
+#define K_745 745
+#define K_746 746
+#define K_747 747
+#define K_748 748
+#define K_749 749
+#define K_750 750
+#define K_751 751
+#define K_752 752
+#define K_753 753
+#define K_754 754
+#define K_755 755
+#define K_756 756
+#define K_757 757
+#define K_758 758
+#define K_759 759
+#define K_760 760
+#define K_761 761
+#define K_762 762
+#define K_763 763
+#define K_764 764
+#define K_765 765
+#define K_766 766
+#define K_767 767
+#define K_768 768
+#define K_769 769
+#define K_770 770
+#define K_771 771
+#define K_772 772
+#define K_773 773
+#define K_774 774
+#define K_775 775
+#define K_776 776
+#define K_777 777
+#define K_778 778
+#define K_779 779
+#define K_780 780
+#define K_781 781
+#define K_782 782
+#define K_783 783
+#define K_784 784
+#define K_785 785
+#define K_786 786
+#define K_787 787
+#define K_788 788
+#define K_789 789
+#define K_790 790
+#define K_791 791
+#define K_792 792
+#define K_793 793
+#define K_794 794
+#define K_795 795
+#define K_796 796
+#define K_797 797
+#define K_798 798
+#define K_799 799
+#define K_800 800
+#define K_801 801
+#define K_802 802
+#define K_803 803
+#define K_804 804
+#define K_805 805
+#define K_806 806
+#define K_807 807
+#define K_808 808
+#define K_809 809
+#define K_810 810
+#define K_811 811
+#define K_812 812
+#define K_813 813
+#define K_814 814
+#define K_815 815
+#define K_816 816
+#define K_817 817
+#define K_818 818
+#define K_819 819
+#define K_820 820
+#define K_821 821
+#define K_822 822
+#define K_823 823
+#define K_824 824
+#define K_825 825
+#define K_826 826
+#define K_827 827
+#define K_828 828
+#define K_829 829
+#define K_830 830
+#define K_831 831
+#define K_832 832
+#define K_833 833
+#define K_834 834
+#define K_835 835
+#define K_836 836
+#define K_837 837
+#define K_838 838
+#define K_839 839
+#define K_840 840
+#define K_841 841
+#define K_842 842
+#define K_843 843
+#define K_844 844
+#define K_845 845
+#define K_846 846
+#define K_847 847
+#define K_848 848
+#define K_849 849
+#define K_850 850
+#define K_851 851
+#define K_852 852
+#define K_853 853
+#define K_854 854
+#define K_855 855
+#define K_856 856
+#define K_857 857
+#define K_858 858
+#define K_859 859
+#define K_860 860
+#define K_861 861
+#define K_862 862
+#define K_863 863
+#define K_864 864
+#define K_865 865
+#define K_866 866
+#define K_867 867
+#define K_868 868
+#define K_869 869
+#define K_870 870
+#define K_871 871
+#define K_872 872
+#define K_873 873
+#define K_874 874
+#define K_875 875
+#define K_876 876
+#define K_877 877
+#define K_878 878
+#define K_879 879
+#define K_880 880
+#define K_881 881
+#define K_882 882
+#define K_883 883
+#define K_884 884
+#define K_885 885
+#define K_886 886
+#define K_887 887
+#define K_888 888
+#define K_889 889
+#define K_890 890
+#define K_891 891
+#define K_892 892
+#define K_893 893
+#define K_894 894
+#define K_895 895
+#define K_896 896
+#define K_897 897
+#define K_898 898
+#define K_899 899
+#define K_900 900
+#define K_901 901
+#define K_902 902
+#define K_903 903
+#define K_904 904
+#define K_905 905
+#define K_906 906
+#define K_907 907
+#define K_908 908
+#define K_909 909
+#define K_910 910
+#define K_911 911
+#define K_912 912
+#define K_913 913
+#define K_914 914
+#define K_915 915
+#define K_916 916
+#define K_917 917
+#define K_918 918
+#define K_919 919
+#define K_920 920
+#define K_921 921
+#define K_922 922
+#define K_923 923
+#define K_924 924
+#define K_925 925
+#define K_926 926
+#define K_927 927
+#define K_928 928
+#define K_929 929
+#define K_930 930
+#define K_931 931
+#define K_932 932
+#define K_933 933
+#define K_934 934
+#define K_935 935
+#define K_936 936
+#define K_937 937
+#define K_938 938
+#define K_939 939
+#define K_940 940
+#define K_941 941
+#define K_942 942
+#define K_943 943
+#define K_944 944
+#define K_945 945
+#define K_946 946
+#define K_947 947
+#define K_948 948
+#define K_949 949
+#define K_950 950
+#define K_951 951
+#define K_952 952
+#define K_953 953
+#define K_954 954
+#define K_955 955
+#define K_956 956
+#define K_957 957
+#define K_958 958
+#define K_959 959
+#define K_960 960
+#define K_961 961
+#define K_962 962
+#define K_963 963
+#define K_964 964
+#define K_965 965
+#define K_966 966
+#define K_967 967
+#define K_968 968
+#define K_969 969
+#define K_970 970
+#define K_971 971
+#define K_972 972
+#define K_973 973
+#define K_974 974
+#define K_975 975
+#define K_976 976
+#define K_977 977
+#define K_978 978
+#define K_979 979
+#define K_980 980
+#define K_981 981
+#define K_982 982
+#define K_983 983
+#define K_984 984
+#define K_985 985
+#define K_986 986
+#define K_987 987
+#define K_988 988
+#define K_989 989
+#define K_990 990
+#define K_991 991
+#define K_992 992
+#define K_993 993
+#define K_994 994
+#define K_995 995
+#define K_996 996
+#define K_997 997
+#define K_998 998
+#define K_999 999
+#define MIX(x, y) ((x) ^ ((y) << 1))
+#define ADD(x, y) ((x) + (y))
+#define SCALE3(x) ((x) * 3)
+#define MIN(x, y) ((x) > (y) ? (y) : (x))
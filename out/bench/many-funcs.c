@@ -0,0 +1,14001 @@
+int f0(int a, int b)
+{
+    return a + b;
+}
+int f1(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1)
+        return f0(c - b, a);
+    return c + 1;
+}
+int f2(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 2)
+        return f1(c - b, a);
+    return c + 2;
+}
+int f3(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 3)
+        return f2(c - b, a);
+    return c + 3;
+}
+int f4(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 4)
+        return f3(c - b, a);
+    return c + 4;
+}
+int f5(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 5)
+        return f4(c - b, a);
+    return c + 5;
+}
+int f6(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 6)
+        return f5(c - b, a);
+    return c + 6;
+}
+int f7(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 7)
+        return f6(c - b, a);
+    return c + 7;
+}
+int f8(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 8)
+        return f7(c - b, a);
+    return c + 8;
+}
+int f9(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 9)
+        return f8(c - b, a);
+    return c + 9;
+}
+int f10(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 10)
+        return f9(c - b, a);
+    return c + 10;
+}
+int f11(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 11)
+        return f10(c - b, a);
+    return c + 11;
+}
+int f12(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 12)
+        return f11(c - b, a);
+    return c + 12;
+}
+int f13(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 13)
+        return f12(c - b, a);
+    return c + 13;
+}
+int f14(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 14)
+        return f13(c - b, a);
+    return c + 14;
+}
+int f15(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 15)
+        return f14(c - b, a);
+    return c + 15;
+}
+int f16(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 16)
+        return f15(c - b, a);
+    return c + 16;
+}
+int f17(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 17)
+        return f16(c - b, a);
+    return c + 17;
+}
+int f18(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 18)
+        return f17(c - b, a);
+    return c + 18;
+}
+int f19(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 19)
+        return f18(c - b, a);
+    return c + 19;
+}
+int f20(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 20)
+        return f19(c - b, a);
+    return c + 20;
+}
+int f21(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 21)
+        return f20(c - b, a);
+    return c + 21;
+}
+int f22(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 22)
+        return f21(c - b, a);
+    return c + 22;
+}
+int f23(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 23)
+        return f22(c - b, a);
+    return c + 23;
+}
+int f24(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 24)
+        return f23(c - b, a);
+    return c + 24;
+}
+int f25(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 25)
+        return f24(c - b, a);
+    return c + 25;
+}
+int f26(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 26)
+        return f25(c - b, a);
+    return c + 26;
+}
+int f27(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 27)
+        return f26(c - b, a);
+    return c + 27;
+}
+int f28(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 28)
+        return f27(c - b, a);
+    return c + 28;
+}
+int f29(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 29)
+        return f28(c - b, a);
+    return c + 29;
+}
+int f30(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 30)
+        return f29(c - b, a);
+    return c + 30;
+}
+int f31(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 31)
+        return f30(c - b, a);
+    return c + 31;
+}
+int f32(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 32)
+        return f31(c - b, a);
+    return c + 32;
+}
+int f33(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 33)
+        return f32(c - b, a);
+    return c + 33;
+}
+int f34(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 34)
+        return f33(c - b, a);
+    return c + 34;
+}
+int f35(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 35)
+        return f34(c - b, a);
+    return c + 35;
+}
+int f36(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 36)
+        return f35(c - b, a);
+    return c + 36;
+}
+int f37(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 37)
+        return f36(c - b, a);
+    return c + 37;
+}
+int f38(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 38)
+        return f37(c - b, a);
+    return c + 38;
+}
+int f39(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 39)
+        return f38(c - b, a);
+    return c + 39;
+}
+int f40(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 40)
+        return f39(c - b, a);
+    return c + 40;
+}
+int f41(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 41)
+        return f40(c - b, a);
+    return c + 41;
+}
+int f42(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 42)
+        return f41(c - b, a);
+    return c + 42;
+}
+int f43(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 43)
+        return f42(c - b, a);
+    return c + 43;
+}
+int f44(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 44)
+        return f43(c - b, a);
+    return c + 44;
+}
+int f45(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 45)
+        return f44(c - b, a);
+    return c + 45;
+}
+int f46(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 46)
+        return f45(c - b, a);
+    return c + 46;
+}
+int f47(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 47)
+        return f46(c - b, a);
+    return c + 47;
+}
+int f48(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 48)
+        return f47(c - b, a);
+    return c + 48;
+}
+int f49(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 49)
+        return f48(c - b, a);
+    return c + 49;
+}
+int f50(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 50)
+        return f49(c - b, a);
+    return c + 50;
+}
+int f51(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 51)
+        return f50(c - b, a);
+    return c + 51;
+}
+int f52(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 52)
+        return f51(c - b, a);
+    return c + 52;
+}
+int f53(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 53)
+        return f52(c - b, a);
+    return c + 53;
+}
+int f54(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 54)
+        return f53(c - b, a);
+    return c + 54;
+}
+int f55(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 55)
+        return f54(c - b, a);
+    return c + 55;
+}
+int f56(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 56)
+        return f55(c - b, a);
+    return c + 56;
+}
+int f57(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 57)
+        return f56(c - b, a);
+    return c + 57;
+}
+int f58(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 58)
+        return f57(c - b, a);
+    return c + 58;
+}
+int f59(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 59)
+        return f58(c - b, a);
+    return c + 59;
+}
+int f60(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 60)
+        return f59(c - b, a);
+    return c + 60;
+}
+int f61(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 61)
+        return f60(c - b, a);
+    return c + 61;
+}
+int f62(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 62)
+        return f61(c - b, a);
+    return c + 62;
+}
+int f63(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 63)
+        return f62(c - b, a);
+    return c + 63;
+}
+int f64(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 64)
+        return f63(c - b, a);
+    return c + 64;
+}
+int f65(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 65)
+        return f64(c - b, a);
+    return c + 65;
+}
+int f66(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 66)
+        return f65(c - b, a);
+    return c + 66;
+}
+int f67(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 67)
+        return f66(c - b, a);
+    return c + 67;
+}
+int f68(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 68)
+        return f67(c - b, a);
+    return c + 68;
+}
+int f69(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 69)
+        return f68(c - b, a);
+    return c + 69;
+}
+int f70(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 70)
+        return f69(c - b, a);
+    return c + 70;
+}
+int f71(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 71)
+        return f70(c - b, a);
+    return c + 71;
+}
+int f72(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 72)
+        return f71(c - b, a);
+    return c + 72;
+}
+int f73(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 73)
+        return f72(c - b, a);
+    return c + 73;
+}
+int f74(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 74)
+        return f73(c - b, a);
+    return c + 74;
+}
+int f75(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 75)
+        return f74(c - b, a);
+    return c + 75;
+}
+int f76(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 76)
+        return f75(c - b, a);
+    return c + 76;
+}
+int f77(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 77)
+        return f76(c - b, a);
+    return c + 77;
+}
+int f78(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 78)
+        return f77(c - b, a);
+    return c + 78;
+}
+int f79(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 79)
+        return f78(c - b, a);
+    return c + 79;
+}
+int f80(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 80)
+        return f79(c - b, a);
+    return c + 80;
+}
+int f81(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 81)
+        return f80(c - b, a);
+    return c + 81;
+}
+int f82(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 82)
+        return f81(c - b, a);
+    return c + 82;
+}
+int f83(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 83)
+        return f82(c - b, a);
+    return c + 83;
+}
+int f84(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 84)
+        return f83(c - b, a);
+    return c + 84;
+}
+int f85(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 85)
+        return f84(c - b, a);
+    return c + 85;
+}
+int f86(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 86)
+        return f85(c - b, a);
+    return c + 86;
+}
+int f87(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 87)
+        return f86(c - b, a);
+    return c + 87;
+}
+int f88(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 88)
+        return f87(c - b, a);
+    return c + 88;
+}
+int f89(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 89)
+        return f88(c - b, a);
+    return c + 89;
+}
+int f90(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 90)
+        return f89(c - b, a);
+    return c + 90;
+}
+int f91(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 91)
+        return f90(c - b, a);
+    return c + 91;
+}
+int f92(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 92)
+        return f91(c - b, a);
+    return c + 92;
+}
+int f93(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 93)
+        return f92(c - b, a);
+    return c + 93;
+}
+int f94(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 94)
+        return f93(c - b, a);
+    return c + 94;
+}
+int f95(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 95)
+        return f94(c - b, a);
+    return c + 95;
+}
+int f96(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 96)
+        return f95(c - b, a);
+    return c + 96;
+}
+int f97(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 97)
+        return f96(c - b, a);
+    return c + 97;
+}
+int f98(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 98)
+        return f97(c - b, a);
+    return c + 98;
+}
+int f99(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 99)
+        return f98(c - b, a);
+    return c + 99;
+}
+int f100(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 100)
+        return f99(c - b, a);
+    return c + 100;
+}
+int f101(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 101)
+        return f100(c - b, a);
+    return c + 101;
+}
+int f102(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 102)
+        return f101(c - b, a);
+    return c + 102;
+}
+int f103(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 103)
+        return f102(c - b, a);
+    return c + 103;
+}
+int f104(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 104)
+        return f103(c - b, a);
+    return c + 104;
+}
+int f105(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 105)
+        return f104(c - b, a);
+    return c + 105;
+}
+int f106(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 106)
+        return f105(c - b, a);
+    return c + 106;
+}
+int f107(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 107)
+        return f106(c - b, a);
+    return c + 107;
+}
+int f108(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 108)
+        return f107(c - b, a);
+    return c + 108;
+}
+int f109(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 109)
+        return f108(c - b, a);
+    return c + 109;
+}
+int f110(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 110)
+        return f109(c - b, a);
+    return c + 110;
+}
+int f111(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 111)
+        return f110(c - b, a);
+    return c + 111;
+}
+int f112(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 112)
+        return f111(c - b, a);
+    return c + 112;
+}
+int f113(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 113)
+        return f112(c - b, a);
+    return c + 113;
+}
+int f114(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 114)
+        return f113(c - b, a);
+    return c + 114;
+}
+int f115(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 115)
+        return f114(c - b, a);
+    return c + 115;
+}
+int f116(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 116)
+        return f115(c - b, a);
+    return c + 116;
+}
+int f117(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 117)
+        return f116(c - b, a);
+    return c + 117;
+}
+int f118(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 118)
+        return f117(c - b, a);
+    return c + 118;
+}
+int f119(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 119)
+        return f118(c - b, a);
+    return c + 119;
+}
+int f120(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 120)
+        return f119(c - b, a);
+    return c + 120;
+}
+int f121(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 121)
+        return f120(c - b, a);
+    return c + 121;
+}
+int f122(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 122)
+        return f121(c - b, a);
+    return c + 122;
+}
+int f123(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 123)
+        return f122(c - b, a);
+    return c + 123;
+}
+int f124(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 124)
+        return f123(c - b, a);
+    return c + 124;
+}
+int f125(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 125)
+        return f124(c - b, a);
+    return c + 125;
+}
+int f126(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 126)
+        return f125(c - b, a);
+    return c + 126;
+}
+int f127(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 127)
+        return f126(c - b, a);
+    return c + 127;
+}
+int f128(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 128)
+        return f127(c - b, a);
+    return c + 128;
+}
+int f129(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 129)
+        return f128(c - b, a);
+    return c + 129;
+}
+int f130(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 130)
+        return f129(c - b, a);
+    return c + 130;
+}
+int f131(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 131)
+        return f130(c - b, a);
+    return c + 131;
+}
+int f132(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 132)
+        return f131(c - b, a);
+    return c + 132;
+}
+int f133(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 133)
+        return f132(c - b, a);
+    return c + 133;
+}
+int f134(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 134)
+        return f133(c - b, a);
+    return c + 134;
+}
+int f135(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 135)
+        return f134(c - b, a);
+    return c + 135;
+}
+int f136(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 136)
+        return f135(c - b, a);
+    return c + 136;
+}
+int f137(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 137)
+        return f136(c - b, a);
+    return c + 137;
+}
+int f138(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 138)
+        return f137(c - b, a);
+    return c + 138;
+}
+int f139(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 139)
+        return f138(c - b, a);
+    return c + 139;
+}
+int f140(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 140)
+        return f139(c - b, a);
+    return c + 140;
+}
+int f141(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 141)
+        return f140(c - b, a);
+    return c + 141;
+}
+int f142(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 142)
+        return f141(c - b, a);
+    return c + 142;
+}
+int f143(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 143)
+        return f142(c - b, a);
+    return c + 143;
+}
+int f144(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 144)
+        return f143(c - b, a);
+    return c + 144;
+}
+int f145(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 145)
+        return f144(c - b, a);
+    return c + 145;
+}
+int f146(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 146)
+        return f145(c - b, a);
+    return c + 146;
+}
+int f147(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 147)
+        return f146(c - b, a);
+    return c + 147;
+}
+int f148(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 148)
+        return f147(c - b, a);
+    return c + 148;
+}
+int f149(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 149)
+        return f148(c - b, a);
+    return c + 149;
+}
+int f150(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 150)
+        return f149(c - b, a);
+    return c + 150;
+}
+int f151(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 151)
+        return f150(c - b, a);
+    return c + 151;
+}
+int f152(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 152)
+        return f151(c - b, a);
+    return c + 152;
+}
+int f153(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 153)
+        return f152(c - b, a);
+    return c + 153;
+}
+int f154(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 154)
+        return f153(c - b, a);
+    return c + 154;
+}
+int f155(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 155)
+        return f154(c - b, a);
+    return c + 155;
+}
+int f156(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 156)
+        return f155(c - b, a);
+    return c + 156;
+}
+int f157(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 157)
+        return f156(c - b, a);
+    return c + 157;
+}
+int f158(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 158)
+        return f157(c - b, a);
+    return c + 158;
+}
+int f159(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 159)
+        return f158(c - b, a);
+    return c + 159;
+}
+int f160(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 160)
+        return f159(c - b, a);
+    return c + 160;
+}
+int f161(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 161)
+        return f160(c - b, a);
+    return c + 161;
+}
+int f162(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 162)
+        return f161(c - b, a);
+    return c + 162;
+}
+int f163(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 163)
+        return f162(c - b, a);
+    return c + 163;
+}
+int f164(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 164)
+        return f163(c - b, a);
+    return c + 164;
+}
+int f165(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 165)
+        return f164(c - b, a);
+    return c + 165;
+}
+int f166(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 166)
+        return f165(c - b, a);
+    return c + 166;
+}
+int f167(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 167)
+        return f166(c - b, a);
+    return c + 167;
+}
+int f168(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 168)
+        return f167(c - b, a);
+    return c + 168;
+}
+int f169(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 169)
+        return f168(c - b, a);
+    return c + 169;
+}
+int f170(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 170)
+        return f169(c - b, a);
+    return c + 170;
+}
+int f171(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 171)
+        return f170(c - b, a);
+    return c + 171;
+}
+int f172(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 172)
+        return f171(c - b, a);
+    return c + 172;
+}
+int f173(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 173)
+        return f172(c - b, a);
+    return c + 173;
+}
+int f174(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 174)
+        return f173(c - b, a);
+    return c + 174;
+}
+int f175(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 175)
+        return f174(c - b, a);
+    return c + 175;
+}
+int f176(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 176)
+        return f175(c - b, a);
+    return c + 176;
+}
+int f177(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 177)
+        return f176(c - b, a);
+    return c + 177;
+}
+int f178(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 178)
+        return f177(c - b, a);
+    return c + 178;
+}
+int f179(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 179)
+        return f178(c - b, a);
+    return c + 179;
+}
+int f180(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 180)
+        return f179(c - b, a);
+    return c + 180;
+}
+int f181(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 181)
+        return f180(c - b, a);
+    return c + 181;
+}
+int f182(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 182)
+        return f181(c - b, a);
+    return c + 182;
+}
+int f183(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 183)
+        return f182(c - b, a);
+    return c + 183;
+}
+int f184(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 184)
+        return f183(c - b, a);
+    return c + 184;
+}
+int f185(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 185)
+        return f184(c - b, a);
+    return c + 185;
+}
+int f186(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 186)
+        return f185(c - b, a);
+    return c + 186;
+}
+int f187(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 187)
+        return f186(c - b, a);
+    return c + 187;
+}
+int f188(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 188)
+        return f187(c - b, a);
+    return c + 188;
+}
+int f189(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 189)
+        return f188(c - b, a);
+    return c + 189;
+}
+int f190(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 190)
+        return f189(c - b, a);
+    return c + 190;
+}
+int f191(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 191)
+        return f190(c - b, a);
+    return c + 191;
+}
+int f192(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 192)
+        return f191(c - b, a);
+    return c + 192;
+}
+int f193(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 193)
+        return f192(c - b, a);
+    return c + 193;
+}
+int f194(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 194)
+        return f193(c - b, a);
+    return c + 194;
+}
+int f195(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 195)
+        return f194(c - b, a);
+    return c + 195;
+}
+int f196(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 196)
+        return f195(c - b, a);
+    return c + 196;
+}
+int f197(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 197)
+        return f196(c - b, a);
+    return c + 197;
+}
+int f198(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 198)
+        return f197(c - b, a);
+    return c + 198;
+}
+int f199(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 199)
+        return f198(c - b, a);
+    return c + 199;
+}
+int f200(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 200)
+        return f199(c - b, a);
+    return c + 200;
+}
+int f201(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 201)
+        return f200(c - b, a);
+    return c + 201;
+}
+int f202(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 202)
+        return f201(c - b, a);
+    return c + 202;
+}
+int f203(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 203)
+        return f202(c - b, a);
+    return c + 203;
+}
+int f204(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 204)
+        return f203(c - b, a);
+    return c + 204;
+}
+int f205(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 205)
+        return f204(c - b, a);
+    return c + 205;
+}
+int f206(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 206)
+        return f205(c - b, a);
+    return c + 206;
+}
+int f207(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 207)
+        return f206(c - b, a);
+    return c + 207;
+}
+int f208(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 208)
+        return f207(c - b, a);
+    return c + 208;
+}
+int f209(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 209)
+        return f208(c - b, a);
+    return c + 209;
+}
+int f210(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 210)
+        return f209(c - b, a);
+    return c + 210;
+}
+int f211(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 211)
+        return f210(c - b, a);
+    return c + 211;
+}
+int f212(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 212)
+        return f211(c - b, a);
+    return c + 212;
+}
+int f213(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 213)
+        return f212(c - b, a);
+    return c + 213;
+}
+int f214(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 214)
+        return f213(c - b, a);
+    return c + 214;
+}
+int f215(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 215)
+        return f214(c - b, a);
+    return c + 215;
+}
+int f216(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 216)
+        return f215(c - b, a);
+    return c + 216;
+}
+int f217(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 217)
+        return f216(c - b, a);
+    return c + 217;
+}
+int f218(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 218)
+        return f217(c - b, a);
+    return c + 218;
+}
+int f219(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 219)
+        return f218(c - b, a);
+    return c + 219;
+}
+int f220(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 220)
+        return f219(c - b, a);
+    return c + 220;
+}
+int f221(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 221)
+        return f220(c - b, a);
+    return c + 221;
+}
+int f222(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 222)
+        return f221(c - b, a);
+    return c + 222;
+}
+int f223(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 223)
+        return f222(c - b, a);
+    return c + 223;
+}
+int f224(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 224)
+        return f223(c - b, a);
+    return c + 224;
+}
+int f225(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 225)
+        return f224(c - b, a);
+    return c + 225;
+}
+int f226(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 226)
+        return f225(c - b, a);
+    return c + 226;
+}
+int f227(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 227)
+        return f226(c - b, a);
+    return c + 227;
+}
+int f228(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 228)
+        return f227(c - b, a);
+    return c + 228;
+}
+int f229(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 229)
+        return f228(c - b, a);
+    return c + 229;
+}
+int f230(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 230)
+        return f229(c - b, a);
+    return c + 230;
+}
+int f231(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 231)
+        return f230(c - b, a);
+    return c + 231;
+}
+int f232(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 232)
+        return f231(c - b, a);
+    return c + 232;
+}
+int f233(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 233)
+        return f232(c - b, a);
+    return c + 233;
+}
+int f234(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 234)
+        return f233(c - b, a);
+    return c + 234;
+}
+int f235(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 235)
+        return f234(c - b, a);
+    return c + 235;
+}
+int f236(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 236)
+        return f235(c - b, a);
+    return c + 236;
+}
+int f237(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 237)
+        return f236(c - b, a);
+    return c + 237;
+}
+int f238(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 238)
+        return f237(c - b, a);
+    return c + 238;
+}
+int f239(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 239)
+        return f238(c - b, a);
+    return c + 239;
+}
+int f240(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 240)
+        return f239(c - b, a);
+    return c + 240;
+}
+int f241(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 241)
+        return f240(c - b, a);
+    return c + 241;
+}
+int f242(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 242)
+        return f241(c - b, a);
+    return c + 242;
+}
+int f243(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 243)
+        return f242(c - b, a);
+    return c + 243;
+}
+int f244(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 244)
+        return f243(c - b, a);
+    return c + 244;
+}
+int f245(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 245)
+        return f244(c - b, a);
+    return c + 245;
+}
+int f246(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 246)
+        return f245(c - b, a);
+    return c + 246;
+}
+int f247(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 247)
+        return f246(c - b, a);
+    return c + 247;
+}
+int f248(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 248)
+        return f247(c - b, a);
+    return c + 248;
+}
+int f249(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 249)
+        return f248(c - b, a);
+    return c + 249;
+}
+int f250(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 250)
+        return f249(c - b, a);
+    return c + 250;
+}
+int f251(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 251)
+        return f250(c - b, a);
+    return c + 251;
+}
+int f252(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 252)
+        return f251(c - b, a);
+    return c + 252;
+}
+int f253(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 253)
+        return f252(c - b, a);
+    return c + 253;
+}
+int f254(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 254)
+        return f253(c - b, a);
+    return c + 254;
+}
+int f255(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 255)
+        return f254(c - b, a);
+    return c + 255;
+}
+int f256(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 256)
+        return f255(c - b, a);
+    return c + 256;
+}
+int f257(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 257)
+        return f256(c - b, a);
+    return c + 257;
+}
+int f258(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 258)
+        return f257(c - b, a);
+    return c + 258;
+}
+int f259(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 259)
+        return f258(c - b, a);
+    return c + 259;
+}
+int f260(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 260)
+        return f259(c - b, a);
+    return c + 260;
+}
+int f261(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 261)
+        return f260(c - b, a);
+    return c + 261;
+}
+int f262(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 262)
+        return f261(c - b, a);
+    return c + 262;
+}
+int f263(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 263)
+        return f262(c - b, a);
+    return c + 263;
+}
+int f264(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 264)
+        return f263(c - b, a);
+    return c + 264;
+}
+int f265(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 265)
+        return f264(c - b, a);
+    return c + 265;
+}
+int f266(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 266)
+        return f265(c - b, a);
+    return c + 266;
+}
+int f267(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 267)
+        return f266(c - b, a);
+    return c + 267;
+}
+int f268(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 268)
+        return f267(c - b, a);
+    return c + 268;
+}
+int f269(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 269)
+        return f268(c - b, a);
+    return c + 269;
+}
+int f270(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 270)
+        return f269(c - b, a);
+    return c + 270;
+}
+int f271(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 271)
+        return f270(c - b, a);
+    return c + 271;
+}
+int f272(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 272)
+        return f271(c - b, a);
+    return c + 272;
+}
+int f273(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 273)
+        return f272(c - b, a);
+    return c + 273;
+}
+int f274(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 274)
+        return f273(c - b, a);
+    return c + 274;
+}
+int f275(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 275)
+        return f274(c - b, a);
+    return c + 275;
+}
+int f276(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 276)
+        return f275(c - b, a);
+    return c + 276;
+}
+int f277(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 277)
+        return f276(c - b, a);
+    return c + 277;
+}
+int f278(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 278)
+        return f277(c - b, a);
+    return c + 278;
+}
+int f279(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 279)
+        return f278(c - b, a);
+    return c + 279;
+}
+int f280(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 280)
+        return f279(c - b, a);
+    return c + 280;
+}
+int f281(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 281)
+        return f280(c - b, a);
+    return c + 281;
+}
+int f282(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 282)
+        return f281(c - b, a);
+    return c + 282;
+}
+int f283(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 283)
+        return f282(c - b, a);
+    return c + 283;
+}
+int f284(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 284)
+        return f283(c - b, a);
+    return c + 284;
+}
+int f285(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 285)
+        return f284(c - b, a);
+    return c + 285;
+}
+int f286(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 286)
+        return f285(c - b, a);
+    return c + 286;
+}
+int f287(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 287)
+        return f286(c - b, a);
+    return c + 287;
+}
+int f288(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 288)
+        return f287(c - b, a);
+    return c + 288;
+}
+int f289(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 289)
+        return f288(c - b, a);
+    return c + 289;
+}
+int f290(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 290)
+        return f289(c - b, a);
+    return c + 290;
+}
+int f291(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 291)
+        return f290(c - b, a);
+    return c + 291;
+}
+int f292(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 292)
+        return f291(c - b, a);
+    return c + 292;
+}
+int f293(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 293)
+        return f292(c - b, a);
+    return c + 293;
+}
+int f294(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 294)
+        return f293(c - b, a);
+    return c + 294;
+}
+int f295(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 295)
+        return f294(c - b, a);
+    return c + 295;
+}
+int f296(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 296)
+        return f295(c - b, a);
+    return c + 296;
+}
+int f297(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 297)
+        return f296(c - b, a);
+    return c + 297;
+}
+int f298(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 298)
+        return f297(c - b, a);
+    return c + 298;
+}
+int f299(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 299)
+        return f298(c - b, a);
+    return c + 299;
+}
+int f300(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 300)
+        return f299(c - b, a);
+    return c + 300;
+}
+int f301(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 301)
+        return f300(c - b, a);
+    return c + 301;
+}
+int f302(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 302)
+        return f301(c - b, a);
+    return c + 302;
+}
+int f303(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 303)
+        return f302(c - b, a);
+    return c + 303;
+}
+int f304(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 304)
+        return f303(c - b, a);
+    return c + 304;
+}
+int f305(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 305)
+        return f304(c - b, a);
+    return c + 305;
+}
+int f306(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 306)
+        return f305(c - b, a);
+    return c + 306;
+}
+int f307(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 307)
+        return f306(c - b, a);
+    return c + 307;
+}
+int f308(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 308)
+        return f307(c - b, a);
+    return c + 308;
+}
+int f309(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 309)
+        return f308(c - b, a);
+    return c + 309;
+}
+int f310(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 310)
+        return f309(c - b, a);
+    return c + 310;
+}
+int f311(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 311)
+        return f310(c - b, a);
+    return c + 311;
+}
+int f312(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 312)
+        return f311(c - b, a);
+    return c + 312;
+}
+int f313(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 313)
+        return f312(c - b, a);
+    return c + 313;
+}
+int f314(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 314)
+        return f313(c - b, a);
+    return c + 314;
+}
+int f315(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 315)
+        return f314(c - b, a);
+    return c + 315;
+}
+int f316(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 316)
+        return f315(c - b, a);
+    return c + 316;
+}
+int f317(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 317)
+        return f316(c - b, a);
+    return c + 317;
+}
+int f318(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 318)
+        return f317(c - b, a);
+    return c + 318;
+}
+int f319(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 319)
+        return f318(c - b, a);
+    return c + 319;
+}
+int f320(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 320)
+        return f319(c - b, a);
+    return c + 320;
+}
+int f321(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 321)
+        return f320(c - b, a);
+    return c + 321;
+}
+int f322(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 322)
+        return f321(c - b, a);
+    return c + 322;
+}
+int f323(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 323)
+        return f322(c - b, a);
+    return c + 323;
+}
+int f324(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 324)
+        return f323(c - b, a);
+    return c + 324;
+}
+int f325(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 325)
+        return f324(c - b, a);
+    return c + 325;
+}
+int f326(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 326)
+        return f325(c - b, a);
+    return c + 326;
+}
+int f327(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 327)
+        return f326(c - b, a);
+    return c + 327;
+}
+int f328(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 328)
+        return f327(c - b, a);
+    return c + 328;
+}
+int f329(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 329)
+        return f328(c - b, a);
+    return c + 329;
+}
+int f330(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 330)
+        return f329(c - b, a);
+    return c + 330;
+}
+int f331(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 331)
+        return f330(c - b, a);
+    return c + 331;
+}
+int f332(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 332)
+        return f331(c - b, a);
+    return c + 332;
+}
+int f333(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 333)
+        return f332(c - b, a);
+    return c + 333;
+}
+int f334(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 334)
+        return f333(c - b, a);
+    return c + 334;
+}
+int f335(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 335)
+        return f334(c - b, a);
+    return c + 335;
+}
+int f336(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 336)
+        return f335(c - b, a);
+    return c + 336;
+}
+int f337(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 337)
+        return f336(c - b, a);
+    return c + 337;
+}
+int f338(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 338)
+        return f337(c - b, a);
+    return c + 338;
+}
+int f339(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 339)
+        return f338(c - b, a);
+    return c + 339;
+}
+int f340(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 340)
+        return f339(c - b, a);
+    return c + 340;
+}
+int f341(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 341)
+        return f340(c - b, a);
+    return c + 341;
+}
+int f342(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 342)
+        return f341(c - b, a);
+    return c + 342;
+}
+int f343(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 343)
+        return f342(c - b, a);
+    return c + 343;
+}
+int f344(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 344)
+        return f343(c - b, a);
+    return c + 344;
+}
+int f345(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 345)
+        return f344(c - b, a);
+    return c + 345;
+}
+int f346(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 346)
+        return f345(c - b, a);
+    return c + 346;
+}
+int f347(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 347)
+        return f346(c - b, a);
+    return c + 347;
+}
+int f348(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 348)
+        return f347(c - b, a);
+    return c + 348;
+}
+int f349(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 349)
+        return f348(c - b, a);
+    return c + 349;
+}
+int f350(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 350)
+        return f349(c - b, a);
+    return c + 350;
+}
+int f351(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 351)
+        return f350(c - b, a);
+    return c + 351;
+}
+int f352(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 352)
+        return f351(c - b, a);
+    return c + 352;
+}
+int f353(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 353)
+        return f352(c - b, a);
+    return c + 353;
+}
+int f354(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 354)
+        return f353(c - b, a);
+    return c + 354;
+}
+int f355(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 355)
+        return f354(c - b, a);
+    return c + 355;
+}
+int f356(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 356)
+        return f355(c - b, a);
+    return c + 356;
+}
+int f357(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 357)
+        return f356(c - b, a);
+    return c + 357;
+}
+int f358(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 358)
+        return f357(c - b, a);
+    return c + 358;
+}
+int f359(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 359)
+        return f358(c - b, a);
+    return c + 359;
+}
+int f360(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 360)
+        return f359(c - b, a);
+    return c + 360;
+}
+int f361(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 361)
+        return f360(c - b, a);
+    return c + 361;
+}
+int f362(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 362)
+        return f361(c - b, a);
+    return c + 362;
+}
+int f363(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 363)
+        return f362(c - b, a);
+    return c + 363;
+}
+int f364(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 364)
+        return f363(c - b, a);
+    return c + 364;
+}
+int f365(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 365)
+        return f364(c - b, a);
+    return c + 365;
+}
+int f366(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 366)
+        return f365(c - b, a);
+    return c + 366;
+}
+int f367(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 367)
+        return f366(c - b, a);
+    return c + 367;
+}
+int f368(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 368)
+        return f367(c - b, a);
+    return c + 368;
+}
+int f369(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 369)
+        return f368(c - b, a);
+    return c + 369;
+}
+int f370(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 370)
+        return f369(c - b, a);
+    return c + 370;
+}
+int f371(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 371)
+        return f370(c - b, a);
+    return c + 371;
+}
+int f372(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 372)
+        return f371(c - b, a);
+    return c + 372;
+}
+int f373(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 373)
+        return f372(c - b, a);
+    return c + 373;
+}
+int f374(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 374)
+        return f373(c - b, a);
+    return c + 374;
+}
+int f375(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 375)
+        return f374(c - b, a);
+    return c + 375;
+}
+int f376(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 376)
+        return f375(c - b, a);
+    return c + 376;
+}
+int f377(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 377)
+        return f376(c - b, a);
+    return c + 377;
+}
+int f378(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 378)
+        return f377(c - b, a);
+    return c + 378;
+}
+int f379(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 379)
+        return f378(c - b, a);
+    return c + 379;
+}
+int f380(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 380)
+        return f379(c - b, a);
+    return c + 380;
+}
+int f381(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 381)
+        return f380(c - b, a);
+    return c + 381;
+}
+int f382(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 382)
+        return f381(c - b, a);
+    return c + 382;
+}
+int f383(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 383)
+        return f382(c - b, a);
+    return c + 383;
+}
+int f384(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 384)
+        return f383(c - b, a);
+    return c + 384;
+}
+int f385(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 385)
+        return f384(c - b, a);
+    return c + 385;
+}
+int f386(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 386)
+        return f385(c - b, a);
+    return c + 386;
+}
+int f387(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 387)
+        return f386(c - b, a);
+    return c + 387;
+}
+int f388(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 388)
+        return f387(c - b, a);
+    return c + 388;
+}
+int f389(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 389)
+        return f388(c - b, a);
+    return c + 389;
+}
+int f390(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 390)
+        return f389(c - b, a);
+    return c + 390;
+}
+int f391(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 391)
+        return f390(c - b, a);
+    return c + 391;
+}
+int f392(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 392)
+        return f391(c - b, a);
+    return c + 392;
+}
+int f393(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 393)
+        return f392(c - b, a);
+    return c + 393;
+}
+int f394(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 394)
+        return f393(c - b, a);
+    return c + 394;
+}
+int f395(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 395)
+        return f394(c - b, a);
+    return c + 395;
+}
+int f396(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 396)
+        return f395(c - b, a);
+    return c + 396;
+}
+int f397(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 397)
+        return f396(c - b, a);
+    return c + 397;
+}
+int f398(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 398)
+        return f397(c - b, a);
+    return c + 398;
+}
+int f399(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 399)
+        return f398(c - b, a);
+    return c + 399;
+}
+int f400(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 400)
+        return f399(c - b, a);
+    return c + 400;
+}
+int f401(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 401)
+        return f400(c - b, a);
+    return c + 401;
+}
+int f402(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 402)
+        return f401(c - b, a);
+    return c + 402;
+}
+int f403(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 403)
+        return f402(c - b, a);
+    return c + 403;
+}
+int f404(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 404)
+        return f403(c - b, a);
+    return c + 404;
+}
+int f405(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 405)
+        return f404(c - b, a);
+    return c + 405;
+}
+int f406(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 406)
+        return f405(c - b, a);
+    return c + 406;
+}
+int f407(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 407)
+        return f406(c - b, a);
+    return c + 407;
+}
+int f408(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 408)
+        return f407(c - b, a);
+    return c + 408;
+}
+int f409(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 409)
+        return f408(c - b, a);
+    return c + 409;
+}
+int f410(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 410)
+        return f409(c - b, a);
+    return c + 410;
+}
+int f411(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 411)
+        return f410(c - b, a);
+    return c + 411;
+}
+int f412(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 412)
+        return f411(c - b, a);
+    return c + 412;
+}
+int f413(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 413)
+        return f412(c - b, a);
+    return c + 413;
+}
+int f414(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 414)
+        return f413(c - b, a);
+    return c + 414;
+}
+int f415(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 415)
+        return f414(c - b, a);
+    return c + 415;
+}
+int f416(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 416)
+        return f415(c - b, a);
+    return c + 416;
+}
+int f417(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 417)
+        return f416(c - b, a);
+    return c + 417;
+}
+int f418(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 418)
+        return f417(c - b, a);
+    return c + 418;
+}
+int f419(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 419)
+        return f418(c - b, a);
+    return c + 419;
+}
+int f420(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 420)
+        return f419(c - b, a);
+    return c + 420;
+}
+int f421(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 421)
+        return f420(c - b, a);
+    return c + 421;
+}
+int f422(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 422)
+        return f421(c - b, a);
+    return c + 422;
+}
+int f423(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 423)
+        return f422(c - b, a);
+    return c + 423;
+}
+int f424(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 424)
+        return f423(c - b, a);
+    return c + 424;
+}
+int f425(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 425)
+        return f424(c - b, a);
+    return c + 425;
+}
+int f426(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 426)
+        return f425(c - b, a);
+    return c + 426;
+}
+int f427(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 427)
+        return f426(c - b, a);
+    return c + 427;
+}
+int f428(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 428)
+        return f427(c - b, a);
+    return c + 428;
+}
+int f429(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 429)
+        return f428(c - b, a);
+    return c + 429;
+}
+int f430(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 430)
+        return f429(c - b, a);
+    return c + 430;
+}
+int f431(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 431)
+        return f430(c - b, a);
+    return c + 431;
+}
+int f432(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 432)
+        return f431(c - b, a);
+    return c + 432;
+}
+int f433(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 433)
+        return f432(c - b, a);
+    return c + 433;
+}
+int f434(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 434)
+        return f433(c - b, a);
+    return c + 434;
+}
+int f435(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 435)
+        return f434(c - b, a);
+    return c + 435;
+}
+int f436(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 436)
+        return f435(c - b, a);
+    return c + 436;
+}
+int f437(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 437)
+        return f436(c - b, a);
+    return c + 437;
+}
+int f438(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 438)
+        return f437(c - b, a);
+    return c + 438;
+}
+int f439(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 439)
+        return f438(c - b, a);
+    return c + 439;
+}
+int f440(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 440)
+        return f439(c - b, a);
+    return c + 440;
+}
+int f441(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 441)
+        return f440(c - b, a);
+    return c + 441;
+}
+int f442(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 442)
+        return f441(c - b, a);
+    return c + 442;
+}
+int f443(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 443)
+        return f442(c - b, a);
+    return c + 443;
+}
+int f444(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 444)
+        return f443(c - b, a);
+    return c + 444;
+}
+int f445(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 445)
+        return f444(c - b, a);
+    return c + 445;
+}
+int f446(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 446)
+        return f445(c - b, a);
+    return c + 446;
+}
+int f447(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 447)
+        return f446(c - b, a);
+    return c + 447;
+}
+int f448(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 448)
+        return f447(c - b, a);
+    return c + 448;
+}
+int f449(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 449)
+        return f448(c - b, a);
+    return c + 449;
+}
+int f450(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 450)
+        return f449(c - b, a);
+    return c + 450;
+}
+int f451(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 451)
+        return f450(c - b, a);
+    return c + 451;
+}
+int f452(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 452)
+        return f451(c - b, a);
+    return c + 452;
+}
+int f453(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 453)
+        return f452(c - b, a);
+    return c + 453;
+}
+int f454(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 454)
+        return f453(c - b, a);
+    return c + 454;
+}
+int f455(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 455)
+        return f454(c - b, a);
+    return c + 455;
+}
+int f456(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 456)
+        return f455(c - b, a);
+    return c + 456;
+}
+int f457(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 457)
+        return f456(c - b, a);
+    return c + 457;
+}
+int f458(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 458)
+        return f457(c - b, a);
+    return c + 458;
+}
+int f459(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 459)
+        return f458(c - b, a);
+    return c + 459;
+}
+int f460(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 460)
+        return f459(c - b, a);
+    return c + 460;
+}
+int f461(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 461)
+        return f460(c - b, a);
+    return c + 461;
+}
+int f462(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 462)
+        return f461(c - b, a);
+    return c + 462;
+}
+int f463(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 463)
+        return f462(c - b, a);
+    return c + 463;
+}
+int f464(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 464)
+        return f463(c - b, a);
+    return c + 464;
+}
+int f465(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 465)
+        return f464(c - b, a);
+    return c + 465;
+}
+int f466(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 466)
+        return f465(c - b, a);
+    return c + 466;
+}
+int f467(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 467)
+        return f466(c - b, a);
+    return c + 467;
+}
+int f468(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 468)
+        return f467(c - b, a);
+    return c + 468;
+}
+int f469(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 469)
+        return f468(c - b, a);
+    return c + 469;
+}
+int f470(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 470)
+        return f469(c - b, a);
+    return c + 470;
+}
+int f471(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 471)
+        return f470(c - b, a);
+    return c + 471;
+}
+int f472(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 472)
+        return f471(c - b, a);
+    return c + 472;
+}
+int f473(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 473)
+        return f472(c - b, a);
+    return c + 473;
+}
+int f474(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 474)
+        return f473(c - b, a);
+    return c + 474;
+}
+int f475(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 475)
+        return f474(c - b, a);
+    return c + 475;
+}
+int f476(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 476)
+        return f475(c - b, a);
+    return c + 476;
+}
+int f477(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 477)
+        return f476(c - b, a);
+    return c + 477;
+}
+int f478(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 478)
+        return f477(c - b, a);
+    return c + 478;
+}
+int f479(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 479)
+        return f478(c - b, a);
+    return c + 479;
+}
+int f480(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 480)
+        return f479(c - b, a);
+    return c + 480;
+}
+int f481(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 481)
+        return f480(c - b, a);
+    return c + 481;
+}
+int f482(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 482)
+        return f481(c - b, a);
+    return c + 482;
+}
+int f483(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 483)
+        return f482(c - b, a);
+    return c + 483;
+}
+int f484(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 484)
+        return f483(c - b, a);
+    return c + 484;
+}
+int f485(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 485)
+        return f484(c - b, a);
+    return c + 485;
+}
+int f486(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 486)
+        return f485(c - b, a);
+    return c + 486;
+}
+int f487(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 487)
+        return f486(c - b, a);
+    return c + 487;
+}
+int f488(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 488)
+        return f487(c - b, a);
+    return c + 488;
+}
+int f489(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 489)
+        return f488(c - b, a);
+    return c + 489;
+}
+int f490(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 490)
+        return f489(c - b, a);
+    return c + 490;
+}
+int f491(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 491)
+        return f490(c - b, a);
+    return c + 491;
+}
+int f492(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 492)
+        return f491(c - b, a);
+    return c + 492;
+}
+int f493(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 493)
+        return f492(c - b, a);
+    return c + 493;
+}
+int f494(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 494)
+        return f493(c - b, a);
+    return c + 494;
+}
+int f495(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 495)
+        return f494(c - b, a);
+    return c + 495;
+}
+int f496(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 496)
+        return f495(c - b, a);
+    return c + 496;
+}
+int f497(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 497)
+        return f496(c - b, a);
+    return c + 497;
+}
+int f498(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 498)
+        return f497(c - b, a);
+    return c + 498;
+}
+int f499(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 499)
+        return f498(c - b, a);
+    return c + 499;
+}
+int f500(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 500)
+        return f499(c - b, a);
+    return c + 500;
+}
+int f501(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 501)
+        return f500(c - b, a);
+    return c + 501;
+}
+int f502(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 502)
+        return f501(c - b, a);
+    return c + 502;
+}
+int f503(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 503)
+        return f502(c - b, a);
+    return c + 503;
+}
+int f504(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 504)
+        return f503(c - b, a);
+    return c + 504;
+}
+int f505(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 505)
+        return f504(c - b, a);
+    return c + 505;
+}
+int f506(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 506)
+        return f505(c - b, a);
+    return c + 506;
+}
+int f507(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 507)
+        return f506(c - b, a);
+    return c + 507;
+}
+int f508(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 508)
+        return f507(c - b, a);
+    return c + 508;
+}
+int f509(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 509)
+        return f508(c - b, a);
+    return c + 509;
+}
+int f510(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 510)
+        return f509(c - b, a);
+    return c + 510;
+}
+int f511(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 511)
+        return f510(c - b, a);
+    return c + 511;
+}
+int f512(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 512)
+        return f511(c - b, a);
+    return c + 512;
+}
+int f513(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 513)
+        return f512(c - b, a);
+    return c + 513;
+}
+int f514(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 514)
+        return f513(c - b, a);
+    return c + 514;
+}
+int f515(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 515)
+        return f514(c - b, a);
+    return c + 515;
+}
+int f516(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 516)
+        return f515(c - b, a);
+    return c + 516;
+}
+int f517(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 517)
+        return f516(c - b, a);
+    return c + 517;
+}
+int f518(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 518)
+        return f517(c - b, a);
+    return c + 518;
+}
+int f519(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 519)
+        return f518(c - b, a);
+    return c + 519;
+}
+int f520(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 520)
+        return f519(c - b, a);
+    return c + 520;
+}
+int f521(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 521)
+        return f520(c - b, a);
+    return c + 521;
+}
+int f522(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 522)
+        return f521(c - b, a);
+    return c + 522;
+}
+int f523(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 523)
+        return f522(c - b, a);
+    return c + 523;
+}
+int f524(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 524)
+        return f523(c - b, a);
+    return c + 524;
+}
+int f525(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 525)
+        return f524(c - b, a);
+    return c + 525;
+}
+int f526(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 526)
+        return f525(c - b, a);
+    return c + 526;
+}
+int f527(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 527)
+        return f526(c - b, a);
+    return c + 527;
+}
+int f528(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 528)
+        return f527(c - b, a);
+    return c + 528;
+}
+int f529(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 529)
+        return f528(c - b, a);
+    return c + 529;
+}
+int f530(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 530)
+        return f529(c - b, a);
+    return c + 530;
+}
+int f531(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 531)
+        return f530(c - b, a);
+    return c + 531;
+}
+int f532(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 532)
+        return f531(c - b, a);
+    return c + 532;
+}
+int f533(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 533)
+        return f532(c - b, a);
+    return c + 533;
+}
+int f534(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 534)
+        return f533(c - b, a);
+    return c + 534;
+}
+int f535(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 535)
+        return f534(c - b, a);
+    return c + 535;
+}
+int f536(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 536)
+        return f535(c - b, a);
+    return c + 536;
+}
+int f537(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 537)
+        return f536(c - b, a);
+    return c + 537;
+}
+int f538(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 538)
+        return f537(c - b, a);
+    return c + 538;
+}
+int f539(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 539)
+        return f538(c - b, a);
+    return c + 539;
+}
+int f540(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 540)
+        return f539(c - b, a);
+    return c + 540;
+}
+int f541(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 541)
+        return f540(c - b, a);
+    return c + 541;
+}
+int f542(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 542)
+        return f541(c - b, a);
+    return c + 542;
+}
+int f543(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 543)
+        return f542(c - b, a);
+    return c + 543;
+}
+int f544(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 544)
+        return f543(c - b, a);
+    return c + 544;
+}
+int f545(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 545)
+        return f544(c - b, a);
+    return c + 545;
+}
+int f546(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 546)
+        return f545(c - b, a);
+    return c + 546;
+}
+int f547(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 547)
+        return f546(c - b, a);
+    return c + 547;
+}
+int f548(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 548)
+        return f547(c - b, a);
+    return c + 548;
+}
+int f549(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 549)
+        return f548(c - b, a);
+    return c + 549;
+}
+int f550(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 550)
+        return f549(c - b, a);
+    return c + 550;
+}
+int f551(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 551)
+        return f550(c - b, a);
+    return c + 551;
+}
+int f552(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 552)
+        return f551(c - b, a);
+    return c + 552;
+}
+int f553(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 553)
+        return f552(c - b, a);
+    return c + 553;
+}
+int f554(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 554)
+        return f553(c - b, a);
+    return c + 554;
+}
+int f555(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 555)
+        return f554(c - b, a);
+    return c + 555;
+}
+int f556(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 556)
+        return f555(c - b, a);
+    return c + 556;
+}
+int f557(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 557)
+        return f556(c - b, a);
+    return c + 557;
+}
+int f558(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 558)
+        return f557(c - b, a);
+    return c + 558;
+}
+int f559(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 559)
+        return f558(c - b, a);
+    return c + 559;
+}
+int f560(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 560)
+        return f559(c - b, a);
+    return c + 560;
+}
+int f561(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 561)
+        return f560(c - b, a);
+    return c + 561;
+}
+int f562(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 562)
+        return f561(c - b, a);
+    return c + 562;
+}
+int f563(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 563)
+        return f562(c - b, a);
+    return c + 563;
+}
+int f564(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 564)
+        return f563(c - b, a);
+    return c + 564;
+}
+int f565(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 565)
+        return f564(c - b, a);
+    return c + 565;
+}
+int f566(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 566)
+        return f565(c - b, a);
+    return c + 566;
+}
+int f567(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 567)
+        return f566(c - b, a);
+    return c + 567;
+}
+int f568(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 568)
+        return f567(c - b, a);
+    return c + 568;
+}
+int f569(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 569)
+        return f568(c - b, a);
+    return c + 569;
+}
+int f570(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 570)
+        return f569(c - b, a);
+    return c + 570;
+}
+int f571(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 571)
+        return f570(c - b, a);
+    return c + 571;
+}
+int f572(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 572)
+        return f571(c - b, a);
+    return c + 572;
+}
+int f573(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 573)
+        return f572(c - b, a);
+    return c + 573;
+}
+int f574(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 574)
+        return f573(c - b, a);
+    return c + 574;
+}
+int f575(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 575)
+        return f574(c - b, a);
+    return c + 575;
+}
+int f576(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 576)
+        return f575(c - b, a);
+    return c + 576;
+}
+int f577(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 577)
+        return f576(c - b, a);
+    return c + 577;
+}
+int f578(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 578)
+        return f577(c - b, a);
+    return c + 578;
+}
+int f579(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 579)
+        return f578(c - b, a);
+    return c + 579;
+}
+int f580(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 580)
+        return f579(c - b, a);
+    return c + 580;
+}
+int f581(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 581)
+        return f580(c - b, a);
+    return c + 581;
+}
+int f582(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 582)
+        return f581(c - b, a);
+    return c + 582;
+}
+int f583(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 583)
+        return f582(c - b, a);
+    return c + 583;
+}
+int f584(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 584)
+        return f583(c - b, a);
+    return c + 584;
+}
+int f585(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 585)
+        return f584(c - b, a);
+    return c + 585;
+}
+int f586(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 586)
+        return f585(c - b, a);
+    return c + 586;
+}
+int f587(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 587)
+        return f586(c - b, a);
+    return c + 587;
+}
+int f588(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 588)
+        return f587(c - b, a);
+    return c + 588;
+}
+int f589(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 589)
+        return f588(c - b, a);
+    return c + 589;
+}
+int f590(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 590)
+        return f589(c - b, a);
+    return c + 590;
+}
+int f591(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 591)
+        return f590(c - b, a);
+    return c + 591;
+}
+int f592(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 592)
+        return f591(c - b, a);
+    return c + 592;
+}
+int f593(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 593)
+        return f592(c - b, a);
+    return c + 593;
+}
+int f594(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 594)
+        return f593(c - b, a);
+    return c + 594;
+}
+int f595(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 595)
+        return f594(c - b, a);
+    return c + 595;
+}
+int f596(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 596)
+        return f595(c - b, a);
+    return c + 596;
+}
+int f597(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 597)
+        return f596(c - b, a);
+    return c + 597;
+}
+int f598(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 598)
+        return f597(c - b, a);
+    return c + 598;
+}
+int f599(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 599)
+        return f598(c - b, a);
+    return c + 599;
+}
+int f600(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 600)
+        return f599(c - b, a);
+    return c + 600;
+}
+int f601(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 601)
+        return f600(c - b, a);
+    return c + 601;
+}
+int f602(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 602)
+        return f601(c - b, a);
+    return c + 602;
+}
+int f603(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 603)
+        return f602(c - b, a);
+    return c + 603;
+}
+int f604(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 604)
+        return f603(c - b, a);
+    return c + 604;
+}
+int f605(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 605)
+        return f604(c - b, a);
+    return c + 605;
+}
+int f606(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 606)
+        return f605(c - b, a);
+    return c + 606;
+}
+int f607(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 607)
+        return f606(c - b, a);
+    return c + 607;
+}
+int f608(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 608)
+        return f607(c - b, a);
+    return c + 608;
+}
+int f609(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 609)
+        return f608(c - b, a);
+    return c + 609;
+}
+int f610(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 610)
+        return f609(c - b, a);
+    return c + 610;
+}
+int f611(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 611)
+        return f610(c - b, a);
+    return c + 611;
+}
+int f612(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 612)
+        return f611(c - b, a);
+    return c + 612;
+}
+int f613(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 613)
+        return f612(c - b, a);
+    return c + 613;
+}
+int f614(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 614)
+        return f613(c - b, a);
+    return c + 614;
+}
+int f615(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 615)
+        return f614(c - b, a);
+    return c + 615;
+}
+int f616(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 616)
+        return f615(c - b, a);
+    return c + 616;
+}
+int f617(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 617)
+        return f616(c - b, a);
+    return c + 617;
+}
+int f618(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 618)
+        return f617(c - b, a);
+    return c + 618;
+}
+int f619(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 619)
+        return f618(c - b, a);
+    return c + 619;
+}
+int f620(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 620)
+        return f619(c - b, a);
+    return c + 620;
+}
+int f621(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 621)
+        return f620(c - b, a);
+    return c + 621;
+}
+int f622(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 622)
+        return f621(c - b, a);
+    return c + 622;
+}
+int f623(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 623)
+        return f622(c - b, a);
+    return c + 623;
+}
+int f624(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 624)
+        return f623(c - b, a);
+    return c + 624;
+}
+int f625(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 625)
+        return f624(c - b, a);
+    return c + 625;
+}
+int f626(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 626)
+        return f625(c - b, a);
+    return c + 626;
+}
+int f627(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 627)
+        return f626(c - b, a);
+    return c + 627;
+}
+int f628(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 628)
+        return f627(c - b, a);
+    return c + 628;
+}
+int f629(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 629)
+        return f628(c - b, a);
+    return c + 629;
+}
+int f630(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 630)
+        return f629(c - b, a);
+    return c + 630;
+}
+int f631(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 631)
+        return f630(c - b, a);
+    return c + 631;
+}
+int f632(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 632)
+        return f631(c - b, a);
+    return c + 632;
+}
+int f633(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 633)
+        return f632(c - b, a);
+    return c + 633;
+}
+int f634(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 634)
+        return f633(c - b, a);
+    return c + 634;
+}
+int f635(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 635)
+        return f634(c - b, a);
+    return c + 635;
+}
+int f636(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 636)
+        return f635(c - b, a);
+    return c + 636;
+}
+int f637(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 637)
+        return f636(c - b, a);
+    return c + 637;
+}
+int f638(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 638)
+        return f637(c - b, a);
+    return c + 638;
+}
+int f639(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 639)
+        return f638(c - b, a);
+    return c + 639;
+}
+int f640(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 640)
+        return f639(c - b, a);
+    return c + 640;
+}
+int f641(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 641)
+        return f640(c - b, a);
+    return c + 641;
+}
+int f642(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 642)
+        return f641(c - b, a);
+    return c + 642;
+}
+int f643(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 643)
+        return f642(c - b, a);
+    return c + 643;
+}
+int f644(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 644)
+        return f643(c - b, a);
+    return c + 644;
+}
+int f645(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 645)
+        return f644(c - b, a);
+    return c + 645;
+}
+int f646(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 646)
+        return f645(c - b, a);
+    return c + 646;
+}
+int f647(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 647)
+        return f646(c - b, a);
+    return c + 647;
+}
+int f648(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 648)
+        return f647(c - b, a);
+    return c + 648;
+}
+int f649(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 649)
+        return f648(c - b, a);
+    return c + 649;
+}
+int f650(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 650)
+        return f649(c - b, a);
+    return c + 650;
+}
+int f651(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 651)
+        return f650(c - b, a);
+    return c + 651;
+}
+int f652(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 652)
+        return f651(c - b, a);
+    return c + 652;
+}
+int f653(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 653)
+        return f652(c - b, a);
+    return c + 653;
+}
+int f654(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 654)
+        return f653(c - b, a);
+    return c + 654;
+}
+int f655(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 655)
+        return f654(c - b, a);
+    return c + 655;
+}
+int f656(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 656)
+        return f655(c - b, a);
+    return c + 656;
+}
+int f657(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 657)
+        return f656(c - b, a);
+    return c + 657;
+}
+int f658(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 658)
+        return f657(c - b, a);
+    return c + 658;
+}
+int f659(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 659)
+        return f658(c - b, a);
+    return c + 659;
+}
+int f660(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 660)
+        return f659(c - b, a);
+    return c + 660;
+}
+int f661(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 661)
+        return f660(c - b, a);
+    return c + 661;
+}
+int f662(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 662)
+        return f661(c - b, a);
+    return c + 662;
+}
+int f663(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 663)
+        return f662(c - b, a);
+    return c + 663;
+}
+int f664(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 664)
+        return f663(c - b, a);
+    return c + 664;
+}
+int f665(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 665)
+        return f664(c - b, a);
+    return c + 665;
+}
+int f666(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 666)
+        return f665(c - b, a);
+    return c + 666;
+}
+int f667(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 667)
+        return f666(c - b, a);
+    return c + 667;
+}
+int f668(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 668)
+        return f667(c - b, a);
+    return c + 668;
+}
+int f669(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 669)
+        return f668(c - b, a);
+    return c + 669;
+}
+int f670(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 670)
+        return f669(c - b, a);
+    return c + 670;
+}
+int f671(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 671)
+        return f670(c - b, a);
+    return c + 671;
+}
+int f672(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 672)
+        return f671(c - b, a);
+    return c + 672;
+}
+int f673(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 673)
+        return f672(c - b, a);
+    return c + 673;
+}
+int f674(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 674)
+        return f673(c - b, a);
+    return c + 674;
+}
+int f675(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 675)
+        return f674(c - b, a);
+    return c + 675;
+}
+int f676(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 676)
+        return f675(c - b, a);
+    return c + 676;
+}
+int f677(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 677)
+        return f676(c - b, a);
+    return c + 677;
+}
+int f678(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 678)
+        return f677(c - b, a);
+    return c + 678;
+}
+int f679(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 679)
+        return f678(c - b, a);
+    return c + 679;
+}
+int f680(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 680)
+        return f679(c - b, a);
+    return c + 680;
+}
+int f681(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 681)
+        return f680(c - b, a);
+    return c + 681;
+}
+int f682(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 682)
+        return f681(c - b, a);
+    return c + 682;
+}
+int f683(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 683)
+        return f682(c - b, a);
+    return c + 683;
+}
+int f684(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 684)
+        return f683(c - b, a);
+    return c + 684;
+}
+int f685(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 685)
+        return f684(c - b, a);
+    return c + 685;
+}
+int f686(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 686)
+        return f685(c - b, a);
+    return c + 686;
+}
+int f687(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 687)
+        return f686(c - b, a);
+    return c + 687;
+}
+int f688(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 688)
+        return f687(c - b, a);
+    return c + 688;
+}
+int f689(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 689)
+        return f688(c - b, a);
+    return c + 689;
+}
+int f690(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 690)
+        return f689(c - b, a);
+    return c + 690;
+}
+int f691(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 691)
+        return f690(c - b, a);
+    return c + 691;
+}
+int f692(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 692)
+        return f691(c - b, a);
+    return c + 692;
+}
+int f693(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 693)
+        return f692(c - b, a);
+    return c + 693;
+}
+int f694(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 694)
+        return f693(c - b, a);
+    return c + 694;
+}
+int f695(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 695)
+        return f694(c - b, a);
+    return c + 695;
+}
+int f696(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 696)
+        return f695(c - b, a);
+    return c + 696;
+}
+int f697(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 697)
+        return f696(c - b, a);
+    return c + 697;
+}
+int f698(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 698)
+        return f697(c - b, a);
+    return c + 698;
+}
+int f699(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 699)
+        return f698(c - b, a);
+    return c + 699;
+}
+int f700(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 700)
+        return f699(c - b, a);
+    return c + 700;
+}
+int f701(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 701)
+        return f700(c - b, a);
+    return c + 701;
+}
+int f702(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 702)
+        return f701(c - b, a);
+    return c + 702;
+}
+int f703(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 703)
+        return f702(c - b, a);
+    return c + 703;
+}
+int f704(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 704)
+        return f703(c - b, a);
+    return c + 704;
+}
+int f705(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 705)
+        return f704(c - b, a);
+    return c + 705;
+}
+int f706(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 706)
+        return f705(c - b, a);
+    return c + 706;
+}
+int f707(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 707)
+        return f706(c - b, a);
+    return c + 707;
+}
+int f708(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 708)
+        return f707(c - b, a);
+    return c + 708;
+}
+int f709(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 709)
+        return f708(c - b, a);
+    return c + 709;
+}
+int f710(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 710)
+        return f709(c - b, a);
+    return c + 710;
+}
+int f711(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 711)
+        return f710(c - b, a);
+    return c + 711;
+}
+int f712(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 712)
+        return f711(c - b, a);
+    return c + 712;
+}
+int f713(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 713)
+        return f712(c - b, a);
+    return c + 713;
+}
+int f714(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 714)
+        return f713(c - b, a);
+    return c + 714;
+}
+int f715(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 715)
+        return f714(c - b, a);
+    return c + 715;
+}
+int f716(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 716)
+        return f715(c - b, a);
+    return c + 716;
+}
+int f717(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 717)
+        return f716(c - b, a);
+    return c + 717;
+}
+int f718(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 718)
+        return f717(c - b, a);
+    return c + 718;
+}
+int f719(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 719)
+        return f718(c - b, a);
+    return c + 719;
+}
+int f720(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 720)
+        return f719(c - b, a);
+    return c + 720;
+}
+int f721(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 721)
+        return f720(c - b, a);
+    return c + 721;
+}
+int f722(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 722)
+        return f721(c - b, a);
+    return c + 722;
+}
+int f723(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 723)
+        return f722(c - b, a);
+    return c + 723;
+}
+int f724(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 724)
+        return f723(c - b, a);
+    return c + 724;
+}
+int f725(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 725)
+        return f724(c - b, a);
+    return c + 725;
+}
+int f726(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 726)
+        return f725(c - b, a);
+    return c + 726;
+}
+int f727(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 727)
+        return f726(c - b, a);
+    return c + 727;
+}
+int f728(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 728)
+        return f727(c - b, a);
+    return c + 728;
+}
+int f729(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 729)
+        return f728(c - b, a);
+    return c + 729;
+}
+int f730(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 730)
+        return f729(c - b, a);
+    return c + 730;
+}
+int f731(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 731)
+        return f730(c - b, a);
+    return c + 731;
+}
+int f732(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 732)
+        return f731(c - b, a);
+    return c + 732;
+}
+int f733(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 733)
+        return f732(c - b, a);
+    return c + 733;
+}
+int f734(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 734)
+        return f733(c - b, a);
+    return c + 734;
+}
+int f735(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 735)
+        return f734(c - b, a);
+    return c + 735;
+}
+int f736(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 736)
+        return f735(c - b, a);
+    return c + 736;
+}
+int f737(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 737)
+        return f736(c - b, a);
+    return c + 737;
+}
+int f738(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 738)
+        return f737(c - b, a);
+    return c + 738;
+}
+int f739(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 739)
+        return f738(c - b, a);
+    return c + 739;
+}
+int f740(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 740)
+        return f739(c - b, a);
+    return c + 740;
+}
+int f741(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 741)
+        return f740(c - b, a);
+    return c + 741;
+}
+int f742(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 742)
+        return f741(c - b, a);
+    return c + 742;
+}
+int f743(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 743)
+        return f742(c - b, a);
+    return c + 743;
+}
+int f744(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 744)
+        return f743(c - b, a);
+    return c + 744;
+}
+int f745(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 745)
+        return f744(c - b, a);
+    return c + 745;
+}
+int f746(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 746)
+        return f745(c - b, a);
+    return c + 746;
+}
+int f747(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 747)
+        return f746(c - b, a);
+    return c + 747;
+}
+int f748(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 748)
+        return f747(c - b, a);
+    return c + 748;
+}
+int f749(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 749)
+        return f748(c - b, a);
+    return c + 749;
+}
+int f750(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 750)
+        return f749(c - b, a);
+    return c + 750;
+}
+int f751(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 751)
+        return f750(c - b, a);
+    return c + 751;
+}
+int f752(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 752)
+        return f751(c - b, a);
+    return c + 752;
+}
+int f753(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 753)
+        return f752(c - b, a);
+    return c + 753;
+}
+int f754(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 754)
+        return f753(c - b, a);
+    return c + 754;
+}
+int f755(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 755)
+        return f754(c - b, a);
+    return c + 755;
+}
+int f756(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 756)
+        return f755(c - b, a);
+    return c + 756;
+}
+int f757(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 757)
+        return f756(c - b, a);
+    return c + 757;
+}
+int f758(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 758)
+        return f757(c - b, a);
+    return c + 758;
+}
+int f759(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 759)
+        return f758(c - b, a);
+    return c + 759;
+}
+int f760(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 760)
+        return f759(c - b, a);
+    return c + 760;
+}
+int f761(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 761)
+        return f760(c - b, a);
+    return c + 761;
+}
+int f762(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 762)
+        return f761(c - b, a);
+    return c + 762;
+}
+int f763(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 763)
+        return f762(c - b, a);
+    return c + 763;
+}
+int f764(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 764)
+        return f763(c - b, a);
+    return c + 764;
+}
+int f765(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 765)
+        return f764(c - b, a);
+    return c + 765;
+}
+int f766(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 766)
+        return f765(c - b, a);
+    return c + 766;
+}
+int f767(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 767)
+        return f766(c - b, a);
+    return c + 767;
+}
+int f768(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 768)
+        return f767(c - b, a);
+    return c + 768;
+}
+int f769(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 769)
+        return f768(c - b, a);
+    return c + 769;
+}
+int f770(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 770)
+        return f769(c - b, a);
+    return c + 770;
+}
+int f771(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 771)
+        return f770(c - b, a);
+    return c + 771;
+}
+int f772(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 772)
+        return f771(c - b, a);
+    return c + 772;
+}
+int f773(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 773)
+        return f772(c - b, a);
+    return c + 773;
+}
+int f774(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 774)
+        return f773(c - b, a);
+    return c + 774;
+}
+int f775(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 775)
+        return f774(c - b, a);
+    return c + 775;
+}
+int f776(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 776)
+        return f775(c - b, a);
+    return c + 776;
+}
+int f777(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 777)
+        return f776(c - b, a);
+    return c + 777;
+}
+int f778(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 778)
+        return f777(c - b, a);
+    return c + 778;
+}
+int f779(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 779)
+        return f778(c - b, a);
+    return c + 779;
+}
+int f780(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 780)
+        return f779(c - b, a);
+    return c + 780;
+}
+int f781(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 781)
+        return f780(c - b, a);
+    return c + 781;
+}
+int f782(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 782)
+        return f781(c - b, a);
+    return c + 782;
+}
+int f783(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 783)
+        return f782(c - b, a);
+    return c + 783;
+}
+int f784(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 784)
+        return f783(c - b, a);
+    return c + 784;
+}
+int f785(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 785)
+        return f784(c - b, a);
+    return c + 785;
+}
+int f786(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 786)
+        return f785(c - b, a);
+    return c + 786;
+}
+int f787(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 787)
+        return f786(c - b, a);
+    return c + 787;
+}
+int f788(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 788)
+        return f787(c - b, a);
+    return c + 788;
+}
+int f789(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 789)
+        return f788(c - b, a);
+    return c + 789;
+}
+int f790(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 790)
+        return f789(c - b, a);
+    return c + 790;
+}
+int f791(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 791)
+        return f790(c - b, a);
+    return c + 791;
+}
+int f792(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 792)
+        return f791(c - b, a);
+    return c + 792;
+}
+int f793(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 793)
+        return f792(c - b, a);
+    return c + 793;
+}
+int f794(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 794)
+        return f793(c - b, a);
+    return c + 794;
+}
+int f795(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 795)
+        return f794(c - b, a);
+    return c + 795;
+}
+int f796(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 796)
+        return f795(c - b, a);
+    return c + 796;
+}
+int f797(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 797)
+        return f796(c - b, a);
+    return c + 797;
+}
+int f798(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 798)
+        return f797(c - b, a);
+    return c + 798;
+}
+int f799(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 799)
+        return f798(c - b, a);
+    return c + 799;
+}
+int f800(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 800)
+        return f799(c - b, a);
+    return c + 800;
+}
+int f801(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 801)
+        return f800(c - b, a);
+    return c + 801;
+}
+int f802(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 802)
+        return f801(c - b, a);
+    return c + 802;
+}
+int f803(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 803)
+        return f802(c - b, a);
+    return c + 803;
+}
+int f804(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 804)
+        return f803(c - b, a);
+    return c + 804;
+}
+int f805(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 805)
+        return f804(c - b, a);
+    return c + 805;
+}
+int f806(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 806)
+        return f805(c - b, a);
+    return c + 806;
+}
+int f807(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 807)
+        return f806(c - b, a);
+    return c + 807;
+}
+int f808(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 808)
+        return f807(c - b, a);
+    return c + 808;
+}
+int f809(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 809)
+        return f808(c - b, a);
+    return c + 809;
+}
+int f810(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 810)
+        return f809(c - b, a);
+    return c + 810;
+}
+int f811(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 811)
+        return f810(c - b, a);
+    return c + 811;
+}
+int f812(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 812)
+        return f811(c - b, a);
+    return c + 812;
+}
+int f813(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 813)
+        return f812(c - b, a);
+    return c + 813;
+}
+int f814(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 814)
+        return f813(c - b, a);
+    return c + 814;
+}
+int f815(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 815)
+        return f814(c - b, a);
+    return c + 815;
+}
+int f816(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 816)
+        return f815(c - b, a);
+    return c + 816;
+}
+int f817(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 817)
+        return f816(c - b, a);
+    return c + 817;
+}
+int f818(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 818)
+        return f817(c - b, a);
+    return c + 818;
+}
+int f819(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 819)
+        return f818(c - b, a);
+    return c + 819;
+}
+int f820(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 820)
+        return f819(c - b, a);
+    return c + 820;
+}
+int f821(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 821)
+        return f820(c - b, a);
+    return c + 821;
+}
+int f822(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 822)
+        return f821(c - b, a);
+    return c + 822;
+}
+int f823(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 823)
+        return f822(c - b, a);
+    return c + 823;
+}
+int f824(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 824)
+        return f823(c - b, a);
+    return c + 824;
+}
+int f825(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 825)
+        return f824(c - b, a);
+    return c + 825;
+}
+int f826(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 826)
+        return f825(c - b, a);
+    return c + 826;
+}
+int f827(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 827)
+        return f826(c - b, a);
+    return c + 827;
+}
+int f828(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 828)
+        return f827(c - b, a);
+    return c + 828;
+}
+int f829(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 829)
+        return f828(c - b, a);
+    return c + 829;
+}
+int f830(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 830)
+        return f829(c - b, a);
+    return c + 830;
+}
+int f831(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 831)
+        return f830(c - b, a);
+    return c + 831;
+}
+int f832(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 832)
+        return f831(c - b, a);
+    return c + 832;
+}
+int f833(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 833)
+        return f832(c - b, a);
+    return c + 833;
+}
+int f834(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 834)
+        return f833(c - b, a);
+    return c + 834;
+}
+int f835(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 835)
+        return f834(c - b, a);
+    return c + 835;
+}
+int f836(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 836)
+        return f835(c - b, a);
+    return c + 836;
+}
+int f837(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 837)
+        return f836(c - b, a);
+    return c + 837;
+}
+int f838(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 838)
+        return f837(c - b, a);
+    return c + 838;
+}
+int f839(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 839)
+        return f838(c - b, a);
+    return c + 839;
+}
+int f840(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 840)
+        return f839(c - b, a);
+    return c + 840;
+}
+int f841(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 841)
+        return f840(c - b, a);
+    return c + 841;
+}
+int f842(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 842)
+        return f841(c - b, a);
+    return c + 842;
+}
+int f843(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 843)
+        return f842(c - b, a);
+    return c + 843;
+}
+int f844(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 844)
+        return f843(c - b, a);
+    return c + 844;
+}
+int f845(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 845)
+        return f844(c - b, a);
+    return c + 845;
+}
+int f846(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 846)
+        return f845(c - b, a);
+    return c + 846;
+}
+int f847(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 847)
+        return f846(c - b, a);
+    return c + 847;
+}
+int f848(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 848)
+        return f847(c - b, a);
+    return c + 848;
+}
+int f849(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 849)
+        return f848(c - b, a);
+    return c + 849;
+}
+int f850(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 850)
+        return f849(c - b, a);
+    return c + 850;
+}
+int f851(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 851)
+        return f850(c - b, a);
+    return c + 851;
+}
+int f852(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 852)
+        return f851(c - b, a);
+    return c + 852;
+}
+int f853(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 853)
+        return f852(c - b, a);
+    return c + 853;
+}
+int f854(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 854)
+        return f853(c - b, a);
+    return c + 854;
+}
+int f855(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 855)
+        return f854(c - b, a);
+    return c + 855;
+}
+int f856(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 856)
+        return f855(c - b, a);
+    return c + 856;
+}
+int f857(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 857)
+        return f856(c - b, a);
+    return c + 857;
+}
+int f858(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 858)
+        return f857(c - b, a);
+    return c + 858;
+}
+int f859(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 859)
+        return f858(c - b, a);
+    return c + 859;
+}
+int f860(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 860)
+        return f859(c - b, a);
+    return c + 860;
+}
+int f861(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 861)
+        return f860(c - b, a);
+    return c + 861;
+}
+int f862(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 862)
+        return f861(c - b, a);
+    return c + 862;
+}
+int f863(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 863)
+        return f862(c - b, a);
+    return c + 863;
+}
+int f864(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 864)
+        return f863(c - b, a);
+    return c + 864;
+}
+int f865(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 865)
+        return f864(c - b, a);
+    return c + 865;
+}
+int f866(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 866)
+        return f865(c - b, a);
+    return c + 866;
+}
+int f867(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 867)
+        return f866(c - b, a);
+    return c + 867;
+}
+int f868(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 868)
+        return f867(c - b, a);
+    return c + 868;
+}
+int f869(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 869)
+        return f868(c - b, a);
+    return c + 869;
+}
+int f870(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 870)
+        return f869(c - b, a);
+    return c + 870;
+}
+int f871(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 871)
+        return f870(c - b, a);
+    return c + 871;
+}
+int f872(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 872)
+        return f871(c - b, a);
+    return c + 872;
+}
+int f873(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 873)
+        return f872(c - b, a);
+    return c + 873;
+}
+int f874(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 874)
+        return f873(c - b, a);
+    return c + 874;
+}
+int f875(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 875)
+        return f874(c - b, a);
+    return c + 875;
+}
+int f876(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 876)
+        return f875(c - b, a);
+    return c + 876;
+}
+int f877(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 877)
+        return f876(c - b, a);
+    return c + 877;
+}
+int f878(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 878)
+        return f877(c - b, a);
+    return c + 878;
+}
+int f879(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 879)
+        return f878(c - b, a);
+    return c + 879;
+}
+int f880(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 880)
+        return f879(c - b, a);
+    return c + 880;
+}
+int f881(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 881)
+        return f880(c - b, a);
+    return c + 881;
+}
+int f882(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 882)
+        return f881(c - b, a);
+    return c + 882;
+}
+int f883(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 883)
+        return f882(c - b, a);
+    return c + 883;
+}
+int f884(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 884)
+        return f883(c - b, a);
+    return c + 884;
+}
+int f885(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 885)
+        return f884(c - b, a);
+    return c + 885;
+}
+int f886(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 886)
+        return f885(c - b, a);
+    return c + 886;
+}
+int f887(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 887)
+        return f886(c - b, a);
+    return c + 887;
+}
+int f888(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 888)
+        return f887(c - b, a);
+    return c + 888;
+}
+int f889(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 889)
+        return f888(c - b, a);
+    return c + 889;
+}
+int f890(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 890)
+        return f889(c - b, a);
+    return c + 890;
+}
+int f891(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 891)
+        return f890(c - b, a);
+    return c + 891;
+}
+int f892(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 892)
+        return f891(c - b, a);
+    return c + 892;
+}
+int f893(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 893)
+        return f892(c - b, a);
+    return c + 893;
+}
+int f894(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 894)
+        return f893(c - b, a);
+    return c + 894;
+}
+int f895(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 895)
+        return f894(c - b, a);
+    return c + 895;
+}
+int f896(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 896)
+        return f895(c - b, a);
+    return c + 896;
+}
+int f897(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 897)
+        return f896(c - b, a);
+    return c + 897;
+}
+int f898(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 898)
+        return f897(c - b, a);
+    return c + 898;
+}
+int f899(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 899)
+        return f898(c - b, a);
+    return c + 899;
+}
+int f900(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 900)
+        return f899(c - b, a);
+    return c + 900;
+}
+int f901(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 901)
+        return f900(c - b, a);
+    return c + 901;
+}
+int f902(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 902)
+        return f901(c - b, a);
+    return c + 902;
+}
+int f903(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 903)
+        return f902(c - b, a);
+    return c + 903;
+}
+int f904(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 904)
+        return f903(c - b, a);
+    return c + 904;
+}
+int f905(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 905)
+        return f904(c - b, a);
+    return c + 905;
+}
+int f906(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 906)
+        return f905(c - b, a);
+    return c + 906;
+}
+int f907(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 907)
+        return f906(c - b, a);
+    return c + 907;
+}
+int f908(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 908)
+        return f907(c - b, a);
+    return c + 908;
+}
+int f909(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 909)
+        return f908(c - b, a);
+    return c + 909;
+}
+int f910(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 910)
+        return f909(c - b, a);
+    return c + 910;
+}
+int f911(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 911)
+        return f910(c - b, a);
+    return c + 911;
+}
+int f912(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 912)
+        return f911(c - b, a);
+    return c + 912;
+}
+int f913(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 913)
+        return f912(c - b, a);
+    return c + 913;
+}
+int f914(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 914)
+        return f913(c - b, a);
+    return c + 914;
+}
+int f915(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 915)
+        return f914(c - b, a);
+    return c + 915;
+}
+int f916(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 916)
+        return f915(c - b, a);
+    return c + 916;
+}
+int f917(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 917)
+        return f916(c - b, a);
+    return c + 917;
+}
+int f918(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 918)
+        return f917(c - b, a);
+    return c + 918;
+}
+int f919(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 919)
+        return f918(c - b, a);
+    return c + 919;
+}
+int f920(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 920)
+        return f919(c - b, a);
+    return c + 920;
+}
+int f921(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 921)
+        return f920(c - b, a);
+    return c + 921;
+}
+int f922(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 922)
+        return f921(c - b, a);
+    return c + 922;
+}
+int f923(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 923)
+        return f922(c - b, a);
+    return c + 923;
+}
+int f924(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 924)
+        return f923(c - b, a);
+    return c + 924;
+}
+int f925(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 925)
+        return f924(c - b, a);
+    return c + 925;
+}
+int f926(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 926)
+        return f925(c - b, a);
+    return c + 926;
+}
+int f927(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 927)
+        return f926(c - b, a);
+    return c + 927;
+}
+int f928(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 928)
+        return f927(c - b, a);
+    return c + 928;
+}
+int f929(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 929)
+        return f928(c - b, a);
+    return c + 929;
+}
+int f930(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 930)
+        return f929(c - b, a);
+    return c + 930;
+}
+int f931(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 931)
+        return f930(c - b, a);
+    return c + 931;
+}
+int f932(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 932)
+        return f931(c - b, a);
+    return c + 932;
+}
+int f933(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 933)
+        return f932(c - b, a);
+    return c + 933;
+}
+int f934(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 934)
+        return f933(c - b, a);
+    return c + 934;
+}
+int f935(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 935)
+        return f934(c - b, a);
+    return c + 935;
+}
+int f936(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 936)
+        return f935(c - b, a);
+    return c + 936;
+}
+int f937(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 937)
+        return f936(c - b, a);
+    return c + 937;
+}
+int f938(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 938)
+        return f937(c - b, a);
+    return c + 938;
+}
+int f939(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 939)
+        return f938(c - b, a);
+    return c + 939;
+}
+int f940(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 940)
+        return f939(c - b, a);
+    return c + 940;
+}
+int f941(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 941)
+        return f940(c - b, a);
+    return c + 941;
+}
+int f942(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 942)
+        return f941(c - b, a);
+    return c + 942;
+}
+int f943(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 943)
+        return f942(c - b, a);
+    return c + 943;
+}
+int f944(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 944)
+        return f943(c - b, a);
+    return c + 944;
+}
+int f945(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 945)
+        return f944(c - b, a);
+    return c + 945;
+}
+int f946(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 946)
+        return f945(c - b, a);
+    return c + 946;
+}
+int f947(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 947)
+        return f946(c - b, a);
+    return c + 947;
+}
+int f948(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 948)
+        return f947(c - b, a);
+    return c + 948;
+}
+int f949(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 949)
+        return f948(c - b, a);
+    return c + 949;
+}
+int f950(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 950)
+        return f949(c - b, a);
+    return c + 950;
+}
+int f951(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 951)
+        return f950(c - b, a);
+    return c + 951;
+}
+int f952(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 952)
+        return f951(c - b, a);
+    return c + 952;
+}
+int f953(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 953)
+        return f952(c - b, a);
+    return c + 953;
+}
+int f954(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 954)
+        return f953(c - b, a);
+    return c + 954;
+}
+int f955(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 955)
+        return f954(c - b, a);
+    return c + 955;
+}
+int f956(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 956)
+        return f955(c - b, a);
+    return c + 956;
+}
+int f957(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 957)
+        return f956(c - b, a);
+    return c + 957;
+}
+int f958(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 958)
+        return f957(c - b, a);
+    return c + 958;
+}
+int f959(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 959)
+        return f958(c - b, a);
+    return c + 959;
+}
+int f960(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 960)
+        return f959(c - b, a);
+    return c + 960;
+}
+int f961(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 961)
+        return f960(c - b, a);
+    return c + 961;
+}
+int f962(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 962)
+        return f961(c - b, a);
+    return c + 962;
+}
+int f963(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 963)
+        return f962(c - b, a);
+    return c + 963;
+}
+int f964(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 964)
+        return f963(c - b, a);
+    return c + 964;
+}
+int f965(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 965)
+        return f964(c - b, a);
+    return c + 965;
+}
+int f966(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 966)
+        return f965(c - b, a);
+    return c + 966;
+}
+int f967(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 967)
+        return f966(c - b, a);
+    return c + 967;
+}
+int f968(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 968)
+        return f967(c - b, a);
+    return c + 968;
+}
+int f969(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 969)
+        return f968(c - b, a);
+    return c + 969;
+}
+int f970(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 970)
+        return f969(c - b, a);
+    return c + 970;
+}
+int f971(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 971)
+        return f970(c - b, a);
+    return c + 971;
+}
+int f972(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 972)
+        return f971(c - b, a);
+    return c + 972;
+}
+int f973(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 973)
+        return f972(c - b, a);
+    return c + 973;
+}
+int f974(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 974)
+        return f973(c - b, a);
+    return c + 974;
+}
+int f975(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 975)
+        return f974(c - b, a);
+    return c + 975;
+}
+int f976(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 976)
+        return f975(c - b, a);
+    return c + 976;
+}
+int f977(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 977)
+        return f976(c - b, a);
+    return c + 977;
+}
+int f978(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 978)
+        return f977(c - b, a);
+    return c + 978;
+}
+int f979(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 979)
+        return f978(c - b, a);
+    return c + 979;
+}
+int f980(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 980)
+        return f979(c - b, a);
+    return c + 980;
+}
+int f981(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 981)
+        return f980(c - b, a);
+    return c + 981;
+}
+int f982(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 982)
+        return f981(c - b, a);
+    return c + 982;
+}
+int f983(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 983)
+        return f982(c - b, a);
+    return c + 983;
+}
+int f984(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 984)
+        return f983(c - b, a);
+    return c + 984;
+}
+int f985(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 985)
+        return f984(c - b, a);
+    return c + 985;
+}
+int f986(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 986)
+        return f985(c - b, a);
+    return c + 986;
+}
+int f987(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 987)
+        return f986(c - b, a);
+    return c + 987;
+}
+int f988(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 988)
+        return f987(c - b, a);
+    return c + 988;
+}
+int f989(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 989)
+        return f988(c - b, a);
+    return c + 989;
+}
+int f990(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 990)
+        return f989(c - b, a);
+    return c + 990;
+}
+int f991(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 991)
+        return f990(c - b, a);
+    return c + 991;
+}
+int f992(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 992)
+        return f991(c - b, a);
+    return c + 992;
+}
+int f993(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 993)
+        return f992(c - b, a);
+    return c + 993;
+}
+int f994(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 994)
+        return f993(c - b, a);
+    return c + 994;
+}
+int f995(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 995)
+        return f994(c - b, a);
+    return c + 995;
+}
+int f996(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 996)
+        return f995(c - b, a);
+    return c + 996;
+}
+int f997(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 997)
+        return f996(c - b, a);
+    return c + 997;
+}
+int f998(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 998)
+        return f997(c - b, a);
+    return c + 998;
+}
+int f999(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 999)
+        return f998(c - b, a);
+    return c + 999;
+}
+int f1000(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1000)
+        return f999(c - b, a);
+    return c + 1000;
+}
+int f1001(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1001)
+        return f1000(c - b, a);
+    return c + 1001;
+}
+int f1002(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1002)
+        return f1001(c - b, a);
+    return c + 1002;
+}
+int f1003(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1003)
+        return f1002(c - b, a);
+    return c + 1003;
+}
+int f1004(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1004)
+        return f1003(c - b, a);
+    return c + 1004;
+}
+int f1005(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1005)
+        return f1004(c - b, a);
+    return c + 1005;
+}
+int f1006(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1006)
+        return f1005(c - b, a);
+    return c + 1006;
+}
+int f1007(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1007)
+        return f1006(c - b, a);
+    return c + 1007;
+}
+int f1008(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1008)
+        return f1007(c - b, a);
+    return c + 1008;
+}
+int f1009(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1009)
+        return f1008(c - b, a);
+    return c + 1009;
+}
+int f1010(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1010)
+        return f1009(c - b, a);
+    return c + 1010;
+}
+int f1011(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1011)
+        return f1010(c - b, a);
+    return c + 1011;
+}
+int f1012(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1012)
+        return f1011(c - b, a);
+    return c + 1012;
+}
+int f1013(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1013)
+        return f1012(c - b, a);
+    return c + 1013;
+}
+int f1014(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1014)
+        return f1013(c - b, a);
+    return c + 1014;
+}
+int f1015(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1015)
+        return f1014(c - b, a);
+    return c + 1015;
+}
+int f1016(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1016)
+        return f1015(c - b, a);
+    return c + 1016;
+}
+int f1017(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1017)
+        return f1016(c - b, a);
+    return c + 1017;
+}
+int f1018(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1018)
+        return f1017(c - b, a);
+    return c + 1018;
+}
+int f1019(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1019)
+        return f1018(c - b, a);
+    return c + 1019;
+}
+int f1020(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1020)
+        return f1019(c - b, a);
+    return c + 1020;
+}
+int f1021(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1021)
+        return f1020(c - b, a);
+    return c + 1021;
+}
+int f1022(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1022)
+        return f1021(c - b, a);
+    return c + 1022;
+}
+int f1023(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1023)
+        return f1022(c - b, a);
+    return c + 1023;
+}
+int f1024(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1024)
+        return f1023(c - b, a);
+    return c + 1024;
+}
+int f1025(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1025)
+        return f1024(c - b, a);
+    return c + 1025;
+}
+int f1026(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1026)
+        return f1025(c - b, a);
+    return c + 1026;
+}
+int f1027(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1027)
+        return f1026(c - b, a);
+    return c + 1027;
+}
+int f1028(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1028)
+        return f1027(c - b, a);
+    return c + 1028;
+}
+int f1029(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1029)
+        return f1028(c - b, a);
+    return c + 1029;
+}
+int f1030(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1030)
+        return f1029(c - b, a);
+    return c + 1030;
+}
+int f1031(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1031)
+        return f1030(c - b, a);
+    return c + 1031;
+}
+int f1032(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1032)
+        return f1031(c - b, a);
+    return c + 1032;
+}
+int f1033(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1033)
+        return f1032(c - b, a);
+    return c + 1033;
+}
+int f1034(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1034)
+        return f1033(c - b, a);
+    return c + 1034;
+}
+int f1035(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1035)
+        return f1034(c - b, a);
+    return c + 1035;
+}
+int f1036(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1036)
+        return f1035(c - b, a);
+    return c + 1036;
+}
+int f1037(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1037)
+        return f1036(c - b, a);
+    return c + 1037;
+}
+int f1038(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1038)
+        return f1037(c - b, a);
+    return c + 1038;
+}
+int f1039(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1039)
+        return f1038(c - b, a);
+    return c + 1039;
+}
+int f1040(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1040)
+        return f1039(c - b, a);
+    return c + 1040;
+}
+int f1041(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1041)
+        return f1040(c - b, a);
+    return c + 1041;
+}
+int f1042(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1042)
+        return f1041(c - b, a);
+    return c + 1042;
+}
+int f1043(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1043)
+        return f1042(c - b, a);
+    return c + 1043;
+}
+int f1044(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1044)
+        return f1043(c - b, a);
+    return c + 1044;
+}
+int f1045(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1045)
+        return f1044(c - b, a);
+    return c + 1045;
+}
+int f1046(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1046)
+        return f1045(c - b, a);
+    return c + 1046;
+}
+int f1047(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1047)
+        return f1046(c - b, a);
+    return c + 1047;
+}
+int f1048(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1048)
+        return f1047(c - b, a);
+    return c + 1048;
+}
+int f1049(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1049)
+        return f1048(c - b, a);
+    return c + 1049;
+}
+int f1050(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1050)
+        return f1049(c - b, a);
+    return c + 1050;
+}
+int f1051(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1051)
+        return f1050(c - b, a);
+    return c + 1051;
+}
+int f1052(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1052)
+        return f1051(c - b, a);
+    return c + 1052;
+}
+int f1053(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1053)
+        return f1052(c - b, a);
+    return c + 1053;
+}
+int f1054(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1054)
+        return f1053(c - b, a);
+    return c + 1054;
+}
+int f1055(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1055)
+        return f1054(c - b, a);
+    return c + 1055;
+}
+int f1056(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1056)
+        return f1055(c - b, a);
+    return c + 1056;
+}
+int f1057(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1057)
+        return f1056(c - b, a);
+    return c + 1057;
+}
+int f1058(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1058)
+        return f1057(c - b, a);
+    return c + 1058;
+}
+int f1059(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1059)
+        return f1058(c - b, a);
+    return c + 1059;
+}
+int f1060(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1060)
+        return f1059(c - b, a);
+    return c + 1060;
+}
+int f1061(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1061)
+        return f1060(c - b, a);
+    return c + 1061;
+}
+int f1062(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1062)
+        return f1061(c - b, a);
+    return c + 1062;
+}
+int f1063(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1063)
+        return f1062(c - b, a);
+    return c + 1063;
+}
+int f1064(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1064)
+        return f1063(c - b, a);
+    return c + 1064;
+}
+int f1065(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1065)
+        return f1064(c - b, a);
+    return c + 1065;
+}
+int f1066(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1066)
+        return f1065(c - b, a);
+    return c + 1066;
+}
+int f1067(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1067)
+        return f1066(c - b, a);
+    return c + 1067;
+}
+int f1068(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1068)
+        return f1067(c - b, a);
+    return c + 1068;
+}
+int f1069(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1069)
+        return f1068(c - b, a);
+    return c + 1069;
+}
+int f1070(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1070)
+        return f1069(c - b, a);
+    return c + 1070;
+}
+int f1071(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1071)
+        return f1070(c - b, a);
+    return c + 1071;
+}
+int f1072(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1072)
+        return f1071(c - b, a);
+    return c + 1072;
+}
+int f1073(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1073)
+        return f1072(c - b, a);
+    return c + 1073;
+}
+int f1074(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1074)
+        return f1073(c - b, a);
+    return c + 1074;
+}
+int f1075(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1075)
+        return f1074(c - b, a);
+    return c + 1075;
+}
+int f1076(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1076)
+        return f1075(c - b, a);
+    return c + 1076;
+}
+int f1077(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1077)
+        return f1076(c - b, a);
+    return c + 1077;
+}
+int f1078(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1078)
+        return f1077(c - b, a);
+    return c + 1078;
+}
+int f1079(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1079)
+        return f1078(c - b, a);
+    return c + 1079;
+}
+int f1080(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1080)
+        return f1079(c - b, a);
+    return c + 1080;
+}
+int f1081(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1081)
+        return f1080(c - b, a);
+    return c + 1081;
+}
+int f1082(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1082)
+        return f1081(c - b, a);
+    return c + 1082;
+}
+int f1083(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1083)
+        return f1082(c - b, a);
+    return c + 1083;
+}
+int f1084(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1084)
+        return f1083(c - b, a);
+    return c + 1084;
+}
+int f1085(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1085)
+        return f1084(c - b, a);
+    return c + 1085;
+}
+int f1086(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1086)
+        return f1085(c - b, a);
+    return c + 1086;
+}
+int f1087(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1087)
+        return f1086(c - b, a);
+    return c + 1087;
+}
+int f1088(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1088)
+        return f1087(c - b, a);
+    return c + 1088;
+}
+int f1089(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1089)
+        return f1088(c - b, a);
+    return c + 1089;
+}
+int f1090(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1090)
+        return f1089(c - b, a);
+    return c + 1090;
+}
+int f1091(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1091)
+        return f1090(c - b, a);
+    return c + 1091;
+}
+int f1092(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1092)
+        return f1091(c - b, a);
+    return c + 1092;
+}
+int f1093(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1093)
+        return f1092(c - b, a);
+    return c + 1093;
+}
+int f1094(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1094)
+        return f1093(c - b, a);
+    return c + 1094;
+}
+int f1095(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1095)
+        return f1094(c - b, a);
+    return c + 1095;
+}
+int f1096(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1096)
+        return f1095(c - b, a);
+    return c + 1096;
+}
+int f1097(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1097)
+        return f1096(c - b, a);
+    return c + 1097;
+}
+int f1098(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1098)
+        return f1097(c - b, a);
+    return c + 1098;
+}
+int f1099(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1099)
+        return f1098(c - b, a);
+    return c + 1099;
+}
+int f1100(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1100)
+        return f1099(c - b, a);
+    return c + 1100;
+}
+int f1101(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1101)
+        return f1100(c - b, a);
+    return c + 1101;
+}
+int f1102(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1102)
+        return f1101(c - b, a);
+    return c + 1102;
+}
+int f1103(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1103)
+        return f1102(c - b, a);
+    return c + 1103;
+}
+int f1104(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1104)
+        return f1103(c - b, a);
+    return c + 1104;
+}
+int f1105(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1105)
+        return f1104(c - b, a);
+    return c + 1105;
+}
+int f1106(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1106)
+        return f1105(c - b, a);
+    return c + 1106;
+}
+int f1107(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1107)
+        return f1106(c - b, a);
+    return c + 1107;
+}
+int f1108(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1108)
+        return f1107(c - b, a);
+    return c + 1108;
+}
+int f1109(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1109)
+        return f1108(c - b, a);
+    return c + 1109;
+}
+int f1110(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1110)
+        return f1109(c - b, a);
+    return c + 1110;
+}
+int f1111(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1111)
+        return f1110(c - b, a);
+    return c + 1111;
+}
+int f1112(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1112)
+        return f1111(c - b, a);
+    return c + 1112;
+}
+int f1113(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1113)
+        return f1112(c - b, a);
+    return c + 1113;
+}
+int f1114(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1114)
+        return f1113(c - b, a);
+    return c + 1114;
+}
+int f1115(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1115)
+        return f1114(c - b, a);
+    return c + 1115;
+}
+int f1116(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1116)
+        return f1115(c - b, a);
+    return c + 1116;
+}
+int f1117(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1117)
+        return f1116(c - b, a);
+    return c + 1117;
+}
+int f1118(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1118)
+        return f1117(c - b, a);
+    return c + 1118;
+}
+int f1119(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1119)
+        return f1118(c - b, a);
+    return c + 1119;
+}
+int f1120(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1120)
+        return f1119(c - b, a);
+    return c + 1120;
+}
+int f1121(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1121)
+        return f1120(c - b, a);
+    return c + 1121;
+}
+int f1122(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1122)
+        return f1121(c - b, a);
+    return c + 1122;
+}
+int f1123(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1123)
+        return f1122(c - b, a);
+    return c + 1123;
+}
+int f1124(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1124)
+        return f1123(c - b, a);
+    return c + 1124;
+}
+int f1125(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1125)
+        return f1124(c - b, a);
+    return c + 1125;
+}
+int f1126(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1126)
+        return f1125(c - b, a);
+    return c + 1126;
+}
+int f1127(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1127)
+        return f1126(c - b, a);
+    return c + 1127;
+}
+int f1128(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1128)
+        return f1127(c - b, a);
+    return c + 1128;
+}
+int f1129(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1129)
+        return f1128(c - b, a);
+    return c + 1129;
+}
+int f1130(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1130)
+        return f1129(c - b, a);
+    return c + 1130;
+}
+int f1131(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1131)
+        return f1130(c - b, a);
+    return c + 1131;
+}
+int f1132(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1132)
+        return f1131(c - b, a);
+    return c + 1132;
+}
+int f1133(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1133)
+        return f1132(c - b, a);
+    return c + 1133;
+}
+int f1134(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1134)
+        return f1133(c - b, a);
+    return c + 1134;
+}
+int f1135(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1135)
+        return f1134(c - b, a);
+    return c + 1135;
+}
+int f1136(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1136)
+        return f1135(c - b, a);
+    return c + 1136;
+}
+int f1137(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1137)
+        return f1136(c - b, a);
+    return c + 1137;
+}
+int f1138(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1138)
+        return f1137(c - b, a);
+    return c + 1138;
+}
+int f1139(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1139)
+        return f1138(c - b, a);
+    return c + 1139;
+}
+int f1140(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1140)
+        return f1139(c - b, a);
+    return c + 1140;
+}
+int f1141(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1141)
+        return f1140(c - b, a);
+    return c + 1141;
+}
+int f1142(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1142)
+        return f1141(c - b, a);
+    return c + 1142;
+}
+int f1143(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1143)
+        return f1142(c - b, a);
+    return c + 1143;
+}
+int f1144(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1144)
+        return f1143(c - b, a);
+    return c + 1144;
+}
+int f1145(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1145)
+        return f1144(c - b, a);
+    return c + 1145;
+}
+int f1146(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1146)
+        return f1145(c - b, a);
+    return c + 1146;
+}
+int f1147(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1147)
+        return f1146(c - b, a);
+    return c + 1147;
+}
+int f1148(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1148)
+        return f1147(c - b, a);
+    return c + 1148;
+}
+int f1149(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1149)
+        return f1148(c - b, a);
+    return c + 1149;
+}
+int f1150(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1150)
+        return f1149(c - b, a);
+    return c + 1150;
+}
+int f1151(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1151)
+        return f1150(c - b, a);
+    return c + 1151;
+}
+int f1152(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1152)
+        return f1151(c - b, a);
+    return c + 1152;
+}
+int f1153(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1153)
+        return f1152(c - b, a);
+    return c + 1153;
+}
+int f1154(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1154)
+        return f1153(c - b, a);
+    return c + 1154;
+}
+int f1155(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1155)
+        return f1154(c - b, a);
+    return c + 1155;
+}
+int f1156(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1156)
+        return f1155(c - b, a);
+    return c + 1156;
+}
+int f1157(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1157)
+        return f1156(c - b, a);
+    return c + 1157;
+}
+int f1158(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1158)
+        return f1157(c - b, a);
+    return c + 1158;
+}
+int f1159(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1159)
+        return f1158(c - b, a);
+    return c + 1159;
+}
+int f1160(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1160)
+        return f1159(c - b, a);
+    return c + 1160;
+}
+int f1161(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1161)
+        return f1160(c - b, a);
+    return c + 1161;
+}
+int f1162(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1162)
+        return f1161(c - b, a);
+    return c + 1162;
+}
+int f1163(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1163)
+        return f1162(c - b, a);
+    return c + 1163;
+}
+int f1164(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1164)
+        return f1163(c - b, a);
+    return c + 1164;
+}
+int f1165(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1165)
+        return f1164(c - b, a);
+    return c + 1165;
+}
+int f1166(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1166)
+        return f1165(c - b, a);
+    return c + 1166;
+}
+int f1167(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1167)
+        return f1166(c - b, a);
+    return c + 1167;
+}
+int f1168(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1168)
+        return f1167(c - b, a);
+    return c + 1168;
+}
+int f1169(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1169)
+        return f1168(c - b, a);
+    return c + 1169;
+}
+int f1170(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1170)
+        return f1169(c - b, a);
+    return c + 1170;
+}
+int f1171(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1171)
+        return f1170(c - b, a);
+    return c + 1171;
+}
+int f1172(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1172)
+        return f1171(c - b, a);
+    return c + 1172;
+}
+int f1173(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1173)
+        return f1172(c - b, a);
+    return c + 1173;
+}
+int f1174(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1174)
+        return f1173(c - b, a);
+    return c + 1174;
+}
+int f1175(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1175)
+        return f1174(c - b, a);
+    return c + 1175;
+}
+int f1176(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1176)
+        return f1175(c - b, a);
+    return c + 1176;
+}
+int f1177(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1177)
+        return f1176(c - b, a);
+    return c + 1177;
+}
+int f1178(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1178)
+        return f1177(c - b, a);
+    return c + 1178;
+}
+int f1179(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1179)
+        return f1178(c - b, a);
+    return c + 1179;
+}
+int f1180(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1180)
+        return f1179(c - b, a);
+    return c + 1180;
+}
+int f1181(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1181)
+        return f1180(c - b, a);
+    return c + 1181;
+}
+int f1182(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1182)
+        return f1181(c - b, a);
+    return c + 1182;
+}
+int f1183(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1183)
+        return f1182(c - b, a);
+    return c + 1183;
+}
+int f1184(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1184)
+        return f1183(c - b, a);
+    return c + 1184;
+}
+int f1185(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1185)
+        return f1184(c - b, a);
+    return c + 1185;
+}
+int f1186(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1186)
+        return f1185(c - b, a);
+    return c + 1186;
+}
+int f1187(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1187)
+        return f1186(c - b, a);
+    return c + 1187;
+}
+int f1188(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1188)
+        return f1187(c - b, a);
+    return c + 1188;
+}
+int f1189(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1189)
+        return f1188(c - b, a);
+    return c + 1189;
+}
+int f1190(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1190)
+        return f1189(c - b, a);
+    return c + 1190;
+}
+int f1191(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1191)
+        return f1190(c - b, a);
+    return c + 1191;
+}
+int f1192(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1192)
+        return f1191(c - b, a);
+    return c + 1192;
+}
+int f1193(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1193)
+        return f1192(c - b, a);
+    return c + 1193;
+}
+int f1194(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1194)
+        return f1193(c - b, a);
+    return c + 1194;
+}
+int f1195(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1195)
+        return f1194(c - b, a);
+    return c + 1195;
+}
+int f1196(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1196)
+        return f1195(c - b, a);
+    return c + 1196;
+}
+int f1197(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1197)
+        return f1196(c - b, a);
+    return c + 1197;
+}
+int f1198(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1198)
+        return f1197(c - b, a);
+    return c + 1198;
+}
+int f1199(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1199)
+        return f1198(c - b, a);
+    return c + 1199;
+}
+int f1200(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1200)
+        return f1199(c - b, a);
+    return c + 1200;
+}
+int f1201(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1201)
+        return f1200(c - b, a);
+    return c + 1201;
+}
+int f1202(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1202)
+        return f1201(c - b, a);
+    return c + 1202;
+}
+int f1203(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1203)
+        return f1202(c - b, a);
+    return c + 1203;
+}
+int f1204(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1204)
+        return f1203(c - b, a);
+    return c + 1204;
+}
+int f1205(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1205)
+        return f1204(c - b, a);
+    return c + 1205;
+}
+int f1206(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1206)
+        return f1205(c - b, a);
+    return c + 1206;
+}
+int f1207(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1207)
+        return f1206(c - b, a);
+    return c + 1207;
+}
+int f1208(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1208)
+        return f1207(c - b, a);
+    return c + 1208;
+}
+int f1209(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1209)
+        return f1208(c - b, a);
+    return c + 1209;
+}
+int f1210(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1210)
+        return f1209(c - b, a);
+    return c + 1210;
+}
+int f1211(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1211)
+        return f1210(c - b, a);
+    return c + 1211;
+}
+int f1212(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1212)
+        return f1211(c - b, a);
+    return c + 1212;
+}
+int f1213(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1213)
+        return f1212(c - b, a);
+    return c + 1213;
+}
+int f1214(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1214)
+        return f1213(c - b, a);
+    return c + 1214;
+}
+int f1215(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1215)
+        return f1214(c - b, a);
+    return c + 1215;
+}
+int f1216(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1216)
+        return f1215(c - b, a);
+    return c + 1216;
+}
+int f1217(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1217)
+        return f1216(c - b, a);
+    return c + 1217;
+}
+int f1218(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1218)
+        return f1217(c - b, a);
+    return c + 1218;
+}
+int f1219(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1219)
+        return f1218(c - b, a);
+    return c + 1219;
+}
+int f1220(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1220)
+        return f1219(c - b, a);
+    return c + 1220;
+}
+int f1221(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1221)
+        return f1220(c - b, a);
+    return c + 1221;
+}
+int f1222(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1222)
+        return f1221(c - b, a);
+    return c + 1222;
+}
+int f1223(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1223)
+        return f1222(c - b, a);
+    return c + 1223;
+}
+int f1224(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1224)
+        return f1223(c - b, a);
+    return c + 1224;
+}
+int f1225(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1225)
+        return f1224(c - b, a);
+    return c + 1225;
+}
+int f1226(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1226)
+        return f1225(c - b, a);
+    return c + 1226;
+}
+int f1227(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1227)
+        return f1226(c - b, a);
+    return c + 1227;
+}
+int f1228(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1228)
+        return f1227(c - b, a);
+    return c + 1228;
+}
+int f1229(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1229)
+        return f1228(c - b, a);
+    return c + 1229;
+}
+int f1230(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1230)
+        return f1229(c - b, a);
+    return c + 1230;
+}
+int f1231(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1231)
+        return f1230(c - b, a);
+    return c + 1231;
+}
+int f1232(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1232)
+        return f1231(c - b, a);
+    return c + 1232;
+}
+int f1233(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1233)
+        return f1232(c - b, a);
+    return c + 1233;
+}
+int f1234(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1234)
+        return f1233(c - b, a);
+    return c + 1234;
+}
+int f1235(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1235)
+        return f1234(c - b, a);
+    return c + 1235;
+}
+int f1236(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1236)
+        return f1235(c - b, a);
+    return c + 1236;
+}
+int f1237(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1237)
+        return f1236(c - b, a);
+    return c + 1237;
+}
+int f1238(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1238)
+        return f1237(c - b, a);
+    return c + 1238;
+}
+int f1239(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1239)
+        return f1238(c - b, a);
+    return c + 1239;
+}
+int f1240(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1240)
+        return f1239(c - b, a);
+    return c + 1240;
+}
+int f1241(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1241)
+        return f1240(c - b, a);
+    return c + 1241;
+}
+int f1242(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1242)
+        return f1241(c - b, a);
+    return c + 1242;
+}
+int f1243(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1243)
+        return f1242(c - b, a);
+    return c + 1243;
+}
+int f1244(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1244)
+        return f1243(c - b, a);
+    return c + 1244;
+}
+int f1245(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1245)
+        return f1244(c - b, a);
+    return c + 1245;
+}
+int f1246(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1246)
+        return f1245(c - b, a);
+    return c + 1246;
+}
+int f1247(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1247)
+        return f1246(c - b, a);
+    return c + 1247;
+}
+int f1248(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1248)
+        return f1247(c - b, a);
+    return c + 1248;
+}
+int f1249(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1249)
+        return f1248(c - b, a);
+    return c + 1249;
+}
+int f1250(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1250)
+        return f1249(c - b, a);
+    return c + 1250;
+}
+int f1251(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1251)
+        return f1250(c - b, a);
+    return c + 1251;
+}
+int f1252(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1252)
+        return f1251(c - b, a);
+    return c + 1252;
+}
+int f1253(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1253)
+        return f1252(c - b, a);
+    return c + 1253;
+}
+int f1254(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1254)
+        return f1253(c - b, a);
+    return c + 1254;
+}
+int f1255(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1255)
+        return f1254(c - b, a);
+    return c + 1255;
+}
+int f1256(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1256)
+        return f1255(c - b, a);
+    return c + 1256;
+}
+int f1257(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1257)
+        return f1256(c - b, a);
+    return c + 1257;
+}
+int f1258(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1258)
+        return f1257(c - b, a);
+    return c + 1258;
+}
+int f1259(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1259)
+        return f1258(c - b, a);
+    return c + 1259;
+}
+int f1260(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1260)
+        return f1259(c - b, a);
+    return c + 1260;
+}
+int f1261(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1261)
+        return f1260(c - b, a);
+    return c + 1261;
+}
+int f1262(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1262)
+        return f1261(c - b, a);
+    return c + 1262;
+}
+int f1263(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1263)
+        return f1262(c - b, a);
+    return c + 1263;
+}
+int f1264(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1264)
+        return f1263(c - b, a);
+    return c + 1264;
+}
+int f1265(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1265)
+        return f1264(c - b, a);
+    return c + 1265;
+}
+int f1266(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1266)
+        return f1265(c - b, a);
+    return c + 1266;
+}
+int f1267(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1267)
+        return f1266(c - b, a);
+    return c + 1267;
+}
+int f1268(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1268)
+        return f1267(c - b, a);
+    return c + 1268;
+}
+int f1269(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1269)
+        return f1268(c - b, a);
+    return c + 1269;
+}
+int f1270(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1270)
+        return f1269(c - b, a);
+    return c + 1270;
+}
+int f1271(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1271)
+        return f1270(c - b, a);
+    return c + 1271;
+}
+int f1272(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1272)
+        return f1271(c - b, a);
+    return c + 1272;
+}
+int f1273(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1273)
+        return f1272(c - b, a);
+    return c + 1273;
+}
+int f1274(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1274)
+        return f1273(c - b, a);
+    return c + 1274;
+}
+int f1275(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1275)
+        return f1274(c - b, a);
+    return c + 1275;
+}
+int f1276(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1276)
+        return f1275(c - b, a);
+    return c + 1276;
+}
+int f1277(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1277)
+        return f1276(c - b, a);
+    return c + 1277;
+}
+int f1278(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1278)
+        return f1277(c - b, a);
+    return c + 1278;
+}
+int f1279(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1279)
+        return f1278(c - b, a);
+    return c + 1279;
+}
+int f1280(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1280)
+        return f1279(c - b, a);
+    return c + 1280;
+}
+int f1281(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1281)
+        return f1280(c - b, a);
+    return c + 1281;
+}
+int f1282(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1282)
+        return f1281(c - b, a);
+    return c + 1282;
+}
+int f1283(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1283)
+        return f1282(c - b, a);
+    return c + 1283;
+}
+int f1284(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1284)
+        return f1283(c - b, a);
+    return c + 1284;
+}
+int f1285(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1285)
+        return f1284(c - b, a);
+    return c + 1285;
+}
+int f1286(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1286)
+        return f1285(c - b, a);
+    return c + 1286;
+}
+int f1287(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1287)
+        return f1286(c - b, a);
+    return c + 1287;
+}
+int f1288(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1288)
+        return f1287(c - b, a);
+    return c + 1288;
+}
+int f1289(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1289)
+        return f1288(c - b, a);
+    return c + 1289;
+}
+int f1290(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1290)
+        return f1289(c - b, a);
+    return c + 1290;
+}
+int f1291(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1291)
+        return f1290(c - b, a);
+    return c + 1291;
+}
+int f1292(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1292)
+        return f1291(c - b, a);
+    return c + 1292;
+}
+int f1293(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1293)
+        return f1292(c - b, a);
+    return c + 1293;
+}
+int f1294(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1294)
+        return f1293(c - b, a);
+    return c + 1294;
+}
+int f1295(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1295)
+        return f1294(c - b, a);
+    return c + 1295;
+}
+int f1296(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1296)
+        return f1295(c - b, a);
+    return c + 1296;
+}
+int f1297(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1297)
+        return f1296(c - b, a);
+    return c + 1297;
+}
+int f1298(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1298)
+        return f1297(c - b, a);
+    return c + 1298;
+}
+int f1299(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1299)
+        return f1298(c - b, a);
+    return c + 1299;
+}
+int f1300(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1300)
+        return f1299(c - b, a);
+    return c + 1300;
+}
+int f1301(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1301)
+        return f1300(c - b, a);
+    return c + 1301;
+}
+int f1302(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1302)
+        return f1301(c - b, a);
+    return c + 1302;
+}
+int f1303(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1303)
+        return f1302(c - b, a);
+    return c + 1303;
+}
+int f1304(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1304)
+        return f1303(c - b, a);
+    return c + 1304;
+}
+int f1305(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1305)
+        return f1304(c - b, a);
+    return c + 1305;
+}
+int f1306(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1306)
+        return f1305(c - b, a);
+    return c + 1306;
+}
+int f1307(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1307)
+        return f1306(c - b, a);
+    return c + 1307;
+}
+int f1308(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1308)
+        return f1307(c - b, a);
+    return c + 1308;
+}
+int f1309(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1309)
+        return f1308(c - b, a);
+    return c + 1309;
+}
+int f1310(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1310)
+        return f1309(c - b, a);
+    return c + 1310;
+}
+int f1311(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1311)
+        return f1310(c - b, a);
+    return c + 1311;
+}
+int f1312(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1312)
+        return f1311(c - b, a);
+    return c + 1312;
+}
+int f1313(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1313)
+        return f1312(c - b, a);
+    return c + 1313;
+}
+int f1314(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1314)
+        return f1313(c - b, a);
+    return c + 1314;
+}
+int f1315(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1315)
+        return f1314(c - b, a);
+    return c + 1315;
+}
+int f1316(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1316)
+        return f1315(c - b, a);
+    return c + 1316;
+}
+int f1317(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1317)
+        return f1316(c - b, a);
+    return c + 1317;
+}
+int f1318(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1318)
+        return f1317(c - b, a);
+    return c + 1318;
+}
+int f1319(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1319)
+        return f1318(c - b, a);
+    return c + 1319;
+}
+int f1320(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1320)
+        return f1319(c - b, a);
+    return c + 1320;
+}
+int f1321(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1321)
+        return f1320(c - b, a);
+    return c + 1321;
+}
+int f1322(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1322)
+        return f1321(c - b, a);
+    return c + 1322;
+}
+int f1323(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1323)
+        return f1322(c - b, a);
+    return c + 1323;
+}
+int f1324(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1324)
+        return f1323(c - b, a);
+    return c + 1324;
+}
+int f1325(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1325)
+        return f1324(c - b, a);
+    return c + 1325;
+}
+int f1326(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1326)
+        return f1325(c - b, a);
+    return c + 1326;
+}
+int f1327(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1327)
+        return f1326(c - b, a);
+    return c + 1327;
+}
+int f1328(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1328)
+        return f1327(c - b, a);
+    return c + 1328;
+}
+int f1329(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1329)
+        return f1328(c - b, a);
+    return c + 1329;
+}
+int f1330(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1330)
+        return f1329(c - b, a);
+    return c + 1330;
+}
+int f1331(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1331)
+        return f1330(c - b, a);
+    return c + 1331;
+}
+int f1332(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1332)
+        return f1331(c - b, a);
+    return c + 1332;
+}
+int f1333(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1333)
+        return f1332(c - b, a);
+    return c + 1333;
+}
+int f1334(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1334)
+        return f1333(c - b, a);
+    return c + 1334;
+}
+int f1335(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1335)
+        return f1334(c - b, a);
+    return c + 1335;
+}
+int f1336(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1336)
+        return f1335(c - b, a);
+    return c + 1336;
+}
+int f1337(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1337)
+        return f1336(c - b, a);
+    return c + 1337;
+}
+int f1338(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1338)
+        return f1337(c - b, a);
+    return c + 1338;
+}
+int f1339(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1339)
+        return f1338(c - b, a);
+    return c + 1339;
+}
+int f1340(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1340)
+        return f1339(c - b, a);
+    return c + 1340;
+}
+int f1341(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1341)
+        return f1340(c - b, a);
+    return c + 1341;
+}
+int f1342(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1342)
+        return f1341(c - b, a);
+    return c + 1342;
+}
+int f1343(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1343)
+        return f1342(c - b, a);
+    return c + 1343;
+}
+int f1344(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1344)
+        return f1343(c - b, a);
+    return c + 1344;
+}
+int f1345(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1345)
+        return f1344(c - b, a);
+    return c + 1345;
+}
+int f1346(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1346)
+        return f1345(c - b, a);
+    return c + 1346;
+}
+int f1347(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1347)
+        return f1346(c - b, a);
+    return c + 1347;
+}
+int f1348(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1348)
+        return f1347(c - b, a);
+    return c + 1348;
+}
+int f1349(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1349)
+        return f1348(c - b, a);
+    return c + 1349;
+}
+int f1350(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1350)
+        return f1349(c - b, a);
+    return c + 1350;
+}
+int f1351(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1351)
+        return f1350(c - b, a);
+    return c + 1351;
+}
+int f1352(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1352)
+        return f1351(c - b, a);
+    return c + 1352;
+}
+int f1353(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1353)
+        return f1352(c - b, a);
+    return c + 1353;
+}
+int f1354(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1354)
+        return f1353(c - b, a);
+    return c + 1354;
+}
+int f1355(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1355)
+        return f1354(c - b, a);
+    return c + 1355;
+}
+int f1356(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1356)
+        return f1355(c - b, a);
+    return c + 1356;
+}
+int f1357(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1357)
+        return f1356(c - b, a);
+    return c + 1357;
+}
+int f1358(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1358)
+        return f1357(c - b, a);
+    return c + 1358;
+}
+int f1359(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1359)
+        return f1358(c - b, a);
+    return c + 1359;
+}
+int f1360(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1360)
+        return f1359(c - b, a);
+    return c + 1360;
+}
+int f1361(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1361)
+        return f1360(c - b, a);
+    return c + 1361;
+}
+int f1362(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1362)
+        return f1361(c - b, a);
+    return c + 1362;
+}
+int f1363(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1363)
+        return f1362(c - b, a);
+    return c + 1363;
+}
+int f1364(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1364)
+        return f1363(c - b, a);
+    return c + 1364;
+}
+int f1365(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1365)
+        return f1364(c - b, a);
+    return c + 1365;
+}
+int f1366(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1366)
+        return f1365(c - b, a);
+    return c + 1366;
+}
+int f1367(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1367)
+        return f1366(c - b, a);
+    return c + 1367;
+}
+int f1368(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1368)
+        return f1367(c - b, a);
+    return c + 1368;
+}
+int f1369(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1369)
+        return f1368(c - b, a);
+    return c + 1369;
+}
+int f1370(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1370)
+        return f1369(c - b, a);
+    return c + 1370;
+}
+int f1371(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1371)
+        return f1370(c - b, a);
+    return c + 1371;
+}
+int f1372(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1372)
+        return f1371(c - b, a);
+    return c + 1372;
+}
+int f1373(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1373)
+        return f1372(c - b, a);
+    return c + 1373;
+}
+int f1374(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1374)
+        return f1373(c - b, a);
+    return c + 1374;
+}
+int f1375(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1375)
+        return f1374(c - b, a);
+    return c + 1375;
+}
+int f1376(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1376)
+        return f1375(c - b, a);
+    return c + 1376;
+}
+int f1377(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1377)
+        return f1376(c - b, a);
+    return c + 1377;
+}
+int f1378(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1378)
+        return f1377(c - b, a);
+    return c + 1378;
+}
+int f1379(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1379)
+        return f1378(c - b, a);
+    return c + 1379;
+}
+int f1380(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1380)
+        return f1379(c - b, a);
+    return c + 1380;
+}
+int f1381(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1381)
+        return f1380(c - b, a);
+    return c + 1381;
+}
+int f1382(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1382)
+        return f1381(c - b, a);
+    return c + 1382;
+}
+int f1383(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1383)
+        return f1382(c - b, a);
+    return c + 1383;
+}
+int f1384(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1384)
+        return f1383(c - b, a);
+    return c + 1384;
+}
+int f1385(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1385)
+        return f1384(c - b, a);
+    return c + 1385;
+}
+int f1386(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1386)
+        return f1385(c - b, a);
+    return c + 1386;
+}
+int f1387(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1387)
+        return f1386(c - b, a);
+    return c + 1387;
+}
+int f1388(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1388)
+        return f1387(c - b, a);
+    return c + 1388;
+}
+int f1389(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1389)
+        return f1388(c - b, a);
+    return c + 1389;
+}
+int f1390(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1390)
+        return f1389(c - b, a);
+    return c + 1390;
+}
+int f1391(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1391)
+        return f1390(c - b, a);
+    return c + 1391;
+}
+int f1392(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1392)
+        return f1391(c - b, a);
+    return c + 1392;
+}
+int f1393(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1393)
+        return f1392(c - b, a);
+    return c + 1393;
+}
+int f1394(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1394)
+        return f1393(c - b, a);
+    return c + 1394;
+}
+int f1395(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1395)
+        return f1394(c - b, a);
+    return c + 1395;
+}
+int f1396(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1396)
+        return f1395(c - b, a);
+    return c + 1396;
+}
+int f1397(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1397)
+        return f1396(c - b, a);
+    return c + 1397;
+}
+int f1398(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1398)
+        return f1397(c - b, a);
+    return c + 1398;
+}
+int f1399(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1399)
+        return f1398(c - b, a);
+    return c + 1399;
+}
+int f1400(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1400)
+        return f1399(c - b, a);
+    return c + 1400;
+}
+int f1401(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1401)
+        return f1400(c - b, a);
+    return c + 1401;
+}
+int f1402(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1402)
+        return f1401(c - b, a);
+    return c + 1402;
+}
+int f1403(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1403)
+        return f1402(c - b, a);
+    return c + 1403;
+}
+int f1404(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1404)
+        return f1403(c - b, a);
+    return c + 1404;
+}
+int f1405(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1405)
+        return f1404(c - b, a);
+    return c + 1405;
+}
+int f1406(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1406)
+        return f1405(c - b, a);
+    return c + 1406;
+}
+int f1407(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1407)
+        return f1406(c - b, a);
+    return c + 1407;
+}
+int f1408(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1408)
+        return f1407(c - b, a);
+    return c + 1408;
+}
+int f1409(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1409)
+        return f1408(c - b, a);
+    return c + 1409;
+}
+int f1410(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1410)
+        return f1409(c - b, a);
+    return c + 1410;
+}
+int f1411(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1411)
+        return f1410(c - b, a);
+    return c + 1411;
+}
+int f1412(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1412)
+        return f1411(c - b, a);
+    return c + 1412;
+}
+int f1413(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1413)
+        return f1412(c - b, a);
+    return c + 1413;
+}
+int f1414(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1414)
+        return f1413(c - b, a);
+    return c + 1414;
+}
+int f1415(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1415)
+        return f1414(c - b, a);
+    return c + 1415;
+}
+int f1416(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1416)
+        return f1415(c - b, a);
+    return c + 1416;
+}
+int f1417(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1417)
+        return f1416(c - b, a);
+    return c + 1417;
+}
+int f1418(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1418)
+        return f1417(c - b, a);
+    return c + 1418;
+}
+int f1419(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1419)
+        return f1418(c - b, a);
+    return c + 1419;
+}
+int f1420(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1420)
+        return f1419(c - b, a);
+    return c + 1420;
+}
+int f1421(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1421)
+        return f1420(c - b, a);
+    return c + 1421;
+}
+int f1422(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1422)
+        return f1421(c - b, a);
+    return c + 1422;
+}
+int f1423(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1423)
+        return f1422(c - b, a);
+    return c + 1423;
+}
+int f1424(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1424)
+        return f1423(c - b, a);
+    return c + 1424;
+}
+int f1425(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1425)
+        return f1424(c - b, a);
+    return c + 1425;
+}
+int f1426(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1426)
+        return f1425(c - b, a);
+    return c + 1426;
+}
+int f1427(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1427)
+        return f1426(c - b, a);
+    return c + 1427;
+}
+int f1428(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1428)
+        return f1427(c - b, a);
+    return c + 1428;
+}
+int f1429(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1429)
+        return f1428(c - b, a);
+    return c + 1429;
+}
+int f1430(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1430)
+        return f1429(c - b, a);
+    return c + 1430;
+}
+int f1431(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1431)
+        return f1430(c - b, a);
+    return c + 1431;
+}
+int f1432(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1432)
+        return f1431(c - b, a);
+    return c + 1432;
+}
+int f1433(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1433)
+        return f1432(c - b, a);
+    return c + 1433;
+}
+int f1434(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1434)
+        return f1433(c - b, a);
+    return c + 1434;
+}
+int f1435(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1435)
+        return f1434(c - b, a);
+    return c + 1435;
+}
+int f1436(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1436)
+        return f1435(c - b, a);
+    return c + 1436;
+}
+int f1437(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1437)
+        return f1436(c - b, a);
+    return c + 1437;
+}
+int f1438(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1438)
+        return f1437(c - b, a);
+    return c + 1438;
+}
+int f1439(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1439)
+        return f1438(c - b, a);
+    return c + 1439;
+}
+int f1440(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1440)
+        return f1439(c - b, a);
+    return c + 1440;
+}
+int f1441(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1441)
+        return f1440(c - b, a);
+    return c + 1441;
+}
+int f1442(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1442)
+        return f1441(c - b, a);
+    return c + 1442;
+}
+int f1443(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1443)
+        return f1442(c - b, a);
+    return c + 1443;
+}
+int f1444(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1444)
+        return f1443(c - b, a);
+    return c + 1444;
+}
+int f1445(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1445)
+        return f1444(c - b, a);
+    return c + 1445;
+}
+int f1446(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1446)
+        return f1445(c - b, a);
+    return c + 1446;
+}
+int f1447(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1447)
+        return f1446(c - b, a);
+    return c + 1447;
+}
+int f1448(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1448)
+        return f1447(c - b, a);
+    return c + 1448;
+}
+int f1449(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1449)
+        return f1448(c - b, a);
+    return c + 1449;
+}
+int f1450(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1450)
+        return f1449(c - b, a);
+    return c + 1450;
+}
+int f1451(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1451)
+        return f1450(c - b, a);
+    return c + 1451;
+}
+int f1452(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1452)
+        return f1451(c - b, a);
+    return c + 1452;
+}
+int f1453(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1453)
+        return f1452(c - b, a);
+    return c + 1453;
+}
+int f1454(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1454)
+        return f1453(c - b, a);
+    return c + 1454;
+}
+int f1455(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1455)
+        return f1454(c - b, a);
+    return c + 1455;
+}
+int f1456(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1456)
+        return f1455(c - b, a);
+    return c + 1456;
+}
+int f1457(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1457)
+        return f1456(c - b, a);
+    return c + 1457;
+}
+int f1458(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1458)
+        return f1457(c - b, a);
+    return c + 1458;
+}
+int f1459(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1459)
+        return f1458(c - b, a);
+    return c + 1459;
+}
+int f1460(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1460)
+        return f1459(c - b, a);
+    return c + 1460;
+}
+int f1461(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1461)
+        return f1460(c - b, a);
+    return c + 1461;
+}
+int f1462(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1462)
+        return f1461(c - b, a);
+    return c + 1462;
+}
+int f1463(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1463)
+        return f1462(c - b, a);
+    return c + 1463;
+}
+int f1464(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1464)
+        return f1463(c - b, a);
+    return c + 1464;
+}
+int f1465(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1465)
+        return f1464(c - b, a);
+    return c + 1465;
+}
+int f1466(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1466)
+        return f1465(c - b, a);
+    return c + 1466;
+}
+int f1467(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1467)
+        return f1466(c - b, a);
+    return c + 1467;
+}
+int f1468(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1468)
+        return f1467(c - b, a);
+    return c + 1468;
+}
+int f1469(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1469)
+        return f1468(c - b, a);
+    return c + 1469;
+}
+int f1470(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1470)
+        return f1469(c - b, a);
+    return c + 1470;
+}
+int f1471(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1471)
+        return f1470(c - b, a);
+    return c + 1471;
+}
+int f1472(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1472)
+        return f1471(c - b, a);
+    return c + 1472;
+}
+int f1473(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1473)
+        return f1472(c - b, a);
+    return c + 1473;
+}
+int f1474(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1474)
+        return f1473(c - b, a);
+    return c + 1474;
+}
+int f1475(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1475)
+        return f1474(c - b, a);
+    return c + 1475;
+}
+int f1476(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1476)
+        return f1475(c - b, a);
+    return c + 1476;
+}
+int f1477(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1477)
+        return f1476(c - b, a);
+    return c + 1477;
+}
+int f1478(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1478)
+        return f1477(c - b, a);
+    return c + 1478;
+}
+int f1479(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1479)
+        return f1478(c - b, a);
+    return c + 1479;
+}
+int f1480(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1480)
+        return f1479(c - b, a);
+    return c + 1480;
+}
+int f1481(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1481)
+        return f1480(c - b, a);
+    return c + 1481;
+}
+int f1482(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1482)
+        return f1481(c - b, a);
+    return c + 1482;
+}
+int f1483(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1483)
+        return f1482(c - b, a);
+    return c + 1483;
+}
+int f1484(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1484)
+        return f1483(c - b, a);
+    return c + 1484;
+}
+int f1485(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1485)
+        return f1484(c - b, a);
+    return c + 1485;
+}
+int f1486(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1486)
+        return f1485(c - b, a);
+    return c + 1486;
+}
+int f1487(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1487)
+        return f1486(c - b, a);
+    return c + 1487;
+}
+int f1488(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1488)
+        return f1487(c - b, a);
+    return c + 1488;
+}
+int f1489(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1489)
+        return f1488(c - b, a);
+    return c + 1489;
+}
+int f1490(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1490)
+        return f1489(c - b, a);
+    return c + 1490;
+}
+int f1491(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1491)
+        return f1490(c - b, a);
+    return c + 1491;
+}
+int f1492(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1492)
+        return f1491(c - b, a);
+    return c + 1492;
+}
+int f1493(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1493)
+        return f1492(c - b, a);
+    return c + 1493;
+}
+int f1494(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1494)
+        return f1493(c - b, a);
+    return c + 1494;
+}
+int f1495(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1495)
+        return f1494(c - b, a);
+    return c + 1495;
+}
+int f1496(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1496)
+        return f1495(c - b, a);
+    return c + 1496;
+}
+int f1497(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1497)
+        return f1496(c - b, a);
+    return c + 1497;
+}
+int f1498(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1498)
+        return f1497(c - b, a);
+    return c + 1498;
+}
+int f1499(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1499)
+        return f1498(c - b, a);
+    return c + 1499;
+}
+int f1500(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1500)
+        return f1499(c - b, a);
+    return c + 1500;
+}
+int f1501(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1501)
+        return f1500(c - b, a);
+    return c + 1501;
+}
+int f1502(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1502)
+        return f1501(c - b, a);
+    return c + 1502;
+}
+int f1503(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1503)
+        return f1502(c - b, a);
+    return c + 1503;
+}
+int f1504(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1504)
+        return f1503(c - b, a);
+    return c + 1504;
+}
+int f1505(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1505)
+        return f1504(c - b, a);
+    return c + 1505;
+}
+int f1506(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1506)
+        return f1505(c - b, a);
+    return c + 1506;
+}
+int f1507(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1507)
+        return f1506(c - b, a);
+    return c + 1507;
+}
+int f1508(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1508)
+        return f1507(c - b, a);
+    return c + 1508;
+}
+int f1509(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1509)
+        return f1508(c - b, a);
+    return c + 1509;
+}
+int f1510(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1510)
+        return f1509(c - b, a);
+    return c + 1510;
+}
+int f1511(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1511)
+        return f1510(c - b, a);
+    return c + 1511;
+}
+int f1512(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1512)
+        return f1511(c - b, a);
+    return c + 1512;
+}
+int f1513(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1513)
+        return f1512(c - b, a);
+    return c + 1513;
+}
+int f1514(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1514)
+        return f1513(c - b, a);
+    return c + 1514;
+}
+int f1515(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1515)
+        return f1514(c - b, a);
+    return c + 1515;
+}
+int f1516(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1516)
+        return f1515(c - b, a);
+    return c + 1516;
+}
+int f1517(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1517)
+        return f1516(c - b, a);
+    return c + 1517;
+}
+int f1518(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1518)
+        return f1517(c - b, a);
+    return c + 1518;
+}
+int f1519(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1519)
+        return f1518(c - b, a);
+    return c + 1519;
+}
+int f1520(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1520)
+        return f1519(c - b, a);
+    return c + 1520;
+}
+int f1521(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1521)
+        return f1520(c - b, a);
+    return c + 1521;
+}
+int f1522(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1522)
+        return f1521(c - b, a);
+    return c + 1522;
+}
+int f1523(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1523)
+        return f1522(c - b, a);
+    return c + 1523;
+}
+int f1524(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1524)
+        return f1523(c - b, a);
+    return c + 1524;
+}
+int f1525(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1525)
+        return f1524(c - b, a);
+    return c + 1525;
+}
+int f1526(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1526)
+        return f1525(c - b, a);
+    return c + 1526;
+}
+int f1527(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1527)
+        return f1526(c - b, a);
+    return c + 1527;
+}
+int f1528(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1528)
+        return f1527(c - b, a);
+    return c + 1528;
+}
+int f1529(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1529)
+        return f1528(c - b, a);
+    return c + 1529;
+}
+int f1530(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1530)
+        return f1529(c - b, a);
+    return c + 1530;
+}
+int f1531(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1531)
+        return f1530(c - b, a);
+    return c + 1531;
+}
+int f1532(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1532)
+        return f1531(c - b, a);
+    return c + 1532;
+}
+int f1533(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1533)
+        return f1532(c - b, a);
+    return c + 1533;
+}
+int f1534(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1534)
+        return f1533(c - b, a);
+    return c + 1534;
+}
+int f1535(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1535)
+        return f1534(c - b, a);
+    return c + 1535;
+}
+int f1536(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1536)
+        return f1535(c - b, a);
+    return c + 1536;
+}
+int f1537(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1537)
+        return f1536(c - b, a);
+    return c + 1537;
+}
+int f1538(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1538)
+        return f1537(c - b, a);
+    return c + 1538;
+}
+int f1539(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1539)
+        return f1538(c - b, a);
+    return c + 1539;
+}
+int f1540(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1540)
+        return f1539(c - b, a);
+    return c + 1540;
+}
+int f1541(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1541)
+        return f1540(c - b, a);
+    return c + 1541;
+}
+int f1542(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1542)
+        return f1541(c - b, a);
+    return c + 1542;
+}
+int f1543(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1543)
+        return f1542(c - b, a);
+    return c + 1543;
+}
+int f1544(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1544)
+        return f1543(c - b, a);
+    return c + 1544;
+}
+int f1545(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1545)
+        return f1544(c - b, a);
+    return c + 1545;
+}
+int f1546(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1546)
+        return f1545(c - b, a);
+    return c + 1546;
+}
+int f1547(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1547)
+        return f1546(c - b, a);
+    return c + 1547;
+}
+int f1548(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1548)
+        return f1547(c - b, a);
+    return c + 1548;
+}
+int f1549(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1549)
+        return f1548(c - b, a);
+    return c + 1549;
+}
+int f1550(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1550)
+        return f1549(c - b, a);
+    return c + 1550;
+}
+int f1551(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1551)
+        return f1550(c - b, a);
+    return c + 1551;
+}
+int f1552(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1552)
+        return f1551(c - b, a);
+    return c + 1552;
+}
+int f1553(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1553)
+        return f1552(c - b, a);
+    return c + 1553;
+}
+int f1554(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1554)
+        return f1553(c - b, a);
+    return c + 1554;
+}
+int f1555(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1555)
+        return f1554(c - b, a);
+    return c + 1555;
+}
+int f1556(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1556)
+        return f1555(c - b, a);
+    return c + 1556;
+}
+int f1557(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1557)
+        return f1556(c - b, a);
+    return c + 1557;
+}
+int f1558(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1558)
+        return f1557(c - b, a);
+    return c + 1558;
+}
+int f1559(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1559)
+        return f1558(c - b, a);
+    return c + 1559;
+}
+int f1560(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1560)
+        return f1559(c - b, a);
+    return c + 1560;
+}
+int f1561(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1561)
+        return f1560(c - b, a);
+    return c + 1561;
+}
+int f1562(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1562)
+        return f1561(c - b, a);
+    return c + 1562;
+}
+int f1563(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1563)
+        return f1562(c - b, a);
+    return c + 1563;
+}
+int f1564(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1564)
+        return f1563(c - b, a);
+    return c + 1564;
+}
+int f1565(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1565)
+        return f1564(c - b, a);
+    return c + 1565;
+}
+int f1566(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1566)
+        return f1565(c - b, a);
+    return c + 1566;
+}
+int f1567(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1567)
+        return f1566(c - b, a);
+    return c + 1567;
+}
+int f1568(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1568)
+        return f1567(c - b, a);
+    return c + 1568;
+}
+int f1569(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1569)
+        return f1568(c - b, a);
+    return c + 1569;
+}
+int f1570(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1570)
+        return f1569(c - b, a);
+    return c + 1570;
+}
+int f1571(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1571)
+        return f1570(c - b, a);
+    return c + 1571;
+}
+int f1572(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1572)
+        return f1571(c - b, a);
+    return c + 1572;
+}
+int f1573(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1573)
+        return f1572(c - b, a);
+    return c + 1573;
+}
+int f1574(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1574)
+        return f1573(c - b, a);
+    return c + 1574;
+}
+int f1575(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1575)
+        return f1574(c - b, a);
+    return c + 1575;
+}
+int f1576(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1576)
+        return f1575(c - b, a);
+    return c + 1576;
+}
+int f1577(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1577)
+        return f1576(c - b, a);
+    return c + 1577;
+}
+int f1578(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1578)
+        return f1577(c - b, a);
+    return c + 1578;
+}
+int f1579(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1579)
+        return f1578(c - b, a);
+    return c + 1579;
+}
+int f1580(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1580)
+        return f1579(c - b, a);
+    return c + 1580;
+}
+int f1581(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1581)
+        return f1580(c - b, a);
+    return c + 1581;
+}
+int f1582(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1582)
+        return f1581(c - b, a);
+    return c + 1582;
+}
+int f1583(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1583)
+        return f1582(c - b, a);
+    return c + 1583;
+}
+int f1584(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1584)
+        return f1583(c - b, a);
+    return c + 1584;
+}
+int f1585(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1585)
+        return f1584(c - b, a);
+    return c + 1585;
+}
+int f1586(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1586)
+        return f1585(c - b, a);
+    return c + 1586;
+}
+int f1587(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1587)
+        return f1586(c - b, a);
+    return c + 1587;
+}
+int f1588(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1588)
+        return f1587(c - b, a);
+    return c + 1588;
+}
+int f1589(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1589)
+        return f1588(c - b, a);
+    return c + 1589;
+}
+int f1590(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1590)
+        return f1589(c - b, a);
+    return c + 1590;
+}
+int f1591(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1591)
+        return f1590(c - b, a);
+    return c + 1591;
+}
+int f1592(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1592)
+        return f1591(c - b, a);
+    return c + 1592;
+}
+int f1593(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1593)
+        return f1592(c - b, a);
+    return c + 1593;
+}
+int f1594(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1594)
+        return f1593(c - b, a);
+    return c + 1594;
+}
+int f1595(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1595)
+        return f1594(c - b, a);
+    return c + 1595;
+}
+int f1596(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1596)
+        return f1595(c - b, a);
+    return c + 1596;
+}
+int f1597(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1597)
+        return f1596(c - b, a);
+    return c + 1597;
+}
+int f1598(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1598)
+        return f1597(c - b, a);
+    return c + 1598;
+}
+int f1599(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1599)
+        return f1598(c - b, a);
+    return c + 1599;
+}
+int f1600(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1600)
+        return f1599(c - b, a);
+    return c + 1600;
+}
+int f1601(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1601)
+        return f1600(c - b, a);
+    return c + 1601;
+}
+int f1602(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1602)
+        return f1601(c - b, a);
+    return c + 1602;
+}
+int f1603(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1603)
+        return f1602(c - b, a);
+    return c + 1603;
+}
+int f1604(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1604)
+        return f1603(c - b, a);
+    return c + 1604;
+}
+int f1605(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1605)
+        return f1604(c - b, a);
+    return c + 1605;
+}
+int f1606(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1606)
+        return f1605(c - b, a);
+    return c + 1606;
+}
+int f1607(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1607)
+        return f1606(c - b, a);
+    return c + 1607;
+}
+int f1608(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1608)
+        return f1607(c - b, a);
+    return c + 1608;
+}
+int f1609(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1609)
+        return f1608(c - b, a);
+    return c + 1609;
+}
+int f1610(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1610)
+        return f1609(c - b, a);
+    return c + 1610;
+}
+int f1611(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1611)
+        return f1610(c - b, a);
+    return c + 1611;
+}
+int f1612(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1612)
+        return f1611(c - b, a);
+    return c + 1612;
+}
+int f1613(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1613)
+        return f1612(c - b, a);
+    return c + 1613;
+}
+int f1614(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1614)
+        return f1613(c - b, a);
+    return c + 1614;
+}
+int f1615(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1615)
+        return f1614(c - b, a);
+    return c + 1615;
+}
+int f1616(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1616)
+        return f1615(c - b, a);
+    return c + 1616;
+}
+int f1617(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1617)
+        return f1616(c - b, a);
+    return c + 1617;
+}
+int f1618(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1618)
+        return f1617(c - b, a);
+    return c + 1618;
+}
+int f1619(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1619)
+        return f1618(c - b, a);
+    return c + 1619;
+}
+int f1620(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1620)
+        return f1619(c - b, a);
+    return c + 1620;
+}
+int f1621(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1621)
+        return f1620(c - b, a);
+    return c + 1621;
+}
+int f1622(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1622)
+        return f1621(c - b, a);
+    return c + 1622;
+}
+int f1623(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1623)
+        return f1622(c - b, a);
+    return c + 1623;
+}
+int f1624(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1624)
+        return f1623(c - b, a);
+    return c + 1624;
+}
+int f1625(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1625)
+        return f1624(c - b, a);
+    return c + 1625;
+}
+int f1626(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1626)
+        return f1625(c - b, a);
+    return c + 1626;
+}
+int f1627(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1627)
+        return f1626(c - b, a);
+    return c + 1627;
+}
+int f1628(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1628)
+        return f1627(c - b, a);
+    return c + 1628;
+}
+int f1629(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1629)
+        return f1628(c - b, a);
+    return c + 1629;
+}
+int f1630(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1630)
+        return f1629(c - b, a);
+    return c + 1630;
+}
+int f1631(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1631)
+        return f1630(c - b, a);
+    return c + 1631;
+}
+int f1632(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1632)
+        return f1631(c - b, a);
+    return c + 1632;
+}
+int f1633(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1633)
+        return f1632(c - b, a);
+    return c + 1633;
+}
+int f1634(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1634)
+        return f1633(c - b, a);
+    return c + 1634;
+}
+int f1635(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1635)
+        return f1634(c - b, a);
+    return c + 1635;
+}
+int f1636(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1636)
+        return f1635(c - b, a);
+    return c + 1636;
+}
+int f1637(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1637)
+        return f1636(c - b, a);
+    return c + 1637;
+}
+int f1638(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1638)
+        return f1637(c - b, a);
+    return c + 1638;
+}
+int f1639(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1639)
+        return f1638(c - b, a);
+    return c + 1639;
+}
+int f1640(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1640)
+        return f1639(c - b, a);
+    return c + 1640;
+}
+int f1641(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1641)
+        return f1640(c - b, a);
+    return c + 1641;
+}
+int f1642(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1642)
+        return f1641(c - b, a);
+    return c + 1642;
+}
+int f1643(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1643)
+        return f1642(c - b, a);
+    return c + 1643;
+}
+int f1644(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1644)
+        return f1643(c - b, a);
+    return c + 1644;
+}
+int f1645(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1645)
+        return f1644(c - b, a);
+    return c + 1645;
+}
+int f1646(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1646)
+        return f1645(c - b, a);
+    return c + 1646;
+}
+int f1647(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1647)
+        return f1646(c - b, a);
+    return c + 1647;
+}
+int f1648(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1648)
+        return f1647(c - b, a);
+    return c + 1648;
+}
+int f1649(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1649)
+        return f1648(c - b, a);
+    return c + 1649;
+}
+int f1650(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1650)
+        return f1649(c - b, a);
+    return c + 1650;
+}
+int f1651(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1651)
+        return f1650(c - b, a);
+    return c + 1651;
+}
+int f1652(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1652)
+        return f1651(c - b, a);
+    return c + 1652;
+}
+int f1653(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1653)
+        return f1652(c - b, a);
+    return c + 1653;
+}
+int f1654(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1654)
+        return f1653(c - b, a);
+    return c + 1654;
+}
+int f1655(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1655)
+        return f1654(c - b, a);
+    return c + 1655;
+}
+int f1656(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1656)
+        return f1655(c - b, a);
+    return c + 1656;
+}
+int f1657(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1657)
+        return f1656(c - b, a);
+    return c + 1657;
+}
+int f1658(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1658)
+        return f1657(c - b, a);
+    return c + 1658;
+}
+int f1659(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1659)
+        return f1658(c - b, a);
+    return c + 1659;
+}
+int f1660(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1660)
+        return f1659(c - b, a);
+    return c + 1660;
+}
+int f1661(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1661)
+        return f1660(c - b, a);
+    return c + 1661;
+}
+int f1662(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1662)
+        return f1661(c - b, a);
+    return c + 1662;
+}
+int f1663(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1663)
+        return f1662(c - b, a);
+    return c + 1663;
+}
+int f1664(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1664)
+        return f1663(c - b, a);
+    return c + 1664;
+}
+int f1665(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1665)
+        return f1664(c - b, a);
+    return c + 1665;
+}
+int f1666(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1666)
+        return f1665(c - b, a);
+    return c + 1666;
+}
+int f1667(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1667)
+        return f1666(c - b, a);
+    return c + 1667;
+}
+int f1668(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1668)
+        return f1667(c - b, a);
+    return c + 1668;
+}
+int f1669(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1669)
+        return f1668(c - b, a);
+    return c + 1669;
+}
+int f1670(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1670)
+        return f1669(c - b, a);
+    return c + 1670;
+}
+int f1671(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1671)
+        return f1670(c - b, a);
+    return c + 1671;
+}
+int f1672(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1672)
+        return f1671(c - b, a);
+    return c + 1672;
+}
+int f1673(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1673)
+        return f1672(c - b, a);
+    return c + 1673;
+}
+int f1674(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1674)
+        return f1673(c - b, a);
+    return c + 1674;
+}
+int f1675(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1675)
+        return f1674(c - b, a);
+    return c + 1675;
+}
+int f1676(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1676)
+        return f1675(c - b, a);
+    return c + 1676;
+}
+int f1677(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1677)
+        return f1676(c - b, a);
+    return c + 1677;
+}
+int f1678(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1678)
+        return f1677(c - b, a);
+    return c + 1678;
+}
+int f1679(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1679)
+        return f1678(c - b, a);
+    return c + 1679;
+}
+int f1680(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1680)
+        return f1679(c - b, a);
+    return c + 1680;
+}
+int f1681(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1681)
+        return f1680(c - b, a);
+    return c + 1681;
+}
+int f1682(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1682)
+        return f1681(c - b, a);
+    return c + 1682;
+}
+int f1683(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1683)
+        return f1682(c - b, a);
+    return c + 1683;
+}
+int f1684(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1684)
+        return f1683(c - b, a);
+    return c + 1684;
+}
+int f1685(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1685)
+        return f1684(c - b, a);
+    return c + 1685;
+}
+int f1686(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1686)
+        return f1685(c - b, a);
+    return c + 1686;
+}
+int f1687(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1687)
+        return f1686(c - b, a);
+    return c + 1687;
+}
+int f1688(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1688)
+        return f1687(c - b, a);
+    return c + 1688;
+}
+int f1689(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1689)
+        return f1688(c - b, a);
+    return c + 1689;
+}
+int f1690(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1690)
+        return f1689(c - b, a);
+    return c + 1690;
+}
+int f1691(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1691)
+        return f1690(c - b, a);
+    return c + 1691;
+}
+int f1692(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1692)
+        return f1691(c - b, a);
+    return c + 1692;
+}
+int f1693(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1693)
+        return f1692(c - b, a);
+    return c + 1693;
+}
+int f1694(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1694)
+        return f1693(c - b, a);
+    return c + 1694;
+}
+int f1695(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1695)
+        return f1694(c - b, a);
+    return c + 1695;
+}
+int f1696(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1696)
+        return f1695(c - b, a);
+    return c + 1696;
+}
+int f1697(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1697)
+        return f1696(c - b, a);
+    return c + 1697;
+}
+int f1698(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1698)
+        return f1697(c - b, a);
+    return c + 1698;
+}
+int f1699(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1699)
+        return f1698(c - b, a);
+    return c + 1699;
+}
+int f1700(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1700)
+        return f1699(c - b, a);
+    return c + 1700;
+}
+int f1701(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1701)
+        return f1700(c - b, a);
+    return c + 1701;
+}
+int f1702(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1702)
+        return f1701(c - b, a);
+    return c + 1702;
+}
+int f1703(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1703)
+        return f1702(c - b, a);
+    return c + 1703;
+}
+int f1704(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1704)
+        return f1703(c - b, a);
+    return c + 1704;
+}
+int f1705(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1705)
+        return f1704(c - b, a);
+    return c + 1705;
+}
+int f1706(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1706)
+        return f1705(c - b, a);
+    return c + 1706;
+}
+int f1707(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1707)
+        return f1706(c - b, a);
+    return c + 1707;
+}
+int f1708(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1708)
+        return f1707(c - b, a);
+    return c + 1708;
+}
+int f1709(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1709)
+        return f1708(c - b, a);
+    return c + 1709;
+}
+int f1710(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1710)
+        return f1709(c - b, a);
+    return c + 1710;
+}
+int f1711(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1711)
+        return f1710(c - b, a);
+    return c + 1711;
+}
+int f1712(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1712)
+        return f1711(c - b, a);
+    return c + 1712;
+}
+int f1713(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1713)
+        return f1712(c - b, a);
+    return c + 1713;
+}
+int f1714(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1714)
+        return f1713(c - b, a);
+    return c + 1714;
+}
+int f1715(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1715)
+        return f1714(c - b, a);
+    return c + 1715;
+}
+int f1716(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1716)
+        return f1715(c - b, a);
+    return c + 1716;
+}
+int f1717(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1717)
+        return f1716(c - b, a);
+    return c + 1717;
+}
+int f1718(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1718)
+        return f1717(c - b, a);
+    return c + 1718;
+}
+int f1719(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1719)
+        return f1718(c - b, a);
+    return c + 1719;
+}
+int f1720(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1720)
+        return f1719(c - b, a);
+    return c + 1720;
+}
+int f1721(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1721)
+        return f1720(c - b, a);
+    return c + 1721;
+}
+int f1722(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1722)
+        return f1721(c - b, a);
+    return c + 1722;
+}
+int f1723(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1723)
+        return f1722(c - b, a);
+    return c + 1723;
+}
+int f1724(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1724)
+        return f1723(c - b, a);
+    return c + 1724;
+}
+int f1725(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1725)
+        return f1724(c - b, a);
+    return c + 1725;
+}
+int f1726(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1726)
+        return f1725(c - b, a);
+    return c + 1726;
+}
+int f1727(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1727)
+        return f1726(c - b, a);
+    return c + 1727;
+}
+int f1728(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1728)
+        return f1727(c - b, a);
+    return c + 1728;
+}
+int f1729(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1729)
+        return f1728(c - b, a);
+    return c + 1729;
+}
+int f1730(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1730)
+        return f1729(c - b, a);
+    return c + 1730;
+}
+int f1731(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1731)
+        return f1730(c - b, a);
+    return c + 1731;
+}
+int f1732(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1732)
+        return f1731(c - b, a);
+    return c + 1732;
+}
+int f1733(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1733)
+        return f1732(c - b, a);
+    return c + 1733;
+}
+int f1734(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1734)
+        return f1733(c - b, a);
+    return c + 1734;
+}
+int f1735(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1735)
+        return f1734(c - b, a);
+    return c + 1735;
+}
+int f1736(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1736)
+        return f1735(c - b, a);
+    return c + 1736;
+}
+int f1737(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1737)
+        return f1736(c - b, a);
+    return c + 1737;
+}
+int f1738(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1738)
+        return f1737(c - b, a);
+    return c + 1738;
+}
+int f1739(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1739)
+        return f1738(c - b, a);
+    return c + 1739;
+}
+int f1740(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1740)
+        return f1739(c - b, a);
+    return c + 1740;
+}
+int f1741(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1741)
+        return f1740(c - b, a);
+    return c + 1741;
+}
+int f1742(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1742)
+        return f1741(c - b, a);
+    return c + 1742;
+}
+int f1743(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1743)
+        return f1742(c - b, a);
+    return c + 1743;
+}
+int f1744(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1744)
+        return f1743(c - b, a);
+    return c + 1744;
+}
+int f1745(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1745)
+        return f1744(c - b, a);
+    return c + 1745;
+}
+int f1746(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1746)
+        return f1745(c - b, a);
+    return c + 1746;
+}
+int f1747(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1747)
+        return f1746(c - b, a);
+    return c + 1747;
+}
+int f1748(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1748)
+        return f1747(c - b, a);
+    return c + 1748;
+}
+int f1749(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1749)
+        return f1748(c - b, a);
+    return c + 1749;
+}
+int f1750(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1750)
+        return f1749(c - b, a);
+    return c + 1750;
+}
+int f1751(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1751)
+        return f1750(c - b, a);
+    return c + 1751;
+}
+int f1752(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1752)
+        return f1751(c - b, a);
+    return c + 1752;
+}
+int f1753(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1753)
+        return f1752(c - b, a);
+    return c + 1753;
+}
+int f1754(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1754)
+        return f1753(c - b, a);
+    return c + 1754;
+}
+int f1755(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1755)
+        return f1754(c - b, a);
+    return c + 1755;
+}
+int f1756(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1756)
+        return f1755(c - b, a);
+    return c + 1756;
+}
+int f1757(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1757)
+        return f1756(c - b, a);
+    return c + 1757;
+}
+int f1758(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1758)
+        return f1757(c - b, a);
+    return c + 1758;
+}
+int f1759(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1759)
+        return f1758(c - b, a);
+    return c + 1759;
+}
+int f1760(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1760)
+        return f1759(c - b, a);
+    return c + 1760;
+}
+int f1761(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1761)
+        return f1760(c - b, a);
+    return c + 1761;
+}
+int f1762(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1762)
+        return f1761(c - b, a);
+    return c + 1762;
+}
+int f1763(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1763)
+        return f1762(c - b, a);
+    return c + 1763;
+}
+int f1764(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1764)
+        return f1763(c - b, a);
+    return c + 1764;
+}
+int f1765(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1765)
+        return f1764(c - b, a);
+    return c + 1765;
+}
+int f1766(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1766)
+        return f1765(c - b, a);
+    return c + 1766;
+}
+int f1767(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1767)
+        return f1766(c - b, a);
+    return c + 1767;
+}
+int f1768(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1768)
+        return f1767(c - b, a);
+    return c + 1768;
+}
+int f1769(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1769)
+        return f1768(c - b, a);
+    return c + 1769;
+}
+int f1770(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1770)
+        return f1769(c - b, a);
+    return c + 1770;
+}
+int f1771(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1771)
+        return f1770(c - b, a);
+    return c + 1771;
+}
+int f1772(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1772)
+        return f1771(c - b, a);
+    return c + 1772;
+}
+int f1773(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1773)
+        return f1772(c - b, a);
+    return c + 1773;
+}
+int f1774(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1774)
+        return f1773(c - b, a);
+    return c + 1774;
+}
+int f1775(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1775)
+        return f1774(c - b, a);
+    return c + 1775;
+}
+int f1776(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1776)
+        return f1775(c - b, a);
+    return c + 1776;
+}
+int f1777(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1777)
+        return f1776(c - b, a);
+    return c + 1777;
+}
+int f1778(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1778)
+        return f1777(c - b, a);
+    return c + 1778;
+}
+int f1779(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1779)
+        return f1778(c - b, a);
+    return c + 1779;
+}
+int f1780(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1780)
+        return f1779(c - b, a);
+    return c + 1780;
+}
+int f1781(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1781)
+        return f1780(c - b, a);
+    return c + 1781;
+}
+int f1782(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1782)
+        return f1781(c - b, a);
+    return c + 1782;
+}
+int f1783(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1783)
+        return f1782(c - b, a);
+    return c + 1783;
+}
+int f1784(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1784)
+        return f1783(c - b, a);
+    return c + 1784;
+}
+int f1785(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1785)
+        return f1784(c - b, a);
+    return c + 1785;
+}
+int f1786(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1786)
+        return f1785(c - b, a);
+    return c + 1786;
+}
+int f1787(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1787)
+        return f1786(c - b, a);
+    return c + 1787;
+}
+int f1788(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1788)
+        return f1787(c - b, a);
+    return c + 1788;
+}
+int f1789(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1789)
+        return f1788(c - b, a);
+    return c + 1789;
+}
+int f1790(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1790)
+        return f1789(c - b, a);
+    return c + 1790;
+}
+int f1791(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1791)
+        return f1790(c - b, a);
+    return c + 1791;
+}
+int f1792(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1792)
+        return f1791(c - b, a);
+    return c + 1792;
+}
+int f1793(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1793)
+        return f1792(c - b, a);
+    return c + 1793;
+}
+int f1794(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1794)
+        return f1793(c - b, a);
+    return c + 1794;
+}
+int f1795(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1795)
+        return f1794(c - b, a);
+    return c + 1795;
+}
+int f1796(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1796)
+        return f1795(c - b, a);
+    return c + 1796;
+}
+int f1797(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1797)
+        return f1796(c - b, a);
+    return c + 1797;
+}
+int f1798(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1798)
+        return f1797(c - b, a);
+    return c + 1798;
+}
+int f1799(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1799)
+        return f1798(c - b, a);
+    return c + 1799;
+}
+int f1800(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1800)
+        return f1799(c - b, a);
+    return c + 1800;
+}
+int f1801(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1801)
+        return f1800(c - b, a);
+    return c + 1801;
+}
+int f1802(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1802)
+        return f1801(c - b, a);
+    return c + 1802;
+}
+int f1803(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1803)
+        return f1802(c - b, a);
+    return c + 1803;
+}
+int f1804(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1804)
+        return f1803(c - b, a);
+    return c + 1804;
+}
+int f1805(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1805)
+        return f1804(c - b, a);
+    return c + 1805;
+}
+int f1806(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1806)
+        return f1805(c - b, a);
+    return c + 1806;
+}
+int f1807(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1807)
+        return f1806(c - b, a);
+    return c + 1807;
+}
+int f1808(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1808)
+        return f1807(c - b, a);
+    return c + 1808;
+}
+int f1809(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1809)
+        return f1808(c - b, a);
+    return c + 1809;
+}
+int f1810(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1810)
+        return f1809(c - b, a);
+    return c + 1810;
+}
+int f1811(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1811)
+        return f1810(c - b, a);
+    return c + 1811;
+}
+int f1812(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1812)
+        return f1811(c - b, a);
+    return c + 1812;
+}
+int f1813(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1813)
+        return f1812(c - b, a);
+    return c + 1813;
+}
+int f1814(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1814)
+        return f1813(c - b, a);
+    return c + 1814;
+}
+int f1815(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1815)
+        return f1814(c - b, a);
+    return c + 1815;
+}
+int f1816(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1816)
+        return f1815(c - b, a);
+    return c + 1816;
+}
+int f1817(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1817)
+        return f1816(c - b, a);
+    return c + 1817;
+}
+int f1818(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1818)
+        return f1817(c - b, a);
+    return c + 1818;
+}
+int f1819(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1819)
+        return f1818(c - b, a);
+    return c + 1819;
+}
+int f1820(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1820)
+        return f1819(c - b, a);
+    return c + 1820;
+}
+int f1821(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1821)
+        return f1820(c - b, a);
+    return c + 1821;
+}
+int f1822(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1822)
+        return f1821(c - b, a);
+    return c + 1822;
+}
+int f1823(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1823)
+        return f1822(c - b, a);
+    return c + 1823;
+}
+int f1824(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1824)
+        return f1823(c - b, a);
+    return c + 1824;
+}
+int f1825(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1825)
+        return f1824(c - b, a);
+    return c + 1825;
+}
+int f1826(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1826)
+        return f1825(c - b, a);
+    return c + 1826;
+}
+int f1827(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1827)
+        return f1826(c - b, a);
+    return c + 1827;
+}
+int f1828(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1828)
+        return f1827(c - b, a);
+    return c + 1828;
+}
+int f1829(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1829)
+        return f1828(c - b, a);
+    return c + 1829;
+}
+int f1830(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1830)
+        return f1829(c - b, a);
+    return c + 1830;
+}
+int f1831(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1831)
+        return f1830(c - b, a);
+    return c + 1831;
+}
+int f1832(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1832)
+        return f1831(c - b, a);
+    return c + 1832;
+}
+int f1833(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1833)
+        return f1832(c - b, a);
+    return c + 1833;
+}
+int f1834(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1834)
+        return f1833(c - b, a);
+    return c + 1834;
+}
+int f1835(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1835)
+        return f1834(c - b, a);
+    return c + 1835;
+}
+int f1836(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1836)
+        return f1835(c - b, a);
+    return c + 1836;
+}
+int f1837(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1837)
+        return f1836(c - b, a);
+    return c + 1837;
+}
+int f1838(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1838)
+        return f1837(c - b, a);
+    return c + 1838;
+}
+int f1839(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1839)
+        return f1838(c - b, a);
+    return c + 1839;
+}
+int f1840(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1840)
+        return f1839(c - b, a);
+    return c + 1840;
+}
+int f1841(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1841)
+        return f1840(c - b, a);
+    return c + 1841;
+}
+int f1842(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1842)
+        return f1841(c - b, a);
+    return c + 1842;
+}
+int f1843(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1843)
+        return f1842(c - b, a);
+    return c + 1843;
+}
+int f1844(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1844)
+        return f1843(c - b, a);
+    return c + 1844;
+}
+int f1845(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1845)
+        return f1844(c - b, a);
+    return c + 1845;
+}
+int f1846(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1846)
+        return f1845(c - b, a);
+    return c + 1846;
+}
+int f1847(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1847)
+        return f1846(c - b, a);
+    return c + 1847;
+}
+int f1848(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1848)
+        return f1847(c - b, a);
+    return c + 1848;
+}
+int f1849(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1849)
+        return f1848(c - b, a);
+    return c + 1849;
+}
+int f1850(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1850)
+        return f1849(c - b, a);
+    return c + 1850;
+}
+int f1851(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1851)
+        return f1850(c - b, a);
+    return c + 1851;
+}
+int f1852(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1852)
+        return f1851(c - b, a);
+    return c + 1852;
+}
+int f1853(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1853)
+        return f1852(c - b, a);
+    return c + 1853;
+}
+int f1854(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1854)
+        return f1853(c - b, a);
+    return c + 1854;
+}
+int f1855(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1855)
+        return f1854(c - b, a);
+    return c + 1855;
+}
+int f1856(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1856)
+        return f1855(c - b, a);
+    return c + 1856;
+}
+int f1857(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1857)
+        return f1856(c - b, a);
+    return c + 1857;
+}
+int f1858(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1858)
+        return f1857(c - b, a);
+    return c + 1858;
+}
+int f1859(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1859)
+        return f1858(c - b, a);
+    return c + 1859;
+}
+int f1860(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1860)
+        return f1859(c - b, a);
+    return c + 1860;
+}
+int f1861(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1861)
+        return f1860(c - b, a);
+    return c + 1861;
+}
+int f1862(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1862)
+        return f1861(c - b, a);
+    return c + 1862;
+}
+int f1863(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1863)
+        return f1862(c - b, a);
+    return c + 1863;
+}
+int f1864(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1864)
+        return f1863(c - b, a);
+    return c + 1864;
+}
+int f1865(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1865)
+        return f1864(c - b, a);
+    return c + 1865;
+}
+int f1866(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1866)
+        return f1865(c - b, a);
+    return c + 1866;
+}
+int f1867(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1867)
+        return f1866(c - b, a);
+    return c + 1867;
+}
+int f1868(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1868)
+        return f1867(c - b, a);
+    return c + 1868;
+}
+int f1869(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1869)
+        return f1868(c - b, a);
+    return c + 1869;
+}
+int f1870(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1870)
+        return f1869(c - b, a);
+    return c + 1870;
+}
+int f1871(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1871)
+        return f1870(c - b, a);
+    return c + 1871;
+}
+int f1872(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1872)
+        return f1871(c - b, a);
+    return c + 1872;
+}
+int f1873(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1873)
+        return f1872(c - b, a);
+    return c + 1873;
+}
+int f1874(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1874)
+        return f1873(c - b, a);
+    return c + 1874;
+}
+int f1875(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1875)
+        return f1874(c - b, a);
+    return c + 1875;
+}
+int f1876(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1876)
+        return f1875(c - b, a);
+    return c + 1876;
+}
+int f1877(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1877)
+        return f1876(c - b, a);
+    return c + 1877;
+}
+int f1878(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1878)
+        return f1877(c - b, a);
+    return c + 1878;
+}
+int f1879(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1879)
+        return f1878(c - b, a);
+    return c + 1879;
+}
+int f1880(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1880)
+        return f1879(c - b, a);
+    return c + 1880;
+}
+int f1881(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1881)
+        return f1880(c - b, a);
+    return c + 1881;
+}
+int f1882(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1882)
+        return f1881(c - b, a);
+    return c + 1882;
+}
+int f1883(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1883)
+        return f1882(c - b, a);
+    return c + 1883;
+}
+int f1884(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1884)
+        return f1883(c - b, a);
+    return c + 1884;
+}
+int f1885(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1885)
+        return f1884(c - b, a);
+    return c + 1885;
+}
+int f1886(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1886)
+        return f1885(c - b, a);
+    return c + 1886;
+}
+int f1887(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1887)
+        return f1886(c - b, a);
+    return c + 1887;
+}
+int f1888(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1888)
+        return f1887(c - b, a);
+    return c + 1888;
+}
+int f1889(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1889)
+        return f1888(c - b, a);
+    return c + 1889;
+}
+int f1890(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1890)
+        return f1889(c - b, a);
+    return c + 1890;
+}
+int f1891(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1891)
+        return f1890(c - b, a);
+    return c + 1891;
+}
+int f1892(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1892)
+        return f1891(c - b, a);
+    return c + 1892;
+}
+int f1893(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1893)
+        return f1892(c - b, a);
+    return c + 1893;
+}
+int f1894(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1894)
+        return f1893(c - b, a);
+    return c + 1894;
+}
+int f1895(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1895)
+        return f1894(c - b, a);
+    return c + 1895;
+}
+int f1896(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1896)
+        return f1895(c - b, a);
+    return c + 1896;
+}
+int f1897(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1897)
+        return f1896(c - b, a);
+    return c + 1897;
+}
+int f1898(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1898)
+        return f1897(c - b, a);
+    return c + 1898;
+}
+int f1899(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1899)
+        return f1898(c - b, a);
+    return c + 1899;
+}
+int f1900(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1900)
+        return f1899(c - b, a);
+    return c + 1900;
+}
+int f1901(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1901)
+        return f1900(c - b, a);
+    return c + 1901;
+}
+int f1902(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1902)
+        return f1901(c - b, a);
+    return c + 1902;
+}
+int f1903(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1903)
+        return f1902(c - b, a);
+    return c + 1903;
+}
+int f1904(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1904)
+        return f1903(c - b, a);
+    return c + 1904;
+}
+int f1905(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1905)
+        return f1904(c - b, a);
+    return c + 1905;
+}
+int f1906(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1906)
+        return f1905(c - b, a);
+    return c + 1906;
+}
+int f1907(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1907)
+        return f1906(c - b, a);
+    return c + 1907;
+}
+int f1908(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1908)
+        return f1907(c - b, a);
+    return c + 1908;
+}
+int f1909(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1909)
+        return f1908(c - b, a);
+    return c + 1909;
+}
+int f1910(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1910)
+        return f1909(c - b, a);
+    return c + 1910;
+}
+int f1911(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1911)
+        return f1910(c - b, a);
+    return c + 1911;
+}
+int f1912(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1912)
+        return f1911(c - b, a);
+    return c + 1912;
+}
+int f1913(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1913)
+        return f1912(c - b, a);
+    return c + 1913;
+}
+int f1914(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1914)
+        return f1913(c - b, a);
+    return c + 1914;
+}
+int f1915(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1915)
+        return f1914(c - b, a);
+    return c + 1915;
+}
+int f1916(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1916)
+        return f1915(c - b, a);
+    return c + 1916;
+}
+int f1917(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1917)
+        return f1916(c - b, a);
+    return c + 1917;
+}
+int f1918(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1918)
+        return f1917(c - b, a);
+    return c + 1918;
+}
+int f1919(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1919)
+        return f1918(c - b, a);
+    return c + 1919;
+}
+int f1920(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1920)
+        return f1919(c - b, a);
+    return c + 1920;
+}
+int f1921(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1921)
+        return f1920(c - b, a);
+    return c + 1921;
+}
+int f1922(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1922)
+        return f1921(c - b, a);
+    return c + 1922;
+}
+int f1923(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1923)
+        return f1922(c - b, a);
+    return c + 1923;
+}
+int f1924(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1924)
+        return f1923(c - b, a);
+    return c + 1924;
+}
+int f1925(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1925)
+        return f1924(c - b, a);
+    return c + 1925;
+}
+int f1926(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1926)
+        return f1925(c - b, a);
+    return c + 1926;
+}
+int f1927(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1927)
+        return f1926(c - b, a);
+    return c + 1927;
+}
+int f1928(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1928)
+        return f1927(c - b, a);
+    return c + 1928;
+}
+int f1929(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1929)
+        return f1928(c - b, a);
+    return c + 1929;
+}
+int f1930(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1930)
+        return f1929(c - b, a);
+    return c + 1930;
+}
+int f1931(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1931)
+        return f1930(c - b, a);
+    return c + 1931;
+}
+int f1932(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1932)
+        return f1931(c - b, a);
+    return c + 1932;
+}
+int f1933(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1933)
+        return f1932(c - b, a);
+    return c + 1933;
+}
+int f1934(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1934)
+        return f1933(c - b, a);
+    return c + 1934;
+}
+int f1935(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1935)
+        return f1934(c - b, a);
+    return c + 1935;
+}
+int f1936(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1936)
+        return f1935(c - b, a);
+    return c + 1936;
+}
+int f1937(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1937)
+        return f1936(c - b, a);
+    return c + 1937;
+}
+int f1938(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1938)
+        return f1937(c - b, a);
+    return c + 1938;
+}
+int f1939(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1939)
+        return f1938(c - b, a);
+    return c + 1939;
+}
+int f1940(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1940)
+        return f1939(c - b, a);
+    return c + 1940;
+}
+int f1941(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1941)
+        return f1940(c - b, a);
+    return c + 1941;
+}
+int f1942(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1942)
+        return f1941(c - b, a);
+    return c + 1942;
+}
+int f1943(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1943)
+        return f1942(c - b, a);
+    return c + 1943;
+}
+int f1944(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1944)
+        return f1943(c - b, a);
+    return c + 1944;
+}
+int f1945(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1945)
+        return f1944(c - b, a);
+    return c + 1945;
+}
+int f1946(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1946)
+        return f1945(c - b, a);
+    return c + 1946;
+}
+int f1947(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1947)
+        return f1946(c - b, a);
+    return c + 1947;
+}
+int f1948(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1948)
+        return f1947(c - b, a);
+    return c + 1948;
+}
+int f1949(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1949)
+        return f1948(c - b, a);
+    return c + 1949;
+}
+int f1950(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1950)
+        return f1949(c - b, a);
+    return c + 1950;
+}
+int f1951(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1951)
+        return f1950(c - b, a);
+    return c + 1951;
+}
+int f1952(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1952)
+        return f1951(c - b, a);
+    return c + 1952;
+}
+int f1953(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1953)
+        return f1952(c - b, a);
+    return c + 1953;
+}
+int f1954(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1954)
+        return f1953(c - b, a);
+    return c + 1954;
+}
+int f1955(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1955)
+        return f1954(c - b, a);
+    return c + 1955;
+}
+int f1956(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1956)
+        return f1955(c - b, a);
+    return c + 1956;
+}
+int f1957(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1957)
+        return f1956(c - b, a);
+    return c + 1957;
+}
+int f1958(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1958)
+        return f1957(c - b, a);
+    return c + 1958;
+}
+int f1959(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1959)
+        return f1958(c - b, a);
+    return c + 1959;
+}
+int f1960(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1960)
+        return f1959(c - b, a);
+    return c + 1960;
+}
+int f1961(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1961)
+        return f1960(c - b, a);
+    return c + 1961;
+}
+int f1962(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1962)
+        return f1961(c - b, a);
+    return c + 1962;
+}
+int f1963(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1963)
+        return f1962(c - b, a);
+    return c + 1963;
+}
+int f1964(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1964)
+        return f1963(c - b, a);
+    return c + 1964;
+}
+int f1965(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1965)
+        return f1964(c - b, a);
+    return c + 1965;
+}
+int f1966(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1966)
+        return f1965(c - b, a);
+    return c + 1966;
+}
+int f1967(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1967)
+        return f1966(c - b, a);
+    return c + 1967;
+}
+int f1968(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1968)
+        return f1967(c - b, a);
+    return c + 1968;
+}
+int f1969(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1969)
+        return f1968(c - b, a);
+    return c + 1969;
+}
+int f1970(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1970)
+        return f1969(c - b, a);
+    return c + 1970;
+}
+int f1971(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1971)
+        return f1970(c - b, a);
+    return c + 1971;
+}
+int f1972(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1972)
+        return f1971(c - b, a);
+    return c + 1972;
+}
+int f1973(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1973)
+        return f1972(c - b, a);
+    return c + 1973;
+}
+int f1974(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1974)
+        return f1973(c - b, a);
+    return c + 1974;
+}
+int f1975(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1975)
+        return f1974(c - b, a);
+    return c + 1975;
+}
+int f1976(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1976)
+        return f1975(c - b, a);
+    return c + 1976;
+}
+int f1977(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1977)
+        return f1976(c - b, a);
+    return c + 1977;
+}
+int f1978(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1978)
+        return f1977(c - b, a);
+    return c + 1978;
+}
+int f1979(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1979)
+        return f1978(c - b, a);
+    return c + 1979;
+}
+int f1980(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1980)
+        return f1979(c - b, a);
+    return c + 1980;
+}
+int f1981(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1981)
+        return f1980(c - b, a);
+    return c + 1981;
+}
+int f1982(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1982)
+        return f1981(c - b, a);
+    return c + 1982;
+}
+int f1983(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1983)
+        return f1982(c - b, a);
+    return c + 1983;
+}
+int f1984(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1984)
+        return f1983(c - b, a);
+    return c + 1984;
+}
+int f1985(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1985)
+        return f1984(c - b, a);
+    return c + 1985;
+}
+int f1986(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1986)
+        return f1985(c - b, a);
+    return c + 1986;
+}
+int f1987(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1987)
+        return f1986(c - b, a);
+    return c + 1987;
+}
+int f1988(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1988)
+        return f1987(c - b, a);
+    return c + 1988;
+}
+int f1989(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1989)
+        return f1988(c - b, a);
+    return c + 1989;
+}
+int f1990(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1990)
+        return f1989(c - b, a);
+    return c + 1990;
+}
+int f1991(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1991)
+        return f1990(c - b, a);
+    return c + 1991;
+}
+int f1992(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1992)
+        return f1991(c - b, a);
+    return c + 1992;
+}
+int f1993(int a, int b)
+{
+    int c = a * 6 + b;
+    if (c > 1993)
+        return f1992(c - b, a);
+    return c + 1993;
+}
+int f1994(int a, int b)
+{
+    int c = a * 7 + b;
+    if (c > 1994)
+        return f1993(c - b, a);
+    return c + 1994;
+}
+int f1995(int a, int b)
+{
+    int c = a * 1 + b;
+    if (c > 1995)
+        return f1994(c - b, a);
+    return c + 1995;
+}
+int f1996(int a, int b)
+{
+    int c = a * 2 + b;
+    if (c > 1996)
+        return f1995(c - b, a);
+    return c + 1996;
+}
+int f1997(int a, int b)
+{
+    int c = a * 3 + b;
+    if (c > 1997)
+        return f1996(c - b, a);
+    return c + 1997;
+}
+int f1998(int a, int b)
+{
+    int c = a * 4 + b;
+    if (c > 1998)
+        return f1997(c - b, a);
+    return c + 1998;
+}
+int f1999(int a, int b)
+{
+    int c = a * 5 + b;
+    if (c > 1999)
+        return f1998(c - b, a);
+    return c + 1999;
+}
+int main()
+{
+    return f1999(1, 2) & 255;
+}
@@ -161,7 +161,7 @@ void cfg_flatten(void)
         /* reserve stack */
         ph2_ir_t *flatten_ir = add_ph2_ir(OP_define);
         flatten_ir->src0 = func->stack_size;
-        strncpy(flatten_ir->func_name, func->return_def.var_name, MAX_VAR_LEN);
+        flatten_ir->func = func;
 
         for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
             bb->elf_offset = elf_offset;
@@ -293,7 +293,7 @@ void emit_ph2_ir(ph2_ir_t *ph2_ir)
         emit(__b(__AL, ph2_ir->next_bb->elf_offset - elf_code->size));
         return;
     case OP_call:
-        func = find_func(ph2_ir->func_name);
+        func = ph2_ir->func;
         emit(__bl(__AL, func->bbs->elf_offset - elf_code->size));
         return;
     case OP_load_data_address:
@@ -305,7 +305,7 @@ void emit_ph2_ir(ph2_ir_t *ph2_ir)
         emit(__movt(__AL, rd, ph2_ir->src0 + elf_rodata_start));
         return;
     case OP_address_of_func:
-        func = find_func(ph2_ir->func_name);
+        func = ph2_ir->func;
         ofs = elf_code_start + func->bbs->elf_offset;
         emit(__movw(__AL, __r8, ofs));
         emit(__movt(__AL, __r8, ofs));
@@ -476,6 +476,9 @@ void code_generate(void)
     elf_rodata_start = elf_data_start + elf_data->size;
     elf_bss_start = elf_rodata_start + elf_rodata->size;
 
+    /* cfg_flatten() already knows the code size, reserve it all at once */
+    strbuf_extend(elf_code, elf_offset);
+
     /* start */
     emit(__movw(__AL, __r8, GLOBAL_FUNC->stack_size));
     emit(__movt(__AL, __r8, GLOBAL_FUNC->stack_size));
@@ -518,8 +521,15 @@ void code_generate(void)
         emit(__add_i(__AL, __r1, __r8, 4));
         emit(__bl(__AL, MAIN_BB->elf_offset - elf_code->size));
 
-        /* exit with main's return value - r0 already has the return value */
-        emit(__mov_i(__AL, __r7, 1));
+        /* exit with main's return value - r0 already has the return value.
+         * Go through exit() when available so that buffered streams are
+         * flushed.
+         */
+        func_t *exit_func = find_func("exit");
+        if (exit_func && exit_func->bbs)
+            emit(__bl(__AL, exit_func->bbs->elf_offset - elf_code->size));
+        else
+            emit(__mov_i(__AL, __r7, 1));
         emit(__svc());
     }
 
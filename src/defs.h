@@ -17,28 +17,8 @@
 #define MAX_VAR_LEN 32
 #define MAX_TYPE_LEN 32
 #define MAX_PARAMS 8
-#define MAX_LOCALS 1600
-#define MAX_FIELDS 64
-#define MAX_TYPES 256
-#define MAX_LABELS 256
-#define MAX_IR_INSTR 80000
-#define MAX_BB_PRED 128
-#define MAX_BB_DOM_SUCC 64
-#define MAX_BB_RDOM_SUCC 256
-#define MAX_GLOBAL_IR 256
-#define MAX_SOURCE 1048576
-#define MAX_CODE 262144
-#define MAX_DATA 262144
-#define MAX_SYMTAB 65536
-#define MAX_STRTAB 65536
-#define MAX_HEADER 1024
-#define MAX_SECTION 1024
-#define MAX_ALIASES 128
-#define MAX_CONSTANTS 1024
-#define MAX_CASES 128
-#define MAX_NESTING 128
-#define MAX_OPERAND_STACK_SIZE 32
-#define MAX_ANALYSIS_STACK_SIZE 800
+#define MAX_PHASES 16
+#define NUM_ARENAS 5
 
 /* Default capacities for common data structures */
 /* Arena sizes optimized based on typical usage patterns */
@@ -47,6 +27,22 @@
 #define LARGE_ARENA_SIZE 524288   /* 512 KiB - for instruction arena */
 #define DEFAULT_FUNCS_SIZE 64
 #define DEFAULT_INCLUSIONS_SIZE 16
+#define DEFAULT_TYPES_SIZE 256
+#define DEFAULT_ALIASES_SIZE 128
+#define DEFAULT_CONSTANTS_SIZE 1024
+#define DEFAULT_PH2_IR_SIZE 16384
+#define LOCALS_INDEX_THRESHOLD 8  /* locals scanned before indexing a block */
+#define MEMBERS_INDEX_THRESHOLD 8 /* fields scanned before indexing a type */
+#define DEFAULT_SOURCE_SIZE 1048576 /* 1 MiB - grown on demand */
+#define DEFAULT_READ_SIZE 65536     /* 64 KiB - per fread() of a source file */
+
+/* Initial sizes of the ELF output buffers, which grow on demand */
+#define DEFAULT_CODE_SIZE 262144
+#define DEFAULT_DATA_SIZE 262144
+#define DEFAULT_SYMTAB_SIZE 65536
+#define DEFAULT_STRTAB_SIZE 65536
+#define DEFAULT_HEADER_SIZE 1024
+#define DEFAULT_SECTION_SIZE 1024
 
 /* Arena compaction bitmask flags for selective memory reclamation */
 #define COMPACT_ARENA_BLOCK 0x01   /* BLOCK_ARENA - variables/blocks */
@@ -67,6 +63,14 @@
 /* Number of the available registers. Either 7 or 8 is accepted now. */
 #define REG_CNT 8
 
+/* Registers that may hold values across blocks at once, half of REG_CNT. The
+ * others are left to the allocation within each block.
+ */
+#define MAX_PINNED_REGS 4
+
+/* var_t::vreg_flags */
+#define VREG_PINNED 1 /* owns 'phys_reg' wherever it is live */
+
 /* This macro will be automatically defined at shecc run-time. */
 #ifdef __SHECC__
 /* use do-while as a substitution for nop */
@@ -75,11 +79,25 @@
         ;         \
     } while (0)
 #define HOST_PTR_SIZE 4
+/* int arithmetic wraps around on the target already */
+#define WRAP_ADD(a, b) ((a) + (b))
+#define WRAP_SUB(a, b) ((a) - (b))
+#define WRAP_MUL(a, b) ((a) * (b))
+#define WRAP_SHL(a, b) ((a) << (b))
+#define WRAP_NEG(a) (-(a))
 #else
 /* suppress GCC/Clang warnings */
 #define UNUSED(x) (void) (x)
 /* configure host data model when using 'memcpy'. */
 #define HOST_PTR_SIZE __SIZEOF_POINTER__
+/* fold constants with the wraparound of the target, which signed overflow
+ * does not guarantee on the host
+ */
+#define WRAP_ADD(a, b) ((int) ((unsigned) (a) + (unsigned) (b)))
+#define WRAP_SUB(a, b) ((int) ((unsigned) (a) - (unsigned) (b)))
+#define WRAP_MUL(a, b) ((int) ((unsigned) (a) * (unsigned) (b)))
+#define WRAP_SHL(a, b) ((int) ((unsigned) (a) << (b)))
+#define WRAP_NEG(a) ((int) (0u - (unsigned) (a)))
 #endif
 
 /* Common data structures */
@@ -94,13 +112,23 @@ typedef struct {
     arena_block_t *head;
     int total_bytes; /* Track total allocation for profiling */
     int block_size;  /* Default block size for new blocks */
+    int used_bytes;  /* Bytes handed out, i.e. the sum of block offsets */
+    int peak_bytes;  /* High-water mark of used_bytes */
+    int freed_bytes; /* Bytes released by compaction so far */
 } arena_t;
 
-/* string-based hash map definitions */
+/* string-based hash map definitions
+ *
+ * A hashmap is used either with hashmap_put/hashmap_get, which copy and
+ * compare key bytes, or with the _interned variants, whose keys are interned
+ * strings compared by identity. The two families must not be mixed on the
+ * same hashmap.
+ */
 
 typedef struct hashmap_node {
     char *key;
     void *val;
+    int hash; /* full hash of key, compared before key itself */
     bool occupied;
 } hashmap_node_t;
 
@@ -110,6 +138,16 @@ typedef struct {
     hashmap_node_t *table;
 } hashmap_t;
 
+/* A name index maps interned names to the first value entered for them. It
+ * is a bare open addressing table, cheaper than a hashmap_t for the many
+ * small scopes that embed one. Nodes are NULL until the first insertion.
+ */
+typedef struct {
+    hashmap_node_t *nodes;
+    int cap;
+    int size;
+} name_index_t;
+
 /* lexer tokens */
 typedef enum {
     T_start, /* FIXME: Unused, intended for lexer state machine init */
@@ -211,6 +249,18 @@ typedef struct token_info {
     struct token_info *next; /* For freelist management */
 } token_info_t;
 
+/* Token recorded once and replayed later, e.g. in a function-like macro */
+typedef struct {
+    token_t type;
+    char *value; /* interned literal, NULL if empty */
+} cached_token_t;
+
+/* Growable sequence of recorded tokens, terminated by T_eof when complete */
+typedef struct {
+    cached_token_t *tokens;
+    int size;
+} token_stream_t;
+
 /* Token freelist for memory reuse */
 typedef struct {
     token_info_t *freelist;
@@ -253,7 +303,7 @@ typedef enum {
     OP_generic,
 
     OP_phi,
-    OP_unwound_phi, /* work like address_of + store */
+    OP_unwound_phi, /* copy into a phi, an assignment after out-of-SSA */
 
     /* calling convention */
     OP_define,   /* function entry point */
@@ -322,11 +372,14 @@ typedef enum {
     OP_start
 } opcode_t;
 
-/* variable definition */
+typedef struct var var_t;
+
+/* SSA rename state, allocated only for declarations that get renamed */
 typedef struct {
-    int counter;
-    int stack[64];
+    int counter; /* number of versions, also the next subscript */
+    int *stack;  /* subscripts of the definitions currently in scope */
     int stack_idx;
+    var_t **subscripts; /* every version, indexed by its subscript */
 } rename_t;
 
 typedef struct ref_block ref_block_t;
@@ -344,9 +397,13 @@ typedef struct use_chain_node {
     struct use_chain_node *next, *prev;
 } use_chain_t;
 
-typedef struct var var_t;
 typedef struct type type_t;
 
+/* Lattice of sparse conditional constant propagation, from top to bottom.
+ * Zero-initialized variables are varying until SCCP finds a definition.
+ */
+typedef enum { SCCP_VARYING = 0, SCCP_UNDEF, SCCP_CONST } sccp_state_t;
+
 typedef struct var_list {
     int capacity;
     int size;
@@ -366,12 +423,10 @@ struct var {
     int offset;   /* offset from stack or frame, index 0 is reserved */
     int init_val; /* for global initialization */
     int liveness; /* live range */
-    int in_loop;
+    int in_loop; /* stamp of the loop under LICM when defined in it */
     struct var *base;
     int subscript;
-    struct var *subscripts[64];
-    int subscripts_idx;
-    rename_t rename;
+    rename_t *rename; /* NULL on SSA versions and unrenamed variables */
     ref_block_list_t ref_block_list; /* blocks which kill variable */
     use_chain_t *users_head, *users_tail;
     struct insn *last_assign;
@@ -379,22 +434,26 @@ struct var {
     bool is_ternary_ret;
     bool is_logical_ret;
     bool is_const;  /* whether a constant representaion or not */
-    int vreg_id;    /* Virtual register ID */
+    int vreg_id;    /* Index in its function's liveness bitsets */
     int phys_reg;   /* Physical register assignment (-1 if unassigned) */
     int vreg_flags; /* VReg flags */
     int first_use;  /* First instruction index where variable is used */
     int last_use;   /* Last instruction index where variable is used */
     int loop_depth; /* Nesting depth if variable is in a loop */
     int use_count;  /* Number of times variable is used */
+    sccp_state_t sccp_state;
+    int sccp_val;  /* value of the SCCP_CONST state */
+    int value_num; /* GVN value number, 0 until numbered */
 };
 
 typedef struct {
     char name[MAX_VAR_LEN];
     bool is_variadic;
-    int start_source_idx;
-    var_t param_defs[MAX_PARAMS];
+    token_stream_t body;
+    char *param_defs[MAX_PARAMS]; /* interned parameter names */
     int num_param_defs;
-    int params[MAX_PARAMS];
+    token_stream_t args; /* arguments of the current expansion */
+    int params[MAX_PARAMS]; /* index of each argument in 'args' */
     int num_params;
     bool disabled;
 } macro_t;
@@ -404,6 +463,8 @@ typedef struct func func_t;
 /* block definition */
 struct block {
     var_list_t locals;
+    name_index_t index; /* named locals by interned name */
+    int indexed; /* number of leading locals visited by the index */
     struct block *parent;
     func_t *func;
     macro_t *macro;
@@ -430,7 +491,7 @@ struct ph2_ir {
     int src0;
     int src1;
     int dest;
-    char func_name[MAX_VAR_LEN];
+    func_t *func; /* OP_define, OP_call and OP_address_of_func target */
     basic_block_t *next_bb;
     basic_block_t *then_bb;
     basic_block_t *else_bb;
@@ -446,8 +507,10 @@ struct type {
     base_type_t base_type;
     struct type *base_struct;
     int size;
-    var_t fields[MAX_FIELDS];
+    var_t *fields; /* arena array grown by add_member() */
     int num_fields;
+    name_index_t index; /* fields by interned name */
+    int indexed;        /* number of leading fields visited by the index */
     int ptr_level; /* pointer level for typedef pointer types */
 };
 
@@ -492,7 +555,9 @@ struct insn {
     bool useful; /* Used in DCE process. Set true if instruction is useful. */
     basic_block_t *belong_to;
     phi_operand_t *phi_ops;
-    char str[64];
+    char *str;    /* interned label or callee name, NULL if none */
+    func_t *func; /* callee of OP_call */
+    basic_block_t *phi_bb; /* block of the phi fed by OP_unwound_phi */
 };
 
 typedef struct {
@@ -503,6 +568,19 @@ typedef struct {
     ph2_ir_t *head, *tail;
 } ph2_ir_list_t;
 
+/* An expression in the GVN hash table and the instruction computing it. An
+ * operand is keyed by its value number, or by its value if constant.
+ */
+typedef struct {
+    opcode_t opcode;
+    int num1, val1;
+    int num2, val2;
+    int sz;
+    int hash;
+    int next; /* index of the next entry in the bucket plus one, 0 if none */
+    insn_t *insn;
+} gvn_entry_t;
+
 typedef enum { NEXT, ELSE, THEN } bb_connection_type_t;
 
 typedef struct {
@@ -510,6 +588,12 @@ typedef struct {
     bb_connection_type_t type;
 } bb_connection_t;
 
+/* Growable array of basic blocks, allocated from BB_ARENA by bb_list_add() */
+typedef struct {
+    int size;
+    basic_block_t **elements;
+} bb_list_t;
+
 struct symbol {
     var_t *var;
     int index;
@@ -522,10 +606,22 @@ typedef struct {
     symbol_t *head, *tail;
 } symbol_list_t;
 
+/* A natural loop, identified by its header */
+struct loop {
+    basic_block_t *header;
+    struct loop *parent; /* innermost loop containing this one */
+    struct loop *next;   /* next loop of the function */
+    int depth;           /* 1 for an outermost loop */
+    bb_list_t bbs;       /* blocks including nested loops', in RPO */
+};
+
+typedef struct loop loop_t;
+
 struct basic_block {
     insn_list_t insn_list;
     ph2_ir_list_t ph2_ir_list;
-    bb_connection_t prev[MAX_BB_PRED];
+    bb_connection_t *prev; /* predecessors, NULL where one is disconnected */
+    int prev_size;         /* number of slots of 'prev' in use */
     /* Used in instruction dumping when ir_dump is enabled. */
     char bb_label_name[MAX_VAR_LEN];
     struct basic_block *next;  /* normal BB */
@@ -533,24 +629,32 @@ struct basic_block {
     struct basic_block *else_;
     struct basic_block *idom;
     struct basic_block *r_idom;
+    bool exit_edge; /* has a virtual edge to the exit, see exit_edges */
     struct basic_block *rpo_next;
     struct basic_block *rpo_r_next;
-    var_list_t live_gen;
-    var_list_t live_kill;
-    var_list_t live_in;
-    var_list_t live_out;
+    var_list_t live_kill; /* variables assigned in the block */
+    /* liveness bitsets, one bit per local of the function by vreg_id */
+    int *live_gen;
+    int *live_def;
+    int *live_in;
+    int *live_out;
+    bool live_queued; /* on the liveness worklist */
     int rpo;
     int rpo_r;
-    struct basic_block *DF[64];
-    struct basic_block *RDF[64];
-    int df_idx;
-    int rdf_idx;
+    bb_list_t DF;
+    bb_list_t RDF;
     int visited;
     bool useful; /* indicate whether this BB contains useful instructions */
-    struct basic_block *dom_next[64];
+    bb_list_t dom_next;
     struct basic_block *dom_prev;
-    struct basic_block *rdom_next[256];
+    bb_list_t rdom_next;
     struct basic_block *rdom_prev;
+    /* Pre/post DFS numbers in the dominator and post-dominator trees, both
+     * starting at 1. They stay 0 for blocks the tree does not reach.
+     */
+    int dom_pre, dom_post;
+    int rdom_pre, rdom_post;
+    loop_t *loop; /* innermost natural loop containing the block, if any */
     func_t *belong_to;
     block_t *scope;
     symbol_list_t symbol_list; /* variable declaration */
@@ -587,6 +691,23 @@ struct func {
     symbol_list_t global_sym_list;
     int bb_cnt;
     int visited;
+    int live_words; /* size of each liveness bitset, in ints */
+
+    /* DFS orders of the CFG, computed by func_dfs() and func_rdfs() and
+     * invalidated whenever an edge changes
+     */
+    bb_list_t dfs_pre, dfs_post;   /* from the entry along successors */
+    bb_list_t rdfs_pre, rdfs_post; /* from the exit along predecessors */
+    bool dfs_valid, rdfs_valid;
+
+    /* blocks which cannot reach the exit, such as those of a loop left only
+     * by calling exit(), get a virtual edge to it from func_connect_exit()
+     */
+    bb_list_t exit_edges;
+    bool dom_valid; /* dominator tree is up to date, see func_refresh_dom() */
+
+    /* natural loops found by func_build_loops(), outer before inner */
+    loop_t *loops;
 
     struct func *next;
 };
@@ -595,18 +716,57 @@ typedef struct {
     func_t *head, *tail;
 } func_list_t;
 
-typedef struct {
-    func_t *func;
-    basic_block_t *bb;
-    void (*preorder_cb)(func_t *, basic_block_t *);
-    void (*postorder_cb)(func_t *, basic_block_t *);
-} bb_traversal_args_t;
-
 typedef struct {
     var_t *var;
     int polluted;
 } regfile_t;
 
+/* Live interval of a local over the positions of its function, see
+ * ra_build_intervals()
+ */
+typedef struct {
+    var_t *var;
+    int start, end; /* first and last positions where it is live */
+    int slot_end;   /* end of the last block it is accessed in */
+    int weight;     /* block boundary loads and stores a register saves */
+    int use_bb;     /* 1 + start of the last block weighting a use */
+    int def_bb;     /* 1 + start of the last block weighting a definition */
+    bool cross;     /* live across a block boundary */
+    bool fixed;     /* kept in memory, e.g. a phi or an address taken */
+    int next;       /* next interval starting at the same position */
+    int next_end;   /* next interval ending at the same position */
+} live_interval_t;
+
+/* Clock reading in the layout of struct timespec */
+typedef struct {
+    int sec;
+    int nsec;
+} clock_stamp_t;
+
+/* Snapshot of one arena taken by --mem-report */
+typedef struct {
+    int reserved; /* bytes held in arena blocks */
+    int used;     /* bytes handed out, i.e. the sum of block offsets */
+    int peak;     /* highest 'used' seen so far */
+    int blocks;
+    int freed; /* bytes released by compaction during the phase */
+} arena_stat_t;
+
+/* Per-phase statistics collected by --time-report and --mem-report. CFG and
+ * instruction counts are -1 for phases that run before the CFG is linearized
+ * in RPO order.
+ */
+typedef struct {
+    char *name;
+    int wall_us;
+    int cpu_us;
+    int funcs;
+    int bbs;
+    int insns;
+    int ph2_irs;
+    arena_stat_t arenas[NUM_ARENAS];
+} phase_stat_t;
+
 /* ELF header */
 typedef struct {
     char e_ident[16];
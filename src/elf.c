@@ -39,19 +39,20 @@ char e_extract_byte(int v, int b)
 
 void elf_write_int(strbuf_t *elf_array, int val)
 {
+    char bytes[4];
+
     if (!elf_array)
         return;
     for (int i = 0; i < 4; i++)
-        strbuf_putc(elf_array, e_extract_byte(val, i));
+        bytes[i] = e_extract_byte(val, i);
+    strbuf_putn(elf_array, bytes, 4);
 }
 
 void elf_write_blk(strbuf_t *elf_array, void *blk, int sz)
 {
     if (!elf_array || !blk || sz <= 0)
         return;
-    char *ptr = blk;
-    for (int i = 0; i < sz; i++)
-        strbuf_putc(elf_array, ptr[i]);
+    strbuf_putn(elf_array, blk, sz);
 }
 
 void elf_generate_header(void)
@@ -207,13 +208,11 @@ void elf_generate_sections(void)
     int shstrtab_start = 0; /* Track start of shstrtab */
 
     /* symtab section */
-    for (int b = 0; b < elf_symtab->size; b++)
-        elf_write_byte(elf_section, elf_symtab->elements[b]);
+    elf_write_blk(elf_section, elf_symtab->elements, elf_symtab->size);
     section_data_size += elf_symtab->size;
 
     /* strtab section */
-    for (int b = 0; b < elf_strtab->size; b++)
-        elf_write_byte(elf_section, elf_strtab->elements[b]);
+    elf_write_blk(elf_section, elf_strtab->elements, elf_strtab->size);
     section_data_size += elf_strtab->size;
 
     /* shstr section - compute size dynamically */
@@ -434,16 +433,11 @@ void elf_generate(const char *outfile)
         return;
     }
 
-    for (int i = 0; i < elf_header->size; i++)
-        fputc(elf_header->elements[i], fp);
-    for (int i = 0; i < elf_code->size; i++)
-        fputc(elf_code->elements[i], fp);
-    for (int i = 0; i < elf_data->size; i++)
-        fputc(elf_data->elements[i], fp);
-    for (int i = 0; i < elf_rodata->size; i++)
-        fputc(elf_rodata->elements[i], fp);
+    fwrite(elf_header->elements, 1, elf_header->size, fp);
+    fwrite(elf_code->elements, 1, elf_code->size, fp);
+    fwrite(elf_data->elements, 1, elf_data->size, fp);
+    fwrite(elf_rodata->elements, 1, elf_rodata->size, fp);
     /* Note: .bss is not written to file (SHT_NOBITS) */
-    for (int i = 0; i < elf_section->size; i++)
-        fputc(elf_section->elements[i], fp);
+    fwrite(elf_section->elements, 1, elf_section->size, fp);
     fclose(fp);
 }
@@ -10,11 +10,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "defs.h"
 
 /* Forward declaration for string interning */
 char *intern_string(char *str);
+char *intern_lookup(char *str);
+int intern_hash(char *str);
 
 /* Lexer */
 char token_str[MAX_TOKEN_LEN];
@@ -29,10 +32,8 @@ source_location_t current_location; /* Will be initialized at runtime */
 
 bool preproc_match;
 
-/* Point to the first character after where the macro has been called. It is
- * needed when returning from the macro body.
- */
-int macro_return_idx;
+/* Next recorded token to lex instead of SOURCE, NULL when lexing SOURCE */
+cached_token_t *replay_token;
 
 /* Global objects */
 
@@ -47,9 +48,17 @@ hashmap_t *CONSTANTS_MAP;
 
 /* Types */
 
-type_t *TYPES;
+type_t **TYPES;
 int types_idx = 0;
 
+/* Named types by interned name: struct and union tags, the other names, and
+ * both together. Types are entered lazily by find_type() once they are named.
+ */
+hashmap_t *TYPE_TAGS_MAP;
+hashmap_t *TYPE_NAMES_MAP;
+hashmap_t *TYPE_ANY_MAP;
+int types_indexed = 0; /* number of leading TYPES visited by the maps */
+
 type_t *TY_void;
 type_t *TY_char;
 type_t *TY_bool;
@@ -159,6 +168,9 @@ arena_t *arena_init(int initial_capacity)
     arena->total_bytes = initial_capacity;
     /* Use the initial capacity as the default block size for future growth. */
     arena->block_size = initial_capacity;
+    arena->used_bytes = 0;
+    arena->peak_bytes = 0;
+    arena->freed_bytes = 0;
     return arena;
 }
 
@@ -196,6 +208,9 @@ void *arena_alloc(arena_t *arena, int size)
 
     void *ptr = arena->head->memory + arena->head->offset;
     arena->head->offset += size;
+    arena->used_bytes += size;
+    if (arena->used_bytes > arena->peak_bytes)
+        arena->peak_bytes = arena->used_bytes;
     return ptr;
 }
 
@@ -269,6 +284,9 @@ void *arena_realloc(arena_t *arena, char *oldptr, int oldsz, int newsz)
     /* grow in place if oldptr is the last allocation in the current block */
     if (oldptr + oldsz == block_end && blk->offset + delta <= blk->capacity) {
         blk->offset += delta;
+        arena->used_bytes += delta;
+        if (arena->used_bytes > arena->peak_bytes)
+            arena->peak_bytes = arena->used_bytes;
         return oldptr;
     }
 
@@ -278,6 +296,47 @@ void *arena_realloc(arena_t *arena, char *oldptr, int oldsz, int newsz)
     return newptr;
 }
 
+/* Grow an arena array so that it holds at least @n elements.
+ * The capacity is stored in the word just before the elements, so callers
+ * only track how many elements are in use. It doubles on growth, which keeps
+ * appending one element at a time amortized O(1).
+ *
+ * @arena: Pointer to the arena. Must not be NULL.
+ * @buf: An array returned by arena_grow() from @arena, or NULL for none.
+ * @n: Number of elements the array has to hold.
+ * @size: Size of each element in bytes. Must not change between calls.
+ *
+ * Return: @buf if it is large enough, otherwise a larger copy of it.
+ */
+void *arena_grow(arena_t *arena, void *buf, int n, int size)
+{
+    int *elements = buf;
+    int cap = 0;
+
+    if (elements) {
+        cap = elements[-1];
+        if (n <= cap)
+            return buf;
+    }
+
+    int capacity = cap ? cap << 1 : 4;
+    while (capacity < n)
+        capacity <<= 1;
+
+    /* a whole pointer in front of the capacity keeps the elements aligned as
+     * arena_alloc() does
+     */
+    const int header = sizeof(void *);
+    char *data = buf;
+    if (data)
+        data -= header;
+    data = arena_realloc(arena, data, data ? header + cap * size : 0,
+                         header + capacity * size);
+    elements = (int *) (data + header);
+    elements[-1] = capacity;
+    return elements;
+}
+
 /* Duplicate a NULL-terminated string into the arena.
  *
  * @arena: a Pointer to the arena. Must not be NULL.
@@ -343,12 +402,6 @@ macro_t *arena_alloc_macro(void)
     return arena_calloc(GENERAL_ARENA, 1, sizeof(macro_t));
 }
 
-bb_traversal_args_t *arena_alloc_traversal_args(void)
-{
-    /* Keep using calloc for safety */
-    return arena_calloc(GENERAL_ARENA, 1, sizeof(bb_traversal_args_t));
-}
-
 void arena_free(arena_t *arena)
 {
     arena_block_t *block = arena->head;
@@ -363,16 +416,14 @@ void arena_free(arena_t *arena)
     free(arena);
 }
 
-/* Hash a string with FNV-1a hash function
- * and converts into usable hashmap index. The range of returned
- * hashmap index is ranged from "(0 ~ 2,147,483,647) mod size" due to
- * lack of unsigned integer implementation.
- * @size: The size of map. Must not be negative or 0.
+/* Hash a string with FNV-1a hash function. The result is kept non-negative
+ * due to lack of unsigned integer implementation, and is stored in each
+ * hashmap node so that probing and rehashing never rescan the key.
  * @key: The key string. May be NULL.
  *
- * Return: The usable hashmap index.
+ * Return: The full hash of the key.
  */
-int hashmap_hash_index(int size, char *key)
+int hashmap_hash(char *key)
 {
     if (!key)
         return 0;
@@ -385,7 +436,7 @@ int hashmap_hash_index(int size, char *key)
     }
 
     const int mask = hash >> 31;
-    return ((hash ^ mask) - mask) & (size - 1);
+    return (hash ^ mask) - mask;
 }
 
 int round_up_pow2(int v)
@@ -448,33 +499,85 @@ void hashmap_rehash(hashmap_t *map)
         return;
     }
 
-    map->size = 0;
-
     for (int i = 0; i < old_cap; i++) {
         if (old_table[i].occupied) {
-            char *key = old_table[i].key;
-            void *val = old_table[i].val;
-
-            int index = hashmap_hash_index(map->cap, key);
-            int start = index;
+            /* the stored hash spares rehashing every key */
+            int index = old_table[i].hash & (map->cap - 1);
 
-            while (map->table[index].occupied) {
+            while (map->table[index].occupied)
                 index = (index + 1) & (map->cap - 1);
-                if (index == start) {
-                    printf("Error: New table is full during rehash\n");
-                    abort();
-                }
-            }
 
-            map->table[index].key = key;
-            map->table[index].val = val;
+            map->table[index].key = old_table[i].key;
+            map->table[index].val = old_table[i].val;
+            map->table[index].hash = old_table[i].hash;
             map->table[index].occupied = true;
-            map->size++;
         }
     }
     free(old_table);
 }
 
+/* Find the node holding the given key, or the free node where it belongs.
+ * Hashes are compared before key bytes, and keys of an interned hashmap are
+ * compared by identity only.
+ * @map: The hashmap to be probed. Must not be NULL.
+ * @key: The key string. May be NULL.
+ * @hash: The hash of the key, as returned by 'hashmap_hash'.
+ * @interned: Whether the keys of the hashmap are interned strings.
+ *
+ * Return: The node of the key if it exists, otherwise an unoccupied node.
+ * NULL if the hashmap is full.
+ */
+hashmap_node_t *hashmap_probe(hashmap_t *map,
+                              char *key,
+                              int hash,
+                              bool interned)
+{
+    int index = hash & (map->cap - 1);
+    int start = index;
+
+    while (map->table[index].occupied) {
+        hashmap_node_t *node = &map->table[index];
+
+        if (node->hash == hash &&
+            (node->key == key || (!interned && !strcmp(node->key, key))))
+            return node;
+
+        index = (index + 1) & (map->cap - 1);
+        if (index == start)
+            return NULL;
+    }
+
+    return &map->table[index];
+}
+
+/* Store a key-value pair into the node returned by 'hashmap_probe'.
+ * @map: The hashmap owning the node. Must not be NULL.
+ * @node: The node of the key. NULL if the hashmap is full, which aborts.
+ * @key: The key string stored as-is if the node is unoccupied.
+ * @hash: The hash of the key.
+ * @val: The value pointer. May be NULL.
+ */
+void hashmap_store(hashmap_t *map,
+                   hashmap_node_t *node,
+                   char *key,
+                   int hash,
+                   void *val)
+{
+    if (!node) {
+        printf("Error: Hashmap is full\n");
+        abort();
+    }
+
+    node->val = val;
+    if (node->occupied)
+        return;
+
+    node->key = key;
+    node->hash = hash;
+    node->occupied = true;
+    map->size++;
+}
+
 /* Put a key-value pair into given hashmap.
  * If key already contains a value, then replace it with new value, the old
  * value will be freed.
@@ -492,26 +595,12 @@ void hashmap_put(hashmap_t *map, char *key, void *val)
     if ((map->cap >> 1) <= map->size)
         hashmap_rehash(map);
 
-    int index = hashmap_hash_index(map->cap, key);
-    int start = index;
+    int hash = hashmap_hash(key);
+    hashmap_node_t *node = hashmap_probe(map, key, hash, false);
 
-    while (map->table[index].occupied) {
-        if (!strcmp(map->table[index].key, key)) {
-            map->table[index].val = val;
-            return;
-        }
-
-        index = (index + 1) & (map->cap - 1);
-        if (index == start) {
-            printf("Error: Hashmap is full\n");
-            abort();
-        }
-    }
-
-    map->table[index].key = arena_strdup(HASHMAP_ARENA, key);
-    map->table[index].val = val;
-    map->table[index].occupied = true;
-    map->size++;
+    if (node && !node->occupied)
+        key = arena_strdup(HASHMAP_ARENA, key);
+    hashmap_store(map, node, key, hash, val);
 }
 
 /* Get key-value pair node from hashmap from given key.
@@ -526,19 +615,8 @@ hashmap_node_t *hashmap_get_node(hashmap_t *map, char *key)
     if (!map)
         return NULL;
 
-    int index = hashmap_hash_index(map->cap, key);
-    int start = index;
-
-    while (map->table[index].occupied) {
-        if (!strcmp(map->table[index].key, key))
-            return &map->table[index];
-
-        index = (index + 1) & (map->cap - 1);
-        if (index == start)
-            return NULL;
-    }
-
-    return NULL;
+    hashmap_node_t *node = hashmap_probe(map, key, hashmap_hash(key), false);
+    return node && node->occupied ? node : NULL;
 }
 
 /* Get value from hashmap from given key.
@@ -566,6 +644,50 @@ bool hashmap_contains(hashmap_t *map, char *key)
     return hashmap_get_node(map, key);
 }
 
+/* Put a key-value pair into given interned hashmap. The key is kept by
+ * reference, and its hash is the one computed when it was interned.
+ * @map: The hashmap to be put into. Must not be NULL.
+ * @key: The key string, as returned by 'intern_string'.
+ * @val: The value pointer. May be NULL.
+ */
+void hashmap_put_interned(hashmap_t *map, char *key, void *val)
+{
+    if (!map)
+        return;
+
+    if ((map->cap >> 1) <= map->size)
+        hashmap_rehash(map);
+
+    int hash = intern_hash(key);
+    hashmap_store(map, hashmap_probe(map, key, hash, true), key, hash, val);
+}
+
+/* Get value from given interned hashmap.
+ * @map: The hashmap to be looked up. Must not be NULL.
+ * @key: The key string, as returned by 'intern_string' or 'intern_lookup'.
+ * May be NULL, which is never a key.
+ *
+ * Return: The value of the key if the key-value pair entry exists, NULL
+ * otherwise.
+ */
+void *hashmap_get_interned(hashmap_t *map, char *key)
+{
+    if (!map || !key)
+        return NULL;
+
+    /* interned keys are unique, only their node needs to be located */
+    int *prefix = (int *) key;
+    int index = prefix[-1] & (map->cap - 1);
+
+    while (map->table[index].occupied) {
+        if (map->table[index].key == key)
+            return map->table[index].val;
+        index = (index + 1) & (map->cap - 1);
+    }
+
+    return NULL;
+}
+
 /* Free the hashmap, this also frees key-value pair entry's value.
  * @map: The hashmap to be looked up. Must no be NULL.
  */
@@ -582,6 +704,33 @@ void hashmap_free(hashmap_t *map)
 
 bool dump_ir = false;
 bool hard_mul_div = false;
+bool time_report = false;
+char *time_report_file = NULL;
+bool mem_report = false;
+bool fast_reg_alloc = false;
+
+/* Enter the named types which follow the indexed ones into the type maps.
+ * Indexing stops at a type whose name is not assigned yet. The first type
+ * of a name is the one kept, as in a linear scan.
+ */
+void index_types(void)
+{
+    for (; types_indexed < types_idx; types_indexed++) {
+        type_t *type = TYPES[types_indexed];
+        hashmap_t *map = TYPE_NAMES_MAP;
+
+        if (!type->type_name[0])
+            return;
+        if (type->base_type == TYPE_struct || type->base_type == TYPE_union)
+            map = TYPE_TAGS_MAP;
+
+        char *key = intern_string(type->type_name);
+        if (!hashmap_get_interned(map, key))
+            hashmap_put_interned(map, key, type);
+        if (!hashmap_get_interned(TYPE_ANY_MAP, key))
+            hashmap_put_interned(TYPE_ANY_MAP, key, type);
+    }
+}
 
 /* Find the type by the given name.
  * @type_name: The name to be searched.
@@ -594,31 +743,48 @@ bool hard_mul_div = false;
  */
 type_t *find_type(char *type_name, int flag)
 {
-    for (int i = 0; i < types_idx; i++) {
-        if (TYPES[i].base_type == TYPE_struct ||
-            TYPES[i].base_type == TYPE_union) {
+    type_t *type = NULL;
+
+    index_types();
+
+    char *key = intern_lookup(type_name);
+    if (key) {
+        if (flag == 0)
+            type = hashmap_get_interned(TYPE_ANY_MAP, key);
+        else if (flag == 1)
+            type = hashmap_get_interned(TYPE_NAMES_MAP, key);
+        else
+            type = hashmap_get_interned(TYPE_TAGS_MAP, key);
+    }
+
+    /* the types left out of the maps are scanned */
+    for (int i = types_indexed; !type && i < types_idx; i++) {
+        if (TYPES[i]->base_type == TYPE_struct ||
+            TYPES[i]->base_type == TYPE_union) {
             if (flag == 1)
                 continue;
-            if (!strcmp(TYPES[i].type_name, type_name))
-                return &TYPES[i];
+            if (!strcmp(TYPES[i]->type_name, type_name))
+                return TYPES[i];
         } else {
             if (flag == 2)
                 continue;
-            if (!strcmp(TYPES[i].type_name, type_name)) {
-                /* If it is a forwardly declared alias of a structure, return
-                 * the base structure type.
-                 */
-                if (TYPES[i].base_type == TYPE_typedef && TYPES[i].size == 0)
-                    return TYPES[i].base_struct;
-                return &TYPES[i];
-            }
+            if (!strcmp(TYPES[i]->type_name, type_name))
+                type = TYPES[i];
         }
     }
-    return NULL;
+
+    /* If it is a forwardly declared alias of a structure, return the base
+     * structure type.
+     */
+    if (type && type->base_type == TYPE_typedef && type->size == 0)
+        return type->base_struct;
+    return type;
 }
 
 ph2_ir_t *add_existed_ph2_ir(ph2_ir_t *ph2_ir)
 {
+    PH2_IR_FLATTEN = arena_grow(GENERAL_ARENA, PH2_IR_FLATTEN, ph2_ir_idx + 1,
+                                sizeof(ph2_ir_t *));
     PH2_IR_FLATTEN[ph2_ir_idx++] = ph2_ir;
     return ph2_ir;
 }
@@ -633,7 +799,7 @@ ph2_ir_t *add_ph2_ir(opcode_t op)
     ph2_ir->src0 = 0;
     ph2_ir->src1 = 0;
     ph2_ir->dest = 0;
-    ph2_ir->func_name[0] = '\0';
+    ph2_ir->func = NULL;
     ph2_ir->next_bb = NULL;
     ph2_ir->then_bb = NULL;
     ph2_ir->else_bb = NULL;
@@ -656,6 +822,10 @@ block_t *add_block(block_t *parent, func_t *func, macro_t *macro)
     blk->locals.capacity = 16;
     blk->locals.elements =
         arena_alloc(BLOCK_ARENA, blk->locals.capacity * sizeof(var_t *));
+    blk->index.nodes = NULL;
+    blk->index.cap = 0;
+    blk->index.size = 0;
+    blk->indexed = 0;
     blk->parent = parent;
     blk->func = func;
     blk->macro = macro;
@@ -663,9 +833,25 @@ block_t *add_block(block_t *parent, func_t *func, macro_t *macro)
     return blk;
 }
 
+/* Remove the most recently added local of a block, dropping the index if it
+ * has already visited that local.
+ */
+void block_pop_var(block_t *block)
+{
+    block->locals.size--;
+    if (block->indexed <= block->locals.size)
+        return;
+
+    block->index.nodes = NULL;
+    block->index.cap = 0;
+    block->index.size = 0;
+    block->indexed = 0;
+}
+
 void add_alias(char *alias, char *value)
 {
-    alias_t *al = hashmap_get(ALIASES_MAP, alias);
+    alias = intern_string(alias);
+    alias_t *al = hashmap_get_interned(ALIASES_MAP, alias);
     if (!al) {
         al = arena_alloc_alias();
         if (!al) {
@@ -673,8 +859,8 @@ void add_alias(char *alias, char *value)
             return;
         }
         /* Use interned string for alias name */
-        strcpy(al->alias, intern_string(alias));
-        hashmap_put(ALIASES_MAP, alias, al);
+        strcpy(al->alias, alias);
+        hashmap_put_interned(ALIASES_MAP, alias, al);
     }
     strcpy(al->value, value);
     al->disabled = false;
@@ -682,7 +868,7 @@ void add_alias(char *alias, char *value)
 
 char *find_alias(char alias[])
 {
-    alias_t *al = hashmap_get(ALIASES_MAP, alias);
+    alias_t *al = hashmap_get_interned(ALIASES_MAP, intern_lookup(alias));
     if (al && !al->disabled)
         return al->value;
     return NULL;
@@ -690,7 +876,7 @@ char *find_alias(char alias[])
 
 bool remove_alias(char *alias)
 {
-    alias_t *al = hashmap_get(ALIASES_MAP, alias);
+    alias_t *al = hashmap_get_interned(ALIASES_MAP, intern_lookup(alias));
     if (al && !al->disabled) {
         al->disabled = true;
         return true;
@@ -700,7 +886,8 @@ bool remove_alias(char *alias)
 
 macro_t *add_macro(char *name)
 {
-    macro_t *ma = hashmap_get(MACROS_MAP, name);
+    name = intern_string(name);
+    macro_t *ma = hashmap_get_interned(MACROS_MAP, name);
     if (!ma) {
         ma = arena_alloc_macro();
         if (!ma) {
@@ -708,8 +895,8 @@ macro_t *add_macro(char *name)
             return NULL;
         }
         /* Use interned string for macro name */
-        strcpy(ma->name, intern_string(name));
-        hashmap_put(MACROS_MAP, name, ma);
+        strcpy(ma->name, name);
+        hashmap_put_interned(MACROS_MAP, name, ma);
     }
     ma->disabled = false;
     return ma;
@@ -717,7 +904,7 @@ macro_t *add_macro(char *name)
 
 macro_t *find_macro(char *name)
 {
-    macro_t *ma = hashmap_get(MACROS_MAP, name);
+    macro_t *ma = hashmap_get_interned(MACROS_MAP, intern_lookup(name));
     if (ma && !ma->disabled)
         return ma;
     return NULL;
@@ -725,7 +912,7 @@ macro_t *find_macro(char *name)
 
 bool remove_macro(char *name)
 {
-    macro_t *ma = hashmap_get(MACROS_MAP, name);
+    macro_t *ma = hashmap_get_interned(MACROS_MAP, intern_lookup(name));
     if (ma) {
         ma->disabled = true;
         return true;
@@ -739,11 +926,16 @@ void error(char *msg);
 string_pool_t *string_pool;
 string_literal_pool_t *string_literal_pool;
 
-/* Safe string interning that works with self-hosting */
+/* Safe string interning that works with self-hosting. Each interned string
+ * is preceded by its hash, so that interned hashmaps never rescan their keys.
+ */
 char *intern_string(char *str)
 {
-    char *existing;
+    hashmap_t *strings;
+    hashmap_node_t *node;
     char *interned;
+    int *prefix;
+    int hash;
     int len;
 
     /* Safety: return original if NULL */
@@ -754,44 +946,79 @@ char *intern_string(char *str)
     if (!GENERAL_ARENA || !string_pool)
         return str;
 
+    strings = string_pool->strings;
+    if ((strings->cap >> 1) <= strings->size)
+        hashmap_rehash(strings);
+
     /* Check if already interned */
-    existing = hashmap_get(string_pool->strings, str);
-    if (existing)
-        return existing;
+    hash = hashmap_hash(str);
+    node = hashmap_probe(strings, str, hash, false);
+    if (node && node->occupied)
+        return node->key;
 
-    /* Allocate and store new string */
+    /* Allocate and store new string after its hash */
     len = strlen(str) + 1;
-    interned = arena_alloc(GENERAL_ARENA, len);
+    prefix = arena_alloc(GENERAL_ARENA, sizeof(int) + len);
+    prefix[0] = hash;
+    interned = (char *) (prefix + 1);
     strcpy(interned, str);
 
-    hashmap_put(string_pool->strings, interned, interned);
+    hashmap_store(strings, node, interned, hash, interned);
 
     return interned;
 }
 
-int find_macro_param_src_idx(char *name, block_t *parent)
+/* Find the interned instance of a string without interning it.
+ * @str: The string to be looked up. May be NULL.
+ *
+ * Return: The interned string, or NULL if it has never been interned, in
+ * which case it cannot be the key of any interned hashmap either.
+ */
+char *intern_lookup(char *str)
+{
+    if (!str || !string_pool)
+        return NULL;
+
+    hashmap_node_t *node =
+        hashmap_probe(string_pool->strings, str, hashmap_hash(str), false);
+    return node && node->occupied ? node->key : NULL;
+}
+
+/* Return the hash computed when the given string was interned.
+ * @str: The string returned by 'intern_string'.
+ */
+int intern_hash(char *str)
+{
+    int *prefix = (int *) str;
+    return prefix[-1];
+}
+
+/* Return the index of the argument tokens passed for the macro parameter
+ * 'name', or -1 if it is not a parameter of the macro being expanded.
+ */
+int find_macro_param_idx(char *name, block_t *parent)
 {
     macro_t *macro = parent->macro;
 
     if (!parent)
         error("The macro expansion is not supported in the global scope");
     if (!parent->macro)
-        return 0;
+        return -1;
 
     for (int i = 0; i < macro->num_param_defs; i++) {
-        if (!strcmp(macro->param_defs[i].var_name, name))
+        if (!strcmp(macro->param_defs[i], name))
             return macro->params[i];
     }
-    return 0;
+    return -1;
 }
 
 type_t *add_type(void)
 {
-    if (types_idx >= MAX_TYPES) {
-        printf("Error: Maximum number of types (%d) exceeded\n", MAX_TYPES);
-        abort();
-    }
-    return &TYPES[types_idx++];
+    TYPES = arena_grow(GENERAL_ARENA, TYPES, types_idx + 1, sizeof(type_t *));
+
+    type_t *type = arena_calloc(GENERAL_ARENA, 1, sizeof(type_t));
+    TYPES[types_idx++] = type;
+    return type;
 }
 
 type_t *add_named_type(char *name)
@@ -811,14 +1038,106 @@ void add_constant(char alias[], int value)
     }
 
     /* Use interned string for constant name */
-    strcpy(constant->alias, intern_string(alias));
+    alias = intern_string(alias);
+    strcpy(constant->alias, alias);
     constant->value = value;
-    hashmap_put(CONSTANTS_MAP, alias, constant);
+    hashmap_put_interned(CONSTANTS_MAP, alias, constant);
 }
 
 constant_t *find_constant(char alias[])
 {
-    return hashmap_get(CONSTANTS_MAP, alias);
+    return hashmap_get_interned(CONSTANTS_MAP, intern_lookup(alias));
+}
+
+/* Append a field to a struct or union type.
+ * Return: The new zero-initialized field. Adding another field may move it.
+ */
+var_t *add_member(type_t *type)
+{
+    type->fields = arena_grow(GENERAL_ARENA, type->fields,
+                              type->num_fields + 1, sizeof(var_t));
+    var_t *var = &type->fields[type->num_fields++];
+    memset(var, 0, sizeof(var_t));
+    return var;
+}
+
+/* Find the slot of an interned name in a name index.
+ * Return: The slot holding the name, or the free slot where it belongs.
+ */
+hashmap_node_t *name_index_probe(name_index_t *index, char *key, int hash)
+{
+    int i = hash & (index->cap - 1);
+
+    while (index->nodes[i].occupied && index->nodes[i].key != key)
+        i = (i + 1) & (index->cap - 1);
+    return &index->nodes[i];
+}
+
+/* Enter an interned name into a name index, unless it is there already.
+ * @index: The name index.
+ * @arena: The arena the nodes of the index are allocated from.
+ * @key: The interned name.
+ * @val: The value to be associated with the name.
+ */
+void name_index_put(name_index_t *index, arena_t *arena, char *key, void *val)
+{
+    /* keep the load factor at most 50% */
+    if ((index->size + 1) * 2 > index->cap) {
+        hashmap_node_t *old_nodes = index->nodes;
+        int old_cap = index->cap;
+
+        index->cap = old_cap ? old_cap << 1 : 32;
+        index->nodes = arena_calloc(arena, index->cap, sizeof(hashmap_node_t));
+        for (int i = 0; i < old_cap; i++) {
+            if (!old_nodes[i].occupied)
+                continue;
+
+            hashmap_node_t *node =
+                name_index_probe(index, old_nodes[i].key, old_nodes[i].hash);
+            node->key = old_nodes[i].key;
+            node->val = old_nodes[i].val;
+            node->hash = old_nodes[i].hash;
+            node->occupied = true;
+        }
+    }
+
+    int hash = intern_hash(key);
+    hashmap_node_t *node = name_index_probe(index, key, hash);
+
+    if (node->occupied)
+        return;
+    node->key = key;
+    node->val = val;
+    node->hash = hash;
+    node->occupied = true;
+    index->size++;
+}
+
+/* Return: The value of an interned name in a name index, NULL if the name is
+ * absent or is NULL.
+ */
+void *name_index_get(name_index_t *index, char *key)
+{
+    if (!index->size || !key)
+        return NULL;
+
+    hashmap_node_t *node = name_index_probe(index, key, intern_hash(key));
+    return node->occupied ? node->val : NULL;
+}
+
+/* Enter the fields of a type which follow the indexed ones into its name
+ * index. Indexing stops at a field whose name is not assigned yet.
+ */
+void index_members(type_t *type)
+{
+    for (; type->indexed < type->num_fields; type->indexed++) {
+        var_t *var = &type->fields[type->indexed];
+
+        if (!var->var_name[0])
+            return;
+        name_index_put(&type->index, GENERAL_ARENA,
+                       intern_string(var->var_name), var);
+    }
 }
 
 var_t *find_member(char token[], type_t *type)
@@ -829,23 +1148,82 @@ var_t *find_member(char token[], type_t *type)
     if (type->size == 0)
         type = type->base_struct;
 
-    for (int i = 0; i < type->num_fields; i++) {
+    if (type->num_fields - type->indexed >= MEMBERS_INDEX_THRESHOLD)
+        index_members(type);
+
+    var_t *var = name_index_get(&type->index, intern_lookup(token));
+    if (var)
+        return var;
+
+    /* the fields left out of the index are scanned */
+    for (int i = type->indexed; i < type->num_fields; i++) {
         if (!strcmp(type->fields[i].var_name, token))
             return &type->fields[i];
     }
     return NULL;
 }
 
-var_t *find_local_var(char *token, block_t *block)
+/* Enter the named locals of a block which follow the indexed ones into its
+ * hash index. Indexing stops at a local whose name is not assigned yet.
+ * Temporaries are never looked up by source identifiers and are skipped.
+ * The first declaration of a name is the one kept, as in a linear scan.
+ */
+void block_index_locals(block_t *block)
+{
+    var_list_t *var_list = &block->locals;
+
+    for (; block->indexed < var_list->size; block->indexed++) {
+        var_t *var = var_list->elements[block->indexed];
+
+        if (!var->var_name[0])
+            return;
+        if (var->var_name[0] == '.')
+            continue;
+        name_index_put(&block->index, BLOCK_ARENA,
+                       intern_string(var->var_name), var);
+    }
+}
+
+/* Find a variable declared directly in the given block.
+ * @token: The name of the variable.
+ * @key: The interned name as returned by 'intern_lookup', NULL if the name
+ * has never been interned.
+ * @block: The block to be searched.
+ *
+ * Return: The first local of the block with the given name, NULL otherwise.
+ */
+var_t *find_block_var(char *token, char *key, block_t *block)
+{
+    var_list_t *var_list = &block->locals;
+    int i = 0;
+
+    if (token[0] != '.') {
+        if (var_list->size - block->indexed >= LOCALS_INDEX_THRESHOLD)
+            block_index_locals(block);
+
+        var_t *var = name_index_get(&block->index, key);
+        if (var)
+            return var;
+
+        /* the locals left out of the index are scanned */
+        i = block->indexed;
+    }
+
+    for (; i < var_list->size; i++) {
+        if (!strcmp(var_list->elements[i]->var_name, token))
+            return var_list->elements[i];
+    }
+    return NULL;
+}
+
+var_t *find_scoped_var(char *token, char *key, block_t *block)
 {
     func_t *func = block->func;
 
     for (; block; block = block->parent) {
-        var_list_t *var_list = &block->locals;
-        for (int i = 0; i < var_list->size; i++) {
-            if (!strcmp(var_list->elements[i]->var_name, token))
-                return var_list->elements[i];
-        }
+        var_t *var = find_block_var(token, key, block);
+        if (var)
+            return var;
     }
 
     if (func) {
@@ -857,22 +1235,22 @@ var_t *find_local_var(char *token, block_t *block)
     return NULL;
 }
 
-var_t *find_global_var(char *token)
+var_t *find_local_var(char *token, block_t *block)
 {
-    var_list_t *var_list = &GLOBAL_BLOCK->locals;
+    return find_scoped_var(token, intern_lookup(token), block);
+}
 
-    for (int i = 0; i < var_list->size; i++) {
-        if (!strcmp(var_list->elements[i]->var_name, token))
-            return var_list->elements[i];
-    }
-    return NULL;
+var_t *find_global_var(char *token)
+{
+    return find_block_var(token, intern_lookup(token), GLOBAL_BLOCK);
 }
 
 var_t *find_var(char *token, block_t *parent)
 {
-    var_t *var = find_local_var(token, parent);
+    char *key = intern_lookup(token);
+    var_t *var = find_scoped_var(token, key, parent);
     if (!var)
-        var = find_global_var(token);
+        var = find_block_var(token, key, GLOBAL_BLOCK);
     return var;
 }
 
@@ -908,15 +1286,16 @@ int size_var(var_t *var)
  */
 func_t *add_func(char *func_name, bool synthesize)
 {
-    func_t *func = hashmap_get(FUNC_MAP, func_name);
+    func_name = intern_string(func_name);
+    func_t *func = hashmap_get_interned(FUNC_MAP, func_name);
 
     if (func)
         return func;
 
     func = arena_alloc_func();
-    hashmap_put(FUNC_MAP, func_name, func);
+    hashmap_put_interned(FUNC_MAP, func_name, func);
     /* Use interned string for function name */
-    strcpy(func->return_def.var_name, intern_string(func_name));
+    strcpy(func->return_def.var_name, func_name);
     func->stack_size = 4;
 
     if (synthesize)
@@ -940,13 +1319,21 @@ func_t *add_func(char *func_name, bool synthesize)
  */
 func_t *find_func(char *func_name)
 {
-    return hashmap_get(FUNC_MAP, func_name);
+    return hashmap_get_interned(FUNC_MAP, intern_lookup(func_name));
+}
+
+/* Append a basic block to a list, growing the list as needed */
+void bb_list_add(bb_list_t *list, basic_block_t *bb)
+{
+    list->elements = arena_grow(BB_ARENA, list->elements, list->size + 1,
+                                sizeof(basic_block_t *));
+    list->elements[list->size++] = bb;
 }
 
 /* Create a basic block and set the scope of variables to 'parent' block */
 basic_block_t *bb_create(block_t *parent)
 {
-    /* Use arena_calloc for basic_block_t as it has many arrays that need
+    /* Use arena_calloc for basic_block_t as it has many lists that need
      * zeroing (live_gen, live_kill, live_in, live_out, DF, RDF, dom_next, etc.)
      * This is simpler and safer than manually initializing everything.
      */
@@ -956,16 +1343,24 @@ basic_block_t *bb_create(block_t *parent)
     bb->scope = parent;
     bb->belong_to = parent->func;
 
-    /* Initialize prev array with NEXT type */
-    for (int i = 0; i < MAX_BB_PRED; i++)
-        bb->prev[i].type = NEXT;
-
     if (dump_ir)
         snprintf(bb->bb_label_name, MAX_VAR_LEN, ".label.%d", bb_label_idx++);
 
     return bb;
 }
 
+/* Drops the cached DFS orders and dominator tree of 'func' once its CFG has
+ * changed
+ */
+void func_invalidate_dfs(func_t *func)
+{
+    if (!func)
+        return;
+    func->dfs_valid = false;
+    func->rdfs_valid = false;
+    func->dom_valid = false;
+}
+
 /* The pred-succ pair must have only one connection */
 void bb_connect(basic_block_t *pred,
                 basic_block_t *succ,
@@ -976,17 +1371,20 @@ void bb_connect(basic_block_t *pred,
     if (!succ)
         abort();
 
+    /* reuse the first slot left by a disconnected predecessor */
     int i = 0;
-    while (succ->prev[i].bb)
+    while (i < succ->prev_size && succ->prev[i].bb)
         i++;
 
-    if (i > MAX_BB_PRED - 1) {
-        printf("Error: too many predecessors\n");
-        abort();
+    if (i == succ->prev_size) {
+        succ->prev = arena_grow(BB_ARENA, succ->prev, succ->prev_size + 1,
+                                sizeof(bb_connection_t));
+        succ->prev_size++;
     }
 
     succ->prev[i].bb = pred;
     succ->prev[i].type = type;
+    func_invalidate_dfs(pred->belong_to);
 
     switch (type) {
     case NEXT:
@@ -1006,7 +1404,7 @@ void bb_connect(basic_block_t *pred,
 /* The pred-succ pair must have only one connection */
 void bb_disconnect(basic_block_t *pred, basic_block_t *succ)
 {
-    for (int i = 0; i < MAX_BB_PRED; i++) {
+    for (int i = 0; i < succ->prev_size; i++) {
         if (succ->prev[i].bb == pred) {
             switch (succ->prev[i].type) {
             case NEXT:
@@ -1023,6 +1421,7 @@ void bb_disconnect(basic_block_t *pred, basic_block_t *succ)
             }
 
             succ->prev[i].bb = NULL;
+            func_invalidate_dfs(pred->belong_to);
             break;
         }
     }
@@ -1053,17 +1452,17 @@ void add_symbol(basic_block_t *bb, var_t *var)
     }
 }
 
-void add_insn(block_t *block,
-              basic_block_t *bb,
-              opcode_t op,
-              var_t *rd,
-              var_t *rs1,
-              var_t *rs2,
-              int sz,
-              char *str)
+insn_t *add_insn(block_t *block,
+                 basic_block_t *bb,
+                 opcode_t op,
+                 var_t *rd,
+                 var_t *rs1,
+                 var_t *rs2,
+                 int sz,
+                 char *str)
 {
     if (!bb)
-        return;
+        return NULL;
 
     bb->scope = block;
 
@@ -1079,11 +1478,8 @@ void add_insn(block_t *block,
     n->belong_to = bb;
     n->phi_ops = NULL;
     n->idx = 0;
-
-    if (str)
-        strcpy(n->str, intern_string(str));
-    else
-        n->str[0] = '\0';
+    n->str = str ? intern_string(str) : NULL;
+    n->func = NULL;
 
     /* Mark variables as address-taken to prevent incorrect constant
      * optimization
@@ -1100,6 +1496,7 @@ void add_insn(block_t *block,
 
     n->prev = bb->insn_list.tail;
     bb->insn_list.tail = n;
+    return n;
 }
 
 strbuf_t *strbuf_create(int init_capacity)
@@ -1155,19 +1552,23 @@ bool strbuf_putc(strbuf_t *src, char value)
     return true;
 }
 
-bool strbuf_puts(strbuf_t *src, const char *value)
+/* Append a block of len bytes, which may contain null characters */
+bool strbuf_putn(strbuf_t *src, const char *value, int len)
 {
-    int len = strlen(value);
-
     if (!strbuf_extend(src, len))
         return false;
 
-    strncpy(src->elements + src->size, value, len);
+    memcpy(src->elements + src->size, value, len);
     src->size += len;
 
     return true;
 }
 
+bool strbuf_puts(strbuf_t *src, const char *value)
+{
+    return strbuf_putn(src, value, strlen(value));
+}
+
 void strbuf_free(strbuf_t *src)
 {
     if (!src)
@@ -1184,7 +1585,7 @@ void global_init(void)
 {
     elf_code_start = ELF_START + elf_header_len;
 
-    MACROS_MAP = hashmap_create(MAX_ALIASES);
+    MACROS_MAP = hashmap_create(DEFAULT_ALIASES_SIZE);
 
     /* Initialize arenas first so we can use them for allocation */
     BLOCK_ARENA = arena_init(DEFAULT_ARENA_SIZE); /* Variables/blocks */
@@ -1195,9 +1596,13 @@ void global_init(void)
         arena_init(DEFAULT_ARENA_SIZE); /* For TYPES and PH2_IR_FLATTEN */
 
     /* Use arena allocation for better memory management */
-    TYPES = arena_alloc(GENERAL_ARENA, MAX_TYPES * sizeof(type_t));
-    PH2_IR_FLATTEN =
-        arena_alloc(GENERAL_ARENA, MAX_IR_INSTR * sizeof(ph2_ir_t *));
+    TYPES =
+        arena_grow(GENERAL_ARENA, NULL, DEFAULT_TYPES_SIZE, sizeof(type_t *));
+    TYPE_TAGS_MAP = hashmap_create(DEFAULT_TYPES_SIZE);
+    TYPE_NAMES_MAP = hashmap_create(DEFAULT_TYPES_SIZE);
+    TYPE_ANY_MAP = hashmap_create(DEFAULT_TYPES_SIZE);
+    PH2_IR_FLATTEN = arena_grow(GENERAL_ARENA, NULL, DEFAULT_PH2_IR_SIZE,
+                                sizeof(ph2_ir_t *));
 
     /* Initialize string pool for identifier deduplication */
     string_pool = arena_alloc(GENERAL_ARENA, sizeof(string_pool_t));
@@ -1208,7 +1613,7 @@ void global_init(void)
         arena_alloc(GENERAL_ARENA, sizeof(string_literal_pool_t));
     string_literal_pool->literals = hashmap_create(256);
 
-    SOURCE = strbuf_create(MAX_SOURCE);
+    SOURCE = strbuf_create(DEFAULT_SOURCE_SIZE);
     FUNC_MAP = hashmap_create(DEFAULT_FUNCS_SIZE);
     INCLUSION_MAP = hashmap_create(DEFAULT_INCLUSIONS_SIZE);
 
@@ -1218,22 +1623,19 @@ void global_init(void)
     current_location.filename = NULL;
     TOKEN_POOL = NULL;
     TOKEN_BUFFER = NULL;
-    ALIASES_MAP = hashmap_create(MAX_ALIASES);
-    CONSTANTS_MAP = hashmap_create(MAX_CONSTANTS);
-
-    elf_code = strbuf_create(MAX_CODE);
-    elf_data = strbuf_create(MAX_DATA);
-    elf_rodata = strbuf_create(MAX_DATA);
-    elf_header = strbuf_create(MAX_HEADER);
-    elf_symtab = strbuf_create(MAX_SYMTAB);
-    elf_strtab = strbuf_create(MAX_STRTAB);
-    elf_section = strbuf_create(MAX_SECTION);
+    ALIASES_MAP = hashmap_create(DEFAULT_ALIASES_SIZE);
+    CONSTANTS_MAP = hashmap_create(DEFAULT_CONSTANTS_SIZE);
+
+    elf_code = strbuf_create(DEFAULT_CODE_SIZE);
+    elf_data = strbuf_create(DEFAULT_DATA_SIZE);
+    elf_rodata = strbuf_create(DEFAULT_DATA_SIZE);
+    elf_header = strbuf_create(DEFAULT_HEADER_SIZE);
+    elf_symtab = strbuf_create(DEFAULT_SYMTAB_SIZE);
+    elf_strtab = strbuf_create(DEFAULT_STRTAB_SIZE);
+    elf_section = strbuf_create(DEFAULT_SECTION_SIZE);
     elf_bss_size = 0;
 }
 
-/* Forward declaration for lexer cleanup */
-void lexer_cleanup(void);
-
 /* Free empty trailing blocks from an arena safely.
  * This only frees blocks that come after the last used block,
  * ensuring no pointers are invalidated.
@@ -1274,6 +1676,7 @@ int arena_free_trailing_blocks(arena_t *arena)
         }
     }
 
+    arena->freed_bytes += freed;
     return freed;
 }
 
@@ -1328,9 +1731,6 @@ int compact_arenas_selective(int phase_mask)
 
 void global_release(void)
 {
-    /* Cleanup lexer hashmaps */
-    lexer_cleanup();
-
     hashmap_free(MACROS_MAP);
 
     /* Free string interning hashmaps */
@@ -1358,6 +1758,9 @@ void global_release(void)
     hashmap_free(INCLUSION_MAP);
     hashmap_free(ALIASES_MAP);
     hashmap_free(CONSTANTS_MAP);
+    hashmap_free(TYPE_TAGS_MAP);
+    hashmap_free(TYPE_NAMES_MAP);
+    hashmap_free(TYPE_ANY_MAP);
 }
 
 /* Reports an error without specifying a position */
@@ -1382,8 +1785,12 @@ void error(char *msg)
 
     start_idx = offset + 1;
 
+    /* Lines are not length-limited, only show a window around the error */
+    if (SOURCE->size - start_idx > MAX_LINE_LEN - 16)
+        start_idx = SOURCE->size - (MAX_LINE_LEN - 16);
+
     for (offset = 0;
-         offset < MAX_SOURCE && (start_idx + offset) < SOURCE->size &&
+         offset < MAX_LINE_LEN && (start_idx + offset) < SOURCE->size &&
          SOURCE->elements[start_idx + offset] != '\n';
          offset++) {
         diagnostic[i++] = SOURCE->elements[start_idx + offset];
@@ -1641,10 +2048,8 @@ void dump_bb_insn(func_t *func, basic_block_t *bb, bool *at_func_start)
 void dump_bb_insn_by_dom(func_t *func, basic_block_t *bb, bool *at_func_start)
 {
     dump_bb_insn(func, bb, at_func_start);
-    for (int i = 0; i < MAX_BB_DOM_SUCC; i++) {
-        if (!bb->dom_next[i])
-            break;
-        dump_bb_insn_by_dom(func, bb->dom_next[i], at_func_start);
+    for (int i = 0; i < bb->dom_next.size; i++) {
+        dump_bb_insn_by_dom(func, bb->dom_next.elements[i], at_func_start);
     }
 }
 
@@ -1679,7 +2084,7 @@ void dump_insn(void)
         dump_bb_insn_by_dom(func, func->bbs, &at_func_start);
 
         /* Handle implicit return */
-        for (int i = 0; i < MAX_BB_PRED; i++) {
+        for (int i = 0; i < func->exit->prev_size; i++) {
             basic_block_t *bb = func->exit->prev[i].bb;
             if (!bb)
                 continue;
@@ -1700,3 +2105,279 @@ void dump_insn(void)
 
     printf("==<END OF INSN DUMP>==\n");
 }
+
+/* Compile-time profiling */
+
+phase_stat_t PHASE_STATS[MAX_PHASES];
+int phase_stats_idx = 0;
+
+/* Timestamps of the last phase boundary */
+clock_stamp_t phase_wall_stamp;
+clock_stamp_t phase_cpu_stamp;
+
+/* Return the microseconds elapsed on @clock_id since @stamp, and advance
+ * @stamp to the current time.
+ */
+int clock_lap_us(int clock_id, clock_stamp_t *stamp)
+{
+    struct timespec ts;
+    int us;
+
+    clock_gettime(clock_id, &ts);
+    us = (ts.tv_sec - stamp->sec) * 1000000;
+    us += (ts.tv_nsec - stamp->nsec) / 1000;
+    stamp->sec = ts.tv_sec;
+    stamp->nsec = ts.tv_nsec;
+    return us;
+}
+
+/* Mark the beginning of the next phase */
+void time_report_start(void)
+{
+    clock_lap_us(CLOCK_MONOTONIC, &phase_wall_stamp);
+    clock_lap_us(CLOCK_PROCESS_CPUTIME_ID, &phase_cpu_stamp);
+}
+
+void time_report_count_ir(phase_stat_t *stat)
+{
+    stat->funcs = 0;
+    stat->bbs = -1;
+    stat->insns = -1;
+    stat->ph2_irs = -1;
+
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
+
+        stat->funcs++;
+
+        /* Basic blocks are chained through rpo_next once SSA is built */
+        if (!func->bb_cnt)
+            continue;
+
+        if (stat->bbs < 0) {
+            stat->bbs = 0;
+            stat->insns = 0;
+            stat->ph2_irs = 0;
+        }
+
+        for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+            stat->bbs++;
+            for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next)
+                stat->insns++;
+            for (ph2_ir_t *ph2_ir = bb->ph2_ir_list.head; ph2_ir;
+                 ph2_ir = ph2_ir->next)
+                stat->ph2_irs++;
+        }
+    }
+}
+
+/* Arenas in the order of the COMPACT_ARENA_* bits */
+arena_t *report_arena(int idx)
+{
+    switch (idx) {
+    case 0:
+        return BLOCK_ARENA;
+    case 1:
+        return INSN_ARENA;
+    case 2:
+        return BB_ARENA;
+    case 3:
+        return HASHMAP_ARENA;
+    default:
+        return GENERAL_ARENA;
+    }
+}
+
+char *report_arena_name(int idx)
+{
+    switch (idx) {
+    case 0:
+        return "BLOCK";
+    case 1:
+        return "INSN";
+    case 2:
+        return "BB";
+    case 3:
+        return "HASHMAP";
+    default:
+        return "GENERAL";
+    }
+}
+
+/* Bytes released by compaction before the current phase */
+int mem_report_freed[NUM_ARENAS];
+
+void mem_report_snapshot(phase_stat_t *stat)
+{
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        arena_t *arena = report_arena(i);
+        arena_stat_t *as = &stat->arenas[i];
+
+        as->reserved = arena->total_bytes;
+        as->peak = arena->peak_bytes;
+        as->used = 0;
+        as->blocks = 0;
+        for (arena_block_t *block = arena->head; block; block = block->next) {
+            as->used += block->offset;
+            as->blocks++;
+        }
+        as->freed = arena->freed_bytes - mem_report_freed[i];
+        mem_report_freed[i] = arena->freed_bytes;
+    }
+}
+
+/* Close the running phase under @name and record its wall-clock time, CPU
+ * time, the size of the IR it left behind and the state of every arena.
+ * Called at each phase boundary in main(), i.e. after its compaction point.
+ */
+void report_phase(char *name)
+{
+    if (!time_report && !mem_report)
+        return;
+
+    if (phase_stats_idx >= MAX_PHASES)
+        fatal("Too many compilation phases");
+
+    phase_stat_t *stat = &PHASE_STATS[phase_stats_idx++];
+    stat->name = name;
+
+    if (mem_report)
+        mem_report_snapshot(stat);
+
+    if (time_report) {
+        stat->wall_us = clock_lap_us(CLOCK_MONOTONIC, &phase_wall_stamp);
+        stat->cpu_us =
+            clock_lap_us(CLOCK_PROCESS_CPUTIME_ID, &phase_cpu_stamp);
+        time_report_count_ir(stat);
+
+        /* Do not charge the counting to the next phase */
+        time_report_start();
+    }
+}
+
+/* Print @str left-aligned in a column of @width characters */
+void report_print_padded(char *str, int width)
+{
+    printf("%s", str);
+    for (int i = strlen(str); i < width; i++)
+        printf(" ");
+}
+
+void time_report_print_count(int count)
+{
+    if (count < 0)
+        printf("        -");
+    else
+        printf("%9d", count);
+}
+
+void time_report_print(void)
+{
+    int wall_us = 0, cpu_us = 0;
+
+    printf("phase         wall(us)  cpu(us)");
+    printf("    funcs      bbs    insns   ph2-ir\n");
+
+    for (int i = 0; i < phase_stats_idx; i++) {
+        phase_stat_t *stat = &PHASE_STATS[i];
+
+        report_print_padded(stat->name, 12);
+        printf("%10d%9d", stat->wall_us, stat->cpu_us);
+        time_report_print_count(stat->funcs);
+        time_report_print_count(stat->bbs);
+        time_report_print_count(stat->insns);
+        time_report_print_count(stat->ph2_irs);
+        printf("\n");
+
+        wall_us += stat->wall_us;
+        cpu_us += stat->cpu_us;
+    }
+
+    printf("total       %10d%9d\n", wall_us, cpu_us);
+}
+
+void time_report_json_count(strbuf_t *json, char *key, int count)
+{
+    char buf[MAX_ID_LEN];
+
+    if (count < 0)
+        snprintf(buf, MAX_ID_LEN, ", \"%s\": null", key);
+    else
+        snprintf(buf, MAX_ID_LEN, ", \"%s\": %d", key, count);
+    strbuf_puts(json, buf);
+}
+
+/* Write the collected phase statistics to @file in JSON */
+void time_report_write_json(char *file)
+{
+    strbuf_t *json = strbuf_create(4096);
+    char buf[MAX_LINE_LEN];
+    int wall_us = 0, cpu_us = 0;
+
+    strbuf_puts(json, "{\n  \"phases\": [\n");
+
+    for (int i = 0; i < phase_stats_idx; i++) {
+        phase_stat_t *stat = &PHASE_STATS[i];
+
+        snprintf(buf, MAX_LINE_LEN,
+                 "    {\"name\": \"%s\", \"wall_us\": %d, \"cpu_us\": %d",
+                 stat->name, stat->wall_us, stat->cpu_us);
+        strbuf_puts(json, buf);
+        time_report_json_count(json, "funcs", stat->funcs);
+        time_report_json_count(json, "bbs", stat->bbs);
+        time_report_json_count(json, "insns", stat->insns);
+        time_report_json_count(json, "ph2_irs", stat->ph2_irs);
+        strbuf_puts(json, i + 1 < phase_stats_idx ? "},\n" : "}\n");
+
+        wall_us += stat->wall_us;
+        cpu_us += stat->cpu_us;
+    }
+
+    snprintf(buf, MAX_LINE_LEN,
+             "  ],\n  \"total\": {\"wall_us\": %d, \"cpu_us\": %d}\n}\n",
+             wall_us, cpu_us);
+    strbuf_puts(json, buf);
+
+    FILE *fp = fopen(file, "wb");
+    if (!fp)
+        fatal("Unable to open time report file");
+
+    for (int i = 0; i < json->size; i++)
+        fputc(json->elements[i], fp);
+
+    fclose(fp);
+    strbuf_free(json);
+}
+
+/* Print the arenas as left by each phase. 'waste' is memory held in arena
+ * blocks that was never handed out, either the free tail of the head block or
+ * the remainder of older blocks that a larger allocation skipped over.
+ */
+void mem_report_print(void)
+{
+    int peak = 0;
+
+    printf("phase       arena     reserved       used       peak");
+    printf(" blocks     waste     freed\n");
+
+    for (int i = 0; i < phase_stats_idx; i++) {
+        phase_stat_t *stat = &PHASE_STATS[i];
+
+        for (int j = 0; j < NUM_ARENAS; j++) {
+            arena_stat_t *as = &stat->arenas[j];
+
+            report_print_padded(j ? "" : stat->name, 12);
+            report_print_padded(report_arena_name(j), 7);
+            printf("%11d%11d%11d%7d%10d%10d\n", as->reserved, as->used,
+                   as->peak, as->blocks, as->reserved - as->used, as->freed);
+        }
+    }
+
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        arena_t *arena = report_arena(i);
+        peak += arena->peak_bytes;
+    }
+    printf("sum of arena peaks: %d bytes\n", peak);
+}
@@ -10,144 +10,147 @@
 #include "defs.h"
 #include "globals.c"
 
-/* Hash table constants */
-#define NUM_DIRECTIVES 11
-#define NUM_KEYWORDS 18
-
-/* Token mapping structure for elegant initialization */
-typedef struct {
-    char *name;
-    token_t token;
-} token_mapping_t;
-
-/* Preprocessor directive hash table using existing shecc hashmap */
-hashmap_t *DIRECTIVE_MAP = NULL;
-/* C keywords hash table */
-hashmap_t *KEYWORD_MAP = NULL;
-/* Token arrays for cleanup */
-token_t *directive_tokens_storage = NULL;
-token_t *keyword_tokens_storage = NULL;
-
-void lex_init_directives()
-{
-    if (DIRECTIVE_MAP)
-        return;
-
-    DIRECTIVE_MAP = hashmap_create(16); /* Small capacity for directives */
-
-    /* Initialization using struct compound literals for elegance */
-    directive_tokens_storage =
-        arena_alloc(GENERAL_ARENA, NUM_DIRECTIVES * sizeof(token_t));
-
-    /* Use array compound literal for directive mappings */
-    token_mapping_t directives[] = {
-        {"#define", T_cppd_define},   {"#elif", T_cppd_elif},
-        {"#else", T_cppd_else},       {"#endif", T_cppd_endif},
-        {"#error", T_cppd_error},     {"#if", T_cppd_if},
-        {"#ifdef", T_cppd_ifdef},     {"#ifndef", T_cppd_ifndef},
-        {"#include", T_cppd_include}, {"#pragma", T_cppd_pragma},
-        {"#undef", T_cppd_undef},
-    };
-
-    /* hashmap insertion */
-    for (int i = 0; i < NUM_DIRECTIVES; i++) {
-        directive_tokens_storage[i] = directives[i].token;
-        hashmap_put(DIRECTIVE_MAP, directives[i].name,
-                    &directive_tokens_storage[i]);
-    }
-}
+/* Character classes, see lex_char_class */
+#define CC_SPACE 1   /* ' ' and '\t' */
+#define CC_NEWLINE 2 /* '\r' and '\n' */
+#define CC_DIGIT 4   /* 0-9 */
+#define CC_ALPHA 8   /* a-z, A-Z and '_' */
+#define CC_HEX 16    /* 0-9, a-f and A-F */
 
-void lex_init_keywords()
-{
-    if (KEYWORD_MAP)
-        return;
-
-    KEYWORD_MAP = hashmap_create(32); /* Capacity for keywords */
-
-    /* Initialization using struct compound literals for elegance */
-    keyword_tokens_storage =
-        arena_alloc(GENERAL_ARENA, NUM_KEYWORDS * sizeof(token_t));
-
-    /* Use array compound literal for keyword mappings */
-    token_mapping_t keywords[] = {
-        {"if", T_if},
-        {"while", T_while},
-        {"for", T_for},
-        {"do", T_do},
-        {"else", T_else},
-        {"return", T_return},
-        {"typedef", T_typedef},
-        {"enum", T_enum},
-        {"struct", T_struct},
-        {"sizeof", T_sizeof},
-        {"switch", T_switch},
-        {"case", T_case},
-        {"break", T_break},
-        {"default", T_default},
-        {"continue", T_continue},
-        {"goto", T_goto},
-        {"union", T_union},
-        {"const", T_const},
-    };
-
-    /* hashmap insertion */
-    for (int i = 0; i < NUM_KEYWORDS; i++) {
-        keyword_tokens_storage[i] = keywords[i].token;
-        hashmap_put(KEYWORD_MAP, keywords[i].name, &keyword_tokens_storage[i]);
-    }
-}
+/* Class bits of every character, indexed by its unsigned value */
+char lex_char_class[256];
 
-/* Hash table lookup for preprocessor directives */
-token_t lookup_directive(char *token)
+void lex_init(void)
 {
-    if (!DIRECTIVE_MAP)
-        lex_init_directives();
-
-    token_t *result = hashmap_get(DIRECTIVE_MAP, token);
-    if (result)
-        return *result;
-
-    return T_identifier;
+    int c;
+
+    lex_char_class[' '] = CC_SPACE;
+    lex_char_class['\t'] = CC_SPACE;
+    lex_char_class['\r'] = CC_NEWLINE;
+    lex_char_class['\n'] = CC_NEWLINE;
+    lex_char_class['_'] = CC_ALPHA;
+    for (c = '0'; c <= '9'; c++)
+        lex_char_class[c] = CC_DIGIT | CC_HEX;
+    for (c = 'a'; c <= 'z'; c++)
+        lex_char_class[c] = CC_ALPHA;
+    for (c = 'A'; c <= 'Z'; c++)
+        lex_char_class[c] = CC_ALPHA;
+    for (c = 'a'; c <= 'f'; c++)
+        lex_char_class[c] = CC_ALPHA | CC_HEX;
+    for (c = 'A'; c <= 'F'; c++)
+        lex_char_class[c] = CC_ALPHA | CC_HEX;
 }
 
-/* Hash table lookup for C keywords */
-token_t lookup_keyword(char *token)
+/* Look up a preprocessor directive, including its '#', by length and then by
+ * content.
+ */
+token_t lookup_directive(char *token, int len)
 {
-    if (!KEYWORD_MAP)
-        lex_init_keywords();
-
-    token_t *result = hashmap_get(KEYWORD_MAP, token);
-    if (result)
-        return *result;
-
+    switch (len) {
+    case 3:
+        if (!memcmp(token, "#if", 3))
+            return T_cppd_if;
+        break;
+    case 5:
+        if (!memcmp(token, "#else", 5))
+            return T_cppd_else;
+        if (!memcmp(token, "#elif", 5))
+            return T_cppd_elif;
+        break;
+    case 6:
+        if (!memcmp(token, "#endif", 6))
+            return T_cppd_endif;
+        if (!memcmp(token, "#ifdef", 6))
+            return T_cppd_ifdef;
+        if (!memcmp(token, "#undef", 6))
+            return T_cppd_undef;
+        if (!memcmp(token, "#error", 6))
+            return T_cppd_error;
+        break;
+    case 7:
+        if (!memcmp(token, "#define", 7))
+            return T_cppd_define;
+        if (!memcmp(token, "#ifndef", 7))
+            return T_cppd_ifndef;
+        if (!memcmp(token, "#pragma", 7))
+            return T_cppd_pragma;
+        break;
+    case 8:
+        if (!memcmp(token, "#include", 8))
+            return T_cppd_include;
+        break;
+    default:
+        break;
+    }
     return T_identifier;
 }
 
-
-/* Cleanup function for lexer hashmaps */
-void lexer_cleanup()
+/* Look up a C keyword by length, then by first character and content */
+token_t lookup_keyword(char *token, int len)
 {
-    if (DIRECTIVE_MAP) {
-        hashmap_free(DIRECTIVE_MAP);
-        DIRECTIVE_MAP = NULL;
-    }
-
-    if (KEYWORD_MAP) {
-        hashmap_free(KEYWORD_MAP);
-        KEYWORD_MAP = NULL;
+    switch (len) {
+    case 2:
+        if (token[0] == 'i' && token[1] == 'f')
+            return T_if;
+        if (token[0] == 'd' && token[1] == 'o')
+            return T_do;
+        break;
+    case 3:
+        if (token[0] == 'f' && token[1] == 'o' && token[2] == 'r')
+            return T_for;
+        break;
+    case 4:
+        if (token[0] == 'e') {
+            if (!memcmp(token, "else", 4))
+                return T_else;
+            if (!memcmp(token, "enum", 4))
+                return T_enum;
+        } else if (!memcmp(token, "case", 4))
+            return T_case;
+        else if (!memcmp(token, "goto", 4))
+            return T_goto;
+        break;
+    case 5:
+        if (token[0] == 'w' && !memcmp(token, "while", 5))
+            return T_while;
+        if (token[0] == 'b' && !memcmp(token, "break", 5))
+            return T_break;
+        if (token[0] == 'u' && !memcmp(token, "union", 5))
+            return T_union;
+        if (token[0] == 'c' && !memcmp(token, "const", 5))
+            return T_const;
+        break;
+    case 6:
+        if (token[0] == 'r' && !memcmp(token, "return", 6))
+            return T_return;
+        if (token[0] == 's') {
+            if (!memcmp(token, "struct", 6))
+                return T_struct;
+            if (!memcmp(token, "switch", 6))
+                return T_switch;
+            if (!memcmp(token, "sizeof", 6))
+                return T_sizeof;
+        }
+        break;
+    case 7:
+        if (!memcmp(token, "typedef", 7))
+            return T_typedef;
+        if (!memcmp(token, "default", 7))
+            return T_default;
+        break;
+    case 8:
+        if (!memcmp(token, "continue", 8))
+            return T_continue;
+        break;
+    default:
+        break;
     }
-
-    /* Token storage arrays are allocated from GENERAL_ARENA and will be
-     * automatically freed when the arena is freed in global_release().
-     * No need to explicitly free them here.
-     */
-    directive_tokens_storage = NULL;
-    keyword_tokens_storage = NULL;
+    return T_identifier;
 }
 
 bool is_whitespace(char c)
 {
-    return c == ' ' || c == '\t';
+    return lex_char_class[c & 0xFF] & CC_SPACE;
 }
 
 char peek_char(int offset);
@@ -155,25 +158,23 @@ char peek_char(int offset);
 
 bool is_newline(char c)
 {
-    return c == '\r' || c == '\n';
+    return lex_char_class[c & 0xFF] & CC_NEWLINE;
 }
 
 /* is it alphabet, number or '_'? */
 bool is_alnum(char c)
 {
-    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
-            (c >= '0' && c <= '9') || (c == '_'));
+    return lex_char_class[c & 0xFF] & (CC_ALPHA | CC_DIGIT);
 }
 
 bool is_digit(char c)
 {
-    return c >= '0' && c <= '9';
+    return lex_char_class[c & 0xFF] & CC_DIGIT;
 }
 
 bool is_hex(char c)
 {
-    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
-           (c >= 'A' && c <= 'F');
+    return lex_char_class[c & 0xFF] & CC_HEX;
 }
 
 int hex_digit_value(char c)
@@ -206,23 +207,43 @@ bool is_numeric(char buffer[])
 
 void skip_whitespace(void)
 {
+    char *src = SOURCE->elements;
     int pos = SOURCE->size;
+    int skipped = skip_newline ? CC_SPACE | CC_NEWLINE : CC_SPACE;
+
     while (true) {
-        /* Handle backslash-newline (line continuation) using local pos */
-        if (next_char == '\\' && SOURCE->elements[pos + 1] == '\n') {
-            pos += 2;
-            next_char = SOURCE->elements[pos];
+        if (lex_char_class[src[pos] & 0xFF] & skipped) {
+            pos++;
             continue;
         }
-        if (is_whitespace(next_char) ||
-            (skip_newline && is_newline(next_char))) {
-            pos++;
-            next_char = SOURCE->elements[pos];
+        /* Handle backslash-newline (line continuation) */
+        if (src[pos] == '\\' && src[pos + 1] == '\n') {
+            pos += 2;
             continue;
         }
         break;
     }
     SOURCE->size = pos;
+    next_char = src[pos];
+}
+
+/* Append the run of characters of the given classes at the current position
+ * to token_str from index 'i', and return the new length of token_str.
+ */
+int lex_scan(int i, int classes)
+{
+    char *src = SOURCE->elements;
+    int start = SOURCE->size, pos = start;
+
+    while (lex_char_class[src[pos] & 0xFF] & classes)
+        pos++;
+    if (i + pos - start > MAX_TOKEN_LEN - 1)
+        error("Token too long");
+
+    memcpy(token_str + i, src + start, pos - start);
+    SOURCE->size = pos;
+    next_char = src[pos];
+    return i + pos - start;
 }
 
 char read_char(bool is_skip_space)
@@ -239,26 +260,102 @@ char peek_char(int offset)
     return SOURCE->elements[SOURCE->size + offset];
 }
 
+/* Replace the identifier in 'token_str' with the value of its object-like
+ * macro, if any, and return the resulting token type.
+ */
+token_t lex_alias(void)
+{
+    char *alias = find_alias(token_str);
+    token_t t;
+
+    if (!alias)
+        return T_identifier;
+
+    /* FIXME: Special-casing _Bool alias handling is a workaround.
+     * Should integrate properly with type system.
+     */
+    if (is_numeric(alias)) {
+        t = T_numeric;
+    } else if (!strcmp(alias, "_Bool")) {
+        t = T_identifier;
+    } else {
+        t = T_string;
+    }
+
+    strcpy(token_str, alias);
+    return t;
+}
+
+/* Append the token just lexed to the stream, growing it as needed */
+void token_stream_push(token_stream_t *stream, token_t type)
+{
+    cached_token_t *token;
+
+    stream->tokens = arena_grow(GENERAL_ARENA, stream->tokens,
+                                stream->size + 1, sizeof(cached_token_t));
+
+    token = &stream->tokens[stream->size];
+    token->type = type;
+    token->value = token_str[0] ? intern_string(token_str) : NULL;
+    stream->size++;
+}
+
 /* Lex next token and returns its token type. Parameter 'aliasing' controls
  * preprocessor aliasing on identifier tokens (true = enable, false = disable).
  */
 token_t lex_token_impl(bool aliasing)
 {
+    /* Replay recorded tokens, e.g. the body of a function-like macro */
+    if (replay_token) {
+        token_t type = replay_token->type;
+
+        if (type == T_eof) {
+            /* end of the recording, continue with SOURCE */
+            replay_token = NULL;
+            return lex_token_impl(aliasing);
+        }
+
+        if (replay_token->value)
+            strcpy(token_str, replay_token->value);
+        else
+            token_str[0] = 0;
+        replay_token++;
+
+        if (type == T_identifier && aliasing)
+            return lex_alias();
+        return type;
+    }
+
     token_str[0] = 0;
 
+    /* Identifiers and keywords are the most common tokens, check them first
+     * and scan them in bulk.
+     */
+    if (lex_char_class[next_char & 0xFF] & CC_ALPHA) {
+        int len = lex_scan(0, CC_ALPHA | CC_DIGIT);
+        token_str[len] = 0;
+        skip_whitespace();
+
+        token_t keyword = lookup_keyword(token_str, len);
+        if (keyword != T_identifier)
+            return keyword;
+
+        if (aliasing)
+            return lex_alias();
+        return T_identifier;
+    }
+
     /* partial preprocessor */
     if (next_char == '#') {
-        int i = 0;
+        int len;
 
-        do {
-            if (i >= MAX_TOKEN_LEN - 1)
-                error("Token too long");
-            token_str[i++] = next_char;
-        } while (is_alnum(read_char(false)));
-        token_str[i] = 0;
+        token_str[0] = next_char;
+        read_char(false);
+        len = lex_scan(1, CC_ALPHA | CC_DIGIT);
+        token_str[len] = 0;
         skip_whitespace();
 
-        token_t directive = lookup_directive(token_str);
+        token_t directive = lookup_directive(token_str, len);
         if (directive != T_identifier)
             return directive;
         error("Unknown directive");
@@ -334,11 +431,7 @@ token_t lex_token_impl(bool aliasing)
             if (!is_hex(next_char))
                 error("Invalid hex literal: expected hex digit after 0x");
 
-            do {
-                if (i >= MAX_TOKEN_LEN - 1)
-                    error("Token too long");
-                token_str[i++] = next_char;
-            } while (is_hex(read_char(false)));
+            i = lex_scan(i, CC_HEX);
 
         } else if (token_str[0] == '0' && ((next_char | 32) == 'b')) {
             /* Binary literal: 0b or 0B */
@@ -370,12 +463,7 @@ token_t lex_token_impl(bool aliasing)
 
         } else {
             /* Decimal */
-            while (is_digit(next_char)) {
-                if (i >= MAX_TOKEN_LEN - 1)
-                    error("Token too long");
-                token_str[i++] = next_char;
-                read_char(false);
-            }
+            i = lex_scan(i, CC_DIGIT);
         }
 
         token_str[i] = 0;
@@ -747,131 +835,11 @@ token_t lex_token_impl(bool aliasing)
         return T_assign;
     }
 
-    if (is_alnum(next_char)) {
-        char *alias;
-        int i = 0;
-        do {
-            if (i >= MAX_TOKEN_LEN - 1)
-                error("Token too long");
-            token_str[i++] = next_char;
-        } while (is_alnum(read_char(false)));
-        token_str[i] = 0;
-        skip_whitespace();
-
-        /* Fast path for common keywords - avoid hashmap lookup */
-        token_t keyword = T_identifier;
-        int token_len = i; /* Length of the token string */
-
-        /* Check most common keywords inline based on token length and first
-         * character.
-         */
-        switch (token_len) {
-        case 2: /* 2-letter keywords: if, do */
-            if (token_str[0] == 'i' && token_str[1] == 'f')
-                keyword = T_if;
-            else if (token_str[0] == 'd' && token_str[1] == 'o')
-                keyword = T_do;
-            break;
-
-        case 3: /* 3-letter keywords: for */
-            if (token_str[0] == 'f' && token_str[1] == 'o' &&
-                token_str[2] == 'r')
-                keyword = T_for;
-            break;
-
-        case 4: /* 4-letter keywords: else, enum, case */
-            if (token_str[0] == 'e') {
-                if (!memcmp(token_str, "else", 4))
-                    keyword = T_else;
-                else if (!memcmp(token_str, "enum", 4))
-                    keyword = T_enum;
-            } else if (!memcmp(token_str, "case", 4))
-                keyword = T_case;
-            else if (!memcmp(token_str, "goto", 4))
-                keyword = T_goto;
-            break;
-
-        case 5: /* 5-letter keywords: while, break, union, const */
-            if (token_str[0] == 'w' && !memcmp(token_str, "while", 5))
-                keyword = T_while;
-            else if (token_str[0] == 'b' && !memcmp(token_str, "break", 5))
-                keyword = T_break;
-            else if (token_str[0] == 'u' && !memcmp(token_str, "union", 5))
-                keyword = T_union;
-            else if (token_str[0] == 'c' && !memcmp(token_str, "const", 5))
-                keyword = T_const;
-            break;
-
-        case 6: /* 6-letter keywords: return, struct, switch, sizeof */
-            if (token_str[0] == 'r' && !memcmp(token_str, "return", 6))
-                keyword = T_return;
-            else if (token_str[0] == 's') {
-                if (!memcmp(token_str, "struct", 6))
-                    keyword = T_struct;
-                else if (!memcmp(token_str, "switch", 6))
-                    keyword = T_switch;
-                else if (!memcmp(token_str, "sizeof", 6))
-                    keyword = T_sizeof;
-            }
-            break;
-
-        case 7: /* 7-letter keywords: typedef, default */
-            if (!memcmp(token_str, "typedef", 7))
-                keyword = T_typedef;
-            else if (!memcmp(token_str, "default", 7))
-                keyword = T_default;
-            break;
-
-        case 8: /* 8-letter keywords: continue */
-            if (!memcmp(token_str, "continue", 8))
-                keyword = T_continue;
-            break;
-
-        default:
-            /* Keywords longer than 8 chars or identifiers - use hashmap */
-            break;
-        }
-
-        /* Fall back to hashmap for uncommon keywords */
-        if (keyword == T_identifier)
-            keyword = lookup_keyword(token_str);
-
-        if (keyword != T_identifier)
-            return keyword;
-
-        if (aliasing) {
-            alias = find_alias(token_str);
-            if (alias) {
-                /* FIXME: Special-casing _Bool alias handling is a workaround.
-                 * Should integrate properly with type system.
-                 */
-                token_t t;
-
-                if (is_numeric(alias)) {
-                    t = T_numeric;
-                } else if (!strcmp(alias, "_Bool")) {
-                    t = T_identifier;
-                } else {
-                    t = T_string;
-                }
-
-                strcpy(token_str, alias);
-                return t;
-            }
-        }
-
-        return T_identifier;
-    }
-
-    /* This only happens when parsing a macro. Move to the token after the
-     * macro definition or return to where the macro has been called.
-     */
     if (next_char == '\n') {
-        if (macro_return_idx) {
-            SOURCE->size = macro_return_idx;
-            next_char = SOURCE->elements[SOURCE->size];
-        } else
-            next_char = read_char(true);
+        /* The body of a macro definition ends at the newline */
+        if (!skip_newline)
+            return T_eof;
+        next_char = read_char(true);
         return lex_token_impl(aliasing);
     }
 
@@ -899,11 +867,18 @@ token_t lex_token_internal(bool aliasing)
 }
 
 
-/* Skip the content. We only need the index where the macro body begins. */
-void skip_macro_body(void)
+/* Record the body of a function-like macro once, so that every expansion
+ * replays its tokens instead of lexing the definition again.
+ */
+void lex_macro_body(macro_t *macro)
 {
-    while (!is_newline(next_char))
-        next_token = lex_token();
+    token_t type;
+
+    macro->body.size = 0;
+    do {
+        type = lex_token_internal(false);
+        token_stream_push(&macro->body, type);
+    } while (type != T_eof);
 
     skip_newline = true;
     next_token = lex_token();
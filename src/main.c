@@ -59,6 +59,15 @@ int main(int argc, char *argv[])
             hard_mul_div = true;
         else if (!strcmp(argv[i], "--no-libc"))
             libc = false;
+        else if (!strcmp(argv[i], "--time-report"))
+            time_report = true;
+        else if (!strncmp(argv[i], "--time-report=", 14)) {
+            time_report = true;
+            time_report_file = argv[i] + 14;
+        } else if (!strcmp(argv[i], "--mem-report"))
+            mem_report = true;
+        else if (!strcmp(argv[i], "--fast-ra"))
+            fast_reg_alloc = true;
         else if (!strcmp(argv[i], "-o")) {
             if (i + 1 < argc) {
                 out = argv[i + 1];
@@ -76,10 +85,13 @@ int main(int argc, char *argv[])
         printf("Missing source file!\n");
         printf(
             "Usage: shecc [-o output] [+m] [--dump-ir] [--no-libc] "
-            "<input.c>\n");
+            "[--time-report[=file]] [--mem-report] [--fast-ra] <input.c>\n");
         return -1;
     }
 
+    if (time_report)
+        time_report_start();
+
     /* initialize global objects */
     global_init();
 
@@ -87,23 +99,34 @@ int main(int argc, char *argv[])
     if (libc)
         libc_generate();
 
+    report_phase("init");
+
     /* load and parse source code into IR */
     parse(in);
 
     /* Compact arenas after parsing to free temporary parse structures */
     compact_all_arenas();
+    report_phase("parse");
 
     ssa_build();
 
     /* dump first phase IR */
     if (dump_ir)
         dump_insn();
+    report_phase("ssa");
 
     /* SSA-based optimization */
     optimize();
 
+    /* Turn phis into copies along the edges reaching them */
+    out_of_ssa();
+
     /* Compact arenas after SSA optimization to free temporary SSA structures */
     compact_all_arenas();
+    report_phase("optimize");
+
+    /* Natural loops weight the spill costs of register allocation */
+    build_loops();
 
     /* SSA-based liveness analyses */
     liveness_analysis();
@@ -111,17 +134,21 @@ int main(int argc, char *argv[])
     /* Compact after liveness analysis - mainly traversal args in GENERAL_ARENA
      */
     compact_arenas_selective(COMPACT_ARENA_GENERAL);
+    report_phase("liveness");
 
     /* allocate register from IR */
     reg_alloc();
 
     /* Compact after register allocation - mainly INSN and BB arenas */
     compact_arenas_selective(COMPACT_ARENA_INSN | COMPACT_ARENA_BB);
+    report_phase("reg-alloc");
 
     peephole();
+    report_phase("peephole");
 
     /* Apply arch-specific IR tweaks before final codegen */
     arch_lower();
+    report_phase("arch-lower");
 
     /* flatten CFG to linear instruction */
     cfg_flatten();
@@ -132,12 +159,24 @@ int main(int argc, char *argv[])
     /* dump second phase IR */
     if (dump_ir)
         dump_ph2_ir();
+    report_phase("cfg-flatten");
 
     /* generate code from IR */
     code_generate();
+    report_phase("codegen");
 
     /* output code in ELF */
     elf_generate(out);
+    report_phase("elf");
+
+    if (time_report) {
+        time_report_print();
+        if (time_report_file)
+            time_report_write_json(time_report_file);
+    }
+
+    if (mem_report)
+        mem_report_print();
 
     /* release allocated objects */
     global_release();
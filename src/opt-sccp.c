@@ -7,195 +7,358 @@
 
 /* SCCP (Sparse Conditional Constant Propagation) Optimization Pass
  *
- * This optimization pass performs:
- * - Constant propagation through assignments
- * - Constant folding for arithmetic and comparison operations
- * - Branch folding when conditions are compile-time constants
- * - Dead code elimination through unreachable branch removal
+ * Wegman and Zadeck's algorithm over the SSA form. Every variable defined in
+ * the function starts undefined and is lowered to a constant or to varying,
+ * while a block is only evaluated once an executable edge reaches it. A branch
+ * on a constant makes only one of its edges executable, so code guarded by it
+ * is never considered. Every variable is lowered at most twice, which bounds
+ * the work and makes a single run reach the fixed point.
+ *
+ * Phi nodes are already unwound into copies at the end of the predecessors.
+ * A copy contributes to its phi only along an executable edge, and copies on
+ * the other edges are dropped together with the dead blocks and branches.
  */
 
-/* Simple constant propagation within basic blocks */
-bool simple_sccp(func_t *func)
+/* Variables whose lattice state dropped, and blocks found executable */
+var_t **sccp_vars;
+int sccp_vars_size = 0;
+basic_block_t **sccp_blocks;
+int sccp_blocks_size = 0;
+
+/* Lowers the state of 'var' to its meet with 'state' holding 'val' */
+void sccp_lower(var_t *var, sccp_state_t state, int val)
 {
-    if (!func || !func->bbs)
+    if (state == SCCP_UNDEF || var->sccp_state == SCCP_VARYING)
+        return;
+    if (var->sccp_state == SCCP_CONST) {
+        if (state == SCCP_CONST && var->sccp_val == val)
+            return;
+        state = SCCP_VARYING;
+    }
+
+    var->sccp_state = state;
+    var->sccp_val = val;
+
+    sccp_vars = arena_grow(GENERAL_ARENA, sccp_vars, sccp_vars_size + 1,
+                           sizeof(var_t *));
+    sccp_vars[sccp_vars_size++] = var;
+}
+
+/* Marks 'bb' executable, blocks are visited once SCCP reaches them */
+void sccp_reach(func_t *func, basic_block_t *bb)
+{
+    if (!bb || bb->visited == func->visited)
+        return;
+    bb->visited = func->visited;
+
+    sccp_blocks = arena_grow(GENERAL_ARENA, sccp_blocks, sccp_blocks_size + 1,
+                             sizeof(basic_block_t *));
+    sccp_blocks[sccp_blocks_size++] = bb;
+}
+
+/* Whether control may flow from 'pred' to its successor 'succ' */
+bool sccp_edge_executable(func_t *func,
+                          basic_block_t *pred,
+                          basic_block_t *succ)
+{
+    if (pred->visited != func->visited)
         return false;
 
-    bool changed = false;
+    insn_t *tail = pred->insn_list.tail;
+    if (!tail || tail->opcode != OP_branch)
+        return true;
 
-    /* Iterate through basic blocks */
-    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
-        /* Process instructions in the block */
-        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
-            /* Skip if no destination */
-            if (!insn->rd)
-                continue;
-
-            /* Handle simple constant propagation */
-            switch (insn->opcode) {
-            case OP_assign:
-                /* Propagate constants through assignments */
-                if (insn->rs1 && insn->rs1->is_const && !insn->rd->is_const) {
-                    insn->rd->is_const = true;
-                    insn->rd->init_val = insn->rs1->init_val;
-                    insn->opcode = OP_load_constant;
-                    insn->rs1 = NULL;
-                    changed = true;
-                }
-                break;
-
-            case OP_trunc:
-                /* Constant truncation optimization integrated into SCCP */
-                if (insn->rs1 && insn->rs1->is_const && !insn->rd->is_global &&
-                    insn->sz > 0) {
-                    int value = insn->rs1->init_val;
-                    int result = value;
-
-                    /* Perform truncation based on size */
-                    if (insn->sz == 1) {
-                        /* Truncate to 8 bits */
-                        result = value & 0xFF;
-                    } else if (insn->sz == 2) {
-                        /* Truncate to 16 bits */
-                        result = value & 0xFFFF;
-                    } else if (insn->sz == 4) {
-                        /* No truncation needed for 32-bit */
-                        result = value;
-                    } else {
-                        /* Invalid size, skip */
-                        break;
-                    }
-
-                    /* Convert to constant load */
-                    insn->opcode = OP_load_constant;
-                    insn->rd->is_const = true;
-                    insn->rd->init_val = result;
-                    insn->rs1 = NULL;
-                    insn->sz = 0;
-                    changed = true;
-                }
-                break;
-
-            case OP_sign_ext:
-                /* Constant sign extension optimization integrated into SCCP */
-                if (insn->rs1 && insn->rs1->is_const && !insn->rd->is_global &&
-                    insn->sz > 0) {
-                    int value = insn->rs1->init_val;
-                    int result = value;
-
-                    /* Perform sign extension based on source size */
-                    if (insn->sz == 1) {
-                        /* Sign extend from 8 bits */
-                        result = (value & 0x80) ? (value | 0xFFFFFF00)
-                                                : (value & 0xFF);
-                    } else if (insn->sz == 2) {
-                        /* Sign extend from 16 bits */
-                        result = (value & 0x8000) ? (value | 0xFFFF0000)
-                                                  : (value & 0xFFFF);
-                    } else if (insn->sz == 4) {
-                        /* No sign extension needed for 32-bit */
-                        result = value;
-                    } else {
-                        /* Invalid size, skip */
-                        break;
-                    }
-
-                    /* Convert to constant load */
-                    insn->opcode = OP_load_constant;
-                    insn->rd->is_const = true;
-                    insn->rd->init_val = result;
-                    insn->rs1 = NULL;
-                    insn->sz = 0;
-                    changed = true;
-                }
-                break;
-
-            case OP_add:
-            case OP_sub:
-            case OP_mul:
-            case OP_eq:
-            case OP_neq:
-            case OP_lt:
-            case OP_leq:
-            case OP_gt:
-            case OP_geq:
-                /* Unified constant folding for binary and comparison ops */
-                if (insn->rs1 && insn->rs1->is_const && insn->rs2 &&
-                    insn->rs2->is_const && !insn->rd->is_global) {
-                    int result = 0;
-                    const int l = insn->rs1->init_val, r = insn->rs2->init_val;
-
-                    /* Compute result based on operation type */
-                    switch (insn->opcode) {
-                    case OP_add:
-                        result = l + r;
-                        break;
-                    case OP_sub:
-                        result = l - r;
-                        break;
-                    case OP_mul:
-                        result = l * r;
-                        break;
-                    case OP_eq:
-                        result = (l == r);
-                        break;
-                    case OP_neq:
-                        result = (l != r);
-                        break;
-                    case OP_lt:
-                        result = (l < r);
-                        break;
-                    case OP_leq:
-                        result = (l <= r);
-                        break;
-                    case OP_gt:
-                        result = (l > r);
-                        break;
-                    case OP_geq:
-                        result = (l >= r);
-                        break;
-                    default:
-                        continue;
-                    }
-
-                    /* Convert to constant load */
-                    insn->opcode = OP_load_constant;
-                    insn->rd->is_const = true;
-                    insn->rd->init_val = result;
-                    insn->rs1 = NULL;
-                    insn->rs2 = NULL;
-                    changed = true;
-                }
-                break;
+    var_t *cond = tail->rs1;
+    if (cond->sccp_state == SCCP_UNDEF)
+        return false;
+    if (cond->sccp_state == SCCP_VARYING)
+        return true;
+    return succ == (cond->sccp_val ? pred->then_ : pred->else_);
+}
+
+/* Lowers 'rd' by the result of 'op' on constants, or to varying if the result
+ * is unknown at compile time.
+ */
+void sccp_fold(var_t *rd, opcode_t op, int l, int r, int sz)
+{
+    int res = 0;
+    bool known = true;
+
+    switch (op) {
+    case OP_add:
+        res = WRAP_ADD(l, r);
+        break;
+    case OP_sub:
+        res = WRAP_SUB(l, r);
+        break;
+    case OP_mul:
+        res = WRAP_MUL(l, r);
+        break;
+    case OP_div:
+        /* the quotient of INT_MIN by -1 overflows, and traps on some hosts */
+        known = r != 0 && (r != -1 || l != -2147483647 - 1);
+        if (known)
+            res = l / r;
+        break;
+    case OP_mod:
+        known = r != 0 && (r != -1 || l != -2147483647 - 1);
+        if (known)
+            res = l % r;
+        break;
+    case OP_lshift:
+        known = r >= 0 && r < 32;
+        if (known)
+            res = WRAP_SHL(l, r);
+        break;
+    case OP_rshift:
+        known = r >= 0 && r < 32;
+        if (known)
+            res = l >> r;
+        break;
+    case OP_bit_and:
+        res = l & r;
+        break;
+    case OP_bit_or:
+        res = l | r;
+        break;
+    case OP_bit_xor:
+        res = l ^ r;
+        break;
+    case OP_log_and:
+        res = l && r;
+        break;
+    case OP_log_or:
+        res = l || r;
+        break;
+    case OP_eq:
+        res = l == r;
+        break;
+    case OP_neq:
+        res = l != r;
+        break;
+    case OP_lt:
+        res = l < r;
+        break;
+    case OP_leq:
+        res = l <= r;
+        break;
+    case OP_gt:
+        res = l > r;
+        break;
+    case OP_geq:
+        res = l >= r;
+        break;
+    case OP_negate:
+        res = WRAP_NEG(l);
+        break;
+    case OP_bit_not:
+        res = ~l;
+        break;
+    case OP_log_not:
+        res = !l;
+        break;
+    case OP_trunc:
+        if (sz == 1)
+            res = l & 0xFF;
+        else if (sz == 2)
+            res = l & 0xFFFF;
+        else
+            res = l;
+        known = sz == 1 || sz == 2 || sz == 4;
+        break;
+    case OP_sign_ext:
+        if (sz == 1)
+            res = (l & 0x80) ? (l | 0xFFFFFF00) : (l & 0xFF);
+        else if (sz == 2)
+            res = (l & 0x8000) ? (l | 0xFFFF0000) : (l & 0xFFFF);
+        else
+            res = l;
+        known = sz == 1 || sz == 2 || sz == 4;
+        break;
+    default:
+        known = false;
+        break;
+    }
 
-            default:
-                /* Other opcodes - no optimization */
-                break;
+    if (known)
+        sccp_lower(rd, SCCP_CONST, res);
+    else
+        sccp_lower(rd, SCCP_VARYING, 0);
+}
+
+/* Lowers the destination of 'insn' by the value it computes */
+void sccp_visit_insn(func_t *func, insn_t *insn)
+{
+    var_t *rd = insn->rd;
+    if (!rd || rd->sccp_state == SCCP_VARYING)
+        return;
+
+    switch (insn->opcode) {
+    case OP_load_constant:
+        sccp_lower(rd, SCCP_CONST, rd->init_val);
+        return;
+    case OP_unwound_phi:
+        if (!sccp_edge_executable(func, insn->belong_to, insn->phi_bb))
+            return;
+        sccp_lower(rd, insn->rs1->sccp_state, insn->rs1->sccp_val);
+        return;
+    case OP_assign:
+        sccp_lower(rd, insn->rs1->sccp_state, insn->rs1->sccp_val);
+        return;
+    default:
+        break;
+    }
+
+    int l = 0, r = 0;
+    if (insn->rs1) {
+        if (insn->rs1->sccp_state == SCCP_UNDEF)
+            return;
+        if (insn->rs1->sccp_state == SCCP_VARYING) {
+            sccp_lower(rd, SCCP_VARYING, 0);
+            return;
+        }
+        l = insn->rs1->sccp_val;
+    }
+    if (insn->rs2) {
+        if (insn->rs2->sccp_state == SCCP_UNDEF)
+            return;
+        if (insn->rs2->sccp_state == SCCP_VARYING) {
+            sccp_lower(rd, SCCP_VARYING, 0);
+            return;
+        }
+        r = insn->rs2->sccp_val;
+    }
+
+    if (insn->rs1)
+        sccp_fold(rd, insn->opcode, l, r, insn->sz);
+    else
+        sccp_lower(rd, SCCP_VARYING, 0);
+}
+
+/* Reaches the successors of 'bb' along its executable edges, and lets its
+ * copies into phis see which of those edges are now executable.
+ */
+void sccp_visit_edges(func_t *func, basic_block_t *bb)
+{
+    if (bb->next)
+        sccp_reach(func, bb->next);
+    if (bb->then_ && sccp_edge_executable(func, bb, bb->then_))
+        sccp_reach(func, bb->then_);
+    if (bb->else_ && sccp_edge_executable(func, bb, bb->else_))
+        sccp_reach(func, bb->else_);
+
+    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+        if (insn->opcode == OP_unwound_phi)
+            sccp_visit_insn(func, insn);
+    }
+}
+
+/* Replaces the code SCCP proved constant or unreachable in 'bb' */
+void sccp_rewrite(func_t *func, basic_block_t *bb)
+{
+    /* Unlink statically dead blocks, which drops them from the next RPO */
+    if (bb->visited != func->visited) {
+        if (bb->next)
+            bb_disconnect(bb, bb->next);
+        if (bb->then_)
+            bb_disconnect(bb, bb->then_);
+        if (bb->else_)
+            bb_disconnect(bb, bb->else_);
+        return;
+    }
+
+    insn_t *insn = bb->insn_list.head;
+    while (insn) {
+        insn_t *next = insn->next;
+        var_t *rd = insn->rd;
+
+        if (insn->opcode == OP_unwound_phi &&
+            !sccp_edge_executable(func, bb, insn->phi_bb)) {
+            /* the phi input of a dead edge */
+            if (insn->next)
+                insn->next->prev = insn->prev;
+            else
+                bb->insn_list.tail = insn->prev;
+            if (insn->prev)
+                insn->prev->next = insn->next;
+            else
+                bb->insn_list.head = insn->next;
+        } else if (rd && rd->sccp_state == SCCP_CONST) {
+            rd->is_const = true;
+            rd->init_val = rd->sccp_val;
+
+            /* copies into a constant phi are dropped out of SSA */
+            if (insn->opcode != OP_unwound_phi) {
+                insn->opcode = OP_load_constant;
+                insn->rs1 = NULL;
+                insn->rs2 = NULL;
+                insn->sz = 0;
             }
         }
+        insn = next;
+    }
 
-        /* Simple constant branch folding */
-        insn_t *last = bb->insn_list.tail;
-        if (last && last->opcode == OP_branch) {
-            if (last->rs1 && last->rs1->is_const) {
-                /* Convert to unconditional jump */
-                last->opcode = OP_jump;
+    insn_t *tail = bb->insn_list.tail;
+    if (!tail || tail->opcode != OP_branch ||
+        tail->rs1->sccp_state != SCCP_CONST)
+        return;
 
-                if (last->rs1->init_val != 0) {
-                    /* Take then branch */
-                    bb->else_ = NULL;
-                } else {
-                    /* Take else branch */
-                    bb->then_ = bb->else_;
-                    bb->else_ = NULL;
-                }
+    /* Fold the constant branch, register allocation emits the jump */
+    basic_block_t *taken = tail->rs1->sccp_val ? bb->then_ : bb->else_;
+    bb_disconnect(bb, bb->then_);
+    bb_disconnect(bb, bb->else_);
+    bb_connect(bb, taken, NEXT);
 
-                last->rs1 = NULL;
-                changed = true;
+    if (tail->prev)
+        tail->prev->next = NULL;
+    else
+        bb->insn_list.head = NULL;
+    bb->insn_list.tail = tail->prev;
+}
+
+/* Sparse conditional constant propagation over the blocks in RPO, the caller
+ * rebuilds the RPO afterwards to drop the blocks which became unreachable.
+ */
+void sccp(func_t *func)
+{
+    /* Only locals defined in the function have a value to find */
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+            var_t *rd = insn->rd;
+            if (rd && !rd->is_global && !rd->address_taken)
+                rd->sccp_state = SCCP_UNDEF;
+        }
+    }
+
+    func->visited++;
+    sccp_vars_size = 0;
+    sccp_blocks_size = 0;
+    sccp_reach(func, func->bbs);
+
+    while (sccp_vars_size || sccp_blocks_size) {
+        if (sccp_vars_size) {
+            var_t *var = sccp_vars[--sccp_vars_size];
+            for (use_chain_t *u = var->users_head; u; u = u->next) {
+                insn_t *insn = u->insn;
+                basic_block_t *bb = insn->belong_to;
+                if (bb->visited != func->visited)
+                    continue;
+                if (insn->opcode == OP_branch)
+                    sccp_visit_edges(func, bb);
+                else
+                    sccp_visit_insn(func, insn);
             }
+            continue;
         }
+
+        basic_block_t *bb = sccp_blocks[--sccp_blocks_size];
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next)
+            sccp_visit_insn(func, insn);
+        sccp_visit_edges(func, bb);
     }
 
-    return changed;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next)
+        sccp_rewrite(func, bb);
 }
 
 /* Targeted constant truncation peephole optimization */
@@ -21,19 +21,19 @@ insn_t side_effect[10];
 int se_idx = 0;
 
 /* Control flow utilities */
-basic_block_t *break_bb[MAX_NESTING];
+basic_block_t **break_bb;
 int break_exit_idx = 0;
-basic_block_t *continue_bb[MAX_NESTING];
+basic_block_t **continue_bb;
 int continue_pos_idx = 0;
 
 /* Label utilities */
-label_t labels[MAX_LABELS];
+label_t *labels;
 int label_idx = 0;
-basic_block_t *backpatch_bb[MAX_LABELS];
+basic_block_t **backpatch_bb;
 int backpatch_bb_idx = 0;
 
 /* stack of the operands of 3AC */
-var_t *operand_stack[MAX_OPERAND_STACK_SIZE];
+var_t **operand_stack;
 int operand_stack_idx = 0;
 
 /* Forward declarations */
@@ -58,14 +58,29 @@ label_t *find_label(char *name)
 
 void add_label(char *name, basic_block_t *bb)
 {
-    if (label_idx > MAX_LABELS - 1)
-        error("Too many labels in function");
+    labels = arena_grow(GENERAL_ARENA, labels, label_idx + 1, sizeof(label_t));
 
     label_t *l = &labels[label_idx++];
     strncpy(l->label_name, name, MAX_ID_LEN);
     l->bb = bb;
 }
 
+/* Enter the target of 'break' for a loop or switch being parsed */
+void push_break_bb(basic_block_t *bb)
+{
+    break_bb = arena_grow(GENERAL_ARENA, break_bb, break_exit_idx + 1,
+                          sizeof(basic_block_t *));
+    break_bb[break_exit_idx++] = bb;
+}
+
+/* Enter the target of 'continue' for a loop being parsed */
+void push_continue_bb(basic_block_t *bb)
+{
+    continue_bb = arena_grow(GENERAL_ARENA, continue_bb, continue_pos_idx + 1,
+                             sizeof(basic_block_t *));
+    continue_bb[continue_pos_idx++] = bb;
+}
+
 char *gen_name_to(char *buf)
 {
     sprintf(buf, ".t%d", global_var_idx++);
@@ -146,6 +161,8 @@ var_t *require_deref_var(block_t *blk, type_t *type, int ptr)
 
 void opstack_push(var_t *var)
 {
+    operand_stack = arena_grow(GENERAL_ARENA, operand_stack,
+                               operand_stack_idx + 1, sizeof(var_t *));
     operand_stack[operand_stack_idx++] = var;
 }
 
@@ -549,6 +566,27 @@ void read_defined_macro(void)
     check_def(lookup_alias, true);
 }
 
+/* Record the arguments of a function-like macro invocation, the next token
+ * being its opening bracket. Each argument is kept in 'macro->args' together
+ * with the ',' or ')' after it, so that every use of a parameter replays it.
+ */
+void read_macro_args(macro_t *macro)
+{
+    macro->num_params = 0;
+    macro->args.size = 0;
+
+    while (!lex_peek(T_close_bracket, NULL)) {
+        macro->params[macro->num_params++] = macro->args.size;
+        do {
+            next_token = lex_token();
+            token_stream_push(&macro->args, next_token);
+        } while (next_token != T_comma && next_token != T_close_bracket);
+    }
+
+    /* past the last argument, continue after the invocation */
+    token_stream_push(&macro->args, T_eof);
+}
+
 /* read preprocessor directive at each potential positions: e.g., global
  * statement / body statement
  */
@@ -597,15 +635,14 @@ bool read_preproc_directive(void)
             skip_newline = false;
             while (lex_peek(T_identifier, alias)) {
                 lex_expect(T_identifier);
-                strcpy(macro->param_defs[macro->num_param_defs++].var_name,
-                       intern_string(alias));
+                macro->param_defs[macro->num_param_defs++] =
+                    intern_string(alias);
                 lex_accept(T_comma);
             }
             if (lex_accept(T_elipsis))
                 macro->is_variadic = true;
 
-            macro->start_source_idx = SOURCE->size;
-            skip_macro_body();
+            lex_macro_body(macro);
         } else {
             /* Empty alias, may be dummy alias serves as include guard */
             value[0] = 0;
@@ -996,7 +1033,7 @@ basic_block_t *handle_while_statement(block_t *parent, basic_block_t *bb)
     bb_connect(bb, n, NEXT);
     bb = n;
 
-    continue_bb[continue_pos_idx++] = bb;
+    push_continue_bb(bb);
 
     basic_block_t *cond = bb;
     lex_expect(T_open_bracket);
@@ -1010,7 +1047,7 @@ basic_block_t *handle_while_statement(block_t *parent, basic_block_t *bb)
     basic_block_t *else_ = bb_create(parent);
     bb_connect(bb, then_, THEN);
     bb_connect(bb, else_, ELSE);
-    break_bb[break_exit_idx++] = else_;
+    push_break_bb(else_);
 
     basic_block_t *body_ = read_body_statement(parent, then_);
 
@@ -1071,9 +1108,8 @@ basic_block_t *handle_goto_statement(block_t *parent, basic_block_t *bb)
         return else_;
     }
 
-    if (backpatch_bb_idx > MAX_LABELS - 1)
-        error("Too many forward-referenced labels");
-
+    backpatch_bb = arena_grow(GENERAL_ARENA, backpatch_bb, backpatch_bb_idx + 1,
+                              sizeof(basic_block_t *));
     backpatch_bb[backpatch_bb_idx++] = then_;
     return else_;
 }
@@ -1606,8 +1642,10 @@ void read_func_call(func_t *func, block_t *parent, basic_block_t **bb)
     /* direct function call */
     read_func_parameters(func, parent, bb);
 
-    add_insn(parent, *bb, OP_call, NULL, NULL, NULL, 0,
-             func->return_def.var_name);
+    insn_t *call = add_insn(parent, *bb, OP_call, NULL, NULL, NULL, 0,
+                            func->return_def.var_name);
+    if (call)
+        call->func = func;
 }
 
 void read_indirect_call(block_t *parent, basic_block_t **bb)
@@ -1933,6 +1971,7 @@ void read_expr_operand(block_t *parent, basic_block_t **bb)
                 int saved_pos = SOURCE->size;
                 char saved_char = next_char;
                 token_t saved_token = next_token;
+                cached_token_t *saved_replay = replay_token;
 
                 /* Try to parse as typename */
                 lex_expect(T_identifier);
@@ -1980,6 +2019,7 @@ void read_expr_operand(block_t *parent, basic_block_t **bb)
                     SOURCE->size = saved_pos;
                     next_char = saved_char;
                     next_token = saved_token;
+                    replay_token = saved_replay;
                 }
             }
         }
@@ -2208,16 +2248,20 @@ void read_expr_operand(block_t *parent, basic_block_t **bb)
 
         lex_peek(T_identifier, token);
 
-        /* is a constant or variable? */
-        constant_t *con = find_constant(token);
-        var_t *var = find_var(token, parent);
-        func_t *func = find_func(token);
-        int macro_param_idx = find_macro_param_src_idx(token, parent);
+        /* is a macro, constant, variable or function? Each lookup is only
+         * made when the ones taking precedence over it failed.
+         */
         macro_t *mac = find_macro(token);
+        int macro_param_idx = mac ? -1 : find_macro_param_idx(token, parent);
+        bool found = mac || macro_param_idx >= 0;
+        constant_t *con = found ? NULL : find_constant(token);
+        var_t *var = found || con ? NULL : find_var(token, parent);
+        func_t *func = found || con || var ? NULL : find_func(token);
 
         if (!strcmp(token, "__VA_ARGS__")) {
-            /* 'size' has pointed at the character after __VA_ARGS__ */
-            int remainder, t = SOURCE->size;
+            /* the replay has pointed at the token after __VA_ARGS__ */
+            cached_token_t *t = replay_token;
+            int remainder;
             macro_t *macro = parent->macro;
 
             if (!macro)
@@ -2227,52 +2271,36 @@ void read_expr_operand(block_t *parent, basic_block_t **bb)
 
             remainder = macro->num_params - macro->num_param_defs;
             for (int i = 0; i < remainder; i++) {
-                SOURCE->size = macro->params[macro->num_params - remainder + i];
-                next_char = SOURCE->elements[SOURCE->size];
+                int idx = macro->params[macro->num_params - remainder + i];
+                replay_token = &macro->args.tokens[idx];
                 next_token = lex_token();
                 read_expr(parent, bb);
             }
-            SOURCE->size = t;
-            next_char = SOURCE->elements[SOURCE->size];
+            replay_token = t;
             next_token = lex_token();
         } else if (mac) {
             if (parent->macro)
                 error("Nested macro is not yet supported");
 
             parent->macro = mac;
-            mac->num_params = 0;
             lex_expect(T_identifier);
+            read_macro_args(mac);
 
-            /* 'size' has pointed at the first parameter */
-            while (!lex_peek(T_close_bracket, NULL)) {
-                mac->params[mac->num_params++] = SOURCE->size;
-                do {
-                    next_token = lex_token();
-                } while (next_token != T_comma &&
-                         next_token != T_close_bracket);
-            }
-            /* move 'size' to the macro body */
-            macro_return_idx = SOURCE->size;
-            SOURCE->size = mac->start_source_idx;
-            next_char = SOURCE->elements[SOURCE->size];
+            /* replay the macro body, then continue after the invocation */
+            replay_token = mac->body.tokens;
             lex_expect(T_close_bracket);
 
-            skip_newline = 0;
             read_expr(parent, bb);
 
             /* cleanup */
-            skip_newline = 1;
             parent->macro = NULL;
-            macro_return_idx = 0;
-        } else if (macro_param_idx) {
-            /* "expand" the argument from where it comes from */
-            int t = SOURCE->size;
-            SOURCE->size = macro_param_idx;
-            next_char = SOURCE->elements[SOURCE->size];
+        } else if (macro_param_idx >= 0) {
+            /* "expand" the argument from the tokens recorded at the call */
+            cached_token_t *t = replay_token;
+            replay_token = &parent->macro->args.tokens[macro_param_idx];
             next_token = lex_token();
             read_expr(parent, bb);
-            SOURCE->size = t;
-            next_char = SOURCE->elements[SOURCE->size];
+            replay_token = t;
             next_token = lex_token();
         } else if (con) {
             vd = require_var(parent);
@@ -3988,7 +4016,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
 
         /* create exit jump for breaks */
         basic_block_t *switch_end = bb_create(parent);
-        break_bb[break_exit_idx++] = switch_end;
+        push_break_bb(switch_end);
         basic_block_t *true_body_ = bb_create(parent);
 
         lex_expect(T_open_curly);
@@ -4082,7 +4110,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         break_exit_idx--;
 
         int dangling = 1;
-        for (int i = 0; i < MAX_BB_PRED; i++)
+        for (int i = 0; i < switch_end->prev_size; i++)
             if (switch_end->prev[i].bb)
                 dangling = 0;
 
@@ -4163,7 +4191,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         basic_block_t *cond_ = bb_create(blk);
         basic_block_t *for_end = bb_create(parent);
         basic_block_t *cond_start = cond_;
-        break_bb[break_exit_idx++] = for_end;
+        push_break_bb(for_end);
         bb_connect(setup, cond_, NEXT);
 
         /* condition - check before the loop */
@@ -4184,7 +4212,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         add_insn(blk, cond_, OP_branch, NULL, vd, NULL, 0, NULL);
 
         basic_block_t *inc_ = bb_create(blk);
-        continue_bb[continue_pos_idx++] = inc_;
+        push_continue_bb(inc_);
 
         /* increment after each loop */
         if (!lex_accept(T_close_bracket)) {
@@ -4225,8 +4253,8 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         basic_block_t *cond_ = bb_create(parent);
         basic_block_t *do_while_end = bb_create(parent);
 
-        continue_bb[continue_pos_idx++] = cond_;
-        break_bb[break_exit_idx++] = do_while_end;
+        push_continue_bb(cond_);
+        push_break_bb(do_while_end);
 
         basic_block_t *do_body = read_body_statement(parent, bb);
         if (do_body)
@@ -4242,7 +4270,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
 
         lex_expect(T_semicolon);
 
-        for (int i = 0; i < MAX_BB_PRED; i++) {
+        for (int i = 0; i < cond_->prev_size; i++) {
             if (cond_->prev[i].bb) {
                 bb_connect(cond_, bb, THEN);
                 bb_connect(cond_, do_while_end, ELSE);
@@ -4499,33 +4527,27 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         error("Unexpected token");
 
     /* handle macro parameter substitution for statements */
-    int macro_param_idx = find_macro_param_src_idx(token, parent);
-    if (macro_param_idx && parent->macro) {
+    int macro_param_idx = find_macro_param_idx(token, parent);
+    if (macro_param_idx >= 0 && parent->macro) {
         /* save current state */
         int saved_size = SOURCE->size;
         char saved_char = next_char;
         int saved_token = next_token;
+        cached_token_t *saved_replay = replay_token;
 
         /* jump to parameter value */
-        SOURCE->size = macro_param_idx;
-        next_char = SOURCE->elements[SOURCE->size];
+        replay_token = &parent->macro->args.tokens[macro_param_idx];
         next_token = lex_token();
 
         /* extract the parameter value as identifier token */
-        if (lex_peek(T_identifier, token)) {
+        if (lex_peek(T_identifier, token))
             lex_expect(T_identifier);
-        } else {
-            /* parameter is not a simple identifier, restore state and continue
-             */
-            SOURCE->size = saved_size;
-            next_char = saved_char;
-            next_token = saved_token;
-        }
 
         /* restore source position */
         SOURCE->size = saved_size;
         next_char = saved_char;
         next_token = saved_token;
+        replay_token = saved_replay;
     }
 
     /* is it a variable declaration? */
@@ -4536,6 +4558,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         int saved_size = SOURCE->size;
         char saved_char = next_char;
         int saved_token = next_token;
+        cached_token_t *saved_replay = replay_token;
 
         /* Skip the asterisk to peek at the identifier */
         lex_accept(T_asterisk);
@@ -4553,6 +4576,7 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
         SOURCE->size = saved_size;
         next_char = saved_char;
         next_token = saved_token;
+        replay_token = saved_replay;
 
         /* If it's not a type, skip the declaration block */
         if (!could_be_type)
@@ -4775,29 +4799,17 @@ basic_block_t *read_body_statement(block_t *parent, basic_block_t *bb)
             error("Nested macro is not yet supported");
 
         parent->macro = mac;
-        mac->num_params = 0;
         lex_expect(T_identifier);
+        read_macro_args(mac);
 
-        /* 'size' has pointed at the first parameter */
-        while (!lex_peek(T_close_bracket, NULL)) {
-            mac->params[mac->num_params++] = SOURCE->size;
-            do {
-                next_token = lex_token();
-            } while (next_token != T_comma && next_token != T_close_bracket);
-        }
-        /* move 'size' to the macro body */
-        macro_return_idx = SOURCE->size;
-        SOURCE->size = mac->start_source_idx;
-        next_char = SOURCE->elements[SOURCE->size];
+        /* replay the macro body, then continue after the invocation */
+        replay_token = mac->body.tokens;
         lex_expect(T_close_bracket);
 
-        skip_newline = 0;
         bb = read_body_statement(parent, bb);
 
         /* cleanup */
-        skip_newline = 1;
         parent->macro = NULL;
-        macro_return_idx = 0;
         return bb;
     }
 
@@ -4989,7 +5001,7 @@ void read_global_decl(block_t *block, bool is_const)
             func = add_func(var->var_name, false);
 
         memcpy(&func->return_def, var, sizeof(var_t));
-        block->locals.size--;
+        block_pop_var(block);
         read_parameter_list_decl(func, 0);
 
         if (check_decl) {
@@ -5124,7 +5136,7 @@ void initialize_struct_field(var_t *nv, var_t *v, int offset)
     nv->in_loop = 0;
     nv->base = NULL;
     nv->subscript = 0;
-    nv->subscripts_idx = 0;
+    nv->rename = NULL;
 }
 
 void read_global_statement(void)
@@ -5138,7 +5150,7 @@ void read_global_statement(void)
         is_const = true;
 
     if (lex_accept(T_struct)) {
-        int i = 0, size = 0;
+        int size = 0;
 
         lex_ident(T_identifier, token);
 
@@ -5210,17 +5222,17 @@ void read_global_statement(void)
 
         lex_expect(T_open_curly);
         do {
-            var_t *v = &type->fields[i++];
+            int first = type->num_fields;
+            var_t *v = add_member(type);
             read_full_var_decl(v, false, true);
             v->offset = size;
             size += size_var(v);
 
             /* Handle multiple variable declarations with same base type */
             while (lex_accept(T_comma)) {
-                if (i >= MAX_FIELDS)
-                    error("Too many struct fields");
-
-                var_t *nv = &type->fields[i++];
+                var_t *nv = add_member(type);
+                /* adding a field may move the ones before it */
+                v = &type->fields[first];
                 initialize_struct_field(nv, v, 0);
                 read_inner_var_decl(nv, false, true);
                 nv->offset = size;
@@ -5231,10 +5243,9 @@ void read_global_statement(void)
         } while (!lex_accept(T_close_curly));
 
         type->size = size;
-        type->num_fields = i;
         lex_expect(T_semicolon);
     } else if (lex_accept(T_union)) {
-        int i = 0, max_size = 0;
+        int max_size = 0;
 
         lex_ident(T_identifier, token);
 
@@ -5248,7 +5259,8 @@ void read_global_statement(void)
 
         lex_expect(T_open_curly);
         do {
-            var_t *v = &type->fields[i++];
+            int first = type->num_fields;
+            var_t *v = add_member(type);
             read_full_var_decl(v, false, true);
             v->offset = 0; /* All union fields start at offset 0 */
             int field_size = size_var(v);
@@ -5257,10 +5269,9 @@ void read_global_statement(void)
 
             /* Handle multiple variable declarations with same base type */
             while (lex_accept(T_comma)) {
-                if (i >= MAX_FIELDS)
-                    error("Too many union fields");
-
-                var_t *nv = &type->fields[i++];
+                var_t *nv = add_member(type);
+                /* adding a field may move the ones before it */
+                v = &type->fields[first];
                 /* All union fields start at offset 0 */
                 initialize_struct_field(nv, v, 0);
                 read_inner_var_decl(nv, false, true);
@@ -5273,7 +5284,6 @@ void read_global_statement(void)
         } while (!lex_accept(T_close_curly));
 
         type->size = max_size;
-        type->num_fields = i;
         lex_expect(T_semicolon);
     } else if (lex_accept(T_typedef)) {
         if (lex_accept(T_enum)) {
@@ -5297,7 +5307,7 @@ void read_global_statement(void)
             strcpy(type->type_name, intern_string(token));
             lex_expect(T_semicolon);
         } else if (lex_accept(T_struct)) {
-            int i = 0, size = 0;
+            int size = 0;
             bool has_struct_def = false;
             type_t *tag = NULL, *type = add_type();
 
@@ -5318,7 +5328,8 @@ void read_global_statement(void)
             if (lex_accept(T_open_curly)) {
                 has_struct_def = true;
                 do {
-                    var_t *v = &type->fields[i++];
+                    int first = type->num_fields;
+                    var_t *v = add_member(type);
                     read_full_var_decl(v, false, true);
                     v->offset = size;
                     size += size_var(v);
@@ -5326,10 +5337,9 @@ void read_global_statement(void)
                     /* Handle multiple variable declarations with same base type
                      */
                     while (lex_accept(T_comma)) {
-                        if (i >= MAX_FIELDS)
-                            error("Too many struct fields");
-
-                        var_t *nv = &type->fields[i++];
+                        var_t *nv = add_member(type);
+                        /* adding a field may move the ones before it */
+                        v = &type->fields[first];
                         initialize_struct_field(nv, v, 0);
                         read_inner_var_decl(nv, false, true);
                         nv->offset = size;
@@ -5342,7 +5352,6 @@ void read_global_statement(void)
 
             lex_ident(T_identifier, type->type_name);
             type->size = size;
-            type->num_fields = i;
             type->base_type = TYPE_typedef;
 
             if (tag && has_struct_def == 1) {
@@ -5360,7 +5369,7 @@ void read_global_statement(void)
 
             lex_expect(T_semicolon);
         } else if (lex_accept(T_union)) {
-            int i = 0, max_size = 0;
+            int max_size = 0;
             bool has_union_def = false;
             type_t *tag = NULL, *type = add_type();
 
@@ -5381,7 +5390,8 @@ void read_global_statement(void)
             if (lex_accept(T_open_curly)) {
                 has_union_def = true;
                 do {
-                    var_t *v = &type->fields[i++];
+                    int first = type->num_fields;
+                    var_t *v = add_member(type);
                     read_full_var_decl(v, false, true);
                     v->offset = 0; /* All union fields start at offset 0 */
                     int field_size = size_var(v);
@@ -5391,10 +5401,9 @@ void read_global_statement(void)
                     /* Handle multiple variable declarations with same base type
                      */
                     while (lex_accept(T_comma)) {
-                        if (i >= MAX_FIELDS)
-                            error("Too many union fields");
-
-                        var_t *nv = &type->fields[i++];
+                        var_t *nv = add_member(type);
+                        /* adding a field may move the ones before it */
+                        v = &type->fields[first];
                         /* All union fields start at offset 0 */
                         initialize_struct_field(nv, v, 0);
                         read_inner_var_decl(nv, false, true);
@@ -5409,7 +5418,6 @@ void read_global_statement(void)
 
             lex_ident(T_identifier, type->type_name);
             type->size = max_size;
-            type->num_fields = i;
             type->base_type = TYPE_typedef;
 
             if (tag && has_union_def == 1) {
@@ -5504,6 +5512,7 @@ void parse_internal(void)
     func->bbs = arena_calloc(BB_ARENA, 1, sizeof(basic_block_t));
 
     /* lexer initialization */
+    lex_init();
     SOURCE->size = 0;
     next_char = SOURCE->elements[0];
     lex_expect(T_start);
@@ -5515,43 +5524,82 @@ void parse_internal(void)
     } while (!lex_accept(T_eof));
 }
 
-/* Load specified source file and referred inclusion recursively */
-void load_source_file(char *file)
+/* Read the whole content of a file into a new buffer. The content is
+ * terminated by a NUL byte which is not accounted in the buffer size.
+ */
+strbuf_t *read_source_file(char *file)
 {
-    char buffer[MAX_LINE_LEN];
-
     FILE *f = fopen(file, "rb");
     if (!f)
-        abort();
+        return NULL;
 
+    strbuf_t *src = strbuf_create(DEFAULT_READ_SIZE);
     for (;;) {
-        if (!fgets(buffer, MAX_LINE_LEN, f)) {
+        strbuf_extend(src, DEFAULT_READ_SIZE);
+        int n = fread(src->elements + src->size, 1,
+                      src->capacity - src->size - 1, f);
+        if (n <= 0)
             break;
-        }
-        if (!strncmp(buffer, "#pragma once", 12) &&
+        src->size += n;
+    }
+    src->elements[src->size] = 0;
+
+    fclose(f);
+    return src;
+}
+
+/* Load specified source file and referred inclusion recursively. Text between
+ * directives is spliced into SOURCE as whole blocks.
+ */
+void load_source_file(char *file)
+{
+    strbuf_t *src = read_source_file(file);
+    if (!src)
+        abort();
+
+    char *text = src->elements;
+    int start = 0; /* first byte not yet copied into SOURCE */
+    int pos = 0;
+
+    while (pos < src->size) {
+        int next = pos;
+        while (next < src->size && text[next] != '\n')
+            next++;
+        if (next < src->size)
+            next++;
+
+        if (!strncmp(text + pos, "#pragma once", 12) &&
             hashmap_contains(INCLUSION_MAP, file)) {
-            fclose(f);
+            strbuf_putn(SOURCE, text + start, pos - start);
+            strbuf_free(src);
             return;
         }
-        if (!strncmp(buffer, "#include ", 9) && (buffer[9] == '"')) {
-            char path[MAX_LINE_LEN];
-            int c = strlen(file) - 1, inclusion_path_len = strlen(buffer) - 11;
-            while (c > 0 && file[c] != '/')
-                c--;
-            if (c) {
-                /* prepend directory name */
-                snprintf(path, c + 2, "%s", file);
-            }
-
-            snprintf(path + c + 1, inclusion_path_len, "%s", buffer + 10);
+        if (!strncmp(text + pos, "#include ", 9) && (text[pos + 9] == '"')) {
+            char *name = text + pos + 10;
+            int name_len = 0, dir_len = strlen(file);
+
+            while (name + name_len < text + next && name[name_len] != '"')
+                name_len++;
+            /* inclusion paths are relative to the including file */
+            while (dir_len > 0 && file[dir_len - 1] != '/')
+                dir_len--;
+
+            char *path = malloc(dir_len + name_len + 1);
+            memcpy(path, file, dir_len);
+            memcpy(path + dir_len, name, name_len);
+            path[dir_len + name_len] = 0;
+
+            strbuf_putn(SOURCE, text + start, pos - start);
             load_source_file(path);
-        } else {
-            strbuf_puts(SOURCE, buffer);
+            free(path);
+            start = next;
         }
+        pos = next;
     }
 
+    strbuf_putn(SOURCE, text + start, src->size - start);
     hashmap_put(INCLUSION_MAP, file, NULL);
-    fclose(f);
+    strbuf_free(src);
 }
 
 void parse(char *file)
@@ -15,6 +15,32 @@
 #include "defs.h"
 #include "globals.c"
 
+/* Live intervals of the function under allocation, indexed by vreg_id */
+live_interval_t *intervals;
+int intervals_size = 0;
+
+/* 'ra_calls[i]' counts the positions up to 'i' where no value may be pinned,
+ * 'ra_starts[i]' and 'ra_ends[i]' head the lists of intervals starting and
+ * ending at 'i'.
+ */
+int *ra_calls;
+int *ra_starts;
+int *ra_ends;
+
+/* Bitset of the intervals by vreg_id, the candidates while they are built
+ * and the pinned ones afterwards
+ */
+int *ra_mask;
+int *ra_free_slots;
+
+/* Position of the instruction under allocation */
+int ra_pos = 0;
+
+bool is_pinned(var_t *var)
+{
+    return var->vreg_flags & VREG_PINNED;
+}
+
 void vreg_map_to_phys(var_t *var, int phys_reg)
 {
     if (var)
@@ -30,7 +56,8 @@ int vreg_get_phys(var_t *var)
 
 void vreg_clear_phys(var_t *var)
 {
-    if (var)
+    /* a pinned variable keeps its register */
+    if (var && !is_pinned(var))
         var->phys_reg = -1;
 }
 
@@ -47,11 +74,7 @@ int align_size(int i)
 
 bool check_live_out(basic_block_t *bb, var_t *var)
 {
-    for (int i = 0; i < bb->live_out.size; i++) {
-        if (bb->live_out.elements[i] == var)
-            return true;
-    }
-    return false;
+    return live_set_has(bb->live_out, var);
 }
 
 void track_var_use(var_t *var, int insn_idx)
@@ -72,7 +95,17 @@ void refresh(basic_block_t *bb, insn_t *insn)
     for (int i = 0; i < REG_CNT; i++) {
         if (!REGS[i].var)
             continue;
-        if (check_live_out(bb, REGS[i].var))
+        if (is_pinned(REGS[i].var)) {
+            if (intervals[REGS[i].var->vreg_id].end < ra_pos) {
+                REGS[i].var = NULL;
+                REGS[i].polluted = 0;
+            }
+            continue;
+        }
+        /* a live-out value is kept until the end of the block unless its
+         * stack slot already holds it
+         */
+        if (check_live_out(bb, REGS[i].var) && REGS[i].polluted)
             continue;
         if (REGS[i].var->consumed < insn->idx) {
             vreg_clear_phys(REGS[i].var);
@@ -92,7 +125,7 @@ ph2_ir_t *bb_add_ph2_ir(basic_block_t *bb, opcode_t op)
     n->src0 = 0;
     n->src1 = 0;
     n->dest = 0;
-    n->func_name[0] = '\0';
+    n->func = NULL;
     n->next_bb = NULL;
     n->then_bb = NULL;
     n->else_bb = NULL;
@@ -171,7 +204,7 @@ int find_best_spill(basic_block_t *bb,
         if (i == avoid_reg1 || i == avoid_reg2)
             continue;
 
-        if (!REGS[i].var)
+        if (!REGS[i].var || is_pinned(REGS[i].var))
             continue;
 
         int cost = calculate_spill_cost(REGS[i].var, bb, current_idx);
@@ -189,14 +222,9 @@ int find_best_spill(basic_block_t *bb,
  * - live_out variable
  * - farthest local variable
  */
-void spill_var(basic_block_t *bb, var_t *var, int idx)
+/* Writes register 'idx' back to the stack slot of 'var', keeping it cached */
+void store_var(basic_block_t *bb, var_t *var, int idx)
 {
-    if (!REGS[idx].polluted) {
-        REGS[idx].var = NULL;
-        vreg_clear_phys(var);
-        return;
-    }
-
     if (!var->offset) {
         var->offset = bb->belong_to->stack_size;
         bb->belong_to->stack_size += 4;
@@ -205,6 +233,15 @@ void spill_var(basic_block_t *bb, var_t *var, int idx)
                                   : bb_add_ph2_ir(bb, OP_store);
     ir->src0 = idx;
     ir->src1 = var->offset;
+    REGS[idx].polluted = 0;
+}
+
+void spill_var(basic_block_t *bb, var_t *var, int idx)
+{
+    /* a pinned value is never reloaded */
+    if (REGS[idx].polluted && !is_pinned(var))
+        store_var(bb, var, idx);
+
     REGS[idx].var = NULL;
     REGS[idx].polluted = 0;
     vreg_clear_phys(var);
@@ -246,6 +283,8 @@ int prepare_operand(basic_block_t *bb, var_t *var, int operand_0)
     int phys_reg = vreg_get_phys(var);
     if (phys_reg >= 0 && phys_reg < REG_CNT && REGS[phys_reg].var == var)
         return phys_reg;
+    if (is_pinned(var))
+        fatal("Pinned variable is not in its register");
 
     /* Force reload for address-taken variables (may be modified via pointer) */
     int i = find_in_regs(var);
@@ -267,7 +306,7 @@ int prepare_operand(basic_block_t *bb, var_t *var, int operand_0)
 
     if (spilled < 0) {
         for (i = 0; i < REG_CNT; i++) {
-            if (i != operand_0 && REGS[i].var) {
+            if (i != operand_0 && REGS[i].var && !is_pinned(REGS[i].var)) {
                 spilled = i;
                 break;
             }
@@ -287,6 +326,16 @@ int prepare_operand(basic_block_t *bb, var_t *var, int operand_0)
 int prepare_dest(basic_block_t *bb, var_t *var, int operand_0, int operand_1)
 {
     int phys_reg = vreg_get_phys(var);
+    if (is_pinned(var)) {
+        if (REGS[phys_reg].var != var) {
+            if (REGS[phys_reg].var)
+                spill_var(bb, REGS[phys_reg].var, phys_reg);
+            REGS[phys_reg].var = var;
+        }
+        REGS[phys_reg].polluted = 1;
+        return phys_reg;
+    }
+
     if (phys_reg >= 0 && phys_reg < REG_CNT && REGS[phys_reg].var == var) {
         REGS[phys_reg].polluted = 1;
         return phys_reg;
@@ -314,7 +363,8 @@ int prepare_dest(basic_block_t *bb, var_t *var, int operand_0, int operand_1)
 
     if (spilled < 0) {
         for (i = 0; i < REG_CNT; i++) {
-            if (i != operand_0 && i != operand_1 && REGS[i].var) {
+            if (i != operand_0 && i != operand_1 && REGS[i].var &&
+                !is_pinned(REGS[i].var)) {
                 spilled = i;
                 break;
             }
@@ -337,7 +387,8 @@ void spill_alive(basic_block_t *bb, insn_t *insn)
     /* Spill all locals on pointer writes (conservative aliasing handling) */
     if (insn && insn->opcode == OP_write) {
         for (int i = 0; i < REG_CNT; i++) {
-            if (REGS[i].var && !REGS[i].var->is_global)
+            if (REGS[i].var && !REGS[i].var->is_global &&
+                !is_pinned(REGS[i].var))
                 spill_var(bb, REGS[i].var, i);
         }
         return;
@@ -345,7 +396,7 @@ void spill_alive(basic_block_t *bb, insn_t *insn)
 
     /* Standard spilling for non-pointer operations */
     for (int i = 0; i < REG_CNT; i++) {
-        if (!REGS[i].var)
+        if (!REGS[i].var || is_pinned(REGS[i].var))
             continue;
         if (check_live_out(bb, REGS[i].var)) {
             spill_var(bb, REGS[i].var, i);
@@ -369,7 +420,7 @@ void spill_live_out(basic_block_t *bb)
             REGS[i].polluted = 0;
             continue;
         }
-        if (!var_check_killed(REGS[i].var, bb)) {
+        if (!live_set_has(bb->live_def, REGS[i].var)) {
             vreg_clear_phys(REGS[i].var);
             REGS[i].var = NULL;
             REGS[i].polluted = 0;
@@ -382,12 +433,387 @@ void spill_live_out(basic_block_t *bb)
 /* The operand of 'OP_push' should not been killed until function called. */
 void extend_liveness(basic_block_t *bb, insn_t *insn, var_t *var, int offset)
 {
-    if (check_live_out(bb, var))
-        return;
     if (insn->idx + offset > var->consumed)
         var->consumed = insn->idx + offset;
 }
 
+/* Function-level register allocation.
+ *
+ * The allocation within a block stores the values living across a block
+ * boundary at the end of the blocks defining them and loads them again in
+ * the blocks using them. Positions number the instructions along the order
+ * the blocks are allocated in, and the live interval of a value covers every
+ * position where it is live. A linear scan over these intervals pins the
+ * values paying most for such round-trips to a register over their whole
+ * interval, unless a call falls within it since calls clobber every
+ * register. The allocation within a block then keeps a pinned register for
+ * its value wherever that value is live and uses it freely elsewhere. The
+ * values left in memory between blocks share stack slots when their
+ * intervals do not overlap.
+ */
+int ra_block_len(basic_block_t *bb)
+{
+    return bb->insn_list.tail ? bb->insn_list.tail->idx + 1 : 0;
+}
+
+int ra_block_weight(basic_block_t *bb)
+{
+    int depth = bb->loop ? bb->loop->depth : 0;
+    return 1 << (3 * (depth < 4 ? depth : 4));
+}
+
+live_interval_t *ra_interval(var_t *var, int pos)
+{
+    if (!var || var->is_global)
+        return NULL;
+    if (var->vreg_id < 0 || var->vreg_id >= intervals_size)
+        return NULL;
+
+    live_interval_t *iv = &intervals[var->vreg_id];
+    if (!iv->var) {
+        iv->var = var;
+        iv->start = pos;
+        iv->end = pos;
+        iv->slot_end = pos;
+        iv->weight = 0;
+        iv->use_bb = 0;
+        iv->def_bb = 0;
+        iv->cross = false;
+        iv->fixed = var->is_const || var->is_func || var->address_taken ||
+                    var->array_size || var->offset;
+        return iv;
+    }
+    /* not numbered by this function */
+    if (iv->var != var)
+        iv->fixed = true;
+
+    if (pos < iv->start)
+        iv->start = pos;
+    if (pos > iv->end)
+        iv->end = pos;
+    return iv;
+}
+
+/* Records an access of 'var' at 'pos' in 'bb', which ends at 'bb_end' */
+void ra_access(basic_block_t *bb,
+               var_t *var,
+               int pos,
+               int bb_start,
+               int bb_end,
+               bool def)
+{
+    live_interval_t *iv = ra_interval(var, pos);
+    if (!iv)
+        return;
+
+    if (bb_end > iv->slot_end)
+        iv->slot_end = bb_end;
+
+    /* a register saves the load of a live-in use and the store of a live-out
+     * definition, once per block
+     */
+    if (def) {
+        if (iv->def_bb != bb_start + 1 &&
+            live_set_has(bb->live_out, var)) {
+            iv->def_bb = bb_start + 1;
+            iv->weight += ra_block_weight(bb);
+        }
+    } else if (iv->use_bb != bb_start + 1 && live_set_has(bb->live_in, var)) {
+        iv->use_bb = bb_start + 1;
+        iv->weight += ra_block_weight(bb);
+    }
+}
+
+void ra_grow(func_t *func, int positions)
+{
+    int size = func->live_words << 5;
+    intervals =
+        arena_grow(GENERAL_ARENA, intervals, size, sizeof(live_interval_t));
+    ra_mask = arena_grow(GENERAL_ARENA, ra_mask, func->live_words, sizeof(int));
+    ra_calls = arena_grow(GENERAL_ARENA, ra_calls, positions, sizeof(int));
+    ra_starts = arena_grow(GENERAL_ARENA, ra_starts, positions, sizeof(int));
+    ra_ends = arena_grow(GENERAL_ARENA, ra_ends, positions, sizeof(int));
+    intervals_size = size;
+}
+
+/* Computes the live intervals of the locals of 'func' and returns the number
+ * of positions. Values which are call arguments or results, or live at the
+ * entry without being parameters are marked fixed.
+ */
+int ra_build_intervals(func_t *func)
+{
+    int positions = 0;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next)
+        positions += ra_block_len(bb) + 2;
+    ra_grow(func, positions + 1);
+
+    for (int i = 0; i < intervals_size; i++)
+        intervals[i].var = NULL;
+
+    int entry_end = ra_block_len(func->bbs) + 1;
+    for (int i = 0; i < func->num_params; i++) {
+        var_t *param = func->param_defs[i].rename->subscripts[0];
+        live_interval_t *iv = ra_interval(param, 0);
+        if (!iv)
+            continue;
+        iv->slot_end = entry_end;
+        if (func->va_args || i >= REG_CNT)
+            iv->fixed = true;
+        else if (live_set_has(func->bbs->live_out, param))
+            iv->weight += ra_block_weight(func->bbs);
+    }
+
+    /* Pushing arguments, calling and taking the result form a region where
+     * every register may be overwritten.
+     */
+    int pos = 0, calls = 0, region = -1;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        int bb_start = pos, bb_end = pos + ra_block_len(bb) + 1;
+        ra_calls[pos] = calls;
+
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+            pos = bb_start + 1 + insn->idx;
+
+            switch (insn->opcode) {
+            case OP_push:
+                if (region < 0)
+                    region = pos;
+                break;
+            case OP_call:
+            case OP_indirect:
+            case OP_func_ret:
+                if (region < 0)
+                    region = pos;
+                calls += pos + 1 - region;
+                region = -1;
+                break;
+            default:
+                break;
+            }
+            ra_calls[pos] = region < 0 ? calls : calls + pos + 1 - region;
+
+            if (insn->rs1)
+                ra_access(bb, insn->rs1, pos, bb_start, bb_end, false);
+            if (insn->rs2)
+                ra_access(bb, insn->rs2, pos, bb_start, bb_end, false);
+            if (insn->rd)
+                ra_access(bb, insn->rd, pos, bb_start, bb_end, true);
+
+            live_interval_t *iv = NULL;
+            switch (insn->opcode) {
+            case OP_allocat:
+            case OP_func_ret:
+                iv = ra_interval(insn->rd, pos);
+                break;
+            case OP_address_of:
+            case OP_global_address_of:
+            case OP_push:
+                iv = ra_interval(insn->rs1, pos);
+                break;
+            default:
+                break;
+            }
+            if (iv)
+                iv->fixed = true;
+        }
+
+        pos = bb_end;
+        ra_calls[pos] = calls;
+        pos++;
+    }
+
+    /* Extend the intervals over the block boundaries they are live across */
+    for (int w = 0; w < func->live_words; w++)
+        ra_mask[w] = 0;
+    for (int i = 0; i < intervals_size; i++) {
+        if (intervals[i].var && !intervals[i].fixed)
+            ra_mask[i >> 5] |= 1 << (i & 31);
+    }
+
+    pos = 0;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        int bb_end = pos + ra_block_len(bb) + 1;
+
+        for (int w = 0; w < func->live_words; w++) {
+            int bits = (bb->live_in[w] | bb->live_out[w]) & ra_mask[w];
+            for (int b = 0; bits && b < 32; b++) {
+                if (!(bits & (1 << b)))
+                    continue;
+                bits &= ~(1 << b);
+
+                live_interval_t *iv = &intervals[(w << 5) + b];
+                if (bb->live_in[w] & (1 << b)) {
+                    /* used before being defined */
+                    if (bb == func->bbs)
+                        iv->fixed = true;
+                    ra_interval(iv->var, pos);
+                }
+                if (bb->live_out[w] & (1 << b)) {
+                    ra_interval(iv->var, bb_end);
+                    iv->cross = true;
+                }
+            }
+        }
+        pos = bb_end + 1;
+    }
+    return pos;
+}
+
+/* Gives the register 'reg' to the interval 'iv' */
+void ra_pin(live_interval_t *iv, int reg)
+{
+    iv->var->vreg_flags |= VREG_PINNED;
+    iv->var->phys_reg = reg;
+}
+
+void ra_unpin(live_interval_t *iv)
+{
+    iv->var->vreg_flags &= ~VREG_PINNED;
+    iv->var->phys_reg = -1;
+}
+
+/* Linear scan over the intervals in the order of their starts. Once the
+ * registers for pinning are all taken, the interval saving the fewest loads
+ * and stores stays in memory. A parameter can only be pinned to the register
+ * it arrives in.
+ */
+void ra_scan_registers(func_t *func, int positions)
+{
+    int owner[REG_CNT];
+    int active = 0;
+
+    for (int r = 0; r < REG_CNT; r++)
+        owner[r] = -1;
+
+    for (int pos = 0; pos < positions; pos++) {
+        for (int id = ra_starts[pos]; id >= 0; id = intervals[id].next) {
+            live_interval_t *iv = &intervals[id];
+            int calls = ra_calls[iv->end] - (pos ? ra_calls[pos - 1] : 0);
+            if (!iv->weight || calls)
+                continue;
+
+            for (int r = 0; r < REG_CNT; r++) {
+                if (owner[r] >= 0 && intervals[owner[r]].end < pos) {
+                    owner[r] = -1;
+                    active--;
+                }
+            }
+
+            int reg = -1;
+            if (!pos) {
+                for (int i = 0; i < func->num_params; i++) {
+                    if (func->param_defs[i].rename->subscripts[0] == iv->var)
+                        reg = i;
+                }
+                if (reg < 0 || owner[reg] >= 0 || active == MAX_PINNED_REGS)
+                    continue;
+            } else if (active < MAX_PINNED_REGS) {
+                /* leave the argument registers to the allocation in blocks */
+                for (int r = REG_CNT - 1; r >= 0 && reg < 0; r--) {
+                    if (owner[r] < 0)
+                        reg = r;
+                }
+            } else {
+                for (int r = 0; r < REG_CNT; r++) {
+                    if (owner[r] < 0 || intervals[owner[r]].weight >= iv->weight)
+                        continue;
+                    if (reg < 0 || intervals[owner[r]].weight <
+                                       intervals[owner[reg]].weight)
+                        reg = r;
+                }
+                if (reg < 0)
+                    continue;
+                ra_unpin(&intervals[owner[reg]]);
+                active--;
+            }
+
+            ra_pin(iv, reg);
+            owner[reg] = id;
+            active++;
+        }
+    }
+}
+
+/* Gives the intervals left in memory stack slots, reusing the slots of the
+ * intervals which ended before.
+ */
+void ra_scan_slots(func_t *func, int positions)
+{
+    int free_slots = 0;
+
+    for (int pos = 0; pos < positions; pos++) {
+        for (int id = ra_starts[pos]; id >= 0; id = intervals[id].next) {
+            live_interval_t *iv = &intervals[id];
+            if (is_pinned(iv->var))
+                continue;
+
+            if (free_slots)
+                iv->var->offset = ra_free_slots[--free_slots];
+            else {
+                iv->var->offset = func->stack_size;
+                func->stack_size += 4;
+            }
+
+            int end = iv->end > iv->slot_end ? iv->end : iv->slot_end;
+            iv->next_end = ra_ends[end];
+            ra_ends[end] = id;
+        }
+
+        for (int id = ra_ends[pos]; id >= 0; id = intervals[id].next_end) {
+            ra_free_slots = arena_grow(GENERAL_ARENA, ra_free_slots,
+                                       free_slots + 1, sizeof(int));
+            ra_free_slots[free_slots++] = intervals[id].var->offset;
+        }
+    }
+}
+
+/* Pins values living across blocks to registers and assigns stack slots to
+ * the others, before 'func' is allocated block by block.
+ */
+void ra_allocate_intervals(func_t *func)
+{
+    int positions = ra_build_intervals(func);
+
+    for (int pos = 0; pos < positions; pos++) {
+        ra_starts[pos] = -1;
+        ra_ends[pos] = -1;
+    }
+    for (int id = intervals_size - 1; id >= 0; id--) {
+        live_interval_t *iv = &intervals[id];
+        if (!iv->var || iv->fixed || !iv->cross)
+            continue;
+        iv->next = ra_starts[iv->start];
+        ra_starts[iv->start] = id;
+    }
+
+    ra_scan_registers(func, positions);
+    ra_scan_slots(func, positions);
+
+    for (int w = 0; w < func->live_words; w++)
+        ra_mask[w] = 0;
+    for (int id = 0; id < intervals_size; id++) {
+        if (intervals[id].var && is_pinned(intervals[id].var))
+            ra_mask[id >> 5] |= 1 << (id & 31);
+    }
+}
+
+/* Puts the pinned values live into 'bb' in their registers */
+void ra_enter_block(func_t *func, basic_block_t *bb)
+{
+    for (int w = 0; w < func->live_words; w++) {
+        int bits = bb->live_in[w] & ra_mask[w];
+        for (int b = 0; bits && b < 32; b++) {
+            if (!(bits & (1 << b)))
+                continue;
+            bits &= ~(1 << b);
+
+            var_t *var = intervals[(w << 5) + b].var;
+            REGS[var->phys_reg].var = var;
+            REGS[var->phys_reg].polluted = 1;
+        }
+    }
+}
+
 void reg_alloc(void)
 {
     /* TODO: Add proper .bss and .data section support for uninitialized /
@@ -536,7 +962,7 @@ void reg_alloc(void)
 
         /* set arguments available */
         for (int i = 0; i < func->num_params; i++) {
-            REGS[i].var = func->param_defs[i].subscripts[0];
+            REGS[i].var = func->param_defs[i].rename->subscripts[0];
             REGS[i].polluted = 1;
         }
 
@@ -546,7 +972,7 @@ void reg_alloc(void)
                 ph2_ir_t *ir = bb_add_ph2_ir(func->bbs, OP_store);
 
                 if (i < func->num_params)
-                    func->param_defs[i].subscripts[0]->offset =
+                    func->param_defs[i].rename->subscripts[0]->offset =
                         func->stack_size;
 
                 ir->src0 = i;
@@ -555,34 +981,29 @@ void reg_alloc(void)
             }
         }
 
+        if (!fast_reg_alloc)
+            ra_allocate_intervals(func);
+
+        int bb_start = 0;
         for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
             bool is_pushing_args = false;
             int args = 0;
 
             bb->visited++;
 
+            if (!fast_reg_alloc)
+                ra_enter_block(func, bb);
+
             for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
                 func_t *callee_func;
                 ph2_ir_t *ir;
                 int dest, src0, src1;
                 int sz, clear_reg;
 
+                ra_pos = bb_start + 1 + insn->idx;
                 refresh(bb, insn);
 
                 switch (insn->opcode) {
-                case OP_unwound_phi:
-                    track_var_use(insn->rs1, insn->idx);
-                    src0 = prepare_operand(bb, insn->rs1, -1);
-
-                    if (!insn->rd->offset) {
-                        insn->rd->offset = bb->belong_to->stack_size;
-                        bb->belong_to->stack_size += 4;
-                    }
-
-                    ir = bb_add_ph2_ir(bb, OP_store);
-                    ir->src0 = src0;
-                    ir->src1 = insn->rd->offset;
-                    break;
                 case OP_allocat:
                     if ((insn->rd->type == TY_void ||
                          insn->rd->type == TY_int ||
@@ -684,6 +1105,18 @@ void reg_alloc(void)
                         clear_reg = 1;
                         src0 = prepare_operand(bb, insn->rs1, -1);
                     }
+
+                    /* Peephole fuses a copy into the instruction that just
+                     * defined its source. Store a source that outlives the
+                     * copy, such as a value reused by GVN, in between.
+                     */
+                    if (!clear_reg && REGS[src0].polluted &&
+                        bb->ph2_ir_list.tail &&
+                        bb->ph2_ir_list.tail->dest == src0 &&
+                        (check_live_out(bb, insn->rs1) ||
+                         insn->rs1->consumed > insn->idx))
+                        store_var(bb, insn->rs1, src0);
+
                     dest = prepare_dest(bb, insn->rd, src0, -1);
                     ir = bb_add_ph2_ir(bb, OP_assign);
                     ir->src0 = src0;
@@ -697,7 +1130,8 @@ void reg_alloc(void)
                         REGS[dest].polluted = 0;
                     }
 
-                    if (clear_reg) {
+                    /* unless a pinned destination took the register */
+                    if (clear_reg && REGS[src0].var == insn->rs1) {
                         vreg_clear_phys(REGS[src0].var);
                         REGS[src0].var = NULL;
                     }
@@ -716,7 +1150,7 @@ void reg_alloc(void)
                         src0 = prepare_operand(bb, insn->rs1, -1);
                         ir = bb_add_ph2_ir(bb, OP_address_of_func);
                         ir->src0 = src0;
-                        strcpy(ir->func_name, insn->rs2->var_name);
+                        ir->func = find_func(insn->rs2->var_name);
                     } else {
                         /* FIXME: Register content becomes stale after store
                          * operation. Current workaround causes redundant
@@ -761,12 +1195,12 @@ void reg_alloc(void)
                     REGS[ir->dest].polluted = 0;
                     break;
                 case OP_call:
-                    callee_func = find_func(insn->str);
+                    callee_func = insn->func;
                     if (!callee_func->num_params)
                         spill_alive(bb, insn);
 
                     ir = bb_add_ph2_ir(bb, OP_call);
-                    strcpy(ir->func_name, insn->str);
+                    ir->func = callee_func;
 
                     is_pushing_args = false;
                     args = 0;
@@ -854,6 +1288,8 @@ void reg_alloc(void)
                 }
             }
 
+            bb_start += ra_block_len(bb) + 2;
+
             if (bb->next)
                 spill_live_out(bb);
 
@@ -876,7 +1312,7 @@ void reg_alloc(void)
         }
 
         /* handle implicit return */
-        for (int i = 0; i < MAX_BB_PRED; i++) {
+        for (int i = 0; i < func->exit->prev_size; i++) {
             basic_block_t *bb = func->exit->prev[i].bb;
             if (!bb)
                 continue;
@@ -905,7 +1341,7 @@ void dump_ph2_ir(void)
 
         switch (ph2_ir->op) {
         case OP_define:
-            printf("%s:", ph2_ir->func_name);
+            printf("%s:", ph2_ir->func->return_def.var_name);
             break;
         case OP_allocat:
             continue;
@@ -931,10 +1367,10 @@ void dump_ph2_ir(void)
             printf("\tbr %%x%c", rs1);
             break;
         case OP_jump:
-            printf("\tj %s", ph2_ir->func_name);
+            printf("\tj %s", ph2_ir->next_bb->bb_label_name);
             break;
         case OP_call:
-            printf("\tcall @%s", ph2_ir->func_name);
+            printf("\tcall @%s", ph2_ir->func->return_def.var_name);
             break;
         case OP_return:
             if (ph2_ir->src0 == -1)
@@ -961,7 +1397,8 @@ void dump_ph2_ir(void)
             printf("\t(%%x%c) = %%x%c", rs1, rs2);
             break;
         case OP_address_of_func:
-            printf("\t(%%x%c) = @%s", rs1, ph2_ir->func_name);
+            printf("\t(%%x%c) = @%s", rs1,
+                   ph2_ir->func->return_def.var_name);
             break;
         case OP_load_func:
             printf("\tload %%t0, %d(sp)", ph2_ir->src0);
@@ -142,7 +142,7 @@ void cfg_flatten(void)
         /* reserve stack */
         ph2_ir_t *flatten_ir = add_ph2_ir(OP_define);
         flatten_ir->src0 = func->stack_size;
-        strncpy(flatten_ir->func_name, func->return_def.var_name, MAX_VAR_LEN);
+        flatten_ir->func = func;
 
         for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
             bb->elf_offset = elf_offset;
@@ -270,7 +270,7 @@ void emit_ph2_ir(ph2_ir_t *ph2_ir)
         emit(__jal(__zero, ph2_ir->next_bb->elf_offset - elf_code->size));
         return;
     case OP_call:
-        func = find_func(ph2_ir->func_name);
+        func = ph2_ir->func;
         emit(__jal(__ra, func->bbs->elf_offset - elf_code->size));
         return;
     case OP_load_data_address:
@@ -282,7 +282,7 @@ void emit_ph2_ir(ph2_ir_t *ph2_ir)
         emit(__addi(rd, rd, rv_lo(elf_rodata_start + ph2_ir->src0)));
         return;
     case OP_address_of_func:
-        func = find_func(ph2_ir->func_name);
+        func = ph2_ir->func;
         ofs = elf_code_start + func->bbs->elf_offset;
         emit(__lui(__t0, rv_hi(ofs)));
         emit(__addi(__t0, __t0, rv_lo(ofs)));
@@ -484,6 +484,9 @@ void code_generate(void)
     elf_rodata_start = elf_data_start + elf_data->size;
     elf_bss_start = elf_rodata_start + elf_rodata->size;
 
+    /* cfg_flatten() already knows the code size, reserve it all at once */
+    strbuf_extend(elf_code, elf_offset);
+
     /* start: save original sp in s0; allocate global stack; run init */
     emit(__addi(__s0, __sp, 0));
     emit(__lui(__t0, rv_hi(GLOBAL_FUNC->stack_size)));
@@ -516,8 +519,14 @@ void code_generate(void)
         emit(__addi(__a1, __t0, 4));
         emit(__jal(__ra, MAIN_BB->elf_offset - elf_code->size));
 
-        /* exit with main's return value in a0 */
-        emit(__addi(__a7, __zero, 93));
+        /* exit with main's return value in a0. Go through exit() when
+         * available so that buffered streams are flushed.
+         */
+        func_t *exit_func = find_func("exit");
+        if (exit_func && exit_func->bbs)
+            emit(__jal(__ra, exit_func->bbs->elf_offset - elf_code->size));
+        else
+            emit(__addi(__a7, __zero, 93));
         emit(__ecall());
     }
 
@@ -14,13 +14,18 @@
 /* SCCP (Sparse Conditional Constant Propagation) optimization */
 #include "opt-sccp.c"
 
-/* Configuration constants - replace magic numbers */
-#define PHI_WORKLIST_SIZE 64
-#define DCE_WORKLIST_SIZE 2048
+/* Worklists of phi insertion and DCE, reused and grown on demand */
+basic_block_t **phi_work_list;
+int phi_work_list_idx = 0;
+insn_t **dce_work_list;
+int dce_work_list_idx = 0;
 
 /* Dead store elimination window size */
 #define OVERWRITE_WINDOW 3
 
+/* Number of buckets in the GVN hash table, a power of two */
+#define GVN_BUCKETS 4096
+
 void var_list_ensure_capacity(var_list_t *list, int min_capacity)
 {
     if (list->capacity >= min_capacity)
@@ -51,126 +56,164 @@ void var_list_add_var(var_list_t *list, var_t *var)
     list->elements[list->size++] = var;
 }
 
-void var_list_assign_array(var_list_t *list, var_t **data, int count)
-{
-    var_list_ensure_capacity(list, count);
-    memcpy(list->elements, data, count * HOST_PTR_SIZE);
-    list->size = count;
-}
+/* Explicit DFS stack: a block and the index of its next edge to follow */
+basic_block_t **dfs_stack;
+int *dfs_edge;
+int dfs_stack_size = 0;
 
-/* cfront does not accept structure as an argument, pass pointer */
-void bb_forward_traversal(bb_traversal_args_t *args)
+/* Called for every push, so only the first push past the end grows */
+void dfs_reserve(int size)
 {
-    args->bb->visited++;
-
-    if (args->preorder_cb)
-        args->preorder_cb(args->func, args->bb);
+    if (size <= dfs_stack_size)
+        return;
 
-    /* 'args' is a reference, do not modify it */
-    bb_traversal_args_t next_args;
-    memcpy(&next_args, args, sizeof(bb_traversal_args_t));
+    dfs_stack_size = size << 1;
+    dfs_stack = arena_grow(GENERAL_ARENA, dfs_stack, dfs_stack_size,
+                           sizeof(basic_block_t *));
+    dfs_edge = arena_grow(GENERAL_ARENA, dfs_edge, dfs_stack_size, sizeof(int));
+}
 
-    if (args->bb->next) {
-        if (args->bb->next->visited < args->func->visited) {
-            next_args.bb = args->bb->next;
-            bb_forward_traversal(&next_args);
-        }
-    }
-    if (args->bb->then_) {
-        if (args->bb->then_->visited < args->func->visited) {
-            next_args.bb = args->bb->then_;
-            bb_forward_traversal(&next_args);
+/* Depth-first search from 'root', recording the blocks in preorder and
+ * postorder. A forward search follows next, then_ and else_ in that order, a
+ * backward one follows predecessors, and the virtual edges to the exit. The
+ * orders match a recursive search.
+ */
+void cfg_dfs(func_t *func,
+             basic_block_t *root,
+             bool backward,
+             bb_list_t *pre,
+             bb_list_t *post)
+{
+    pre->size = 0;
+    post->size = 0;
+    func->visited++;
+
+    root->visited = func->visited;
+    bb_list_add(pre, root);
+
+    int sp = 0;
+    dfs_reserve(1);
+    dfs_stack[sp] = root;
+    dfs_edge[sp++] = 0;
+
+    while (sp > 0) {
+        basic_block_t *bb = dfs_stack[sp - 1];
+        int edges = 3;
+        if (backward) {
+            edges = bb->prev_size;
+            if (bb == func->exit)
+                edges += func->exit_edges.size;
         }
-    }
-    if (args->bb->else_) {
-        if (args->bb->else_->visited < args->func->visited) {
-            next_args.bb = args->bb->else_;
-            bb_forward_traversal(&next_args);
+        basic_block_t *succ = NULL;
+
+        while (!succ && dfs_edge[sp - 1] < edges) {
+            int i = dfs_edge[sp - 1];
+            dfs_edge[sp - 1] = i + 1;
+
+            if (backward && i >= bb->prev_size)
+                succ = func->exit_edges.elements[i - bb->prev_size];
+            else if (backward)
+                succ = bb->prev[i].bb;
+            else if (i == 0)
+                succ = bb->next;
+            else if (i == 1)
+                succ = bb->then_;
+            else
+                succ = bb->else_;
+
+            if (succ && succ->visited == func->visited)
+                succ = NULL;
         }
-    }
-
-    if (args->postorder_cb)
-        args->postorder_cb(args->func, args->bb);
-}
-
-/* cfront does not accept structure as an argument, pass pointer */
-void bb_backward_traversal(bb_traversal_args_t *args)
-{
-    args->bb->visited++;
-
-    if (args->preorder_cb)
-        args->preorder_cb(args->func, args->bb);
 
-    for (int i = 0; i < MAX_BB_PRED; i++) {
-        if (!args->bb->prev[i].bb)
+        if (!succ) {
+            bb_list_add(post, bb);
+            sp--;
             continue;
-        if (args->bb->prev[i].bb->visited < args->func->visited) {
-            /* 'args' is a reference, do not modify it */
-            bb_traversal_args_t next_args;
-            memcpy(&next_args, args, sizeof(bb_traversal_args_t));
-
-            next_args.bb = args->bb->prev[i].bb;
-            bb_backward_traversal(&next_args);
         }
-    }
 
-    if (args->postorder_cb)
-        args->postorder_cb(args->func, args->bb);
-}
+        succ->visited = func->visited;
+        bb_list_add(pre, succ);
 
-void bb_index_rpo(func_t *func, basic_block_t *bb)
-{
-    bb->rpo = func->bb_cnt++;
+        dfs_reserve(sp + 1);
+        dfs_stack[sp] = succ;
+        dfs_edge[sp++] = 0;
+    }
 }
 
-void bb_reverse_index(func_t *func, basic_block_t *bb)
+/* Makes func->dfs_pre and func->dfs_post current */
+void func_dfs(func_t *func)
 {
-    bb->rpo = func->bb_cnt - bb->rpo;
+    if (func->dfs_valid)
+        return;
+    cfg_dfs(func, func->bbs, false, &func->dfs_pre, &func->dfs_post);
+    func->dfs_valid = true;
 }
 
-void bb_build_rpo(func_t *func, basic_block_t *bb)
+/* Makes func->rdfs_pre and func->rdfs_post current */
+void func_rdfs(func_t *func)
 {
-    if (func->bbs == bb)
+    if (func->rdfs_valid)
         return;
+    cfg_dfs(func, func->exit, true, &func->rdfs_pre, &func->rdfs_post);
+    func->rdfs_valid = true;
+}
 
-    basic_block_t *prev = func->bbs;
-    basic_block_t *curr = prev->rpo_next;
-    for (; curr; curr = curr->rpo_next) {
-        if (curr->rpo < bb->rpo) {
-            prev = curr;
-            continue;
+/* Gives a virtual edge to the exit to a block of each region which cannot
+ * reach it, until every block reaches the exit. Post-dominance then covers
+ * the whole CFG.
+ */
+void func_connect_exit(func_t *func)
+{
+    for (int i = 0; i < func->exit_edges.size; i++)
+        func->exit_edges.elements[i]->exit_edge = false;
+    func->exit_edges.size = 0;
+    func->rdfs_valid = false;
+
+    func_dfs(func);
+    for (;;) {
+        func_rdfs(func);
+
+        /* the deepest block left, in postorder */
+        basic_block_t *loose = NULL;
+        for (int i = 0; i < func->dfs_post.size && !loose; i++) {
+            basic_block_t *bb = func->dfs_post.elements[i];
+            if (bb->visited != func->visited)
+                loose = bb;
         }
-        bb->rpo_next = curr;
-        prev->rpo_next = bb;
-        prev = curr;
-        return;
+        if (!loose)
+            return;
+
+        loose->exit_edge = true;
+        bb_list_add(&func->exit_edges, loose);
+        func->rdfs_valid = false;
     }
+}
+
+/* Chains the blocks of 'func' in reverse postorder, numbered from 1 */
+void func_build_rpo(func_t *func)
+{
+    func_dfs(func);
 
-    prev->rpo_next = bb;
+    basic_block_t *prev = NULL;
+    func->bb_cnt = func->dfs_post.size;
+    for (int i = func->bb_cnt - 1; i >= 0; i--) {
+        basic_block_t *bb = func->dfs_post.elements[i];
+        bb->rpo = func->bb_cnt - i;
+        bb->rpo_next = NULL;
+        if (prev)
+            prev->rpo_next = bb;
+        prev = bb;
+    }
 }
 
 void build_rpo(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->postorder_cb = bb_index_rpo;
-        bb_forward_traversal(args);
-
-        func->visited++;
-        args->postorder_cb = bb_reverse_index;
-        bb_forward_traversal(args);
-
-        func->visited++;
-        args->postorder_cb = bb_build_rpo;
-        bb_forward_traversal(args);
+        func_build_rpo(func);
     }
 }
 
@@ -196,6 +239,45 @@ basic_block_t *intersect(basic_block_t *i, basic_block_t *j)
  *   Cooper, Keith D.; Harvey, Timothy J.; Kennedy, Ken (2001).
  *   "A Simple, Fast Dominance Algorithm"
  */
+void func_build_idom(func_t *func)
+{
+    bool changed;
+
+    func->bbs->idom = func->bbs;
+    for (basic_block_t *bb = func->bbs->rpo_next; bb; bb = bb->rpo_next)
+        bb->idom = NULL;
+
+    do {
+        changed = false;
+
+        for (basic_block_t *bb = func->bbs->rpo_next; bb; bb = bb->rpo_next) {
+            /* pick one predecessor */
+            basic_block_t *pred;
+            for (int i = 0; i < bb->prev_size; i++) {
+                if (!bb->prev[i].bb)
+                    continue;
+                if (!bb->prev[i].bb->idom)
+                    continue;
+                pred = bb->prev[i].bb;
+                break;
+            }
+
+            for (int i = 0; i < bb->prev_size; i++) {
+                if (!bb->prev[i].bb)
+                    continue;
+                if (bb->prev[i].bb == pred)
+                    continue;
+                if (bb->prev[i].bb->idom)
+                    pred = intersect(bb->prev[i].bb, pred);
+            }
+            if (bb->idom != pred) {
+                bb->idom = pred;
+                changed = true;
+            }
+        }
+    } while (changed);
+}
+
 void build_idom(void)
 {
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
@@ -203,40 +285,7 @@ void build_idom(void)
         if (!func->bbs)
             continue;
 
-        bool changed;
-
-        func->bbs->idom = func->bbs;
-
-        do {
-            changed = false;
-
-            for (basic_block_t *bb = func->bbs->rpo_next; bb;
-                 bb = bb->rpo_next) {
-                /* pick one predecessor */
-                basic_block_t *pred;
-                for (int i = 0; i < MAX_BB_PRED; i++) {
-                    if (!bb->prev[i].bb)
-                        continue;
-                    if (!bb->prev[i].bb->idom)
-                        continue;
-                    pred = bb->prev[i].bb;
-                    break;
-                }
-
-                for (int i = 0; i < MAX_BB_PRED; i++) {
-                    if (!bb->prev[i].bb)
-                        continue;
-                    if (bb->prev[i].bb == pred)
-                        continue;
-                    if (bb->prev[i].bb->idom)
-                        pred = intersect(bb->prev[i].bb, pred);
-                }
-                if (bb->idom != pred) {
-                    bb->idom = pred;
-                    changed = true;
-                }
-            }
-        } while (changed);
+        func_build_idom(func);
     }
 }
 
@@ -245,18 +294,12 @@ bool dom_connect(basic_block_t *pred, basic_block_t *succ)
     if (succ->dom_prev)
         return false;
 
-    int i;
-    for (i = 0; i < MAX_BB_DOM_SUCC; i++) {
-        if (pred->dom_next[i] == succ)
+    for (int i = 0; i < pred->dom_next.size; i++) {
+        if (pred->dom_next.elements[i] == succ)
             return false;
-        if (!pred->dom_next[i])
-            break;
     }
 
-    if (i > MAX_BB_DOM_SUCC - 1)
-        fatal("Too many predecessors in dominator tree");
-
-    pred->dom_next[i++] = succ;
+    bb_list_add(&pred->dom_next, succ);
     succ->dom_prev = pred;
     return true;
 }
@@ -271,58 +314,125 @@ void bb_build_dom(func_t *func, basic_block_t *bb)
     }
 }
 
+/* Numbers the dominator tree, or the post-dominator tree if 'post_dom', in
+ * DFS pre/post order starting at 1.
+ */
+void dom_number(basic_block_t *root, bool post_dom)
+{
+    int n = 1, sp = 0;
+
+    dfs_reserve(1);
+    if (post_dom)
+        root->rdom_pre = n++;
+    else
+        root->dom_pre = n++;
+    dfs_stack[sp] = root;
+    dfs_edge[sp++] = 0;
+
+    while (sp > 0) {
+        basic_block_t *bb = dfs_stack[sp - 1];
+        bb_list_t *children = post_dom ? &bb->rdom_next : &bb->dom_next;
+        int i = dfs_edge[sp - 1];
+
+        if (i == children->size) {
+            if (post_dom)
+                bb->rdom_post = n++;
+            else
+                bb->dom_post = n++;
+            sp--;
+            continue;
+        }
+
+        basic_block_t *child = children->elements[i];
+        dfs_edge[sp - 1] = i + 1;
+        if (post_dom)
+            child->rdom_pre = n++;
+        else
+            child->dom_pre = n++;
+
+        dfs_reserve(sp + 1);
+        dfs_stack[sp] = child;
+        dfs_edge[sp++] = 0;
+    }
+}
+
+void func_build_dom(func_t *func)
+{
+    func_dfs(func);
+    for (int i = 0; i < func->dfs_pre.size; i++) {
+        basic_block_t *bb = func->dfs_pre.elements[i];
+        bb->dom_next.size = 0;
+        bb->dom_prev = NULL;
+    }
+    for (int i = 0; i < func->dfs_pre.size; i++)
+        bb_build_dom(func, func->dfs_pre.elements[i]);
+
+    dom_number(func->bbs, false);
+    func->dom_valid = true;
+}
+
 void build_dom(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->preorder_cb = bb_build_dom;
-        bb_forward_traversal(args);
+        func_build_dom(func);
     }
 }
 
+/* Recomputes the reverse postorder and the dominator tree of 'func' once
+ * an edge of its CFG has changed, e.g. after a branch was folded.
+ */
+void func_refresh_dom(func_t *func)
+{
+    if (func->dom_valid)
+        return;
+
+    func_build_rpo(func);
+    func_build_idom(func);
+    func_build_dom(func);
+}
+
+/* Whether 'a' dominates 'b', a block dominating itself */
+bool dominates(basic_block_t *a, basic_block_t *b)
+{
+    return a->dom_pre && a->dom_pre <= b->dom_pre &&
+           b->dom_post <= a->dom_post;
+}
+
 void bb_build_df(func_t *func, basic_block_t *bb)
 {
     UNUSED(func);
 
     int cnt = 0;
-    for (int i = 0; i < MAX_BB_PRED; i++) {
+    for (int i = 0; i < bb->prev_size; i++) {
         if (bb->prev[i].bb)
             cnt++;
     }
     if (cnt <= 0)
         return;
 
-    for (int i = 0; i < MAX_BB_PRED; i++) {
+    for (int i = 0; i < bb->prev_size; i++) {
         if (bb->prev[i].bb) {
             for (basic_block_t *curr = bb->prev[i].bb; curr != bb->idom;
                  curr = curr->idom)
-                curr->DF[curr->df_idx++] = bb;
+                bb_list_add(&curr->DF, bb);
         }
     }
 }
 
 void build_df(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->postorder_cb = bb_build_df;
-        bb_forward_traversal(args);
+        func_dfs(func);
+        for (int i = 0; i < func->dfs_post.size; i++)
+            bb_build_df(func, func->dfs_post.elements[i]);
     }
 }
 
@@ -354,8 +464,10 @@ void build_r_idom(void)
             for (basic_block_t *bb = func->exit->rpo_r_next; bb;
                  bb = bb->rpo_r_next) {
                 /* pick one predecessor */
-                basic_block_t *pred;
-                if (bb->next && bb->next->r_idom) {
+                basic_block_t *pred = NULL;
+                if (bb->exit_edge) {
+                    pred = func->exit;
+                } else if (bb->next && bb->next->r_idom) {
                     pred = bb->next;
                 } else if (bb->else_ && bb->else_->r_idom) {
                     pred = bb->else_;
@@ -383,18 +495,12 @@ bool rdom_connect(basic_block_t *pred, basic_block_t *succ)
     if (succ->rdom_prev)
         return false;
 
-    int i;
-    for (i = 0; i < MAX_BB_RDOM_SUCC; i++) {
-        if (pred->rdom_next[i] == succ)
+    for (int i = 0; i < pred->rdom_next.size; i++) {
+        if (pred->rdom_next.elements[i] == succ)
             return false;
-        if (!pred->rdom_next[i])
-            break;
     }
 
-    if (i > MAX_BB_RDOM_SUCC - 1)
-        fatal("Too many predecessors in reverse dominator tree");
-
-    pred->rdom_next[i++] = succ;
+    bb_list_add(&pred->rdom_next, succ);
     succ->rdom_prev = pred;
     return true;
 }
@@ -409,21 +515,26 @@ void bb_build_rdom(func_t *func, basic_block_t *bb)
 
 void build_rdom(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->exit;
+        func_rdfs(func);
+        for (int i = 0; i < func->rdfs_pre.size; i++)
+            bb_build_rdom(func, func->rdfs_pre.elements[i]);
 
-        func->visited++;
-        args->preorder_cb = bb_build_rdom;
-        bb_backward_traversal(args);
+        dom_number(func->exit, true);
     }
 }
 
+/* Whether 'a' post-dominates 'b', a block post-dominating itself */
+bool post_dominates(basic_block_t *a, basic_block_t *b)
+{
+    return a->rdom_pre && a->rdom_pre <= b->rdom_pre &&
+           b->rdom_post <= a->rdom_post;
+}
+
 void bb_build_rdf(func_t *func, basic_block_t *bb)
 {
     UNUSED(func);
@@ -441,34 +552,144 @@ void bb_build_rdf(func_t *func, basic_block_t *bb)
     if (bb->next) {
         for (basic_block_t *curr = bb->next; curr != bb->r_idom;
              curr = curr->r_idom)
-            curr->RDF[curr->rdf_idx++] = bb;
+            bb_list_add(&curr->RDF, bb);
     }
     if (bb->else_) {
         for (basic_block_t *curr = bb->else_; curr != bb->r_idom;
              curr = curr->r_idom)
-            curr->RDF[curr->rdf_idx++] = bb;
+            bb_list_add(&curr->RDF, bb);
     }
     if (bb->then_) {
         for (basic_block_t *curr = bb->then_; curr != bb->r_idom;
              curr = curr->r_idom)
-            curr->RDF[curr->rdf_idx++] = bb;
+            bb_list_add(&curr->RDF, bb);
     }
 }
 
 void build_rdf(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->exit;
+        func_rdfs(func);
+        for (int i = 0; i < func->rdfs_post.size; i++)
+            bb_build_rdf(func, func->rdfs_post.elements[i]);
+    }
+}
 
-        func->visited++;
-        args->postorder_cb = bb_build_rdf;
-        bb_backward_traversal(args);
+/* Outermost loop found so far that contains 'loop' */
+loop_t *loop_root(loop_t *loop)
+{
+    while (loop->parent)
+        loop = loop->parent;
+    return loop;
+}
+
+/* Whether 'bb' belongs to 'loop' or to a loop nested in it */
+bool loop_contains(loop_t *loop, basic_block_t *bb)
+{
+    for (loop_t *l = bb->loop; l; l = l->parent) {
+        if (l == loop)
+            return true;
+    }
+    return false;
+}
+
+/* Adds to 'loop' the blocks reaching 'latch' without passing through the
+ * header. A block of an inner loop brings that whole loop, which becomes
+ * nested in 'loop', and the walk resumes from the inner header.
+ */
+void loop_collect(func_t *func, loop_t *loop, basic_block_t *latch)
+{
+    int sp = 0;
+    dfs_reserve(1);
+    dfs_stack[sp++] = latch;
+
+    while (sp > 0) {
+        basic_block_t *bb = dfs_stack[--sp];
+        if (bb == loop->header)
+            continue;
+
+        if (bb->loop) {
+            loop_t *inner = loop_root(bb->loop);
+            if (inner == loop)
+                continue;
+            inner->parent = loop;
+            bb = inner->header;
+        } else
+            bb->loop = loop;
+
+        for (int i = 0; i < bb->prev_size; i++) {
+            basic_block_t *pred = bb->prev[i].bb;
+            if (!pred || pred->visited != func->visited)
+                continue;
+            dfs_reserve(sp + 1);
+            dfs_stack[sp++] = pred;
+        }
+    }
+}
+
+/* Finds the natural loops of 'func', one per header, i.e. per block that
+ * dominates some of its predecessors, points each block to the innermost
+ * loop containing it and lists the blocks of each loop.
+ */
+void func_build_loops(func_t *func)
+{
+    func_refresh_dom(func);
+    func->loops = NULL;
+    func->visited++;
+    for (int i = 0; i < func->dfs_post.size; i++) {
+        basic_block_t *bb = func->dfs_post.elements[i];
+        bb->visited = func->visited;
+        bb->loop = NULL;
+    }
+
+    /* In postorder, inner loops are found before the loops containing them */
+    for (int i = 0; i < func->dfs_post.size; i++) {
+        basic_block_t *bb = func->dfs_post.elements[i];
+        loop_t *loop = NULL;
+
+        for (int j = 0; j < bb->prev_size; j++) {
+            basic_block_t *latch = bb->prev[j].bb;
+            if (!latch || latch->visited != func->visited)
+                continue;
+            if (!dominates(bb, latch))
+                continue;
+
+            if (!loop) {
+                loop = arena_calloc(BB_ARENA, 1, sizeof(loop_t));
+                loop->header = bb;
+                bb->loop = loop;
+            }
+            loop_collect(func, loop, latch);
+        }
+
+        if (loop) {
+            loop->next = func->loops;
+            func->loops = loop;
+        }
+    }
+
+    for (loop_t *loop = func->loops; loop; loop = loop->next)
+        loop->depth = loop->parent ? loop->parent->depth + 1 : 1;
+
+    for (int i = func->dfs_post.size - 1; i >= 0; i--) {
+        basic_block_t *bb = func->dfs_post.elements[i];
+        for (loop_t *loop = bb->loop; loop; loop = loop->parent)
+            bb_list_add(&loop->bbs, bb);
+    }
+}
+
+void build_loops(void)
+{
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
+
+        func_build_loops(func);
     }
 }
 
@@ -602,18 +823,14 @@ void bb_solve_globals(func_t *func, basic_block_t *bb)
 
 void solve_globals(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->postorder_cb = bb_solve_globals;
-        bb_forward_traversal(args);
+        func_dfs(func);
+        for (int i = 0; i < func->dfs_post.size; i++)
+            bb_solve_globals(func, func->dfs_post.elements[i]);
     }
 }
 
@@ -666,6 +883,13 @@ bool insert_phi_insn(basic_block_t *bb, var_t *var)
     return true;
 }
 
+void phi_push(basic_block_t *bb)
+{
+    phi_work_list = arena_grow(GENERAL_ARENA, phi_work_list,
+                               phi_work_list_idx + 1, sizeof(basic_block_t *));
+    phi_work_list[phi_work_list_idx++] = bb;
+}
+
 void solve_phi_insertion(void)
 {
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
@@ -676,20 +900,16 @@ void solve_phi_insertion(void)
         for (symbol_t *sym = func->global_sym_list.head; sym; sym = sym->next) {
             var_t *var = sym->var;
 
-            basic_block_t *work_list[PHI_WORKLIST_SIZE];
-            int work_list_idx = 0;
+            phi_work_list_idx = 0;
 
             for (ref_block_t *ref = var->ref_block_list.head; ref;
-                 ref = ref->next) {
-                if (work_list_idx >= PHI_WORKLIST_SIZE - 1)
-                    fatal("PHI worklist overflow");
-                work_list[work_list_idx++] = ref->bb;
-            }
+                 ref = ref->next)
+                phi_push(ref->bb);
 
-            for (int i = 0; i < work_list_idx; i++) {
-                basic_block_t *bb = work_list[i];
-                for (int j = 0; j < bb->df_idx; j++) {
-                    basic_block_t *df = bb->DF[j];
+            for (int i = 0; i < phi_work_list_idx; i++) {
+                basic_block_t *bb = phi_work_list[i];
+                for (int j = 0; j < bb->DF.size; j++) {
+                    basic_block_t *df = bb->DF.elements[j];
                     if (!var_check_in_scope(var, df->scope))
                         continue;
 
@@ -723,17 +943,14 @@ void solve_phi_insertion(void)
                         if (var->is_ternary_ret || var->is_logical_ret)
                             continue;
 
-                        for (int l = 0; l < work_list_idx; l++) {
-                            if (work_list[l] == df) {
+                        for (int l = 0; l < phi_work_list_idx; l++) {
+                            if (phi_work_list[l] == df) {
                                 found = true;
                                 break;
                             }
                         }
-                        if (!found) {
-                            if (work_list_idx >= PHI_WORKLIST_SIZE - 1)
-                                fatal("PHI worklist overflow");
-                            work_list[work_list_idx++] = df;
-                        }
+                        if (!found)
+                            phi_push(df);
                     }
                 }
             }
@@ -743,6 +960,30 @@ void solve_phi_insertion(void)
 
 var_t *require_var(block_t *blk);
 
+/* Records 'var' as the next version of 'base' and makes it the one in scope.
+ * The rename state is allocated on the declaration the first time it is
+ * renamed, so temporaries and SSA versions never carry it.
+ */
+void push_subscript(var_t *base, var_t *var)
+{
+    rename_t *rn = base->rename;
+    if (!rn) {
+        rn = arena_calloc(GENERAL_ARENA, 1, sizeof(rename_t));
+        base->rename = rn;
+    }
+
+    rn->stack =
+        arena_grow(GENERAL_ARENA, rn->stack, rn->stack_idx + 1, sizeof(int));
+    rn->subscripts = arena_grow(GENERAL_ARENA, rn->subscripts, rn->counter + 1,
+                                sizeof(var_t *));
+
+    var->base = base;
+    var->subscript = rn->counter;
+    var->rename = NULL;
+    rn->stack[rn->stack_idx++] = rn->counter;
+    rn->subscripts[rn->counter++] = var;
+}
+
 void new_name(block_t *block, var_t **var)
 {
     var_t *v = *var;
@@ -751,29 +992,20 @@ void new_name(block_t *block, var_t **var)
     if (v->is_global)
         return;
 
-    int i = v->base->rename.counter++;
-    v->base->rename.stack[v->base->rename.stack_idx++] = i;
     var_t *vd = require_var(block);
-    memcpy(vd, *var, sizeof(var_t));
-    vd->base = *var;
-    vd->subscript = i;
-    v->subscripts[v->subscripts_idx++] = vd;
+    memcpy(vd, v, sizeof(var_t));
+    push_subscript(v->base, vd);
     var[0] = vd;
 }
 
 var_t *get_stack_top_subscript_var(var_t *var)
 {
-    if (var->base->rename.stack_idx < 1)
+    rename_t *rn = var->base->rename;
+    if (!rn || rn->stack_idx < 1)
         return var; /* fallback: use base when no prior definition */
 
-    int sub = var->base->rename.stack[var->base->rename.stack_idx - 1];
-    for (int i = 0; i < var->base->subscripts_idx; i++) {
-        if (var->base->subscripts[i]->subscript == sub)
-            return var->base->subscripts[i];
-    }
-
-    fatal("Failed to find subscript variable on rename stack");
-    return NULL; /* unreachable, but silences compiler warning */
+    int sub = rn->stack[rn->stack_idx - 1];
+    return rn->subscripts[sub];
 }
 
 void rename_var(var_t **var)
@@ -791,7 +1023,7 @@ void pop_name(var_t *var)
 {
     if (var->is_global)
         return;
-    var->base->rename.stack_idx--;
+    var->base->rename->stack_idx--;
 }
 
 void append_phi_operand(insn_t *insn, var_t *var, basic_block_t *bb_from)
@@ -809,7 +1041,10 @@ void append_phi_operand(insn_t *insn, var_t *var, basic_block_t *bb_from)
         insn->phi_ops = op;
 }
 
-void bb_solve_phi_params(basic_block_t *bb)
+/* Renames the definitions and uses of 'bb' and gives the phis of its
+ * successors their operands along the edges leaving it
+ */
+void rename_enter(basic_block_t *bb)
 {
     for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
         if (insn->opcode == OP_phi)
@@ -847,13 +1082,13 @@ void bb_solve_phi_params(basic_block_t *bb)
                 append_phi_operand(insn, insn->rd, bb);
         }
     }
+}
 
-    for (int i = 0; i < MAX_BB_DOM_SUCC; i++) {
-        if (!bb->dom_next[i])
-            break;
-        bb_solve_phi_params(bb->dom_next[i]);
-    }
-
+/* Takes the definitions of 'bb' out of scope once its dominator subtree is
+ * renamed
+ */
+void rename_leave(basic_block_t *bb)
+{
     for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
         if (insn->opcode == OP_phi)
             pop_name(insn->rd);
@@ -862,6 +1097,38 @@ void bb_solve_phi_params(basic_block_t *bb)
     }
 }
 
+/* Renames the blocks dominated by 'root', walking the dominator tree with the
+ * explicit DFS stack so that deep trees cannot overflow the native stack
+ */
+void bb_solve_phi_params(basic_block_t *root)
+{
+    int sp = 0;
+
+    rename_enter(root);
+    dfs_reserve(1);
+    dfs_stack[sp] = root;
+    dfs_edge[sp++] = 0;
+
+    while (sp > 0) {
+        basic_block_t *bb = dfs_stack[sp - 1];
+        int i = dfs_edge[sp - 1];
+
+        if (i == bb->dom_next.size) {
+            rename_leave(bb);
+            sp--;
+            continue;
+        }
+
+        basic_block_t *child = bb->dom_next.elements[i];
+        dfs_edge[sp - 1] = i + 1;
+        rename_enter(child);
+
+        dfs_reserve(sp + 1);
+        dfs_stack[sp] = child;
+        dfs_edge[sp++] = 0;
+    }
+}
+
 void solve_phi_params(void)
 {
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
@@ -876,25 +1143,24 @@ void solve_phi_params(void)
             var_t *var = require_var(func->bbs->scope);
             var_t *base = &func->param_defs[i];
             memcpy(var, base, sizeof(var_t));
-            var->base = base;
-            var->subscript = 0;
-
-            base->rename.stack[base->rename.stack_idx++] =
-                base->rename.counter++;
-            base->subscripts[base->subscripts_idx++] = var;
+            push_subscript(base, var);
         }
 
         bb_solve_phi_params(func->bbs);
     }
 }
 
-void append_unwound_phi_insn(basic_block_t *bb, var_t *dest, var_t *rs)
+void append_unwound_phi_insn(basic_block_t *bb,
+                             basic_block_t *phi_bb,
+                             var_t *dest,
+                             var_t *rs)
 {
     insn_t *n = arena_calloc(INSN_ARENA, 1, sizeof(insn_t));
     n->opcode = OP_unwound_phi;
     n->rd = dest;
     n->rs1 = rs;
     n->belong_to = bb;
+    n->phi_bb = phi_bb;
 
     insn_t *tail = bb->insn_list.tail;
     if (!tail) {
@@ -913,6 +1179,7 @@ void append_unwound_phi_insn(basic_block_t *bb, var_t *dest, var_t *rs)
             tail->prev = n;
         } else {
             tail->next = n;
+            n->prev = tail;
             bb->insn_list.tail = n;
         }
     }
@@ -929,7 +1196,8 @@ void bb_unwind_phi(func_t *func, basic_block_t *bb)
 
         for (phi_operand_t *operand = insn->phi_ops; operand;
              operand = operand->next)
-            append_unwound_phi_insn(operand->from, insn->rd, operand->var);
+            append_unwound_phi_insn(operand->from, bb, insn->rd,
+                                    operand->var);
     }
 
     bb->insn_list.head = insn;
@@ -941,36 +1209,21 @@ void bb_unwind_phi(func_t *func, basic_block_t *bb)
 
 void unwind_phi(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->preorder_cb = bb_unwind_phi;
-        bb_forward_traversal(args);
+        func_dfs(func);
+        for (int i = 0; i < func->dfs_pre.size; i++)
+            bb_unwind_phi(func, func->dfs_pre.elements[i]);
     }
 }
 
+/* Whether 'pred' strictly dominates 'succ' */
 bool is_dominate(basic_block_t *pred, basic_block_t *succ)
 {
-    int i;
-    bool found = false;
-    for (i = 0; i < MAX_BB_DOM_SUCC; i++) {
-        if (!pred->dom_next[i])
-            break;
-        if (pred->dom_next[i] == succ) {
-            found = true;
-            break;
-        }
-        found |= is_dominate(pred->dom_next[i], succ);
-    }
-
-    return found;
+    return pred != succ && dominates(pred, succ);
 }
 
 /*
@@ -1017,18 +1270,14 @@ void bb_check_var_cross_init(func_t *func, basic_block_t *bb)
  */
 void check_var_cross_init()
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
-
-        func->visited++;
-        args->postorder_cb = bb_check_var_cross_init;
-        bb_forward_traversal(args);
+        func_dfs(func);
+        for (int i = 0; i < func->dfs_post.size; i++)
+            bb_check_var_cross_init(func, func->dfs_post.elements[i]);
     }
 }
 
@@ -1323,7 +1572,7 @@ void bb_dump(FILE *fd, func_t *func, basic_block_t *bb)
         bb_dump_connection(fd, bb, bb->else_, ELSE);
     }
 
-    for (int i = 0; i < MAX_BB_PRED; i++)
+    for (int i = 0; i < bb->prev_size; i++)
         if (bb->prev[i].bb)
             bb_dump_connection(fd, bb->prev[i].bb, bb, bb->prev[i].type);
 }
@@ -1352,11 +1601,9 @@ void dump_cfg(char name[])
 void dom_dump(FILE *fd, basic_block_t *bb)
 {
     fprintf(fd, "\"%p\"\n", bb);
-    for (int i = 0; i < MAX_BB_DOM_SUCC; i++) {
-        if (!bb->dom_next[i])
-            break;
-        dom_dump(fd, bb->dom_next[i]);
-        fprintf(fd, "\"%p\":s->\"%p\":n\n", bb, bb->dom_next[i]);
+    for (int i = 0; i < bb->dom_next.size; i++) {
+        dom_dump(fd, bb->dom_next.elements[i]);
+        fprintf(fd, "\"%p\":s->\"%p\":n\n", bb, bb->dom_next.elements[i]);
     }
 }
 
@@ -1407,8 +1654,17 @@ void ssa_build(void)
     unwind_phi();
 }
 
-/* Check if operation can be subject to CSE */
-bool is_cse_candidate(insn_t *insn)
+/* Scoped hash table of global value numbering. Entries form a stack, and
+ * those of a dominator subtree are popped once the walk leaves it.
+ */
+gvn_entry_t *gvn_entries;
+int gvn_entries_size = 0;
+int *gvn_buckets;
+int *gvn_scopes; /* stack height on entry to each level of the walk */
+int gvn_last_num = 0;
+
+/* Check if operation can be subject to value numbering */
+bool is_gvn_candidate(insn_t *insn)
 {
     switch (insn->opcode) {
     case OP_add:
@@ -1429,118 +1685,324 @@ bool is_cse_candidate(insn_t *insn)
     case OP_leq:
     case OP_gt:
     case OP_geq:
+    case OP_negate:
+    case OP_bit_not:
+    case OP_log_not:
+    case OP_trunc:
+    case OP_sign_ext:
         return true;
     default:
         return false;
     }
 }
 
-/* Common Subexpression Elimination (CSE) */
-/* Enhanced to support general binary operations */
-bool cse(insn_t *insn, basic_block_t *bb)
+bool is_commutative(opcode_t op)
 {
-    /* Handle array access pattern: add + read */
-    if (insn->opcode == OP_read) {
-        insn_t *prev = insn->prev;
-        if (!prev)
-            return false;
-        if (prev->opcode != OP_add)
-            return false;
-        if (prev->rd != insn->rs1)
-            return false;
-
-        var_t *def = insn->rd, *base = prev->rs1, *idx = prev->rs2;
-        if (base->is_global || idx->is_global)
-            return false;
-
-        /* Look for identical add+read patterns */
-        for (use_chain_t *user = base->users_head; user; user = user->next) {
-            insn_t *i = user->insn;
-            if (i == prev)
-                continue;
-            if (i->opcode != OP_add)
-                continue;
-            if (!i->next)
-                continue;
-            if (i->next->opcode != OP_read)
-                continue;
-            if (i->rs1 != base || i->rs2 != idx)
-                continue;
-
-            /* Check dominance */
-            basic_block_t *i_bb = i->belong_to;
-            bool check_dom = false;
-            for (;; i_bb = i_bb->idom) {
-                if (i_bb == bb) {
-                    check_dom = true;
-                    break;
-                }
-                if (i_bb == i_bb->idom)
-                    break;
-            }
-            if (!check_dom)
-                continue;
-
-            /* Replace with assignment */
-            i->next->opcode = OP_assign;
-            i->next->rs1 = def;
-            if (i->prev) {
-                i->prev->next = i->next;
-                i->next->prev = i->prev;
-            } else {
-                i->belong_to->insn_list.head = i->next;
-                i->next->prev = NULL;
-            }
-        }
+    switch (op) {
+    case OP_add:
+    case OP_mul:
+    case OP_bit_and:
+    case OP_bit_or:
+    case OP_bit_xor:
+    case OP_log_and:
+    case OP_log_or:
+    case OP_eq:
+    case OP_neq:
         return true;
+    default:
+        return false;
     }
+}
 
-    /* Handle general binary operations */
-    if (!is_cse_candidate(insn))
-        return false;
+/* Whether 'var' may change behind the instructions defining it */
+bool gvn_unstable(var_t *var)
+{
+    return var->is_global || var->address_taken;
+}
 
-    if (!insn->rs1 || !insn->rs2 || !insn->rd)
-        return false;
+/* Value number of 'var', shared with the source of the copy defining it */
+int gvn_number(var_t *var)
+{
+    while (var->last_assign && var->last_assign->opcode == OP_assign) {
+        var_t *src = var->last_assign->rs1;
+        if (gvn_unstable(src) || src->is_const)
+            break;
+        var = src;
+    }
 
-    /* Don't CSE operations with global variables */
-    if (insn->rs1->is_global || insn->rs2->is_global)
-        return false;
+    if (!var->value_num)
+        var->value_num = ++gvn_last_num;
+    return var->value_num;
+}
 
-    /* Look for identical binary operations */
-    for (insn_t *other = bb->insn_list.head; other; other = other->next) {
-        if (other == insn)
-            break; /* Only consider earlier instructions */
+/* Replaces 'insn' with a copy if a dominating instruction computes the same
+ * value, otherwise records it for the dominator subtree.
+ */
+void gvn_insn(insn_t *insn)
+{
+    if (insn->rd)
+        insn->rd->last_assign = insn;
+
+    if (!is_gvn_candidate(insn) || !insn->rd || !insn->rs1)
+        return;
+    if (gvn_unstable(insn->rd) || gvn_unstable(insn->rs1))
+        return;
+    if (insn->rs2 && gvn_unstable(insn->rs2))
+        return;
 
-        if (other->opcode != insn->opcode)
+    opcode_t op = insn->opcode;
+    int num1 = 0, val1 = 0, num2 = 0, val2 = 0;
+    if (insn->rs1->is_const)
+        val1 = insn->rs1->init_val;
+    else
+        num1 = gvn_number(insn->rs1);
+    if (insn->rs2 && insn->rs2->is_const)
+        val2 = insn->rs2->init_val;
+    else if (insn->rs2)
+        num2 = gvn_number(insn->rs2);
+
+    /* 'a > b' is 'b < a', and commutative operands are ordered */
+    bool swap = false;
+    if (op == OP_gt || op == OP_geq) {
+        op = op == OP_gt ? OP_lt : OP_leq;
+        swap = true;
+    } else if (is_commutative(op))
+        swap = num1 < num2 || (num1 == num2 && val1 < val2);
+    if (swap) {
+        int t = num1;
+        num1 = num2;
+        num2 = t;
+        t = val1;
+        val1 = val2;
+        val2 = t;
+    }
+
+    int hash = op;
+    hash = ((hash * 31) ^ num1) & 0xFFFFFF;
+    hash = ((hash * 31) ^ val1) & 0xFFFFFF;
+    hash = ((hash * 31) ^ num2) & 0xFFFFFF;
+    hash = ((hash * 31) ^ val2) & 0xFFFFFF;
+    hash = ((hash * 31) ^ insn->sz) & 0xFFFFFF;
+    int bucket = hash & (GVN_BUCKETS - 1);
+
+    for (int i = gvn_buckets[bucket]; i; i = gvn_entries[i - 1].next) {
+        gvn_entry_t *e = &gvn_entries[i - 1];
+        if (e->hash != hash || e->opcode != op || e->sz != insn->sz)
+            continue;
+        if (e->num1 != num1 || e->val1 != val1)
             continue;
-        if (!other->rs1 || !other->rs2 || !other->rd)
+        if (e->num2 != num2 || e->val2 != val2)
             continue;
 
-        /* Check if operands match */
-        bool operands_match = false;
-        if (other->rs1 == insn->rs1 && other->rs2 == insn->rs2) {
-            operands_match = true;
-        } else if (insn->opcode == OP_add || insn->opcode == OP_mul ||
-                   insn->opcode == OP_bit_and || insn->opcode == OP_bit_or ||
-                   insn->opcode == OP_bit_xor || insn->opcode == OP_log_and ||
-                   insn->opcode == OP_log_or || insn->opcode == OP_eq ||
-                   insn->opcode == OP_neq) {
-            /* Commutative operations */
-            if (other->rs1 == insn->rs2 && other->rs2 == insn->rs1) {
-                operands_match = true;
-            }
+        insn->opcode = OP_assign;
+        insn->rs1 = e->insn->rd;
+        insn->rs2 = NULL;
+        return;
+    }
+
+    gvn_entries = arena_grow(GENERAL_ARENA, gvn_entries, gvn_entries_size + 1,
+                             sizeof(gvn_entry_t));
+    gvn_entry_t *e = &gvn_entries[gvn_entries_size++];
+    e->opcode = op;
+    e->num1 = num1;
+    e->val1 = val1;
+    e->num2 = num2;
+    e->val2 = val2;
+    e->sz = insn->sz;
+    e->hash = hash;
+    e->next = gvn_buckets[bucket];
+    e->insn = insn;
+    gvn_buckets[bucket] = gvn_entries_size;
+}
+
+/* Pops the entries above 'height', unlinking each from its bucket */
+void gvn_pop(int height)
+{
+    while (gvn_entries_size > height) {
+        gvn_entry_t *e = &gvn_entries[--gvn_entries_size];
+        gvn_buckets[e->hash & (GVN_BUCKETS - 1)] = e->next;
+    }
+}
+
+/* Pushes 'bb' at 'depth' of the dominator tree walk and numbers its code */
+void gvn_enter(basic_block_t *bb, int depth)
+{
+    gvn_scopes = arena_grow(GENERAL_ARENA, gvn_scopes, depth + 1, sizeof(int));
+    gvn_scopes[depth] = gvn_entries_size;
+
+    dfs_reserve(depth + 1);
+    dfs_stack[depth] = bb;
+    dfs_edge[depth] = 0;
+
+    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next)
+        gvn_insn(insn);
+}
+
+/* Global value numbering: a walk of the dominator tree in preorder, where the
+ * instructions of a block see those of all its dominators. Each expression is
+ * looked up in constant time, and a redundant one becomes a copy of the value
+ * computed first.
+ */
+void gvn(func_t *func)
+{
+    if (!gvn_buckets)
+        gvn_buckets = arena_calloc(GENERAL_ARENA, GVN_BUCKETS, sizeof(int));
+
+    int sp = 0;
+    gvn_enter(func->bbs, sp++);
+
+    while (sp > 0) {
+        basic_block_t *bb = dfs_stack[sp - 1];
+        int i = dfs_edge[sp - 1];
+
+        if (i == bb->dom_next.size) {
+            gvn_pop(gvn_scopes[--sp]);
+            continue;
         }
 
-        if (operands_match) {
-            /* Replace current instruction with assignment */
-            insn->opcode = OP_assign;
-            insn->rs1 = other->rd;
-            insn->rs2 = NULL;
-            return true;
+        dfs_edge[sp - 1] = i + 1;
+        gvn_enter(bb->dom_next.elements[i], sp++);
+    }
+}
+
+/* Stamp of the loop under LICM, given to the variables defined in it */
+int licm_stamp = 0;
+
+/* Whether 'var' holds the same value in every iteration of the loop */
+bool licm_invariant(var_t *var)
+{
+    if (var->is_const)
+        return true;
+    return !gvn_unstable(var) && var->in_loop != licm_stamp;
+}
+
+bool licm_hoistable(insn_t *insn)
+{
+    if (!is_gvn_candidate(insn) || !insn->rd || !insn->rs1)
+        return false;
+
+    /* a division might trap where the loop would not have run it */
+    if (insn->opcode == OP_div || insn->opcode == OP_mod)
+        return false;
+
+    if (gvn_unstable(insn->rd) || !licm_invariant(insn->rs1))
+        return false;
+    return !insn->rs2 || licm_invariant(insn->rs2);
+}
+
+/* Block entering the header of 'loop' from outside, which is created unless
+ * a single predecessor outside the loop falls through to the header only.
+ */
+basic_block_t *licm_preheader(loop_t *loop)
+{
+    basic_block_t *header = loop->header, *entry = NULL;
+    int entries = 0;
+
+    for (int i = 0; i < header->prev_size; i++) {
+        basic_block_t *pred = header->prev[i].bb;
+        if (pred && !loop_contains(loop, pred)) {
+            entry = pred;
+            entries++;
         }
     }
+    if (entries == 1 && !entry->then_ && !entry->else_)
+        return entry;
 
-    return false;
+    basic_block_t *pre = bb_create(header->scope);
+    for (int i = 0; i < header->prev_size; i++) {
+        basic_block_t *pred = header->prev[i].bb;
+        if (!pred || loop_contains(loop, pred))
+            continue;
+
+        bb_connection_type_t type = header->prev[i].type;
+        bb_disconnect(pred, header);
+        bb_connect(pred, pre, type);
+    }
+    bb_connect(pre, header, NEXT);
+    pre->loop = loop->parent;
+    return pre;
+}
+
+/* Moves 'insn' to the end of the preheader 'pre', which has no branch */
+void licm_hoist(insn_t *insn, basic_block_t *pre)
+{
+    basic_block_t *bb = insn->belong_to;
+    if (insn->prev)
+        insn->prev->next = insn->next;
+    else
+        bb->insn_list.head = insn->next;
+    if (insn->next)
+        insn->next->prev = insn->prev;
+    else
+        bb->insn_list.tail = insn->prev;
+
+    insn->belong_to = pre;
+    insn->next = NULL;
+    insn->prev = pre->insn_list.tail;
+    if (pre->insn_list.tail)
+        pre->insn_list.tail->next = insn;
+    else
+        pre->insn_list.head = insn;
+    pre->insn_list.tail = insn;
+
+    insn->rd->in_loop = 0;
+}
+
+/* Moves along the load of a constant operand defined in the loop. Register
+ * allocation rematerializes constants where they are used, so only a load
+ * left behind for the hoisted user alone would cost anything.
+ */
+void licm_hoist_const(var_t *var, basic_block_t *pre)
+{
+    insn_t *def = var ? var->last_assign : NULL;
+    if (!def || var->in_loop != licm_stamp || !var->is_const)
+        return;
+    if (def->opcode == OP_load_constant)
+        licm_hoist(def, pre);
+}
+
+/* Loop-invariant code motion: a pure computation whose operands are defined
+ * outside a loop, or are constants, is moved to the preheader of the loop and
+ * runs once rather than once per iteration. Loops are visited from outermost
+ * inward so that a value is hoisted as far as it can go, and blocks in
+ * reverse postorder so that a chain of invariant computations moves together.
+ */
+void licm(func_t *func)
+{
+    func_build_loops(func);
+
+    for (loop_t *loop = func->loops; loop; loop = loop->next) {
+        /* nothing runs before a loop headed by the function entry */
+        if (loop->header == func->bbs)
+            continue;
+
+        licm_stamp++;
+        for (int i = 0; i < loop->bbs.size; i++) {
+            basic_block_t *bb = loop->bbs.elements[i];
+            for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+                if (!insn->rd)
+                    continue;
+                insn->rd->in_loop = licm_stamp;
+                insn->rd->last_assign = insn;
+            }
+        }
+
+        basic_block_t *pre = NULL;
+        for (int i = 0; i < loop->bbs.size; i++) {
+            basic_block_t *bb = loop->bbs.elements[i];
+            insn_t *next;
+            for (insn_t *insn = bb->insn_list.head; insn; insn = next) {
+                next = insn->next;
+                if (!licm_hoistable(insn))
+                    continue;
+                if (!pre)
+                    pre = licm_preheader(loop);
+                licm_hoist_const(insn->rs1, pre);
+                licm_hoist_const(insn->rs2, pre);
+                licm_hoist(insn, pre);
+            }
+        }
+    }
 }
 
 bool mark_const(insn_t *insn)
@@ -1600,11 +2062,15 @@ bool eval_const_arithmetic(insn_t *insn)
     case OP_div:
         if (r == 0)
             return false; /* avoid division by zero */
+        if (r == -1 && l == -2147483647 - 1)
+            return false; /* avoid the overflow of INT_MIN / -1 */
         res = l / r;
         break;
     case OP_mod:
         if (r == 0)
             return false; /* avoid modulo by zero */
+        if (r == -1 && l == -2147483647 - 1)
+            return false;
         res = l % r;
         break;
     case OP_lshift:
@@ -1744,10 +2210,16 @@ bool var_escapes(var_t *var)
     return true;
 }
 
+void dce_push(insn_t *insn)
+{
+    dce_work_list = arena_grow(GENERAL_ARENA, dce_work_list,
+                               dce_work_list_idx + 1, sizeof(insn_t *));
+    dce_work_list[dce_work_list_idx++] = insn;
+}
+
 /* initial mark useful instruction */
-int dce_init_mark(insn_t *insn, insn_t *work_list[], int work_list_idx)
+void dce_init_mark(insn_t *insn)
 {
-    int mark_num = 0;
     /* mark instruction "useful" if it sets a return value, affects the value in
      * a storage location, or it is a function call.
      */
@@ -1755,8 +2227,7 @@ int dce_init_mark(insn_t *insn, insn_t *work_list[], int work_list_idx)
     case OP_return:
         insn->useful = true;
         insn->belong_to->useful = true;
-        work_list[work_list_idx + mark_num] = insn;
-        mark_num++;
+        dce_push(insn);
         break;
     case OP_write:
     case OP_store:
@@ -1764,42 +2235,36 @@ int dce_init_mark(insn_t *insn, insn_t *work_list[], int work_list_idx)
         if (!insn->rd || var_escapes(insn->rd)) {
             insn->useful = true;
             insn->belong_to->useful = true;
-            work_list[work_list_idx + mark_num] = insn;
-            mark_num++;
+            dce_push(insn);
         }
         break;
     case OP_global_store:
         /* Global stores always escape */
         insn->useful = true;
         insn->belong_to->useful = true;
-        work_list[work_list_idx + mark_num] = insn;
-        mark_num++;
+        dce_push(insn);
         break;
     case OP_address_of:
     case OP_unwound_phi:
     case OP_allocat:
         insn->useful = true;
         insn->belong_to->useful = true;
-        work_list[work_list_idx + mark_num] = insn;
-        mark_num++;
+        dce_push(insn);
         break;
     case OP_indirect:
     case OP_call:
         insn->useful = true;
         insn->belong_to->useful = true;
-        work_list[work_list_idx + mark_num] = insn;
-        mark_num++;
+        dce_push(insn);
         /* mark precall and postreturn sequences at calls */
         if (insn->next && insn->next->opcode == OP_func_ret) {
             insn->next->useful = true;
-            work_list[work_list_idx + mark_num] = insn->next;
-            mark_num++;
+            dce_push(insn->next);
         }
         while (insn->prev && insn->prev->opcode == OP_push) {
             insn = insn->prev;
             insn->useful = true;
-            work_list[work_list_idx + mark_num] = insn;
-            mark_num++;
+            dce_push(insn);
         }
         break;
     default:
@@ -1809,31 +2274,24 @@ int dce_init_mark(insn_t *insn, insn_t *work_list[], int work_list_idx)
         if (insn->rd->is_global && !insn->useful) {
             insn->useful = true;
             insn->belong_to->useful = true;
-            work_list[work_list_idx + mark_num] = insn;
-            mark_num++;
+            dce_push(insn);
         }
         break;
     }
-    return mark_num;
 }
 
 /* Dead Code Elimination (DCE) */
 void dce_insn(basic_block_t *bb)
 {
-    insn_t *work_list[DCE_WORKLIST_SIZE];
-    int work_list_idx = 0;
+    dce_work_list_idx = 0;
 
     /* initially analyze current bb */
-    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
-        int mark_num = dce_init_mark(insn, work_list, work_list_idx);
-        work_list_idx += mark_num;
-        if (work_list_idx > DCE_WORKLIST_SIZE - 1)
-            fatal("DCE worklist size exceeded");
-    }
+    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next)
+        dce_init_mark(insn);
 
     /* Process worklist - marking dependencies as useful */
-    while (work_list_idx != 0) {
-        insn_t *curr = work_list[--work_list_idx];
+    while (dce_work_list_idx != 0) {
+        insn_t *curr = dce_work_list[--dce_work_list_idx];
 
         /* Skip if already processed to avoid redundant work */
         if (!curr)
@@ -1848,10 +2306,7 @@ void dce_insn(basic_block_t *bb)
             if (!dep_insn->useful) {
                 dep_insn->useful = true;
                 dep_insn->belong_to->useful = true;
-                if (work_list_idx < DCE_WORKLIST_SIZE - 1)
-                    work_list[work_list_idx++] = dep_insn;
-                else
-                    fatal("DCE worklist overflow");
+                dce_push(dep_insn);
             }
         }
 
@@ -1861,10 +2316,7 @@ void dce_insn(basic_block_t *bb)
             if (!dep_insn->useful) {
                 dep_insn->useful = true;
                 dep_insn->belong_to->useful = true;
-                if (work_list_idx < DCE_WORKLIST_SIZE - 1)
-                    work_list[work_list_idx++] = dep_insn;
-                else
-                    fatal("DCE worklist overflow");
+                dce_push(dep_insn);
             }
         }
 
@@ -1876,26 +2328,21 @@ void dce_insn(basic_block_t *bb)
                     !phi_op->var->last_assign->useful) {
                     phi_op->var->last_assign->useful = true;
                     phi_op->var->last_assign->belong_to->useful = true;
-                    if (work_list_idx < DCE_WORKLIST_SIZE - 1)
-                        work_list[work_list_idx++] = phi_op->var->last_assign;
-                    else
-                        fatal("DCE worklist overflow");
+                    dce_push(phi_op->var->last_assign);
                 }
             }
         }
 
         basic_block_t *rdf;
-        for (int i = 0; i < curr->belong_to->rdf_idx; i++) {
-            rdf = curr->belong_to->RDF[i];
+        for (int i = 0; i < curr->belong_to->RDF.size; i++) {
+            rdf = curr->belong_to->RDF.elements[i];
             if (!rdf)
                 break;
             insn_t *tail = rdf->insn_list.tail;
             if (tail && tail->opcode == OP_branch && !tail->useful) {
                 tail->useful = true;
                 rdf->useful = true;
-                work_list[work_list_idx++] = tail;
-                if (work_list_idx > DCE_WORKLIST_SIZE - 1)
-                    fatal("DCE worklist overflow");
+                dce_push(tail);
             }
         }
     }
@@ -1968,37 +2415,46 @@ void build_reversed_rpo();
 
 void optimize(void)
 {
+    use_chain_build();
+
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
+
+        /* drop the blocks SCCP found unreachable, and the edges it removed
+         * from the dominator tree
+         */
+        sccp(func);
+        func_refresh_dom(func);
+    }
+
     /* build rdf information for DCE */
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        if (func->bbs)
+            func_connect_exit(func);
+    }
     build_reversed_rpo();
     build_r_idom();
     build_rdom();
     build_rdf();
 
-    use_chain_build();
-
-    /* Run SCCP optimization multiple times for full propagation */
-    bool sccp_changed = true;
-    int sccp_iterations = 0;
-    while (sccp_changed && sccp_iterations < 5) {
-        sccp_changed = false;
-        for (func_t *func = FUNC_LIST.head; func; func = func->next) {
-            /* Skip function declarations without bodies */
-            if (!func->bbs)
-                continue;
+    /* Run constant cast optimization for truncation */
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
 
-            if (simple_sccp(func))
-                sccp_changed = true;
-        }
-        sccp_iterations++;
+        optimize_constant_casts(func);
     }
 
-    /* Run constant cast optimization for truncation */
+    /* Eliminate redundant computations along the dominator tree */
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        optimize_constant_casts(func);
+        gvn(func);
     }
 
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
@@ -2018,8 +2474,6 @@ void optimize(void)
                 /* Apply optimizations in order */
                 if (const_folding(insn)) /* First: fold constants */
                     continue;
-                if (cse(insn, bb)) /* Then: eliminate common subexpressions */
-                    continue;
 
                 /* Eliminate redundant assignments: x = x */
                 if (insn->opcode == OP_assign && insn->rd && insn->rs1 &&
@@ -2440,108 +2894,259 @@ void optimize(void)
 
     /* Eliminate dead instructions */
     dce_sweep();
+
+    /* Hoist loop-invariant computations out of loops */
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
+
+        licm(func);
+    }
+}
+
+/* Out-of-SSA translation.
+ *
+ * Every phi left a copy of each of its inputs, OP_unwound_phi, at the end of
+ * the predecessor the input comes from. A predecessor which also branches
+ * elsewhere would run the copy on both edges, so such an edge gets a block of
+ * its own to hold it. The copies at the end of a block form a parallel copy,
+ * whose sources are all read before any destination is written, and are
+ * ordered into plain assignments. A copy is emitted once no other remaining
+ * copy reads its destination, and a cycle of copies is broken by saving one
+ * destination in a temporary. The results of phis are then variables assigned
+ * along each incoming edge, which registers may hold like any other.
+ */
+insn_t **copy_list;
+
+void bb_unlink_insn(basic_block_t *bb, insn_t *insn)
+{
+    if (insn->prev)
+        insn->prev->next = insn->next;
+    else
+        bb->insn_list.head = insn->next;
+    if (insn->next)
+        insn->next->prev = insn->prev;
+    else
+        bb->insn_list.tail = insn->prev;
+    insn->prev = NULL;
+    insn->next = NULL;
+}
+
+/* Appends 'insn' to 'bb', before the branch ending it if any */
+void bb_append_copy(basic_block_t *bb, insn_t *insn)
+{
+    insn_t *tail = bb->insn_list.tail;
+    insn->belong_to = bb;
+
+    if (tail && tail->opcode == OP_branch) {
+        insn->prev = tail->prev;
+        insn->next = tail;
+        if (tail->prev)
+            tail->prev->next = insn;
+        else
+            bb->insn_list.head = insn;
+        tail->prev = insn;
+        return;
+    }
+
+    insn->prev = tail;
+    insn->next = NULL;
+    if (tail)
+        tail->next = insn;
+    else
+        bb->insn_list.head = insn;
+    bb->insn_list.tail = insn;
 }
 
-void bb_index_reversed_rpo(func_t *func, basic_block_t *bb)
+bool bb_has_copies(basic_block_t *bb, basic_block_t *phi_bb)
 {
-    bb->rpo_r = func->bb_cnt++;
+    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+        if (insn->opcode == OP_unwound_phi && insn->phi_bb == phi_bb)
+            return true;
+    }
+    return false;
 }
 
-void bb_reverse_reversed_index(func_t *func, basic_block_t *bb)
+/* Moves the copies into the phis of 'succ' from 'pred' to a new block on the
+ * edge between them
+ */
+void split_phi_edge(basic_block_t *pred, basic_block_t *succ)
 {
-    bb->rpo_r = func->bb_cnt - bb->rpo_r;
+    bb_connection_type_t type = NEXT;
+    for (int i = 0; i < succ->prev_size; i++) {
+        if (succ->prev[i].bb == pred)
+            type = succ->prev[i].type;
+    }
+
+    basic_block_t *edge = bb_create(succ->scope);
+    bb_disconnect(pred, succ);
+    bb_connect(pred, edge, type);
+    bb_connect(edge, succ, NEXT);
+
+    insn_t *next;
+    for (insn_t *insn = pred->insn_list.head; insn; insn = next) {
+        next = insn->next;
+        if (insn->opcode != OP_unwound_phi || insn->phi_bb != succ)
+            continue;
+        bb_unlink_insn(pred, insn);
+        bb_append_copy(edge, insn);
+    }
 }
 
-void bb_build_reversed_rpo(func_t *func, basic_block_t *bb)
+/* Turns the copies into phis at the end of 'bb' into assignments, ordered so
+ * that none overwrites a value another one still has to read
+ */
+void bb_sequentialize_copies(basic_block_t *bb)
 {
-    if (func->exit == bb)
-        return;
+    int n = 0;
+    insn_t *next;
+    for (insn_t *insn = bb->insn_list.head; insn; insn = next) {
+        next = insn->next;
+        if (insn->opcode != OP_unwound_phi)
+            continue;
+        bb_unlink_insn(bb, insn);
 
-    basic_block_t *prev = func->exit;
-    basic_block_t *curr = func->exit->rpo_r_next;
-    for (; curr; curr = curr->rpo_r_next) {
-        if (curr->rpo_r < bb->rpo_r) {
-            prev = curr;
+        /* constant phis are rematerialized where they are used */
+        if (insn->rd->is_const || insn->rd == insn->rs1)
             continue;
-        }
-        bb->rpo_r_next = curr;
-        prev->rpo_r_next = bb;
-        prev = curr;
-        return;
+
+        copy_list =
+            arena_grow(GENERAL_ARENA, copy_list, n + 1, sizeof(insn_t *));
+        insn->opcode = OP_assign;
+        insn->phi_bb = NULL;
+        copy_list[n++] = insn;
     }
 
-    prev->rpo_r_next = bb;
+    while (n > 0) {
+        int i;
+        for (i = 0; i < n; i++) {
+            int j = 0;
+            while (j < n && copy_list[j]->rs1 != copy_list[i]->rd)
+                j++;
+            if (j == n)
+                break;
+        }
+
+        if (i == n) {
+            /* every copy left lies on a cycle */
+            var_t *dest = copy_list[0]->rd;
+            var_t *tmp = require_var(bb->scope);
+            gen_name_to(tmp->var_name);
+            tmp->type = dest->type;
+            tmp->ptr_level = dest->ptr_level;
+
+            insn_t *save = arena_calloc(INSN_ARENA, 1, sizeof(insn_t));
+            save->opcode = OP_assign;
+            save->rd = tmp;
+            save->rs1 = dest;
+            bb_append_copy(bb, save);
+
+            for (int j = 0; j < n; j++) {
+                if (copy_list[j]->rs1 == dest)
+                    copy_list[j]->rs1 = tmp;
+            }
+            i = 0;
+        }
+
+        bb_append_copy(bb, copy_list[i]);
+        copy_list[i] = copy_list[--n];
+    }
 }
 
-void build_reversed_rpo(void)
+void out_of_ssa(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        func->bb_cnt = 0;
-        args->func = func;
-        args->bb = func->exit;
-
-        func->visited++;
-        args->postorder_cb = bb_index_reversed_rpo;
-        bb_backward_traversal(args);
-
-        func->visited++;
-        args->postorder_cb = bb_reverse_reversed_index;
-        bb_backward_traversal(args);
+        /* the blocks created on the way are complete when created */
+        func_dfs(func);
+        for (int i = 0; i < func->dfs_pre.size; i++) {
+            basic_block_t *bb = func->dfs_pre.elements[i];
+            basic_block_t *then_ = bb->then_, *else_ = bb->else_;
 
-        func->visited++;
-        args->postorder_cb = bb_build_reversed_rpo;
-        bb_backward_traversal(args);
+            if (then_ && else_ && then_ != else_) {
+                if (bb_has_copies(bb, then_)) {
+                    split_phi_edge(bb, then_);
+                    bb_sequentialize_copies(bb->then_);
+                }
+                if (bb_has_copies(bb, else_)) {
+                    split_phi_edge(bb, else_);
+                    bb_sequentialize_copies(bb->else_);
+                }
+            }
+            bb_sequentialize_copies(bb);
+        }
     }
 }
 
-void bb_reset_live_kill_idx(func_t *func, basic_block_t *bb)
+void build_reversed_rpo(void)
 {
-    UNUSED(func);
-    bb->live_kill.size = 0;
+    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
+        /* Skip function declarations without bodies */
+        if (!func->bbs)
+            continue;
+
+        func_rdfs(func);
+
+        /* chain the blocks in reverse postorder of the reversed CFG */
+        basic_block_t *prev = NULL;
+        func->bb_cnt = func->rdfs_post.size;
+        for (int i = func->bb_cnt - 1; i >= 0; i--) {
+            basic_block_t *bb = func->rdfs_post.elements[i];
+            bb->rpo_r = func->bb_cnt - i;
+            bb->rpo_r_next = NULL;
+            if (prev)
+                prev->rpo_r_next = bb;
+            prev = bb;
+        }
+    }
 }
 
-void add_live_gen(basic_block_t *bb, var_t *var);
-void update_consumed(insn_t *insn, var_t *var);
+/* Locals of the function under liveness analysis, indexed by vreg_id */
+var_t **live_vars;
+int live_vars_size = 0;
+
+/* Ring buffer of basic blocks whose live_out must be recomputed */
+basic_block_t **live_worklist;
 
-/* Combined function to reset and solve locals in one pass */
-void bb_reset_and_solve_locals(func_t *func, basic_block_t *bb)
+/* Gives 'var' a slot in the liveness bitsets of the current function, and
+ * keeps the deepest loop nesting it occurs at for the spill costs.
+ */
+void live_number_var(var_t *var, int loop_depth)
 {
-    UNUSED(func);
+    if (var->is_global)
+        return;
 
-    /* Reset live_kill list */
-    bb->live_kill.size = 0;
+    int id = var->vreg_id;
+    if (id >= 0 && id < live_vars_size && live_vars[id] == var) {
+        if (loop_depth > var->loop_depth)
+            var->loop_depth = loop_depth;
+        return;
+    }
 
-    /* Solve locals */
-    int i = 0;
-    for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
-        insn->idx = i++;
+    live_vars = arena_grow(GENERAL_ARENA, live_vars, live_vars_size + 1,
+                           sizeof(var_t *));
+    var->vreg_id = live_vars_size;
+    var->loop_depth = loop_depth;
+    live_vars[live_vars_size++] = var;
+}
 
-        if (insn->rs1) {
-            if (!var_check_killed(insn->rs1, bb))
-                add_live_gen(bb, insn->rs1);
-            update_consumed(insn, insn->rs1);
-        }
-        if (insn->rs2) {
-            if (!var_check_killed(insn->rs2, bb))
-                add_live_gen(bb, insn->rs2);
-            update_consumed(insn, insn->rs2);
-        }
-        if (insn->rd && insn->opcode != OP_unwound_phi)
-            bb_add_killed_var(bb, insn->rd);
-    }
+/* Global variables are never tracked, so they are never live */
+bool live_set_has(int *set, var_t *var)
+{
+    if (var->is_global)
+        return false;
+    return (set[var->vreg_id >> 5] >> (var->vreg_id & 31)) & 1;
 }
 
-void add_live_gen(basic_block_t *bb, var_t *var)
+void live_set_add(int *set, var_t *var)
 {
     if (var->is_global)
         return;
-
-    var_list_add_var(&bb->live_gen, var);
+    set[var->vreg_id >> 5] |= 1 << (var->vreg_id & 31);
 }
 
 void update_consumed(insn_t *insn, var_t *var)
@@ -2550,191 +3155,481 @@ void update_consumed(insn_t *insn, var_t *var)
         var->consumed = insn->idx;
 }
 
+void bb_alloc_live_sets(func_t *func, basic_block_t *bb)
+{
+    bb->live_gen = arena_calloc(BB_ARENA, func->live_words, sizeof(int));
+    bb->live_def = arena_calloc(BB_ARENA, func->live_words, sizeof(int));
+    bb->live_in = arena_calloc(BB_ARENA, func->live_words, sizeof(int));
+    bb->live_out = arena_calloc(BB_ARENA, func->live_words, sizeof(int));
+    bb->live_queued = false;
+    bb->visited = func->visited;
+}
+
+/* Computes the upward-exposed uses and the definitions of 'bb' */
 void bb_solve_locals(func_t *func, basic_block_t *bb)
 {
-    UNUSED(func);
+    bb_alloc_live_sets(func, bb);
 
-    int i = 0;
     for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
-        insn->idx = i++;
-
-        if (insn->rs1) {
-            if (!var_check_killed(insn->rs1, bb))
-                add_live_gen(bb, insn->rs1);
-            update_consumed(insn, insn->rs1);
-        }
-        if (insn->rs2) {
-            if (!var_check_killed(insn->rs2, bb))
-                add_live_gen(bb, insn->rs2);
-            update_consumed(insn, insn->rs2);
-        }
+        if (insn->rs1 && !live_set_has(bb->live_def, insn->rs1))
+            live_set_add(bb->live_gen, insn->rs1);
+        if (insn->rs2 && !live_set_has(bb->live_def, insn->rs2))
+            live_set_add(bb->live_gen, insn->rs2);
         if (insn->rd)
-            if (insn->opcode != OP_unwound_phi)
-                bb_add_killed_var(bb, insn->rd);
+            live_set_add(bb->live_def, insn->rd);
     }
+
+    for (int i = 0; i < func->live_words; i++)
+        bb->live_in[i] = bb->live_gen[i];
 }
 
-void add_live_in(basic_block_t *bb, var_t *var)
+/* Adds the live_in set of 'succ' to the live_out set of 'bb' */
+bool bb_merge_live_in(func_t *func, basic_block_t *bb, basic_block_t *succ)
 {
-    var_list_add_var(&bb->live_in, var);
+    if (!succ || succ->visited != func->visited)
+        return false;
+
+    bool changed = false;
+    for (int i = 0; i < func->live_words; i++) {
+        int added = succ->live_in[i] & ~bb->live_out[i];
+        if (added) {
+            bb->live_out[i] |= added;
+            changed = true;
+        }
+    }
+    return changed;
 }
 
-void compute_live_in(basic_block_t *bb)
+bool bb_update_live_in(func_t *func, basic_block_t *bb)
 {
-    bb->live_in.size = 0;
+    bool changed = false;
+    for (int i = 0; i < func->live_words; i++) {
+        int live_in = bb->live_gen[i] | (bb->live_out[i] & ~bb->live_def[i]);
+        if (live_in != bb->live_in[i]) {
+            bb->live_in[i] = live_in;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/* Solves live_out for every block, starting from the reverse postorder of the
+ * reversed CFG. A block is only revisited when the live_in set of one of its
+ * successors grows.
+ */
+void live_solve(func_t *func)
+{
+    int size = 0, cap = 0;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next)
+        cap++;
+    for (basic_block_t *bb = func->exit; bb; bb = bb->rpo_r_next) {
+        if (bb->visited != func->visited) {
+            /* not reachable from the entry */
+            bb_alloc_live_sets(func, bb);
+            cap++;
+        }
+    }
 
-    for (int i = 0; i < bb->live_out.size; i++) {
-        var_t *var = bb->live_out.elements[i];
-        if (var_check_killed(var, bb))
+    live_worklist =
+        arena_grow(GENERAL_ARENA, live_worklist, cap, sizeof(basic_block_t *));
+
+    for (basic_block_t *bb = func->exit; bb; bb = bb->rpo_r_next) {
+        bb->live_queued = true;
+        live_worklist[size++] = bb;
+    }
+    /* blocks added since the reversed CFG was ordered, such as split edges
+     * and loop preheaders
+     */
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        if (bb->live_queued)
             continue;
-        add_live_in(bb, var);
+        bb->live_queued = true;
+        live_worklist[size++] = bb;
+    }
+
+    int head = 0;
+    while (size > 0) {
+        basic_block_t *bb = live_worklist[head];
+        head = (head + 1) % cap;
+        size--;
+        bb->live_queued = false;
+
+        bool changed = bb_merge_live_in(func, bb, bb->next);
+        if (bb_merge_live_in(func, bb, bb->then_))
+            changed = true;
+        if (bb_merge_live_in(func, bb, bb->else_))
+            changed = true;
+        if (!changed || !bb_update_live_in(func, bb))
+            continue;
+
+        for (int i = 0; i < bb->prev_size; i++) {
+            basic_block_t *pred = bb->prev[i].bb;
+            if (!pred || pred->live_queued || pred->visited != func->visited)
+                continue;
+            pred->live_queued = true;
+            live_worklist[(head + size) % cap] = pred;
+            size++;
+        }
     }
-    for (int i = 0; i < bb->live_gen.size; i++)
-        add_live_in(bb, bb->live_gen.elements[i]);
 }
 
-int merge_live_in(var_t *live_out[], int live_out_idx, basic_block_t *bb)
+/* Copy coalescing.
+ *
+ * The source and the destination of a copy may share one variable unless
+ * they interfere, i.e. one of them is live right after an assignment to the
+ * other. Interference is collected once, as edges between the variables that
+ * take part in some copy. Merged variables form classes, kept by union-find
+ * over vreg_id along with the concatenated edges of their members, and two
+ * classes interfere when an edge of the one with fewer edges leads into the
+ * other. The liveness sets and the instructions follow the classes once all
+ * copies are decided, and copies within a class are dropped.
+ */
+int *co_parent; /* -1 for a variable never merged */
+int *co_copied; /* whether the variable is the operand of a candidate copy */
+int *co_edges_head;
+int *co_edges_tail;
+int *co_degree;
+int *co_edge_to;
+int *co_edge_next;
+int co_edges_size = 0;
+
+/* Words of the liveness sets holding copy-related variables */
+int *co_words;
+int co_words_size = 0;
+
+/* Copy-related variables live at the instruction under scan, as a sparse set */
+int *co_live;
+int *co_live_pos; /* index in co_live, or -1 */
+int co_live_size = 0;
+
+int co_find(int id)
 {
-    /* Early exit for empty live_in */
-    if (bb->live_in.size == 0)
-        return live_out_idx;
+    while (co_parent[id] != id) {
+        co_parent[id] = co_parent[co_parent[id]];
+        id = co_parent[id];
+    }
+    return id;
+}
 
-    /* Optimize for common case of small sets */
-    if (live_out_idx < 16) {
-        /* For small sets, simple linear search is fast enough */
-        for (int i = 0; i < bb->live_in.size; i++) {
-            bool found = false;
-            var_t *var = bb->live_in.elements[i];
-            for (int j = 0; j < live_out_idx; j++) {
-                if (live_out[j] == var) {
-                    found = true;
-                    break;
-                }
+/* Class of 'var', or -1 */
+int co_class(var_t *var)
+{
+    if (!var || var->is_global || co_parent[var->vreg_id] < 0)
+        return -1;
+    return co_find(var->vreg_id);
+}
+
+void co_add_edge(int from, int to)
+{
+    co_edge_to = arena_grow(GENERAL_ARENA, co_edge_to, co_edges_size + 1,
+                            sizeof(int));
+    co_edge_next = arena_grow(GENERAL_ARENA, co_edge_next, co_edges_size + 1,
+                              sizeof(int));
+    co_edge_to[co_edges_size] = to;
+    co_edge_next[co_edges_size] = -1;
+    if (co_edges_head[from] < 0)
+        co_edges_head[from] = co_edges_size;
+    else
+        co_edge_next[co_edges_tail[from]] = co_edges_size;
+    co_edges_tail[from] = co_edges_size++;
+    co_degree[from]++;
+}
+
+void co_live_add(var_t *var)
+{
+    if (!var || var->is_global)
+        return;
+    int id = var->vreg_id;
+    if (!co_copied[id] || co_live_pos[id] >= 0)
+        return;
+    co_live_pos[id] = co_live_size;
+    co_live[co_live_size++] = id;
+}
+
+void co_live_remove(int id)
+{
+    int pos = co_live_pos[id];
+    if (pos < 0)
+        return;
+    int last = co_live[--co_live_size];
+    co_live[pos] = last;
+    co_live_pos[last] = pos;
+    co_live_pos[id] = -1;
+}
+
+/* Records that the copy-related variables live right after each assignment
+ * in 'bb' interfere with the variable assigned. A copy does not make its
+ * source interfere with its destination, as both hold the same value.
+ */
+void co_scan_block(basic_block_t *bb)
+{
+    while (co_live_size > 0)
+        co_live_remove(co_live[co_live_size - 1]);
+
+    for (int i = 0; i < co_words_size; i++) {
+        int w = co_words[i];
+        int bits = bb->live_out[w];
+        for (int b = 0; bits; b++) {
+            if (bits & (1 << b)) {
+                bits &= ~(1 << b);
+                co_live_add(live_vars[(w << 5) + b]);
             }
-            if (!found && live_out_idx < MAX_ANALYSIS_STACK_SIZE)
-                live_out[live_out_idx++] = var;
         }
-    } else {
-        /* For larger sets, check bounds and use optimized loop */
-        for (int i = 0; i < bb->live_in.size; i++) {
-            bool found = false;
-            var_t *var = bb->live_in.elements[i];
-            /* Unroll inner loop for better performance */
-            int j;
-            for (j = 0; j + 3 < live_out_idx; j += 4) {
-                if (live_out[j] == var || live_out[j + 1] == var ||
-                    live_out[j + 2] == var || live_out[j + 3] == var) {
-                    found = true;
-                    break;
+    }
+
+    for (insn_t *insn = bb->insn_list.tail; insn; insn = insn->prev) {
+        if (insn->rd && !insn->rd->is_global) {
+            int id = insn->rd->vreg_id, src = -1;
+            if (insn->opcode == OP_assign && !insn->rs1->is_global)
+                src = insn->rs1->vreg_id;
+
+            co_live_remove(id);
+            if (co_copied[id]) {
+                for (int i = 0; i < co_live_size; i++) {
+                    if (co_live[i] == src)
+                        continue;
+                    co_add_edge(id, co_live[i]);
+                    co_add_edge(co_live[i], id);
                 }
             }
-            /* Handle remaining elements */
-            if (!found) {
-                for (; j < live_out_idx; j++) {
-                    if (live_out[j] == var) {
-                        found = true;
-                        break;
-                    }
-                }
+        }
+        co_live_add(insn->rs1);
+        co_live_add(insn->rs2);
+    }
+}
+
+/* Whether an edge of one of the classes 'a' and 'b' leads into the other */
+bool co_interferes(int a, int b)
+{
+    if (co_degree[a] > co_degree[b]) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    for (int i = co_edges_head[a]; i >= 0; i = co_edge_next[i]) {
+        if (co_find(co_edge_to[i]) == b)
+            return true;
+    }
+    return false;
+}
+
+void co_merge(int into, int from)
+{
+    co_parent[from] = into;
+
+    if (co_edges_head[from] >= 0) {
+        if (co_edges_head[into] < 0)
+            co_edges_head[into] = co_edges_head[from];
+        else
+            co_edge_next[co_edges_tail[into]] = co_edges_head[from];
+        co_edges_tail[into] = co_edges_tail[from];
+    }
+    co_degree[into] += co_degree[from];
+
+    var_t *var = live_vars[into], *merged = live_vars[from];
+    if (merged->loop_depth > var->loop_depth)
+        var->loop_depth = merged->loop_depth;
+}
+
+/* Moves the bits of the merged variables in 'set' to their classes. Only the
+ * words listed in co_words are looked at.
+ */
+void co_remap_set(int *set, int *merged)
+{
+    for (int i = 0; i < co_words_size; i++) {
+        int w = co_words[i];
+        int bits = set[w] & merged[w];
+        if (!bits)
+            continue;
+        set[w] &= ~bits;
+        for (int b = 0; bits; b++) {
+            if (bits & (1 << b)) {
+                bits &= ~(1 << b);
+                int cls = co_find((w << 5) + b);
+                set[cls >> 5] |= 1 << (cls & 31);
             }
-            if (!found && live_out_idx < MAX_ANALYSIS_STACK_SIZE)
-                live_out[live_out_idx++] = var;
         }
     }
-    return live_out_idx;
 }
 
-bool recompute_live_out(basic_block_t *bb)
+var_t *co_rename(var_t *var)
 {
-    var_t *live_out[MAX_ANALYSIS_STACK_SIZE];
-    int live_out_idx = 0;
+    int cls = co_class(var);
+    return cls < 0 ? var : live_vars[cls];
+}
 
-    /* Compute union of successor live_in sets */
-    if (bb->next) {
-        compute_live_in(bb->next);
-        live_out_idx = merge_live_in(live_out, live_out_idx, bb->next);
+void coalesce_copies(func_t *func)
+{
+    int n = live_vars_size;
+    co_parent = arena_grow(GENERAL_ARENA, co_parent, n, sizeof(int));
+    co_copied = arena_grow(GENERAL_ARENA, co_copied, n, sizeof(int));
+    co_edges_head = arena_grow(GENERAL_ARENA, co_edges_head, n, sizeof(int));
+    co_edges_tail = arena_grow(GENERAL_ARENA, co_edges_tail, n, sizeof(int));
+    co_degree = arena_grow(GENERAL_ARENA, co_degree, n, sizeof(int));
+    co_live = arena_grow(GENERAL_ARENA, co_live, n, sizeof(int));
+    co_live_pos = arena_grow(GENERAL_ARENA, co_live_pos, n, sizeof(int));
+    for (int id = 0; id < n; id++) {
+        co_parent[id] = -2; /* not assigned yet */
+        co_copied[id] = false;
+        co_edges_head[id] = -1;
+        co_degree[id] = 0;
+        co_live_pos[id] = -1;
     }
-    if (bb->then_) {
-        compute_live_in(bb->then_);
-        live_out_idx = merge_live_in(live_out, live_out_idx, bb->then_);
+    co_edges_size = 0;
+    co_live_size = 0;
+
+    /* Only plain values assigned by instructions are merged, which leaves
+     * out parameters, storage, the results of calls and the variables
+     * holding the operand of the instruction assigning them.
+     */
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+            if (!insn->rd || insn->rd->is_global)
+                continue;
+
+            int id = insn->rd->vreg_id;
+            if (insn->opcode == OP_allocat || insn->opcode == OP_func_ret ||
+                insn->opcode == OP_load_constant ||
+                insn->opcode == OP_load_data_address ||
+                insn->opcode == OP_load_rodata_address)
+                co_parent[id] = -1;
+            else if (co_parent[id] == -2)
+                co_parent[id] = id;
+        }
     }
-    if (bb->else_) {
-        compute_live_in(bb->else_);
-        live_out_idx = merge_live_in(live_out, live_out_idx, bb->else_);
+    for (int id = 0; id < n; id++) {
+        var_t *var = live_vars[id];
+        if (co_parent[id] == -2 || var->is_const || var->is_func ||
+            var->address_taken || var->array_size)
+            co_parent[id] = -1;
     }
 
-    /* Quick check: if sizes differ, sets must be different */
-    if (bb->live_out.size != live_out_idx) {
-        var_list_assign_array(&bb->live_out, live_out, live_out_idx);
-        return true;
+    int copies = 0;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+            if (insn->opcode != OP_assign)
+                continue;
+
+            int rd = co_class(insn->rd), rs = co_class(insn->rs1);
+            if (rd < 0 || rs < 0 || rd == rs)
+                continue;
+            co_copied[rd] = true;
+            co_copied[rs] = true;
+            copies++;
+        }
+    }
+    co_words_size = 0;
+    for (int id = 0; copies && id < n; id++) {
+        int w = id >> 5;
+        if (!co_copied[id] ||
+            (co_words_size && co_words[co_words_size - 1] == w))
+            continue;
+        co_words =
+            arena_grow(GENERAL_ARENA, co_words, co_words_size + 1, sizeof(int));
+        co_words[co_words_size++] = w;
     }
+    for (basic_block_t *bb = func->bbs; copies && bb; bb = bb->rpo_next)
+        co_scan_block(bb);
 
-    /* Size is same, need to check if contents are identical */
-    /* Optimize by checking if first few elements match (common case) */
-    if (live_out_idx > 0) {
-        /* Quick check first element */
-        bool first_found = false;
-        for (int j = 0; j < bb->live_out.size; j++) {
-            if (live_out[0] == bb->live_out.elements[j]) {
-                first_found = true;
-                break;
-            }
+    int merges = 0;
+    for (basic_block_t *bb = func->bbs; copies && bb; bb = bb->rpo_next) {
+        for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+            if (insn->opcode != OP_assign)
+                continue;
+
+            int rd = co_class(insn->rd), rs = co_class(insn->rs1);
+            if (rd < 0 || rs < 0 || rd == rs || co_interferes(rd, rs))
+                continue;
+            co_merge(rd, rs);
+            merges++;
         }
-        if (!first_found) {
-            var_list_assign_array(&bb->live_out, live_out, live_out_idx);
-            return true;
+    }
+
+    /* The liveness sets follow the merges in a single sweep. Only merged
+     * variables move, and those are copy-related. live_gen is not used past
+     * this point.
+     */
+    if (merges) {
+        int *moved = arena_calloc(GENERAL_ARENA, func->live_words, sizeof(int));
+        for (int id = 0; id < n; id++) {
+            if (co_parent[id] >= 0 && co_find(id) != id)
+                moved[id >> 5] |= 1 << (id & 31);
+        }
+        for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+            co_remap_set(bb->live_in, moved);
+            co_remap_set(bb->live_out, moved);
+            co_remap_set(bb->live_def, moved);
         }
     }
 
-    /* Full comparison */
-    for (int i = 0; i < live_out_idx; i++) {
-        int same = 0;
-        for (int j = 0; j < bb->live_out.size; j++) {
-            if (live_out[i] == bb->live_out.elements[j]) {
-                same = 1;
-                break;
+    /* the instructions left are numbered again */
+    for (int id = 0; id < live_vars_size; id++)
+        live_vars[id]->consumed = -1;
+    for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+        int i = 0;
+        insn_t *next;
+        for (insn_t *insn = bb->insn_list.head; insn; insn = next) {
+            next = insn->next;
+            insn->rd = co_rename(insn->rd);
+            insn->rs1 = co_rename(insn->rs1);
+            insn->rs2 = co_rename(insn->rs2);
+            if (insn->opcode == OP_assign && insn->rd == insn->rs1) {
+                bb_unlink_insn(bb, insn);
+                continue;
             }
-        }
-        if (!same) {
-            var_list_assign_array(&bb->live_out, live_out, live_out_idx);
-            return true;
+
+            insn->idx = i++;
+            if (insn->rs1)
+                update_consumed(insn, insn->rs1);
+            if (insn->rs2)
+                update_consumed(insn, insn->rs2);
         }
     }
-    return false;
 }
 
 void liveness_analysis(void)
 {
-    bb_traversal_args_t *args = arena_alloc_traversal_args();
     for (func_t *func = FUNC_LIST.head; func; func = func->next) {
         /* Skip function declarations without bodies */
         if (!func->bbs)
             continue;
 
-        args->func = func;
-        args->bb = func->bbs;
+        /* Number the instructions and the locals they refer to */
+        live_vars_size = 0;
+        for (int i = 0; i < func->num_params; i++)
+            live_number_var(func->param_defs[i].rename->subscripts[0], 0);
+        for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next) {
+            int depth = bb->loop ? bb->loop->depth : 0;
+            int i = 0;
+            for (insn_t *insn = bb->insn_list.head; insn; insn = insn->next) {
+                insn->idx = i++;
+
+                if (insn->rs1) {
+                    live_number_var(insn->rs1, depth);
+                    update_consumed(insn, insn->rs1);
+                }
+                if (insn->rs2) {
+                    live_number_var(insn->rs2, depth);
+                    update_consumed(insn, insn->rs2);
+                }
+                if (insn->rd)
+                    live_number_var(insn->rd, depth);
+            }
+        }
+        func->live_words = (live_vars_size >> 5) + 1;
 
-        /* Combined traversal: reset and solve locals in one pass */
         func->visited++;
-        args->preorder_cb = bb_reset_and_solve_locals;
-        bb_forward_traversal(args);
+        for (basic_block_t *bb = func->bbs; bb; bb = bb->rpo_next)
+            bb_solve_locals(func, bb);
 
         /* Add function parameters as killed in entry block */
-        for (int i = 0; i < func->num_params; i++)
-            bb_add_killed_var(func->bbs, func->param_defs[i].subscripts[0]);
-    }
-
-    for (func_t *func = FUNC_LIST.head; func; func = func->next) {
-        /* Skip function declarations without bodies */
-        if (!func->bbs)
-            continue;
+        for (int i = 0; i < func->num_params; i++) {
+            rename_t *rn = func->param_defs[i].rename;
+            live_set_add(func->bbs->live_def, rn->subscripts[0]);
+        }
 
-        basic_block_t *bb = func->exit;
-        bool changed;
-        do {
-            changed = false;
-            for (bb = func->exit; bb; bb = bb->rpo_r_next)
-                changed |= recompute_live_out(bb);
-        } while (changed);
+        live_solve(func);
+        if (!fast_reg_alloc)
+            coalesce_copies(func);
     }
 }
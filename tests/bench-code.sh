@@ -0,0 +1,141 @@
+#!/usr/bin/env bash
+
+# Generated-code benchmark.
+#
+# Compiles every kernel in tests/kernels with the stage 0 compiler, checks its
+# output against the same kernel built by the host compiler, and records the
+# size of the .text section along with the number of instructions executed.
+# Results are written to out/bench/code-<arch>.json. When
+# tests/bench/code-<arch>.json exists, the results are compared against it.
+#
+# Instructions are counted by the QEMU user-mode "insn" plugin
+# (contrib/plugins/libinsn.so in a QEMU build tree). Point QEMU_PLUGIN at it;
+# without the plugin only the code size is recorded.
+#
+# Environment variables:
+#   QEMU_PLUGIN=path   Instruction-counting plugin passed to qemu -plugin
+#   CC=compiler        Host compiler for the reference output (default: cc)
+
+set -u
+
+if [ "$#" -lt 1 ] || [ "$#" -gt 2 ]; then
+    echo "Usage: $0 <architecture> [update]"
+    exit 1
+fi
+
+readonly ARCH="$1"
+readonly MODE="${2:-}"
+readonly SHECC="$PWD/out/shecc"
+readonly HOST_CC="${CC:-cc}"
+readonly WORKDIR="$PWD/out/bench"
+readonly RESULT="$WORKDIR/code-$ARCH.json"
+readonly BASELINE="tests/bench/code-$ARCH.json"
+
+# Instruction counting needs both an emulator and the plugin.
+COUNT_INSNS=0
+if [ -z "${TARGET_EXEC:-}" ]; then
+    echo "Warning: running natively, instructions are not counted"
+elif [ -z "${QEMU_PLUGIN:-}" ] || [ ! -f "$QEMU_PLUGIN" ]; then
+    echo "Warning: QEMU_PLUGIN not set, instructions are not counted"
+else
+    COUNT_INSNS=1
+fi
+
+mkdir -p "$WORKDIR"
+
+# Cleared once an executable fails to start, e.g. when no emulator is found.
+RUNNABLE=1
+
+RESULTS=()
+
+# Print the size of the .text section of an ELF file in bytes.
+function text_size() {
+    local size=$(readelf -S -W "$1" |
+        awk '{ for (i = 1; i < NF; i++) if ($i == ".text") print $(i + 4) }')
+    echo $((16#$size))
+}
+
+function bench() {
+    local source="$1"
+    local name=$(basename "$source" .c)
+    local elf="$WORKDIR/$name-$ARCH.elf"
+    local output="$WORKDIR/$name-$ARCH.out"
+    local expected="$WORKDIR/$name-host.out"
+    local log="$WORKDIR/$name-$ARCH.log"
+    local insns="null"
+
+    if ! $SHECC -o "$elf" "$source" >/dev/null 2>&1; then
+        echo "FAILED: $name does not compile"
+        exit 1
+    fi
+    chmod +x "$elf"
+
+    if [ "$RUNNABLE" = 0 ]; then
+        :
+    elif [ "$COUNT_INSNS" = 1 ]; then
+        $TARGET_EXEC -plugin "$QEMU_PLUGIN" -d plugin -D "$log" "$elf" \
+            > "$output"
+    else
+        ${TARGET_EXEC:-} "$elf" > "$output"
+    fi
+    local status=$?
+    if [ $status -eq 126 ] || [ $status -eq 127 ]; then
+        echo "Warning: unable to run $ARCH executables, only code size is recorded"
+        COUNT_INSNS=0
+        RUNNABLE=0
+    elif [ $status -ne 0 ]; then
+        echo "FAILED: $name exited with $status"
+        exit 1
+    fi
+
+    # The kernels are plain C, so the host build serves as the reference.
+    if [ "$RUNNABLE" = 1 ] &&
+        $HOST_CC -w -o "$WORKDIR/$name-host" "$source" &>/dev/null; then
+        "$WORKDIR/$name-host" > "$expected"
+        if ! cmp -s "$expected" "$output"; then
+            echo "FAILED: $name output differs from the host build"
+            exit 1
+        fi
+    fi
+
+    if [ "$COUNT_INSNS" = 1 ]; then
+        insns=$(sed -n 's/^insns: \([0-9]*\)$/\1/p' "$log" | tail -n 1)
+        [ -n "$insns" ] || insns="null"
+    fi
+
+    local text=$(text_size "$elf")
+    printf "  %-10s %10d bytes %14s insns\n" "$name" "$text" "$insns"
+    RESULTS+=("{\"name\": \"$name\", \"text_bytes\": $text, \"insns\": $insns}")
+}
+
+echo "Benchmarking generated code for $ARCH"
+for source in tests/kernels/*.c; do
+    bench "$source"
+done
+
+(
+    IFS=,
+    echo "{\"arch\": \"$ARCH\", \"benchmarks\": [${RESULTS[*]}]}"
+) | jq -S . > "$RESULT"
+echo "Results written to $RESULT"
+
+if [ "$MODE" = "update" ]; then
+    mkdir -p "$(dirname "$BASELINE")"
+    cp "$RESULT" "$BASELINE"
+    echo "Baseline updated: $BASELINE"
+    exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+    echo "No baseline at $BASELINE, run 'make update-bench-code' to record one"
+    exit 0
+fi
+
+echo "Comparison against $BASELINE (current / baseline)"
+jq -r -n --slurpfile base "$BASELINE" --slurpfile cur "$RESULT" '
+    def ratio(a; b): if a == null or b == null or b == 0 then "n/a"
+                     else ((a / b * 1000 | round) / 1000 | tostring) + "x" end;
+    $cur[0].benchmarks[] as $c
+    | ($base[0].benchmarks[] | select(.name == $c.name)) as $b
+    | "  \($c.name): text \(ratio($c.text_bytes; $b.text_bytes)),"
+      + " insns \(ratio($c.insns; $b.insns))"'
@@ -0,0 +1,317 @@
+#!/usr/bin/env bash
+
+# Compiler throughput benchmark.
+#
+# Generates synthetic C sources that stress different parts of the compiler,
+# compiles each of them with the stage 0 compiler and self-compiles src/main.c
+# with both the stage 0 and the stage 2 compiler. Wall-clock time, peak RSS and
+# output size of every run are written to out/bench/compile-<arch>.json. When
+# tests/bench/compile-<arch>.json exists, the results are compared against it.
+#
+# Environment variables:
+#   SCALE=n    Multiply the size of every synthetic input (default: 1)
+#   REPEAT=n   Runs per benchmark; the fastest one is kept (default: 3)
+
+set -u
+
+if [ "$#" -lt 1 ] || [ "$#" -gt 2 ]; then
+    echo "Usage: $0 <architecture> [update]"
+    exit 1
+fi
+
+readonly ARCH="$1"
+readonly MODE="${2:-}"
+readonly SCALE="${SCALE:-1}"
+readonly REPEAT="${REPEAT:-3}"
+
+readonly STAGE0="$PWD/out/shecc"
+readonly STAGE2="${TARGET_EXEC:-} $PWD/out/shecc-stage2.elf"
+readonly WORKDIR="$PWD/out/bench"
+readonly RESULT="$WORKDIR/compile-$ARCH.json"
+readonly BASELINE="tests/bench/compile-$ARCH.json"
+
+# GNU time reports the peak RSS; without it only time and size are recorded.
+TIME_CMD=""
+if [ -x /usr/bin/time ] && /usr/bin/time -f "%M" true &>/dev/null; then
+    TIME_CMD="/usr/bin/time"
+else
+    echo "Warning: GNU time not found, peak RSS is not recorded"
+fi
+
+mkdir -p "$WORKDIR"
+
+# Synthetic inputs
+
+# Thousands of small functions calling each other in a chain
+function gen_many_funcs() {
+    local n=$((2000 * SCALE))
+
+    echo "int f0(int a, int b)"
+    echo "{"
+    echo "    return a + b;"
+    echo "}"
+    for ((i = 1; i < n; i++)); do
+        echo "int f$i(int a, int b)"
+        echo "{"
+        echo "    int c = a * $((i % 7 + 1)) + b;"
+        echo "    if (c > $i)"
+        echo "        return f$((i - 1))(c - b, a);"
+        echo "    return c + $i;"
+        echo "}"
+    done
+    echo "int main()"
+    echo "{"
+    echo "    return f$((n - 1))(1, 2) & 255;"
+    echo "}"
+}
+
+# A single function with a very long straight-line and branchy body
+function gen_long_func() {
+    local n=$((4000 * SCALE))
+
+    echo "int work(int x, int y)"
+    echo "{"
+    for ((i = 0; i < 16; i++)); do
+        echo "    int v$i = x + $i * y;"
+    done
+    for ((i = 0; i < n; i++)); do
+        local d=$((i % 16)) s1=$(((i + 3) % 16)) s2=$(((i + 7) % 16))
+        echo "    v$d = v$s1 * $((i % 13 + 1)) + (v$s2 ^ $i);"
+        echo "    if (v$d > 100000)"
+        echo "        v$d = v$d % $((i % 11 + 2));"
+    done
+    echo "    return v0 + v15;"
+    echo "}"
+    echo "int main()"
+    echo "{"
+    echo "    return work(1, 2) & 255;"
+    echo "}"
+}
+
+# Functions made of deeply nested loops and conditionals
+function gen_deep_nesting() {
+    local n=$((20 * SCALE)) depth=200
+
+    for ((f = 0; f < n; f++)); do
+        echo "int nest$f(int n)"
+        echo "{"
+        echo "    int s = $f;"
+        for ((d = 0; d < depth; d++)); do
+            if ((d % 2)); then
+                echo "    if ((s + $d) & 1) {"
+            else
+                echo "    for (int i$d = 0; i$d < n; i$d++) {"
+            fi
+        done
+        echo "    s = s + n;"
+        for ((d = 0; d < depth; d++)); do
+            echo "    }"
+        done
+        echo "    return s;"
+        echo "}"
+    done
+    echo "int main()"
+    echo "{"
+    echo "    return nest0(1) & 255;"
+    echo "}"
+}
+
+# Functions dominated by a large switch statement
+function gen_huge_switch() {
+    local n=$((30 * SCALE)) cases=500
+
+    for ((f = 0; f < n; f++)); do
+        echo "int dispatch$f(int op, int x)"
+        echo "{"
+        echo "    switch (op) {"
+        for ((c = 0; c < cases; c++)); do
+            echo "    case $c:"
+            echo "        return x * $((c % 9 + 1)) + $c;"
+        done
+        echo "    default:"
+        echo "        return -1;"
+        echo "    }"
+        echo "}"
+    done
+    echo "int main()"
+    echo "{"
+    echo "    return dispatch0(3, 4) & 255;"
+    echo "}"
+}
+
+# A header full of macros that the source expands thousands of times. The
+# macro table grows as needed, so the number of object-like macros scales with
+# the input. Each statement expands a single function-like macro, parameters
+# are named differently from the arguments passed to them and member accesses
+# are kept out of macro arguments, as the preprocessor cannot handle any of
+# these yet.
+readonly MACROS=$((1000 * SCALE))
+
+function gen_macro_header() {
+    local n=$MACROS
+
+    echo "typedef struct {"
+    echo "    int n;"
+    echo "    int m;"
+    echo "} pair_t;"
+    for ((i = 0; i < n; i++)); do
+        echo "#define K_$i $i"
+    done
+    echo "#define MIX(x, y) ((x) ^ ((y) << 1))"
+    echo "#define ADD(x, y) ((x) + (y))"
+    echo "#define SCALE3(x) ((x) * 3)"
+    echo "#define MIN(x, y) ((x) > (y) ? (y) : (x))"
+}
+
+function gen_macro_heavy() {
+    local n=$((200 * SCALE)) uses=10
+
+    echo "#include \"macro-heavy.h\""
+    for ((f = 0; f < n; f++)); do
+        echo "int use$f(pair_t *p)"
+        echo "{"
+        echo "    int m = p->m;"
+        echo "    int s = p->n;"
+        for ((u = 0; u < uses; u++)); do
+            echo "    s = ADD(s, K_$(((f * uses + u) % MACROS)));"
+            echo "    s = SCALE3(s);"
+            echo "    s = MIX(s, m);"
+            echo "    s = MIN(s, K_$(((f * 7 + u) % MACROS)));"
+        done
+        echo "    return s;"
+        echo "}"
+    done
+    echo "int main()"
+    echo "{"
+    echo "    pair_t p;"
+    echo "    p.n = 1;"
+    echo "    p.m = 2;"
+    echo "    return use0(&p);"
+    echo "}"
+}
+
+# Large initialized arrays, both global and local
+function gen_big_arrays() {
+    local n=$((4 * SCALE)) len=4000
+
+    for ((a = 0; a < n; a++)); do
+        echo -n "int global$a[$len] = {"
+        for ((i = 0; i < len; i++)); do
+            echo -n "$(((i * 7 + a) % 1000)), "
+        done
+        echo "};"
+    done
+    for ((a = 0; a < n; a++)); do
+        echo "int local$a(int k)"
+        echo "{"
+        echo -n "    int table[$len] = {"
+        for ((i = 0; i < len; i++)); do
+            echo -n "$(((i * 11 + a) % 1000)), "
+        done
+        echo "};"
+        echo "    return table[k];"
+        echo "}"
+    done
+    echo "int main()"
+    echo "{"
+    echo "    return local0(5);"
+    echo "}"
+}
+
+# Measurement
+
+RESULTS=()
+
+# Run the compiler on a source file REPEAT times and record the fastest run.
+function bench() {
+    local name="$1"
+    local compiler="$2"
+    local cmd="$3"
+    local source="$4"
+    local output="$WORKDIR/$name-$compiler.elf"
+    local best_ms="" best_rss="null"
+
+    for ((r = 0; r < REPEAT; r++)); do
+        local start end ms rss="null"
+
+        start=$(date +%s%N)
+        if [ -n "$TIME_CMD" ]; then
+            $TIME_CMD -f "%M" -o "$WORKDIR/rss" $cmd -o "$output" "$source" \
+                >/dev/null 2>&1
+        else
+            $cmd -o "$output" "$source" >/dev/null 2>&1
+        fi
+        local status=$?
+        end=$(date +%s%N)
+
+        if [ $status -ne 0 ]; then
+            echo "FAILED: $name ($compiler) exited with $status"
+            exit 1
+        fi
+
+        ms=$(((end - start) / 1000000))
+        if [ -n "$TIME_CMD" ]; then
+            rss=$(tail -n 1 "$WORKDIR/rss")
+        fi
+        if [ -z "$best_ms" ] || [ "$ms" -lt "$best_ms" ]; then
+            best_ms=$ms
+            best_rss=$rss
+        fi
+    done
+
+    local size=$(stat -c %s "$output")
+    printf "  %-16s %-8s %8d ms %10s KiB %10d bytes\n" \
+        "$name" "$compiler" "$best_ms" "$best_rss" "$size"
+    RESULTS+=("{\"name\": \"$name\", \"compiler\": \"$compiler\", \"time_ms\": $best_ms, \"rss_kb\": $best_rss, \"output_bytes\": $size}")
+}
+
+echo "Generating synthetic inputs (SCALE=$SCALE)"
+gen_many_funcs > "$WORKDIR/many-funcs.c"
+gen_long_func > "$WORKDIR/long-func.c"
+gen_deep_nesting > "$WORKDIR/deep-nesting.c"
+gen_huge_switch > "$WORKDIR/huge-switch.c"
+gen_macro_header > "$WORKDIR/macro-heavy.h"
+gen_macro_heavy > "$WORKDIR/macro-heavy.c"
+gen_big_arrays > "$WORKDIR/big-arrays.c"
+
+echo "Benchmarking (best of $REPEAT runs)"
+for input in many-funcs long-func deep-nesting huge-switch macro-heavy \
+    big-arrays; do
+    bench "$input" "stage0" "$STAGE0" "$WORKDIR/$input.c"
+done
+bench "self-compile" "stage0" "$STAGE0" "src/main.c"
+bench "self-compile" "stage2" "$STAGE2" "src/main.c"
+
+(
+    IFS=,
+    echo "{\"arch\": \"$ARCH\", \"scale\": $SCALE, \"benchmarks\": [${RESULTS[*]}]}"
+) | jq -S . > "$RESULT"
+echo "Results written to $RESULT"
+
+if [ "$MODE" = "update" ]; then
+    mkdir -p "$(dirname "$BASELINE")"
+    cp "$RESULT" "$BASELINE"
+    echo "Baseline updated: $BASELINE"
+    exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+    echo "No baseline at $BASELINE, run 'make update-bench-compile' to record one"
+    exit 0
+fi
+
+if [ "$(jq .scale "$BASELINE")" != "$SCALE" ]; then
+    echo "Baseline was recorded with SCALE=$(jq .scale "$BASELINE"), not comparing"
+    exit 0
+fi
+
+echo "Comparison against $BASELINE (current / baseline)"
+jq -r -n --slurpfile base "$BASELINE" --slurpfile cur "$RESULT" '
+    def ratio(a; b): if a == null or b == null or b == 0 then "n/a"
+                     else ((a / b * 100 | round) / 100 | tostring) + "x" end;
+    $cur[0].benchmarks[] as $c
+    | ($base[0].benchmarks[]
+       | select(.name == $c.name and .compiler == $c.compiler)) as $b
+    | "  \($c.name) (\($c.compiler)): time \(ratio($c.time_ms; $b.time_ms)),"
+      + " rss \(ratio($c.rss_kb; $b.rss_kb)),"
+      + " size \(ratio($c.output_bytes; $b.output_bytes))"'
@@ -9,6 +9,7 @@ readonly VERBOSE_MODE="${VERBOSE:-0}"
 readonly SHOW_SUMMARY="${SHOW_SUMMARY:-1}"
 readonly SHOW_PROGRESS="${SHOW_PROGRESS:-1}"
 readonly COLOR_OUTPUT="${COLOR_OUTPUT:-1}"
+readonly SHECC_FLAGS="${SHECC_FLAGS:-}"
 
 # Test Counters
 TOTAL_TESTS=0
@@ -36,18 +37,19 @@ if [ "$#" != 1 ]; then
     echo "  SHOW_SUMMARY=1    Show category summaries (default)"
     echo "  SHOW_PROGRESS=1   Show progress dots (default)"
     echo "  COLOR_OUTPUT=1    Enable colored output (default)"
+    echo "  SHECC_FLAGS=...   Extra options passed to the compiler"
     exit 1
 fi
 
 case "$1" in
     "0")
-        readonly SHECC="$PWD/out/shecc"
+        readonly SHECC="$PWD/out/shecc $SHECC_FLAGS"
         readonly STAGE="Stage 0 (Host Compiler)" ;;
     "1")
-        readonly SHECC="${TARGET_EXEC:-} $PWD/out/shecc-stage1.elf"
+        readonly SHECC="${TARGET_EXEC:-} $PWD/out/shecc-stage1.elf $SHECC_FLAGS"
         readonly STAGE="Stage 1 (Cross-compiled)" ;;
     "2")
-        readonly SHECC="${TARGET_EXEC:-} $PWD/out/shecc-stage2.elf"
+        readonly SHECC="${TARGET_EXEC:-} $PWD/out/shecc-stage2.elf $SHECC_FLAGS"
         readonly STAGE="Stage 2 (Self-hosted)" ;;
     *)
         echo "$1 is not a valid stage"
@@ -351,6 +353,126 @@ EOF
     fi
 }
 
+# try_stack_limit - test shecc with a small native stack
+# Usage:
+# - try_stack_limit expected_exit_code stack_kib < input_code
+# compile "input_code" with the stack of the compiler limited to "stack_kib"
+# KiB and check the exit code of the program, so that a pass recursing once
+# per basic block crashes the compiler instead of passing unnoticed.
+function try_stack_limit() {
+    local expected="$1"
+    local stack_kib="$2"
+    local input="$(cat)"
+
+    local tmp_in="$(mktemp --suffix .c)"
+    local tmp_exe="$(mktemp)"
+    echo "$input" > "$tmp_in"
+    (
+        ulimit -s "$stack_kib"
+        $SHECC -o "$tmp_exe" "$tmp_in"
+    ) >/dev/null 2>&1
+    chmod +x $tmp_exe
+
+    local output=''
+    output=$(${TARGET_EXEC:-} "$tmp_exe")
+    local actual="$?"
+
+    ((TOTAL_TESTS++))
+    ((CATEGORY_TESTS["$CURRENT_CATEGORY"]++))
+
+    if [ "$actual" != "$expected" ]; then
+        report_test_failure "STACK LIMIT TEST" "$tmp_in" "$tmp_exe" "$expected" "$actual" "$output"
+    else
+        ((PASSED_TESTS++))
+        ((CATEGORY_PASSED["$CURRENT_CATEGORY"]++))
+        show_progress
+        if [ "$VERBOSE_MODE" = "1" ]; then
+            echo "Stack limit test: $stack_kib KiB (exit code => $actual)"
+        fi
+    fi
+}
+
+# try_report - test the --time-report and --mem-report options
+# Usage:
+# - try_report expected_exit_code report_options... < input_code
+# compile "input_code" with the given report options and check that the
+# program still runs, that every requested table is printed and, for
+# --time-report=file, that the file holds well-formed JSON with one entry per
+# phase of the printed table.
+function try_report() {
+    local expected="$1"
+    shift
+    local input="$(cat)"
+
+    local tmp_in="$(mktemp --suffix .c)"
+    local tmp_exe="$(mktemp)"
+    local tmp_json=""
+    local options=""
+    echo "$input" > "$tmp_in"
+
+    for opt in "$@"; do
+        if [ "$opt" = "--time-report=file" ]; then
+            tmp_json="$(mktemp --suffix .json)"
+            rm -f "$tmp_json"
+            opt="--time-report=$tmp_json"
+        fi
+        options="$options $opt"
+    done
+
+    local report=$($SHECC $options -o "$tmp_exe" "$tmp_in" 2>/dev/null)
+    chmod +x $tmp_exe
+
+    local output=''
+    output=$(${TARGET_EXEC:-} "$tmp_exe")
+    local actual="$?"
+
+    ((TOTAL_TESTS++))
+    ((CATEGORY_TESTS["$CURRENT_CATEGORY"]++))
+
+    local error=""
+    local rows=$(echo "$report" | awk '/^phase +wall/ { t = 1; next }
+                                       /^total / { t = 0 } t' | wc -l)
+    case "$options" in
+        *--time-report*)
+            if ! echo "$report" | grep -q '^phase *wall(us) *cpu(us)' ||
+               ! echo "$report" | grep -q '^total ' || [ "$rows" -eq 0 ]; then
+                error="phase time table missing"
+            fi ;;
+    esac
+    case "$options" in
+        *--mem-report*)
+            if ! echo "$report" | grep -q '^phase *arena *reserved *used *peak' ||
+               ! echo "$report" | grep -q '^sum of arena peaks: [0-9]* bytes'; then
+                error="arena table missing"
+            fi ;;
+    esac
+    if [ -n "$tmp_json" ]; then
+        if [ ! -s "$tmp_json" ]; then
+            error="JSON report $tmp_json not written"
+        elif command -v python3 > /dev/null &&
+             ! python3 -m json.tool "$tmp_json" > /dev/null 2>&1; then
+            error="JSON report $tmp_json does not parse"
+        elif [ "$(grep -c '"name": "[a-z-]*"' "$tmp_json")" != "$rows" ] ||
+             ! grep -q '"total": {"wall_us": [0-9]*, "cpu_us": [0-9]*}' "$tmp_json"; then
+            error="JSON report $tmp_json does not match the phase table"
+        fi
+    fi
+
+    if [ "$actual" != "$expected" ]; then
+        report_test_failure "REPORT TEST" "$tmp_in" "$tmp_exe" "$expected" "$actual" "$output"
+    elif [ -n "$error" ]; then
+        echo "$report"
+        report_test_failure "REPORT TEST" "$tmp_in" "$tmp_exe" "$expected" "$actual" "$error"
+    else
+        ((PASSED_TESTS++))
+        ((CATEGORY_PASSED["$CURRENT_CATEGORY"]++))
+        show_progress
+        if [ "$VERBOSE_MODE" = "1" ]; then
+            echo "$report"
+        fi
+    fi
+}
+
 # Test Execution Begins
 
 echo "[[[ shecc Test Suite ]]]"
@@ -831,6 +953,75 @@ items 27 "int a; a = 15; int b; b = 2; if(a - 15) b = 10; else if (b) return a +
 items 8 "if (1) return 010; else return 11;"
 items 10 "int a; a = 012 - 10; int b; b = 0100 - 64; if (a) b = 10; else if (0) return a; else if (a) return b; else return 10;"
 
+# branches on propagated constants, including ones inside a loop
+try_ 47 << EOF
+int main() {
+    int debug = 0, level = 3, s = 0, x = 1;
+    for (int i = 0; i < 10; i++) {
+        if (debug)
+            s = s + 100;
+        if (level > 2)
+            x = 2;
+        s = s + i;
+    }
+    if (debug + 1 == 1)
+        s = s + x;
+    return s;
+}
+EOF
+
+# loops left only by exit() never reach the function exit
+try_ 3 << EOF
+int main() { int i = 0; while (1) { i++; if (i == 3) exit(i); } }
+EOF
+try_ 3 << EOF
+int main() { int i = 0; L: i++; if (i == 3) exit(i); goto L; }
+EOF
+try_ 3 << EOF
+int main() { int i = 0; for (;;) { i++; if (i == 3) exit(i); } }
+EOF
+
+# constants fold with the wraparound of the target
+try_ 15 << EOF
+int main() {
+    int a = 2147483647, b = -5, m = 65536;
+    int s = a + 1;
+    int p = m * m + m * 3;
+    int n = -(-2147483647 - 1);
+    int q = b << 3;
+    return (s == -2147483647 - 1) + (p == 196608) * 2 + (n == s) * 4 +
+           (q == -40) * 8;
+}
+EOF
+
+# INT_MIN / -1 is not folded, the division never runs here
+try_ 7 << EOF
+int main(int argc, char **argv) {
+    int a = -2147483647 - 1, b = -1;
+    if (argc > 5)
+        return a / b;
+    if (argc > 6)
+        return a % b;
+    return 7;
+}
+EOF
+
+# values reused across blocks, in commuted form and from sibling branches
+try_ 116 << EOF
+int f(int p, int w, int c)
+{
+    w -= 16 - p;
+    if (c)
+        w = w + (16 - p) * 2;
+    else
+        w = w + p * 3;
+    return w + 3 * p + (16 - p);
+}
+int main() {
+    return f(4, 20, 1) + f(5, 30, 0);
+}
+EOF
+
 # Category: Compound Statements
 begin_category "Compound Statements" "Testing block scoping and compound statements"
 
@@ -859,6 +1050,121 @@ items 0 "int x; for(x = 10; x > 0; x--); return x;"
 items 30 "int i; int acc; i = 0; acc = 0; do { i = i + 1; if (i - 1 < 5) continue; acc = acc + i; if (i == 9) break; } while (i < 10); return acc;"
 items 26 "int acc; acc = 0; int i; for (i = 0; i < 100; i++) { if (i < 5) continue; if (i == 9) break; acc = acc + i; } return acc;"
 
+# nested loops, a loop built with goto and one with two entries
+try_ 26 << EOF
+int main() {
+    int s = 0, i, j, k = 0;
+    for (i = 0; i < 4; i++)
+        for (j = 0; j < i; j++)
+            while (k < i * j)
+                k++;
+    i = 3;
+    goto mid;
+top:
+    s = s + i;
+mid:
+    if (--i > 0)
+        goto top;
+    if (k > 5)
+        goto b;
+a:
+    s = s + 1;
+b:
+    s = s + 2;
+    if (s < 20)
+        goto a;
+    return s + k;
+}
+EOF
+
+# loop-invariant code, including a division that must stay in a zero-trip loop
+try_ 32 << EOF
+int main() {
+    int n = 5, d = 0, s = 0, i, j;
+    int a[8];
+    for (i = 0; i < d; i++)
+        s = s + n / d;
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 8; j++)
+            a[j] = i * n + j * 3;
+        if (d)
+            s = s + n % d;
+        s = s + a[i + 2] - n * 2;
+    }
+    return s;
+}
+EOF
+
+# values kept in registers across blocks, calls and pointer writes
+try_ 200 << EOF
+int cnt[2];
+int twice(int x) { return x + x; }
+int sum(int n, int k) {
+    int a = 1, b = 2, c = 3, d = 4, e = 5, i;
+    int *p = cnt;
+    for (i = 0; i < n; i++) {
+        a = a + k;
+        b = b + a;
+        if (i & 1)
+            c = c ^ b;
+        else
+            d = d + c;
+        e = e + (i < 3 ? a : d);
+        p[1] = p[1] + i;
+    }
+    return a + b + c + d + e + cnt[1] + twice(k);
+}
+int main() {
+    return sum(6, 3) & 255;
+}
+EOF
+
+# phis swapping values and conditional back edges out of SSA
+try_ 8 << EOF
+int rot(int n)
+{
+    int a = 1, b = 2, c = 3, t;
+    do {
+        t = a;
+        a = b;
+        b = c;
+        c = t;
+        if (a > 2)
+            continue;
+        c = c + a;
+    } while (--n);
+    return a * 100 + b * 10 + c;
+}
+int main()
+{
+    int x = 5, y = 8, i;
+    for (i = 0; i < 7; i++) {
+        int t = x;
+        x = y;
+        y = t;
+    }
+    return (rot(4) + x * 3 + y) & 255;
+}
+EOF
+
+# values carried around a loop left only by exit()
+try_ 254 << EOF
+int main()
+{
+    int a = 1, b = 0, n = 0;
+    for (;;) {
+        if (n == 10)
+            exit((a + b * 3) & 255);
+        int t = a + b;
+        b = a;
+        a = t;
+        n++;
+        if (a > 1000)
+            exit(1);
+    }
+}
+EOF
+
 # Category: Comments
 begin_category "Comments" "Testing C-style and C++-style comment parsing"
 
@@ -2559,6 +2865,24 @@ int main() {
 }
 EOF
 
+# Source lines are not limited in length
+long_sum=$(printf ' + %d' {1..300})
+try_ 0 << EOF
+int main() {
+    return (0$long_sum) - 45150;
+}
+EOF
+
+# A local is not limited in how many times it may be redefined
+many_defs=$(printf '    x = x + %d;\n' {1..200})
+try_ 132 << EOF
+int main() {
+    int x = 0;
+$many_defs
+    return x & 255;
+}
+EOF
+
 begin_category "Goto statements" "Testing goto and label statements"
 
 # label undeclaration
@@ -2710,6 +3034,20 @@ int main()
 }
 EOF
 
+# macro body is recorded once and replayed on every expansion
+try_ 18 << EOF
+#define SQUARE(a) ((a) * (a)) /* comment after the body */
+#define TWICE(a) ((a) + (a)) // comment after the body
+int main()
+{
+    int x = 3, y;
+    x = SQUARE(x + 1);
+    y = SQUARE(x - 13);
+    x = TWICE(x);
+    return TWICE(y) + x - 32;
+}
+EOF
+
 # function-like variadic macro
 try_ 2 << EOF
 #define M(m, n, ...)     \
@@ -3610,13 +3948,12 @@ EOF
 
 # test the return value when calling fputc().
 #
-# Since the FILE data type is defined as an int in
-# the built-in C library, and most of the functions
-# such as fputc(), fgetc(), fclose() and fgets() directly
-# treat the "stream" parameter (of type FILE *) as a file
-# descriptor for performing input/output operations, the
-# following test cases define "stdout" as 1, which is the
-# file descriptor for the standard output.
+# The built-in C library treats any FILE pointer that was
+# not returned by fopen() as a plain file descriptor, and
+# functions such as fputc(), fgetc(), fclose() and fgets()
+# access it without buffering. Thus, the following test
+# cases define "stdout" as 1, which is the file descriptor
+# for the standard output.
 try_output 0 "awritten = a" << EOF
 #define stdout 1
 int main()
@@ -3637,6 +3974,88 @@ int main()
 }
 EOF
 
+# Streams returned by fopen() are buffered. Round-trip data through a
+# temporary file with fputs(), fputc(), fwrite(), fgets(), fread() and
+# fgetc(), and check that reopening for writing truncates the file.
+tmp_file="$(mktemp)"
+try_output 2 "hello world
+3 abc -1" << EOF
+int main()
+{
+    char buf[32];
+    FILE *f = fopen("$tmp_file", "wb");
+    fputs("hello", f);
+    fputc(' ', f);
+    fwrite("world\nabc", 1, 9, f);
+    if (fclose(f))
+        return 1;
+
+    f = fopen("$tmp_file", "rb");
+    fgets(buf, 32, f);
+    printf("%s", buf);
+    int n = fread(buf, 1, 32, f);
+    buf[n] = 0;
+    printf("%d %s %d\n", n, buf, fgetc(f));
+    fclose(f);
+
+    f = fopen("$tmp_file", "wb");
+    fputs("xy", f);
+    fclose(f);
+    f = fopen("$tmp_file", "rb");
+    n = fread(buf, 1, 32, f);
+    fclose(f);
+    return n;
+}
+EOF
+
+# Output larger than the stream buffer, written byte by byte and in blocks
+try_output 0 "15000 15000" << EOF
+int main()
+{
+    char block[5000];
+    FILE *f = fopen("$tmp_file", "wb");
+    for (int i = 0; i < 10000; i++)
+        fputc('a' + i % 26, f);
+    for (int i = 0; i < 5000; i++)
+        block[i] = 'a' + (10000 + i) % 26;
+    fwrite(block, 1, 5000, f);
+    fclose(f);
+
+    int count = 0, matched = 0;
+    f = fopen("$tmp_file", "rb");
+    for (int c = fgetc(f); c != -1; c = fgetc(f)) {
+        if (c == 'a' + count % 26)
+            matched++;
+        count++;
+    }
+    fclose(f);
+    printf("%d %d", count, matched);
+    return 0;
+}
+EOF
+rm -f "$tmp_file"
+
+# Buffered streams are flushed both when main returns and on exit()
+try_output 0 "ab" << EOF
+int main()
+{
+    FILE *f = fopen("/dev/stdout", "w");
+    fputs("b", f);
+    printf("a");
+    return 0;
+}
+EOF
+
+try_output 3 "ab" << EOF
+int main()
+{
+    FILE *f = fopen("/dev/stdout", "w");
+    fputs("b", f);
+    printf("a");
+    exit(3);
+}
+EOF
+
 # tests integer type conversion
 # excerpted and modified from issue #166
 try_output 0 "a = -127, b = -78, c = -93, d = -44" << EOF
@@ -5807,6 +6226,120 @@ int main()
 }
 EOF
 
+begin_category "Compiler Limits" "Testing tables that grow past their former capacities"
+
+# Tables that used to have fixed capacities grow as needed. The program below
+# declares 300 struct types, jumps across 300 labels, dispatches over 300
+# cases, nests 200 loops and evaluates a 40-level expression. The join points
+# after the labels and the switch have 300 predecessors each.
+function gen_limits_program() {
+    for ((i = 0; i < 300; i++)); do
+        echo "typedef struct { int a; int b; } t$i;"
+    done
+
+    echo "int labels(int n)"
+    echo "{"
+    echo "    int s = 0;"
+    for ((i = 0; i < 300; i++)); do
+        echo "l$i:"
+        echo "    s += $i;"
+        echo "    if (s > n)"
+        echo "        goto done;"
+        echo "    goto l$(((i + 1) % 300));"
+    done
+    echo "done:"
+    echo "    return s;"
+    echo "}"
+
+    echo "int dispatch(int x)"
+    echo "{"
+    echo "    int r = 0;"
+    echo "    switch (x) {"
+    for ((i = 0; i < 300; i++)); do
+        echo "    case $i:"
+        echo "        r = $((i * 3 % 101));"
+        echo "        break;"
+    done
+    echo "    }"
+    echo "    return r;"
+    echo "}"
+
+    echo "int nest(int n)"
+    echo "{"
+    echo "    int s = 0;"
+    for ((d = 0; d < 200; d++)); do
+        echo "    for (int i$d = 0; i$d < 1 && n > $d; i$d++) {"
+    done
+    echo "    s++;"
+    for ((d = 0; d < 200; d++)); do
+        echo "    }"
+    done
+    echo "    return s;"
+    echo "}"
+
+    local e="n"
+    for ((i = 1; i <= 40; i++)); do
+        e="($i + $e * 2)"
+    done
+    echo "int expr(int n)"
+    echo "{"
+    echo "    return $e;"
+    echo "}"
+
+    echo "int main()"
+    echo "{"
+    echo "    t299 t;"
+    echo "    t.a = labels(1000);"
+    echo "    t.b = dispatch(250);"
+    echo "    return (t.a + t.b + nest(300) + expr(1)) & 255;"
+    echo "}"
+}
+
+try_ 13 <<< "$(gen_limits_program)"
+
+# The dominator tree of a chain of ifs is as deep as the chain is long, and
+# renaming, value numbering and the tree numbering all walk it. They keep
+# their own stack, so 1 MiB of native stack is enough.
+function gen_sequential_ifs() {
+    echo "int main(int argc, char **argv)"
+    echo "{"
+    echo "    int s = argc;"
+    for ((i = 0; i < 5000; i++)); do
+        echo "    if (s > $i)"
+        echo "        s = s + 1;"
+    done
+    echo "    return s & 255;"
+    echo "}"
+}
+
+try_stack_limit 137 1024 <<< "$(gen_sequential_ifs)"
+
+# Compiler reports: the statistics options must not change the generated
+# code, and the stage 2 compiler has to print and write the same reports as
+# the stage 0 one.
+begin_category "Compiler Reports" "Testing --time-report and --mem-report"
+
+report_program='
+int fib(int n)
+{
+    if (n < 2)
+        return n;
+    return fib(n - 1) + fib(n - 2);
+}
+
+int main()
+{
+    int s = 0;
+    for (int i = 0; i < 10; i++)
+        s += fib(i);
+    return s;
+}'
+
+try_report 88 --time-report <<< "$report_program"
+try_report 88 --time-report=file <<< "$report_program"
+try_report 88 --mem-report <<< "$report_program"
+try_report 88 --time-report=file --mem-report <<< "$report_program"
+
 # Test Results Summary
 
 echo ""
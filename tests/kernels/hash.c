@@ -0,0 +1,76 @@
+/* String hashing into an open-addressing table: byte loads, shifts, xors */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORDS 8192
+#define TABLE_SIZE 16384
+#define WORD_LEN 12
+
+int hash_djb2(char *s)
+{
+    int h = 5381;
+
+    while (s[0]) {
+        h = ((h << 5) + h + s[0]) & 0x7ffffff;
+        s++;
+    }
+    return h;
+}
+
+int hash_fnv(char *s)
+{
+    int h = 0x1c9dc5;
+
+    for (int i = 0; s[i]; i++) {
+        h = h ^ s[i];
+        h = (h * 403) & 0xfffffff;
+    }
+    return h;
+}
+
+/* Returns the number of probes needed to insert or find the word */
+int insert(char **table, char *word)
+{
+    int slot = hash_djb2(word) & (TABLE_SIZE - 1);
+    int step = (hash_fnv(word) & 15) | 1;
+    int probes = 1;
+
+    while (table[slot]) {
+        if (!strcmp(table[slot], word))
+            return probes;
+        slot = (slot + step) & (TABLE_SIZE - 1);
+        probes++;
+    }
+    table[slot] = word;
+    return probes;
+}
+
+int main()
+{
+    char **table = calloc(TABLE_SIZE, sizeof(char *));
+    char *words = malloc(WORDS * WORD_LEN);
+    int seed = 7, probes = 0, checksum = 0;
+
+    for (int i = 0; i < WORDS; i++) {
+        char *word = words + i * WORD_LEN;
+        int len = 4 + i % (WORD_LEN - 5);
+
+        for (int j = 0; j < len; j++) {
+            seed = (seed * 75 + 74) % 65537;
+            word[j] = 'a' + seed % 26;
+        }
+        word[len] = 0;
+    }
+    for (int r = 0; r < 2; r++) {
+        for (int i = 0; i < WORDS; i++) {
+            char *word = words + i * WORD_LEN;
+            probes += insert(table, word);
+            checksum = (checksum * 31 + hash_fnv(word)) & 0xffffff;
+        }
+    }
+    printf("probes: %d, checksum: %d\n", probes, checksum);
+    free(words);
+    free(table);
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* Linked-list walks: pointer chasing and struct field accesses */
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NODES 4000
+#define WALKS 50
+
+typedef struct node {
+    int key;
+    int value;
+    struct node *next;
+} node_t;
+
+node_t *build(int count)
+{
+    node_t *head = NULL;
+    int seed = 11;
+
+    for (int i = 0; i < count; i++) {
+        node_t *n = malloc(sizeof(node_t));
+        seed = (seed * 75 + 74) % 65537;
+        n->key = seed;
+        n->value = i;
+        n->next = head;
+        head = n;
+    }
+    return head;
+}
+
+node_t *reverse(node_t *head)
+{
+    node_t *prev = NULL;
+
+    while (head) {
+        node_t *next = head->next;
+        head->next = prev;
+        prev = head;
+        head = next;
+    }
+    return prev;
+}
+
+int walk(node_t *head, int threshold)
+{
+    int sum = 0;
+
+    for (node_t *n = head; n; n = n->next) {
+        if (n->key > threshold)
+            sum += n->value;
+        else
+            n->value = n->value + 1;
+    }
+    return sum & 0xffffff;
+}
+
+int main()
+{
+    node_t *head = build(NODES);
+    int checksum = 0;
+
+    for (int w = 0; w < WALKS; w++) {
+        checksum = (checksum + walk(head, w * 1000)) & 0xffffff;
+        head = reverse(head);
+    }
+    while (head) {
+        node_t *next = head->next;
+        free(head);
+        head = next;
+    }
+    printf("checksum: %d\n", checksum);
+    return 0;
+}
@@ -0,0 +1,45 @@
+/* Integer matrix multiplication: nested loops with array index arithmetic */
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N 64
+
+void fill(int *m, int seed)
+{
+    for (int i = 0; i < N * N; i++) {
+        seed = (seed * 75 + 74) % 65537;
+        m[i] = seed % 100 - 50;
+    }
+}
+
+void multiply(int *c, int *a, int *b)
+{
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            int sum = 0;
+            for (int k = 0; k < N; k++)
+                sum += a[i * N + k] * b[k * N + j];
+            c[i * N + j] = sum;
+        }
+    }
+}
+
+int main()
+{
+    int *a = malloc(N * N * sizeof(int));
+    int *b = malloc(N * N * sizeof(int));
+    int *c = malloc(N * N * sizeof(int));
+    int checksum = 0;
+
+    fill(a, 1);
+    fill(b, 2);
+    multiply(c, a, b);
+    multiply(a, c, b);
+    for (int i = 0; i < N * N; i++)
+        checksum = (checksum * 31 + a[i]) & 0xffffff;
+    printf("checksum: %d\n", checksum);
+    free(a);
+    free(b);
+    free(c);
+    return 0;
+}
@@ -0,0 +1,29 @@
+/* Formatted output: variadic calls and number-to-string conversion */
+#include <stdio.h>
+
+#define LINES 2000
+
+char *name(int i)
+{
+    switch (i & 3) {
+    case 0:
+        return "alpha";
+    case 1:
+        return "beta";
+    case 2:
+        return "gamma";
+    }
+    return "delta";
+}
+
+int main()
+{
+    int seed = 5;
+
+    for (int i = 0; i < LINES; i++) {
+        seed = (seed * 75 + 74) % 65537;
+        printf("%5d %s %x %o %c %d\n", i, name(i), seed, seed & 511,
+               'a' + i % 26, seed - 30000);
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+/* Sieve of Eratosthenes: tight loops over a byte array */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIMIT 200000
+#define ROUNDS 3
+
+int sieve(char *composite, int limit)
+{
+    int count = 0;
+
+    memset(composite, 0, limit + 1);
+    for (int i = 2; i <= limit; i++) {
+        if (composite[i])
+            continue;
+        count++;
+        for (int j = i + i; j <= limit; j += i)
+            composite[j] = 1;
+    }
+    return count;
+}
+
+int main()
+{
+    char *composite = malloc(LIMIT + 1);
+    int total = 0;
+
+    for (int r = 0; r < ROUNDS; r++)
+        total += sieve(composite, LIMIT - r * 1000);
+    printf("primes: %d\n", total);
+    free(composite);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/* Quicksort and insertion sort: compares, swaps and recursion */
+#include <stdio.h>
+#include <stdlib.h>
+
+#define COUNT 20000
+#define CUTOFF 16
+
+void insertion_sort(int *a, int lo, int hi)
+{
+    for (int i = lo + 1; i <= hi; i++) {
+        int v = a[i];
+        int j = i - 1;
+        while (j >= lo && a[j] > v) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = v;
+    }
+}
+
+void quick_sort(int *a, int lo, int hi)
+{
+    while (hi - lo > CUTOFF) {
+        int pivot = a[lo + (hi - lo) / 2];
+        int i = lo, j = hi;
+
+        while (i <= j) {
+            while (a[i] < pivot)
+                i++;
+            while (a[j] > pivot)
+                j--;
+            if (i <= j) {
+                int t = a[i];
+                a[i] = a[j];
+                a[j] = t;
+                i++;
+                j--;
+            }
+        }
+        /* Recurse into the smaller half, loop on the larger one */
+        if (j - lo < hi - i) {
+            quick_sort(a, lo, j);
+            lo = i;
+        } else {
+            quick_sort(a, i, hi);
+            hi = j;
+        }
+    }
+    insertion_sort(a, lo, hi);
+}
+
+int main()
+{
+    int *a = malloc(COUNT * sizeof(int));
+    int seed = 3, checksum = 0;
+
+    for (int i = 0; i < COUNT; i++) {
+        seed = (seed * 75 + 74) % 65537;
+        a[i] = seed;
+    }
+    quick_sort(a, 0, COUNT - 1);
+    for (int i = 1; i < COUNT; i++) {
+        if (a[i - 1] > a[i]) {
+            printf("not sorted at %d\n", i);
+            return 1;
+        }
+    }
+    for (int i = 0; i < COUNT; i += 7)
+        checksum = (checksum * 31 + a[i]) & 0xffffff;
+    printf("checksum: %d\n", checksum);
+    free(a);
+    return 0;
+}
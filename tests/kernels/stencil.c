@@ -0,0 +1,33 @@
+/* Five-point stencil over a grid: nested loops with loop-invariant scaling */
+#include <stdio.h>
+
+#define N 64
+#define ITERATIONS 10
+
+int g[N][N];
+int h[N][N];
+
+int main()
+{
+    int w = N, scale = 3, off = 5;
+    int checksum = 0;
+
+    for (int i = 0; i < w; i++)
+        for (int j = 0; j < w; j++)
+            g[i][j] = (i * 7 + j * 3) & 15;
+    for (int it = 0; it < ITERATIONS; it++) {
+        for (int i = 1; i < w - 1; i++)
+            for (int j = 1; j < w - 1; j++)
+                h[i][j] = (g[i - 1][j] + g[i + 1][j] + g[i][j - 1] +
+                           g[i][j + 1]) *
+                          scale / (scale + off);
+        for (int i = 1; i < w - 1; i++)
+            for (int j = 1; j < w - 1; j++)
+                g[i][j] = h[i][j] + (w - 1) - (off << 1);
+    }
+    for (int i = 0; i < w; i++)
+        for (int j = 0; j < w; j++)
+            checksum += g[i][j];
+    printf("checksum: %d\n", checksum);
+    return 0;
+}
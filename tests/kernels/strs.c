@@ -0,0 +1,27 @@
+/* Seeded string hashing: an inner loop over bytes with a loop-invariant term */
+#include <stdio.h>
+
+#define LEN 64
+#define ROUNDS 3000
+
+int hash(char *s, int len, int seed)
+{
+    int h = seed;
+    for (int i = 0; i < len; i++)
+        h = (h * 31 + s[i] + (seed >> 3)) & 0xffffff;
+    return h;
+}
+
+int main()
+{
+    char buf[LEN];
+    int checksum = 0;
+
+    for (int i = 0; i < LEN - 1; i++)
+        buf[i] = 'a' + i % 26;
+    buf[LEN - 1] = 0;
+    for (int r = 0; r < ROUNDS; r++)
+        checksum ^= hash(buf, LEN - 1 - (r & 7), r);
+    printf("checksum: %d\n", checksum);
+    return 0;
+}